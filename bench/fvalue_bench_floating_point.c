@@ -0,0 +1,238 @@
+/*
+ * Floating-point value benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_functions.h"
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_ITERATIONS	100000
+
+typedef struct fvalue_bench_value_definition fvalue_bench_value_definition_t;
+
+struct fvalue_bench_value_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The value type
+	 */
+	int type;
+
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The encoding
+	 */
+	int encoding;
+
+	/* The format flags
+	 */
+	uint32_t format_flags;
+};
+
+uint8_t fvalue_bench_floating_point_data_32bit[ 4 ] = {
+	0xd0, 0x0f, 0x49, 0x40 };
+
+uint8_t fvalue_bench_floating_point_data_64bit[ 8 ] = {
+	0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x09, 0x40 };
+
+uint8_t fvalue_bench_floating_point_data_integral[ 8 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f };
+
+uint8_t fvalue_bench_floating_point_data_small[ 8 ] = {
+	0x3c, 0x11, 0xe3, 0x8f, 0x3b, 0x9e, 0x3a, 0x01 };
+
+fvalue_bench_value_definition_t fvalue_bench_value_definitions[ 8 ] = {
+	{ "float32_decimal", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT, fvalue_bench_floating_point_data_32bit, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL },
+	{ "float64_decimal", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_64bit, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL },
+	{ "float64_decimal_integral", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_integral, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL },
+	{ "float64_decimal_small", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_small, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL },
+	{ "float64_hexadecimal", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_64bit, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL },
+	{ "float32_shortest", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT, fvalue_bench_floating_point_data_32bit, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST },
+	{ "float64_shortest", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_64bit, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST },
+	{ "float64_shortest_small", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT, fvalue_bench_floating_point_data_small, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST } };
+
+/* Benchmarks copying a value to strings
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_floating_point_copy_to_strings(
+     fvalue_bench_value_definition_t *value_definition,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_floating_point_copy_to_strings";
+
+	if( libfvalue_value_type_initialize(
+	     &value,
+	     value_definition->type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_format_flags(
+	     value,
+	     value_definition->format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     value,
+	     value_definition->data,
+	     value_definition->data_size,
+	     value_definition->encoding,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "floating_point/copy_to_string/%s",
+	 value_definition->name );
+
+	if( fvalue_bench_value_copy_to_strings(
+	     name,
+	     value,
+	     FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int definition_index     = 0;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	for( definition_index = 0;
+	     definition_index < 8;
+	     definition_index++ )
+	{
+		if( fvalue_bench_floating_point_copy_to_strings(
+		     &( fvalue_bench_value_definitions[ definition_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
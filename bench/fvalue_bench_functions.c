@@ -0,0 +1,350 @@
+/*
+ * Functions for benchmarking
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fvalue_bench_functions.h"
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+
+/* The size of the string buffers, large enough for the rendered binary data
+ */
+#define FVALUE_BENCH_MAXIMUM_STRING_SIZE	16384
+
+/* Benchmarks copying a value to an UTF-8 string
+ * The name is suffixed with "/utf8"
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_copy_to_utf8_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	char result_name[ 256 ];
+	uint8_t utf8_string[ FVALUE_BENCH_MAXIMUM_STRING_SIZE ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	static char *function    = "fvalue_bench_value_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+	uint64_t iteration       = 0;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		utf8_string_index = 0;
+
+		if( libfvalue_value_copy_to_utf8_string_with_index(
+		     value,
+		     0,
+		     utf8_string,
+		     FVALUE_BENCH_MAXIMUM_STRING_SIZE,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 result_name,
+	 256,
+	 "%s/utf8",
+	 name );
+
+	fvalue_bench_print_result(
+	 result_name,
+	 number_of_iterations,
+	 &start_counters,
+	 &end_counters );
+
+	return( 1 );
+}
+
+/* Benchmarks copying a value to an UTF-16 string
+ * The name is suffixed with "/utf16"
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_copy_to_utf16_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	char result_name[ 256 ];
+	uint16_t utf16_string[ FVALUE_BENCH_MAXIMUM_STRING_SIZE ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	static char *function     = "fvalue_bench_value_copy_to_utf16_string";
+	size_t utf16_string_index = 0;
+	uint64_t iteration        = 0;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		utf16_string_index = 0;
+
+		if( libfvalue_value_copy_to_utf16_string_with_index(
+		     value,
+		     0,
+		     utf16_string,
+		     FVALUE_BENCH_MAXIMUM_STRING_SIZE,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 result_name,
+	 256,
+	 "%s/utf16",
+	 name );
+
+	fvalue_bench_print_result(
+	 result_name,
+	 number_of_iterations,
+	 &start_counters,
+	 &end_counters );
+
+	return( 1 );
+}
+
+/* Benchmarks copying a value to an UTF-32 string
+ * The name is suffixed with "/utf32"
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_copy_to_utf32_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	char result_name[ 256 ];
+	uint32_t utf32_string[ FVALUE_BENCH_MAXIMUM_STRING_SIZE ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	static char *function     = "fvalue_bench_value_copy_to_utf32_string";
+	size_t utf32_string_index = 0;
+	uint64_t iteration        = 0;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		utf32_string_index = 0;
+
+		if( libfvalue_value_copy_to_utf32_string_with_index(
+		     value,
+		     0,
+		     utf32_string,
+		     FVALUE_BENCH_MAXIMUM_STRING_SIZE,
+		     &utf32_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-32 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 result_name,
+	 256,
+	 "%s/utf32",
+	 name );
+
+	fvalue_bench_print_result(
+	 result_name,
+	 number_of_iterations,
+	 &start_counters,
+	 &end_counters );
+
+	return( 1 );
+}
+
+/* Benchmarks copying a value from an UTF-8 string
+ * The name is suffixed with "/utf8"
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_copy_from_utf8_string(
+     const char *name,
+     libfvalue_value_t *value,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	char result_name[ 256 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	static char *function = "fvalue_bench_value_copy_from_utf8_string";
+	uint64_t iteration    = 0;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libfvalue_value_copy_from_utf8_string(
+		     value,
+		     0,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 result_name,
+	 256,
+	 "%s/utf8",
+	 name );
+
+	fvalue_bench_print_result(
+	 result_name,
+	 number_of_iterations,
+	 &start_counters,
+	 &end_counters );
+
+	return( 1 );
+}
+
+/* Benchmarks copying a value to an UTF-8, UTF-16 and UTF-32 string
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_copy_to_strings(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	static char *function = "fvalue_bench_value_copy_to_strings";
+
+	if( fvalue_bench_value_copy_to_utf8_string(
+	     name,
+	     value,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( fvalue_bench_value_copy_to_utf16_string(
+	     name,
+	     value,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( fvalue_bench_value_copy_to_utf32_string(
+	     name,
+	     value,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,72 @@
+/*
+ * Functions for benchmarking
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVALUE_BENCH_FUNCTIONS_H )
+#define _FVALUE_BENCH_FUNCTIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int fvalue_bench_value_copy_to_utf8_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error );
+
+int fvalue_bench_value_copy_to_utf16_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error );
+
+int fvalue_bench_value_copy_to_utf32_string(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error );
+
+int fvalue_bench_value_copy_from_utf8_string(
+     const char *name,
+     libfvalue_value_t *value,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error );
+
+int fvalue_bench_value_copy_to_strings(
+     const char *name,
+     libfvalue_value_t *value,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVALUE_BENCH_FUNCTIONS_H ) */
+
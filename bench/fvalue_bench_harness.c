@@ -0,0 +1,259 @@
+/*
+ * Benchmark harness functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( __GLIBC__ )
+#include <malloc.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "fvalue_bench_harness.h"
+
+#if defined( HAVE_FVALUE_BENCH_ALLOCATION_COUNTERS )
+
+static void *(*fvalue_bench_real_malloc)(size_t)          = NULL;
+static void *(*fvalue_bench_real_realloc)(void *, size_t) = NULL;
+static void (*fvalue_bench_real_free)(void *)             = NULL;
+
+static uint64_t fvalue_bench_number_of_allocations        = 0;
+static uint64_t fvalue_bench_allocated_size               = 0;
+static int64_t fvalue_bench_live_size                     = 0;
+
+/* Determines the size of an allocation
+ * Returns the size or 0 if not available
+ */
+static size_t fvalue_bench_get_allocation_size(
+               void *ptr )
+{
+#if defined( __GLIBC__ )
+	if( ptr != NULL )
+	{
+		return( malloc_usable_size(
+		         ptr ) );
+	}
+#endif
+	return( 0 );
+}
+
+/* Custom malloc that counts allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	void *ptr = NULL;
+
+	if( fvalue_bench_real_malloc == NULL )
+	{
+		fvalue_bench_real_malloc = dlsym(
+		                            RTLD_NEXT,
+		                            "malloc" );
+
+		if( fvalue_bench_real_malloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	ptr = fvalue_bench_real_malloc(
+	       size );
+
+	if( ptr != NULL )
+	{
+		fvalue_bench_number_of_allocations += 1;
+		fvalue_bench_allocated_size        += size;
+		fvalue_bench_live_size             += (int64_t) fvalue_bench_get_allocation_size( ptr );
+	}
+	return( ptr );
+}
+
+/* Custom realloc that counts allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	size_t previous_size = 0;
+
+	if( fvalue_bench_real_realloc == NULL )
+	{
+		fvalue_bench_real_realloc = dlsym(
+		                             RTLD_NEXT,
+		                             "realloc" );
+
+		if( fvalue_bench_real_realloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	previous_size = fvalue_bench_get_allocation_size(
+	                 ptr );
+
+	ptr = fvalue_bench_real_realloc(
+	       ptr,
+	       size );
+
+	if( ptr != NULL )
+	{
+		fvalue_bench_number_of_allocations += 1;
+		fvalue_bench_allocated_size        += size;
+		fvalue_bench_live_size             += (int64_t) fvalue_bench_get_allocation_size( ptr );
+		fvalue_bench_live_size             -= (int64_t) previous_size;
+	}
+	return( ptr );
+}
+
+/* Custom free that keeps track of the allocated bytes that have not been freed
+ */
+void free(
+      void *ptr )
+{
+	if( fvalue_bench_real_free == NULL )
+	{
+		fvalue_bench_real_free = dlsym(
+		                          RTLD_NEXT,
+		                          "free" );
+
+		if( fvalue_bench_real_free == NULL )
+		{
+			return;
+		}
+	}
+	fvalue_bench_live_size -= (int64_t) fvalue_bench_get_allocation_size( ptr );
+
+	fvalue_bench_real_free(
+	 ptr );
+}
+
+#endif /* defined( HAVE_FVALUE_BENCH_ALLOCATION_COUNTERS ) */
+
+/* Retrieves the current time and allocation counters
+ */
+void fvalue_bench_counters_get(
+      fvalue_bench_counters_t *counters )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+#else
+	struct timespec time_value;
+#endif
+
+	if( counters == NULL )
+	{
+		return;
+	}
+#if defined( WINAPI )
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	counters->time = (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart );
+#else
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_value );
+
+	counters->time = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+#endif
+#if defined( HAVE_FVALUE_BENCH_ALLOCATION_COUNTERS )
+	counters->number_of_allocations = fvalue_bench_number_of_allocations;
+	counters->allocated_size        = fvalue_bench_allocated_size;
+	counters->live_size             = fvalue_bench_live_size;
+#else
+	counters->number_of_allocations = 0;
+	counters->allocated_size        = 0;
+	counters->live_size             = 0;
+#endif
+}
+
+/* Prints the header of the benchmark results
+ * The results are tab separated with one line per benchmark
+ */
+void fvalue_bench_print_header(
+      void )
+{
+	fprintf(
+	 stdout,
+	 "# name\titerations\tns/op\tbytes/op\tallocs/op\tlive-bytes/op\n" );
+}
+
+/* Prints a benchmark result
+ * The live bytes are the allocated bytes that were not freed during the benchmark
+ * The allocation counters are printed as "-" if not available
+ */
+void fvalue_bench_print_result(
+      const char *name,
+      uint64_t number_of_operations,
+      const fvalue_bench_counters_t *start_counters,
+      const fvalue_bench_counters_t *end_counters )
+{
+	double operations = 0.0;
+
+	if( ( name == NULL )
+	 || ( number_of_operations == 0 )
+	 || ( start_counters == NULL )
+	 || ( end_counters == NULL ) )
+	{
+		return;
+	}
+	operations = (double) number_of_operations;
+
+	fprintf(
+	 stdout,
+	 "%s\t%" PRIu64 "\t%.2f",
+	 name,
+	 number_of_operations,
+	 (double) ( end_counters->time - start_counters->time ) / operations );
+
+#if defined( HAVE_FVALUE_BENCH_ALLOCATION_COUNTERS )
+	fprintf(
+	 stdout,
+	 "\t%.2f\t%.2f\t%.2f\n",
+	 (double) ( end_counters->allocated_size - start_counters->allocated_size ) / operations,
+	 (double) ( end_counters->number_of_allocations - start_counters->number_of_allocations ) / operations,
+	 (double) ( end_counters->live_size - start_counters->live_size ) / operations );
+#else
+	fprintf(
+	 stdout,
+	 "\t-\t-\t-\n" );
+#endif
+}
+
@@ -0,0 +1,81 @@
+/*
+ * Benchmark harness functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVALUE_BENCH_HARNESS_H )
+#define _FVALUE_BENCH_HARNESS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Allocation counting replaces malloc, realloc and free and hence
+ * cannot be used in combination with DLLs or CygWin and requires dlsym
+ */
+#if !defined( LIBFVALUE_DLL_IMPORT ) && !defined( __CYGWIN__ )
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+
+#define HAVE_FVALUE_BENCH_ALLOCATION_COUNTERS	1
+
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) */
+#endif /* !defined( LIBFVALUE_DLL_IMPORT ) && !defined( __CYGWIN__ ) */
+
+typedef struct fvalue_bench_counters fvalue_bench_counters_t;
+
+struct fvalue_bench_counters
+{
+	/* The time in nano seconds
+	 */
+	uint64_t time;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of allocated bytes
+	 */
+	uint64_t allocated_size;
+
+	/* The number of allocated bytes that have not been freed
+	 */
+	int64_t live_size;
+};
+
+void fvalue_bench_counters_get(
+      fvalue_bench_counters_t *counters );
+
+void fvalue_bench_print_header(
+      void );
+
+void fvalue_bench_print_result(
+      const char *name,
+      uint64_t number_of_operations,
+      const fvalue_bench_counters_t *start_counters,
+      const fvalue_bench_counters_t *end_counters );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVALUE_BENCH_HARNESS_H ) */
+
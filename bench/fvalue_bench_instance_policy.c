@@ -0,0 +1,494 @@
+/*
+ * Value instance policy benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_VALUES	100000
+#define FVALUE_BENCH_NUMBER_OF_READS	1000000
+
+typedef struct fvalue_bench_value_definition fvalue_bench_value_definition_t;
+
+struct fvalue_bench_value_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The value type
+	 */
+	int type;
+
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The encoding
+	 */
+	int encoding;
+
+	/* The format flags
+	 */
+	uint32_t format_flags;
+};
+
+uint8_t fvalue_bench_integer_data[ 4 ] = {
+	0x78, 0x56, 0x34, 0x12 };
+
+uint8_t fvalue_bench_string_data[ 66 ] = {
+	'C', 0, ':', 0, '\\', 0, 'W', 0, 'i', 0, 'n', 0, 'd', 0, 'o', 0, 'w', 0, 's', 0, '\\', 0,
+	'S', 0, 'y', 0, 's', 0, 't', 0, 'e', 0, 'm', 0, '3', 0, '2', 0, '\\', 0,
+	'k', 0, 'e', 0, 'r', 0, 'n', 0, 'e', 0, 'l', 0, '3', 0, '2', 0, '.', 0, 'd', 0, 'l', 0, 'l', 0, 0, 0 };
+
+fvalue_bench_value_definition_t fvalue_bench_value_definitions[ 2 ] = {
+	{ "uint32", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT, fvalue_bench_integer_data, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED },
+	{ "string_utf16", LIBFVALUE_VALUE_TYPE_STRING_UTF16, fvalue_bench_string_data, 66, LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN, 0 } };
+
+const char *fvalue_bench_instance_policy_names[ 3 ] = {
+	"lazy",
+	"no_cache",
+	"eager" };
+
+/* Sets the data of a value and reads it once, as done when streaming values
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_instance_policy_touch_once(
+     uint8_t instance_policy,
+     fvalue_bench_value_definition_t *value_definition,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+	uint8_t utf8_string[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	libfvalue_value_t **values = NULL;
+	static char *function      = "fvalue_bench_instance_policy_touch_once";
+	size_t utf8_string_index   = 0;
+	int value_index            = 0;
+
+	values = (libfvalue_value_t **) memory_allocate(
+	                                 sizeof( libfvalue_value_t * ) * FVALUE_BENCH_NUMBER_OF_VALUES );
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     values,
+	     0,
+	     sizeof( libfvalue_value_t * ) * FVALUE_BENCH_NUMBER_OF_VALUES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < FVALUE_BENCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( libfvalue_value_type_initialize(
+		     &( values[ value_index ] ),
+		     value_definition->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfvalue_value_set_format_flags(
+		     values[ value_index ],
+		     value_definition->format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set format flags of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfvalue_value_set_instance_policy(
+		     values[ value_index ],
+		     instance_policy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set instance policy of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( value_index = 0;
+	     value_index < FVALUE_BENCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( libfvalue_value_set_data(
+		     values[ value_index ],
+		     value_definition->data,
+		     value_definition->data_size,
+		     value_definition->encoding,
+		     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		utf8_string_index = 0;
+
+		if( libfvalue_value_copy_to_utf8_string_with_index(
+		     values[ value_index ],
+		     0,
+		     utf8_string,
+		     128,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value: %d to UTF-8 string.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "instance_policy/%s/%s/touch_once",
+	 fvalue_bench_instance_policy_names[ instance_policy ],
+	 value_definition->name );
+
+	fvalue_bench_print_result(
+	 name,
+	 FVALUE_BENCH_NUMBER_OF_VALUES,
+	 &start_counters,
+	 &end_counters );
+
+	for( value_index = 0;
+	     value_index < FVALUE_BENCH_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( libfvalue_value_free(
+		     &( values[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( values != NULL )
+	{
+		for( value_index = 0;
+		     value_index < FVALUE_BENCH_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			if( values[ value_index ] != NULL )
+			{
+				libfvalue_value_free(
+				 &( values[ value_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 values );
+	}
+	return( -1 );
+}
+
+/* Reads the same value repeatedly, as done when querying values
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_instance_policy_touch_many(
+     uint8_t instance_policy,
+     fvalue_bench_value_definition_t *value_definition,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+	uint8_t utf8_string[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_instance_policy_touch_many";
+	size_t utf8_string_index = 0;
+	int read_index           = 0;
+
+	if( libfvalue_value_type_initialize(
+	     &value,
+	     value_definition->type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_format_flags(
+	     value,
+	     value_definition->format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_instance_policy(
+	     value,
+	     instance_policy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set instance policy.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     value,
+	     value_definition->data,
+	     value_definition->data_size,
+	     value_definition->encoding,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( read_index = 0;
+	     read_index < FVALUE_BENCH_NUMBER_OF_READS;
+	     read_index++ )
+	{
+		utf8_string_index = 0;
+
+		if( libfvalue_value_copy_to_utf8_string_with_index(
+		     value,
+		     0,
+		     utf8_string,
+		     128,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "instance_policy/%s/%s/touch_many",
+	 fvalue_bench_instance_policy_names[ instance_policy ],
+	 value_definition->name );
+
+	fvalue_bench_print_result(
+	 name,
+	 FVALUE_BENCH_NUMBER_OF_READS,
+	 &start_counters,
+	 &end_counters );
+
+	if( libfvalue_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int definition_index     = 0;
+	uint8_t instance_policy  = 0;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	for( definition_index = 0;
+	     definition_index < 2;
+	     definition_index++ )
+	{
+		for( instance_policy = LIBFVALUE_VALUE_INSTANCE_POLICY_LAZY;
+		     instance_policy <= LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER;
+		     instance_policy++ )
+		{
+			if( fvalue_bench_instance_policy_touch_once(
+			     instance_policy,
+			     &( fvalue_bench_value_definitions[ definition_index ] ),
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( fvalue_bench_instance_policy_touch_many(
+			     instance_policy,
+			     &( fvalue_bench_value_definitions[ definition_index ] ),
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,369 @@
+/*
+ * Integer value benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_functions.h"
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_ITERATIONS	1000000
+
+typedef struct fvalue_bench_value_definition fvalue_bench_value_definition_t;
+
+struct fvalue_bench_value_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The value type
+	 */
+	int type;
+
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The encoding
+	 */
+	int encoding;
+
+	/* The format flags
+	 */
+	uint32_t format_flags;
+};
+
+uint8_t fvalue_bench_integer_data_small[ 4 ] = {
+	0x2a, 0x00, 0x00, 0x00 };
+
+uint8_t fvalue_bench_integer_data_32bit[ 4 ] = {
+	0xd2, 0x02, 0x96, 0x49 };
+
+uint8_t fvalue_bench_integer_data_64bit[ 8 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+uint8_t fvalue_bench_integer_data_negative[ 8 ] = {
+	0x2e, 0xfd, 0x69, 0xb6, 0x1c, 0xbe, 0x99, 0xfe };
+
+fvalue_bench_value_definition_t fvalue_bench_value_definitions[ 6 ] = {
+	{ "uint32_decimal_small", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT, fvalue_bench_integer_data_small, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED },
+	{ "uint32_decimal", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT, fvalue_bench_integer_data_32bit, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED },
+	{ "uint64_decimal", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT, fvalue_bench_integer_data_64bit, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED },
+	{ "int64_decimal", LIBFVALUE_VALUE_TYPE_INTEGER_64BIT, fvalue_bench_integer_data_negative, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED },
+	{ "uint32_hexadecimal", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT, fvalue_bench_integer_data_32bit, 4, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL },
+	{ "uint64_hexadecimal", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT, fvalue_bench_integer_data_64bit, 8, LIBFVALUE_ENDIAN_LITTLE, LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL } };
+
+/* Benchmarks copying a value to strings
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_integer_copy_to_strings(
+     fvalue_bench_value_definition_t *value_definition,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_integer_copy_to_strings";
+
+	if( libfvalue_value_type_initialize(
+	     &value,
+	     value_definition->type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_format_flags(
+	     value,
+	     value_definition->format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     value,
+	     value_definition->data,
+	     value_definition->data_size,
+	     value_definition->encoding,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "integer/copy_to_string/%s",
+	 value_definition->name );
+
+	if( fvalue_bench_value_copy_to_strings(
+	     name,
+	     value,
+	     FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks copying a value from an UTF-8 string
+ * The string is the UTF-8 representation of the value data
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_integer_copy_from_utf8_string(
+     fvalue_bench_value_definition_t *value_definition,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+	uint8_t utf8_string[ 64 ];
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_integer_copy_from_utf8_string";
+	size_t utf8_string_index = 0;
+
+	if( libfvalue_value_type_initialize(
+	     &value,
+	     value_definition->type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_format_flags(
+	     value,
+	     value_definition->format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     value,
+	     value_definition->data,
+	     value_definition->data_size,
+	     value_definition->encoding,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_copy_to_utf8_string_with_index(
+	     value,
+	     0,
+	     utf8_string,
+	     64,
+	     &utf8_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "integer/copy_from_string/%s",
+	 value_definition->name );
+
+	/* The string index includes the end of string character
+	 */
+	if( fvalue_bench_value_copy_from_utf8_string(
+	     name,
+	     value,
+	     utf8_string,
+	     utf8_string_index - 1,
+	     FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy from UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int definition_index     = 0;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	for( definition_index = 0;
+	     definition_index < 6;
+	     definition_index++ )
+	{
+		if( fvalue_bench_integer_copy_to_strings(
+		     &( fvalue_bench_value_definitions[ definition_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fvalue_bench_integer_copy_from_utf8_string(
+		     &( fvalue_bench_value_definitions[ definition_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,363 @@
+/*
+ * String value benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_functions.h"
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_ITERATIONS	100000
+
+/* The maximum size of an encoded text, in bytes
+ */
+#define FVALUE_BENCH_MAXIMUM_STREAM_SIZE	2048
+
+typedef struct fvalue_bench_codepage fvalue_bench_codepage_t;
+
+struct fvalue_bench_codepage
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The value type
+	 */
+	int type;
+
+	/* The codepage
+	 */
+	int codepage;
+
+	/* Value to indicate the codepage can represent non-ASCII text
+	 */
+	int supports_non_ascii;
+};
+
+fvalue_bench_codepage_t fvalue_bench_codepages[ 10 ] = {
+	{ "ascii", LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM, LIBFVALUE_CODEPAGE_ASCII, 0 },
+	{ "iso_8859_1", LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM, LIBFVALUE_CODEPAGE_ISO_8859_1, 1 },
+	{ "windows_1252", LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM, LIBFVALUE_CODEPAGE_WINDOWS_1252, 1 },
+	{ "windows_932", LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM, LIBFVALUE_CODEPAGE_WINDOWS_932, 0 },
+	{ "utf8", LIBFVALUE_VALUE_TYPE_STRING_UTF8, LIBFVALUE_CODEPAGE_UTF8, 1 },
+	{ "utf16le", LIBFVALUE_VALUE_TYPE_STRING_UTF16, LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN, 1 },
+	{ "utf16be", LIBFVALUE_VALUE_TYPE_STRING_UTF16, LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN, 1 },
+	{ "utf32le", LIBFVALUE_VALUE_TYPE_STRING_UTF32, LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN, 1 },
+	{ "utf32be", LIBFVALUE_VALUE_TYPE_STRING_UTF32, LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN, 1 },
+	{ "1200_mixed", LIBFVALUE_VALUE_TYPE_STRING_UTF16, LIBFVALUE_CODEPAGE_1200_MIXED, 1 } };
+
+/* The benchmark texts where '#' is replaced by U+00E9
+ */
+const char *fvalue_bench_ascii_text = \
+	"C:\\Program Files\\Common Files\\Microsoft Shared\\ink\\TabTip.exe /autostart "
+	"HKEY_LOCAL_MACHINE\\SOFTWARE\\Microsoft\\Windows\\CurrentVersion\\Run "
+	"The quick brown fox jumps over the lazy dog 0123456789";
+
+const char *fvalue_bench_non_ascii_text = \
+	"C:\\Users\\Ren#e\\Documents\\R#sum#s\\Caf# cr#me br#l#e recette.docx "
+	"Pr#f#rences syst#me d#taill#es pour l'#quipe de s#curit# "
+	"Le d#l#gu# a #t# #lu apr#s la r#union 0123456789";
+
+/* Encodes a benchmark text
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_string_encode(
+     const char *text,
+     int codepage,
+     uint8_t *stream,
+     size_t stream_size,
+     size_t *stream_length,
+     libcerror_error_t **error )
+{
+	static char *function = "fvalue_bench_string_encode";
+	size_t stream_index   = 0;
+	size_t text_index     = 0;
+	size_t text_length    = 0;
+	uint32_t code_point   = 0;
+
+	text_length = narrow_string_length(
+	               text );
+
+	/* The end of string character is included
+	 */
+	for( text_index = 0;
+	     text_index <= text_length;
+	     text_index++ )
+	{
+		code_point = (uint32_t) (uint8_t) text[ text_index ];
+
+		if( code_point == (uint32_t) '#' )
+		{
+			code_point = 0x000000e9UL;
+		}
+		if( ( stream_index + 4 ) > stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid stream size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		switch( codepage )
+		{
+			case LIBFVALUE_CODEPAGE_UTF8:
+				if( code_point < 0x80 )
+				{
+					stream[ stream_index++ ] = (uint8_t) code_point;
+				}
+				else
+				{
+					stream[ stream_index++ ] = (uint8_t) ( 0xc0 | ( code_point >> 6 ) );
+					stream[ stream_index++ ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+				}
+				break;
+
+			case LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN:
+				byte_stream_copy_from_uint16_big_endian(
+				 &( stream[ stream_index ] ),
+				 code_point );
+
+				stream_index += 2;
+
+				break;
+
+			case LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN:
+			case LIBFVALUE_CODEPAGE_1200_MIXED:
+				byte_stream_copy_from_uint16_little_endian(
+				 &( stream[ stream_index ] ),
+				 code_point );
+
+				stream_index += 2;
+
+				break;
+
+			case LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN:
+				byte_stream_copy_from_uint32_big_endian(
+				 &( stream[ stream_index ] ),
+				 code_point );
+
+				stream_index += 4;
+
+				break;
+
+			case LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN:
+				byte_stream_copy_from_uint32_little_endian(
+				 &( stream[ stream_index ] ),
+				 code_point );
+
+				stream_index += 4;
+
+				break;
+
+			default:
+				stream[ stream_index++ ] = (uint8_t) code_point;
+
+				break;
+		}
+	}
+	*stream_length = stream_index;
+
+	return( 1 );
+}
+
+/* Benchmarks copying a string value to strings
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_string_copy_to_strings(
+     fvalue_bench_codepage_t *codepage,
+     const char *text_name,
+     const char *text,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+	uint8_t stream[ FVALUE_BENCH_MAXIMUM_STREAM_SIZE ];
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_string_copy_to_strings";
+	size_t stream_length     = 0;
+
+	if( fvalue_bench_string_encode(
+	     text,
+	     codepage->codepage,
+	     stream,
+	     FVALUE_BENCH_MAXIMUM_STREAM_SIZE,
+	     &stream_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to encode text.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_type_initialize(
+	     &value,
+	     codepage->type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     value,
+	     stream,
+	     stream_length,
+	     codepage->codepage,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "string/copy_to_string/%s/%s",
+	 codepage->name,
+	 text_name );
+
+	if( fvalue_bench_value_copy_to_strings(
+	     name,
+	     value,
+	     FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to benchmark copy to strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int codepage_index       = 0;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	for( codepage_index = 0;
+	     codepage_index < 10;
+	     codepage_index++ )
+	{
+		if( fvalue_bench_string_copy_to_strings(
+		     &( fvalue_bench_codepages[ codepage_index ] ),
+		     "ascii_text",
+		     fvalue_bench_ascii_text,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fvalue_bench_codepages[ codepage_index ].supports_non_ascii != 0 )
+		{
+			if( fvalue_bench_string_copy_to_strings(
+			     &( fvalue_bench_codepages[ codepage_index ] ),
+			     "non_ascii_text",
+			     fvalue_bench_non_ascii_text,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
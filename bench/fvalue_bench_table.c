@@ -0,0 +1,565 @@
+/*
+ * Values table benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_LOOKUPS		1000000
+
+/* The size of an identifier including the end of string character
+ */
+#define FVALUE_BENCH_IDENTIFIER_SIZE		13
+
+/* Retrieves the identifier of the value with the specified index
+ */
+void fvalue_bench_table_get_identifier(
+      int value_index,
+      char *identifier )
+{
+	narrow_string_snprintf(
+	 identifier,
+	 FVALUE_BENCH_IDENTIFIER_SIZE,
+	 "value_%06u",
+	 (unsigned int) value_index % 1000000U );
+}
+
+/* Creates a values table with a number of 32-bit integer values
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_table_create(
+     libfvalue_table_t **table,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	char identifier[ FVALUE_BENCH_IDENTIFIER_SIZE ];
+	uint8_t value_data[ 4 ];
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_table_create";
+	int value_index          = 0;
+
+	if( libfvalue_table_initialize(
+	     table,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		fvalue_bench_table_get_identifier(
+		 value_index,
+		 identifier );
+
+		value_data[ 0 ] = (uint8_t) value_index;
+		value_data[ 1 ] = (uint8_t) ( value_index >> 8 );
+		value_data[ 2 ] = (uint8_t) ( value_index >> 16 );
+		value_data[ 3 ] = 0;
+
+		if( libfvalue_value_type_initialize(
+		     &value,
+		     LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfvalue_value_set_identifier(
+		     value,
+		     (uint8_t *) identifier,
+		     FVALUE_BENCH_IDENTIFIER_SIZE,
+		     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set identifier of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfvalue_value_set_data(
+		     value,
+		     value_data,
+		     4,
+		     LIBFVALUE_ENDIAN_LITTLE,
+		     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfvalue_table_set_value_by_index(
+		     *table,
+		     value_index,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in table.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		value = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( *table != NULL )
+	{
+		libfvalue_table_free(
+		 table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks retrieving values by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_table_get_value_by_identifier(
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	char *identifiers        = NULL;
+	libfvalue_table_t *table = NULL;
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_table_get_value_by_identifier";
+	uint64_t lookup_index    = 0;
+	int value_index          = 0;
+
+	if( fvalue_bench_table_create(
+	     &table,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		goto on_error;
+	}
+	identifiers = (char *) memory_allocate(
+	                        sizeof( char ) * FVALUE_BENCH_IDENTIFIER_SIZE * number_of_values );
+
+	if( identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		fvalue_bench_table_get_identifier(
+		 value_index,
+		 &( identifiers[ value_index * FVALUE_BENCH_IDENTIFIER_SIZE ] ) );
+	}
+	/* The first look up can build the identifier index
+	 * hence it is done before the measurement
+	 */
+	if( libfvalue_table_get_value_by_identifier(
+	     table,
+	     (uint8_t *) identifiers,
+	     FVALUE_BENCH_IDENTIFIER_SIZE,
+	     &value,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %s.",
+		 function,
+		 identifiers );
+
+		goto on_error;
+	}
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( lookup_index = 0;
+	     lookup_index < FVALUE_BENCH_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		/* Visit the values in a scattered order
+		 */
+		value_index = (int) ( ( lookup_index * 7919 ) % (uint64_t) number_of_values );
+
+		if( libfvalue_table_get_value_by_identifier(
+		     table,
+		     (uint8_t *) &( identifiers[ value_index * FVALUE_BENCH_IDENTIFIER_SIZE ] ),
+		     FVALUE_BENCH_IDENTIFIER_SIZE,
+		     &value,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "table/get_value_by_identifier/%d",
+	 number_of_values );
+
+	fvalue_bench_print_result(
+	 name,
+	 FVALUE_BENCH_NUMBER_OF_LOOKUPS,
+	 &start_counters,
+	 &end_counters );
+
+	memory_free(
+	 identifiers );
+
+	identifiers = NULL;
+
+	if( libfvalue_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( identifiers != NULL )
+	{
+		memory_free(
+		 identifiers );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks copying a values table from an UTF-8 encoded XML string
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_table_copy_from_utf8_xml_string(
+     int number_of_values,
+     uint64_t number_of_iterations,
+     libcerror_error_t **error )
+{
+	char identifier[ FVALUE_BENCH_IDENTIFIER_SIZE ];
+	char name[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	libfvalue_table_t *table = NULL;
+	uint8_t *xml_string      = NULL;
+	static char *function    = "fvalue_bench_table_copy_from_utf8_xml_string";
+	size_t xml_string_index  = 0;
+	size_t xml_string_size   = 0;
+	uint64_t iteration       = 0;
+	int print_count          = 0;
+	int value_index          = 0;
+
+	/* Every value is stored as: <value_NNNNNN>Value data of value_NNNNNN</value_NNNNNN>
+	 */
+	xml_string_size = 16 + ( (size_t) number_of_values * 80 );
+
+	xml_string = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * xml_string_size );
+
+	if( xml_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML string.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = narrow_string_snprintf(
+	               (char *) xml_string,
+	               xml_string_size,
+	               "<table>" );
+
+	xml_string_index = (size_t) print_count;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		fvalue_bench_table_get_identifier(
+		 value_index,
+		 identifier );
+
+		print_count = narrow_string_snprintf(
+		               (char *) &( xml_string[ xml_string_index ] ),
+		               xml_string_size - xml_string_index,
+		               "<%s>Value data of %s</%s>",
+		               identifier,
+		               identifier,
+		               identifier );
+
+		xml_string_index += (size_t) print_count;
+	}
+	print_count = narrow_string_snprintf(
+	               (char *) &( xml_string[ xml_string_index ] ),
+	               xml_string_size - xml_string_index,
+	               "</table>" );
+
+	xml_string_index += (size_t) print_count + 1;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libfvalue_table_initialize(
+		     &table,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_table_copy_from_utf8_xml_string(
+		     table,
+		     xml_string,
+		     xml_string_index,
+		     (uint8_t *) "table",
+		     5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy table from XML string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "table/copy_from_utf8_xml_string/%d",
+	 number_of_values );
+
+	fvalue_bench_print_result(
+	 name,
+	 number_of_iterations,
+	 &start_counters,
+	 &end_counters );
+
+	memory_free(
+	 xml_string );
+
+	return( 1 );
+
+on_error:
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	if( xml_string != NULL )
+	{
+		memory_free(
+		 xml_string );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	if( fvalue_bench_table_get_value_by_identifier(
+	     10,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fvalue_bench_table_get_value_by_identifier(
+	     1000,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fvalue_bench_table_get_value_by_identifier(
+	     100000,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fvalue_bench_table_copy_from_utf8_xml_string(
+	     100,
+	     1000,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fvalue_bench_table_copy_from_utf8_xml_string(
+	     10000,
+	     10,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,305 @@
+/*
+ * Value benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_bench_harness.h"
+#include "fvalue_bench_libcerror.h"
+#include "fvalue_bench_libfvalue.h"
+#include "fvalue_bench_unused.h"
+
+#define FVALUE_BENCH_NUMBER_OF_ITERATIONS	1000000
+
+typedef struct fvalue_bench_value_type fvalue_bench_value_type_t;
+
+struct fvalue_bench_value_type
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The value type
+	 */
+	int type;
+};
+
+fvalue_bench_value_type_t fvalue_bench_value_types[ 7 ] = {
+	{ "binary_data", LIBFVALUE_VALUE_TYPE_BINARY_DATA },
+	{ "uint32", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT },
+	{ "uint64", LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT },
+	{ "float64", LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT },
+	{ "string_utf16", LIBFVALUE_VALUE_TYPE_STRING_UTF16 },
+	{ "filetime", LIBFVALUE_VALUE_TYPE_FILETIME },
+	{ "guid", LIBFVALUE_VALUE_TYPE_GUID } };
+
+/* Benchmarks creating and freeing a value
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_initialize(
+     fvalue_bench_value_type_t *value_type,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_value_initialize";
+	uint64_t iteration       = 0;
+
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < FVALUE_BENCH_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( libfvalue_value_type_initialize(
+		     &value,
+		     value_type->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfvalue_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "value/initialize_free/%s",
+	 value_type->name );
+
+	fvalue_bench_print_result(
+	 name,
+	 FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	 &start_counters,
+	 &end_counters );
+
+	return( 1 );
+}
+
+/* Benchmarks creating values in an arena that is reset every 1024 values
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_bench_value_initialize_in_arena(
+     fvalue_bench_value_type_t *value_type,
+     libcerror_error_t **error )
+{
+	char name[ 128 ];
+
+	fvalue_bench_counters_t end_counters;
+	fvalue_bench_counters_t start_counters;
+
+	libfvalue_arena_t *arena = NULL;
+	libfvalue_value_t *value = NULL;
+	static char *function    = "fvalue_bench_value_initialize_in_arena";
+	uint64_t iteration       = 0;
+
+	if( libfvalue_arena_initialize(
+	     &arena,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	fvalue_bench_counters_get(
+	 &start_counters );
+
+	for( iteration = 0;
+	     iteration < FVALUE_BENCH_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		value = NULL;
+
+		if( libfvalue_value_type_initialize_in_arena(
+		     &value,
+		     arena,
+		     value_type->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value in arena.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( iteration % 1024 ) == 1023 )
+		{
+			if( libfvalue_arena_reset(
+			     arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to reset arena.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfvalue_arena_reset(
+	     arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
+
+		goto on_error;
+	}
+	fvalue_bench_counters_get(
+	 &end_counters );
+
+	narrow_string_snprintf(
+	 name,
+	 128,
+	 "value/initialize_in_arena/%s",
+	 value_type->name );
+
+	fvalue_bench_print_result(
+	 name,
+	 FVALUE_BENCH_NUMBER_OF_ITERATIONS,
+	 &start_counters,
+	 &end_counters );
+
+	if( libfvalue_arena_free(
+	     &arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_BENCH_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_BENCH_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	int type_index           = 0;
+
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argc )
+	FVALUE_BENCH_UNREFERENCED_PARAMETER( argv )
+
+	fvalue_bench_print_header();
+
+	for( type_index = 0;
+	     type_index < 7;
+	     type_index++ )
+	{
+		if( fvalue_bench_value_initialize(
+		     &( fvalue_bench_value_types[ type_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( fvalue_bench_value_initialize_in_arena(
+		     &( fvalue_bench_value_types[ type_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,573 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvalue_arena.h"
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
+
+/* The arena hands out memory from a list of blocks by advancing an offset.
+ * Individual allocations are not freed, all memory is released at once
+ * when the arena is reset. The blocks are retained on reset so that
+ * a subsequent use of the arena does not need to allocate memory.
+ *
+ * Memory that was allocated outside the arena, such as value instances,
+ * can be registered as a cleanup and is freed when the arena is reset.
+ */
+
+/* Rounds a size up to the arena alignment
+ */
+#define libfvalue_arena_align_size( size ) \
+	( ( ( size ) + ( LIBFVALUE_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFVALUE_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * If block size is 0 the default block size is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_arena_initialize(
+     libfvalue_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	static char *function                      = "libfvalue_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		block_size = LIBFVALUE_ARENA_DEFAULT_BLOCK_SIZE;
+	}
+	if( block_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( libfvalue_arena_block_t ) - LIBFVALUE_ARENA_ALIGNMENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = memory_allocate_structure(
+	                  libfvalue_internal_arena_t );
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_ARENA,
+	 sizeof( libfvalue_internal_arena_t ) );
+
+	if( memory_set(
+	     internal_arena,
+	     0,
+	     sizeof( libfvalue_internal_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 internal_arena );
+
+		return( -1 );
+	}
+	internal_arena->block_size = libfvalue_arena_align_size( block_size );
+
+	*arena = (libfvalue_arena_t *) internal_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_arena != NULL )
+	{
+		memory_free(
+		 internal_arena );
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * The cleanups of the arena are run before the memory is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_arena_free(
+     libfvalue_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfvalue_arena_block_t *arena_block       = NULL;
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	static char *function                      = "libfvalue_arena_free";
+	int result                                 = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		if( libfvalue_arena_reset(
+		     *arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset arena.",
+			 function );
+
+			result = -1;
+		}
+		internal_arena = (libfvalue_internal_arena_t *) *arena;
+		*arena         = NULL;
+
+		while( internal_arena->first_block != NULL )
+		{
+			arena_block                 = internal_arena->first_block;
+			internal_arena->first_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+		}
+		memory_free(
+		 internal_arena );
+	}
+	return( result );
+}
+
+/* Resets an arena
+ * Runs the cleanups and releases all memory allocated from the arena at once
+ * The blocks are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_arena_reset(
+     libfvalue_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfvalue_arena_block_t *arena_block       = NULL;
+	libfvalue_arena_cleanup_t *arena_cleanup   = NULL;
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	static char *function                      = "libfvalue_arena_reset";
+	int result                                 = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfvalue_internal_arena_t *) arena;
+
+	/* The cleanups are stored in the arena hence they must be run
+	 * before the blocks are reset
+	 */
+	for( arena_cleanup = internal_arena->cleanups;
+	     arena_cleanup != NULL;
+	     arena_cleanup = arena_cleanup->next_cleanup )
+	{
+		if( arena_cleanup->free_instance == NULL )
+		{
+			memory_free(
+			 arena_cleanup->instance );
+		}
+		else if( arena_cleanup->free_instance(
+		          &( arena_cleanup->instance ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free instance.",
+			 function );
+
+			result = -1;
+		}
+		arena_cleanup->instance = NULL;
+	}
+	internal_arena->cleanups = NULL;
+
+	for( arena_block = internal_arena->first_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		arena_block->data_offset = 0;
+	}
+	internal_arena->current_block   = internal_arena->first_block;
+	internal_arena->last_allocation = NULL;
+
+	return( result );
+}
+
+/* Appends a block to the arena and makes it the current block
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_arena_append_block(
+     libfvalue_internal_arena_t *internal_arena,
+     size_t minimum_data_size,
+     libcerror_error_t **error )
+{
+	libfvalue_arena_block_t *arena_block = NULL;
+	libfvalue_arena_block_t *last_block  = NULL;
+	static char *function                = "libfvalue_internal_arena_append_block";
+	size_t block_header_size             = 0;
+	size_t data_size                     = 0;
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	block_header_size = libfvalue_arena_align_size( sizeof( libfvalue_arena_block_t ) );
+
+	data_size = internal_arena->block_size;
+
+	if( minimum_data_size > data_size )
+	{
+		data_size = minimum_data_size;
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - block_header_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid minimum data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block and its data are allocated as a single chunk of memory
+	 */
+	arena_block = (libfvalue_arena_block_t *) memory_allocate(
+	                                           block_header_size + data_size );
+
+	if( arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_ARENA,
+	 block_header_size + data_size );
+
+	arena_block->next_block  = NULL;
+	arena_block->data        = &( ( (uint8_t *) arena_block )[ block_header_size ] );
+	arena_block->data_size   = data_size;
+	arena_block->data_offset = 0;
+
+	if( internal_arena->first_block == NULL )
+	{
+		internal_arena->first_block = arena_block;
+	}
+	else
+	{
+		last_block = internal_arena->current_block;
+
+		while( last_block->next_block != NULL )
+		{
+			last_block = last_block->next_block;
+		}
+		last_block->next_block = arena_block;
+	}
+	internal_arena->current_block = arena_block;
+
+	return( 1 );
+}
+
+/* Appends a cleanup to the arena
+ * The free instance function is called with the instance when the arena is reset
+ * If free instance is NULL the instance is freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_arena_append_cleanup(
+     libfvalue_arena_t *arena,
+     intptr_t *instance,
+     int (*free_instance)(
+            intptr_t **instance,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfvalue_arena_cleanup_t *arena_cleanup   = NULL;
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	static char *function                      = "libfvalue_arena_append_cleanup";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfvalue_internal_arena_t *) arena;
+
+	if( instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instance.",
+		 function );
+
+		return( -1 );
+	}
+	arena_cleanup = (libfvalue_arena_cleanup_t *) libfvalue_arena_allocate_memory(
+	                                               arena,
+	                                               sizeof( libfvalue_arena_cleanup_t ) );
+
+	if( arena_cleanup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cleanup.",
+		 function );
+
+		return( -1 );
+	}
+	arena_cleanup->instance      = instance;
+	arena_cleanup->free_instance = free_instance;
+	arena_cleanup->next_cleanup  = internal_arena->cleanups;
+
+	internal_arena->cleanups = arena_cleanup;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * If arena is NULL the memory is allocated with memory_allocate
+ * Returns a pointer to the memory if successful or NULL on error
+ */
+void *libfvalue_arena_allocate_memory(
+       libfvalue_arena_t *arena,
+       size_t size )
+{
+	libfvalue_arena_block_t *arena_block       = NULL;
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	uint8_t *memory                            = NULL;
+
+	if( arena == NULL )
+	{
+		return( memory_allocate(
+		         size ) );
+	}
+	internal_arena = (libfvalue_internal_arena_t *) arena;
+
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( NULL );
+	}
+	size = libfvalue_arena_align_size( size );
+
+	/* The blocks after the current block are unused
+	 */
+	arena_block = internal_arena->current_block;
+
+	while( arena_block != NULL )
+	{
+		if( size <= ( arena_block->data_size - arena_block->data_offset ) )
+		{
+			break;
+		}
+		arena_block = arena_block->next_block;
+	}
+	if( arena_block == NULL )
+	{
+		if( libfvalue_internal_arena_append_block(
+		     internal_arena,
+		     size,
+		     NULL ) != 1 )
+		{
+			return( NULL );
+		}
+		arena_block = internal_arena->current_block;
+	}
+	internal_arena->current_block = arena_block;
+
+	memory = &( ( arena_block->data )[ arena_block->data_offset ] );
+
+	arena_block->data_offset += size;
+
+	internal_arena->last_allocation = memory;
+
+	return( memory );
+}
+
+/* Reallocates memory from an arena
+ * The last allocation is grown in place if the current block has sufficient space
+ * otherwise new memory is allocated and the data is copied. The previous memory
+ * is released when the arena is reset.
+ * If arena is NULL the memory is reallocated with memory_reallocate
+ * Returns a pointer to the memory if successful or NULL on error
+ */
+void *libfvalue_arena_reallocate_memory(
+       libfvalue_arena_t *arena,
+       void *memory,
+       size_t size,
+       size_t new_size )
+{
+	libfvalue_arena_block_t *arena_block       = NULL;
+	libfvalue_internal_arena_t *internal_arena = NULL;
+	uint8_t *new_memory                        = NULL;
+	size_t memory_offset                       = 0;
+
+	if( arena == NULL )
+	{
+		return( memory_reallocate(
+		         memory,
+		         new_size ) );
+	}
+	internal_arena = (libfvalue_internal_arena_t *) arena;
+
+	if( memory == NULL )
+	{
+		return( libfvalue_arena_allocate_memory(
+		         arena,
+		         new_size ) );
+	}
+	if( ( new_size == 0 )
+	 || ( new_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( NULL );
+	}
+	arena_block = internal_arena->current_block;
+
+	if( ( arena_block != NULL )
+	 && ( (uint8_t *) memory == internal_arena->last_allocation ) )
+	{
+		memory_offset = (size_t) ( (uint8_t *) memory - arena_block->data );
+
+		if( libfvalue_arena_align_size( new_size ) <= ( arena_block->data_size - memory_offset ) )
+		{
+			arena_block->data_offset = memory_offset + libfvalue_arena_align_size( new_size );
+
+			return( memory );
+		}
+	}
+	new_memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                          arena,
+	                          new_size );
+
+	if( new_memory == NULL )
+	{
+		return( NULL );
+	}
+	if( size > new_size )
+	{
+		size = new_size;
+	}
+	if( size > 0 )
+	{
+		if( memory_copy(
+		     new_memory,
+		     memory,
+		     size ) == NULL )
+		{
+			return( NULL );
+		}
+	}
+	return( new_memory );
+}
+
+/* Frees memory of an arena
+ * Memory allocated from an arena is released when the arena is reset
+ * If arena is NULL the memory is freed with memory_free
+ */
+void libfvalue_arena_free_memory(
+      libfvalue_arena_t *arena,
+      void *memory )
+{
+	if( arena == NULL )
+	{
+		memory_free(
+		 memory );
+	}
+}
+
@@ -0,0 +1,153 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_ARENA_H )
+#define _LIBFVALUE_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_extern.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvalue_arena_block libfvalue_arena_block_t;
+
+struct libfvalue_arena_block
+{
+	/* The next block
+	 */
+	libfvalue_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 * contains the offset of the first unused byte
+	 */
+	size_t data_offset;
+};
+
+typedef struct libfvalue_arena_cleanup libfvalue_arena_cleanup_t;
+
+struct libfvalue_arena_cleanup
+{
+	/* The next cleanup
+	 */
+	libfvalue_arena_cleanup_t *next_cleanup;
+
+	/* The instance
+	 */
+	intptr_t *instance;
+
+	/* The free instance function
+	 * NULL if the instance is memory that was allocated with memory_allocate
+	 */
+	int (*free_instance)(
+	       intptr_t **instance,
+	       libcerror_error_t **error );
+};
+
+typedef struct libfvalue_internal_arena libfvalue_internal_arena_t;
+
+struct libfvalue_internal_arena
+{
+	/* The first block
+	 */
+	libfvalue_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libfvalue_arena_block_t *current_block;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The cleanups
+	 * these are stored in the arena and are run in reverse order of registration
+	 */
+	libfvalue_arena_cleanup_t *cleanups;
+
+	/* The last allocated memory
+	 * used to grow the last allocation in place
+	 */
+	uint8_t *last_allocation;
+};
+
+LIBFVALUE_EXTERN \
+int libfvalue_arena_initialize(
+     libfvalue_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_arena_free(
+     libfvalue_arena_t **arena,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_arena_reset(
+     libfvalue_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfvalue_internal_arena_append_block(
+     libfvalue_internal_arena_t *internal_arena,
+     size_t minimum_data_size,
+     libcerror_error_t **error );
+
+int libfvalue_arena_append_cleanup(
+     libfvalue_arena_t *arena,
+     intptr_t *instance,
+     int (*free_instance)(
+            intptr_t **instance,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+void *libfvalue_arena_allocate_memory(
+       libfvalue_arena_t *arena,
+       size_t size );
+
+void *libfvalue_arena_reallocate_memory(
+       libfvalue_arena_t *arena,
+       void *memory,
+       size_t size,
+       size_t new_size );
+
+void libfvalue_arena_free_memory(
+      libfvalue_arena_t *arena,
+      void *memory );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_ARENA_H ) */
+
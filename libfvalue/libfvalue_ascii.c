@@ -0,0 +1,1039 @@
+/*
+ * ASCII string functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+
+#define LIBFVALUE_ASCII_HAVE_SSE2
+
+#endif
+
+#include "libfvalue_ascii.h"
+#include "libfvalue_codepage.h"
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+
+#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
+#define LIBFVALUE_ASCII_HOST_BYTE_ORDER LIBFVALUE_ENDIAN_BIG
+#else
+#define LIBFVALUE_ASCII_HOST_BYTE_ORDER LIBFVALUE_ENDIAN_LITTLE
+#endif
+
+/* Most strings stored in UTF-16 or in a byte stream codepage only contain
+ * 7-bit ASCII characters, which map 1:1 onto UTF-8, UTF-16 and UTF-32.
+ * The functions in this file convert such strings without decoding
+ * individual characters, 16 bytes at a time using SSE2 if available.
+ *
+ * The functions return 0 as soon as they encounter a unit that is not
+ * a non-zero ASCII character, except for a terminating zero unit,
+ * in which case the caller is expected to fall back to libuna.
+ */
+
+/* Determines the unit size and byte order of a stream
+ * Returns 1 if the stream can contain ASCII characters or 0 if not
+ */
+static int libfvalue_ascii_get_stream_format(
+            const uint8_t *stream,
+            size_t stream_size,
+            int codepage,
+            uint8_t *unit_size,
+            int *byte_order,
+            size_t *number_of_characters )
+{
+	size_t number_of_units = 0;
+	size_t stream_index    = 0;
+
+	*byte_order = LIBFVALUE_ENDIAN_LITTLE;
+
+	switch( codepage )
+	{
+		case LIBFVALUE_CODEPAGE_1200_MIXED:
+			if( ( stream_size % 2 ) == 0 )
+			{
+				*unit_size = 2;
+			}
+			else
+			{
+				*unit_size = 1;
+			}
+			break;
+
+		case LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN:
+			*unit_size  = 2;
+			*byte_order = LIBFVALUE_ENDIAN_BIG;
+			break;
+
+		case LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN:
+			*unit_size = 2;
+			break;
+
+		case LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN:
+			*unit_size  = 4;
+			*byte_order = LIBFVALUE_ENDIAN_BIG;
+			break;
+
+		case LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN:
+			*unit_size = 4;
+			break;
+
+		/* In UTF-7 the '+' character starts an encoded sequence and in SCSU
+		 * control characters are tags, hence ASCII is not mapped 1:1
+		 */
+		case LIBFVALUE_CODEPAGE_UTF7:
+		case LIBFVALUE_CODEPAGE_SCSU:
+			return( 0 );
+
+		default:
+			*unit_size = 1;
+			break;
+	}
+	if( ( stream_size == 0 )
+	 || ( ( stream_size % *unit_size ) != 0 ) )
+	{
+		return( 0 );
+	}
+	number_of_units = stream_size / *unit_size;
+
+	/* Ignore the end of string character
+	 */
+	for( stream_index = stream_size - *unit_size;
+	     stream_index < stream_size;
+	     stream_index++ )
+	{
+		if( stream[ stream_index ] != 0 )
+		{
+			break;
+		}
+	}
+	if( stream_index == stream_size )
+	{
+		number_of_units -= 1;
+	}
+	*number_of_characters = number_of_units;
+
+	return( 1 );
+}
+
+/* Copies ASCII characters from a stream into a string with the character size
+ * If string is NULL the characters are only checked
+ * Returns the number of ASCII characters before the first non-ASCII or zero unit
+ */
+static size_t libfvalue_ascii_copy_characters(
+               uint8_t *string,
+               uint8_t character_size,
+               const uint8_t *stream,
+               size_t number_of_units,
+               uint8_t unit_size,
+               int byte_order )
+{
+	uint16_t *utf16_string    = (uint16_t *) string;
+	uint32_t *utf32_string    = (uint32_t *) string;
+	size_t unit_index         = 0;
+	uint32_t unit_value       = 0;
+
+#if defined( LIBFVALUE_ASCII_HAVE_SSE2 )
+	__m128i high_vector       = _mm_setzero_si128();
+	__m128i low_vector        = _mm_setzero_si128();
+	__m128i vector            = _mm_setzero_si128();
+	__m128i zero_vector       = _mm_setzero_si128();
+	size_t units_per_vector   = 16 / unit_size;
+	int expected_zero_mask    = 0;
+
+	/* In a vector of ASCII characters only the unused upper bytes
+	 * of the units are zero and no byte has the high bit set
+	 */
+	if( unit_size == 2 )
+	{
+		if( byte_order == LIBFVALUE_ENDIAN_BIG )
+		{
+			expected_zero_mask = 0x5555;
+		}
+		else
+		{
+			expected_zero_mask = 0xaaaa;
+		}
+	}
+	else if( unit_size == 4 )
+	{
+		if( byte_order == LIBFVALUE_ENDIAN_BIG )
+		{
+			expected_zero_mask = 0x7777;
+		}
+		else
+		{
+			expected_zero_mask = 0xeeee;
+		}
+	}
+	while( ( number_of_units - unit_index ) >= units_per_vector )
+	{
+		vector = _mm_loadu_si128(
+		          (const __m128i *) &( stream[ unit_index * unit_size ] ) );
+
+		if( ( _mm_movemask_epi8( vector ) != 0 )
+		 || ( _mm_movemask_epi8( _mm_cmpeq_epi8( vector, zero_vector ) ) != expected_zero_mask ) )
+		{
+			break;
+		}
+		if( string != NULL )
+		{
+			if( byte_order == LIBFVALUE_ENDIAN_BIG )
+			{
+				if( unit_size == 2 )
+				{
+					vector = _mm_srli_epi16( vector, 8 );
+				}
+				else if( unit_size == 4 )
+				{
+					vector = _mm_srli_epi32( vector, 24 );
+				}
+			}
+			/* Reduce UTF-32 units to UTF-16 units
+			 */
+			if( ( unit_size == 4 )
+			 && ( character_size != 4 ) )
+			{
+				vector = _mm_packs_epi32( vector, vector );
+			}
+			/* Widen bytes to UTF-16 units
+			 */
+			if( ( unit_size == 1 )
+			 && ( character_size != 1 ) )
+			{
+				low_vector  = _mm_unpacklo_epi8( vector, zero_vector );
+				high_vector = _mm_unpackhi_epi8( vector, zero_vector );
+			}
+			switch( character_size )
+			{
+				case 1:
+					if( unit_size == 1 )
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( string[ unit_index ] ),
+						 vector );
+					}
+					else if( unit_size == 2 )
+					{
+						_mm_storel_epi64(
+						 (__m128i *) &( string[ unit_index ] ),
+						 _mm_packus_epi16( vector, vector ) );
+					}
+					else
+					{
+						unit_value = (uint32_t) _mm_cvtsi128_si32(
+						                         _mm_packus_epi16( vector, vector ) );
+
+						byte_stream_copy_from_uint32_little_endian(
+						 &( string[ unit_index ] ),
+						 unit_value );
+					}
+					break;
+
+				case 2:
+					if( unit_size == 1 )
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( utf16_string[ unit_index ] ),
+						 low_vector );
+						_mm_storeu_si128(
+						 (__m128i *) &( utf16_string[ unit_index + 8 ] ),
+						 high_vector );
+					}
+					else if( unit_size == 2 )
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( utf16_string[ unit_index ] ),
+						 vector );
+					}
+					else
+					{
+						_mm_storel_epi64(
+						 (__m128i *) &( utf16_string[ unit_index ] ),
+						 vector );
+					}
+					break;
+
+				case 4:
+					if( unit_size == 1 )
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index ] ),
+						 _mm_unpacklo_epi16( low_vector, zero_vector ) );
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index + 4 ] ),
+						 _mm_unpackhi_epi16( low_vector, zero_vector ) );
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index + 8 ] ),
+						 _mm_unpacklo_epi16( high_vector, zero_vector ) );
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index + 12 ] ),
+						 _mm_unpackhi_epi16( high_vector, zero_vector ) );
+					}
+					else if( unit_size == 2 )
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index ] ),
+						 _mm_unpacklo_epi16( vector, zero_vector ) );
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index + 4 ] ),
+						 _mm_unpackhi_epi16( vector, zero_vector ) );
+					}
+					else
+					{
+						_mm_storeu_si128(
+						 (__m128i *) &( utf32_string[ unit_index ] ),
+						 vector );
+					}
+					break;
+			}
+		}
+		unit_index += units_per_vector;
+	}
+#else
+	uint64_t value_64bit      = 0;
+	size_t character_index    = 0;
+
+	/* Check 8 bytes at a time for the high bit or a zero byte
+	 */
+	if( unit_size == 1 )
+	{
+		while( ( number_of_units - unit_index ) >= 8 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( stream[ unit_index ] ),
+			 value_64bit );
+
+			if( ( ( value_64bit | ( ( value_64bit - 0x0101010101010101ULL ) & ~value_64bit ) ) & 0x8080808080808080ULL ) != 0 )
+			{
+				break;
+			}
+			if( string != NULL )
+			{
+				if( character_size == 1 )
+				{
+					byte_stream_copy_from_uint64_little_endian(
+					 &( string[ unit_index ] ),
+					 value_64bit );
+				}
+				else for( character_index = unit_index;
+				          character_index < ( unit_index + 8 );
+				          character_index++ )
+				{
+					if( character_size == 2 )
+					{
+						utf16_string[ character_index ] = (uint16_t) stream[ character_index ];
+					}
+					else
+					{
+						utf32_string[ character_index ] = (uint32_t) stream[ character_index ];
+					}
+				}
+			}
+			unit_index += 8;
+		}
+	}
+#endif /* defined( LIBFVALUE_ASCII_HAVE_SSE2 ) */
+
+	while( unit_index < number_of_units )
+	{
+		if( unit_size == 1 )
+		{
+			unit_value = stream[ unit_index ];
+		}
+		else if( unit_size == 2 )
+		{
+			if( byte_order == LIBFVALUE_ENDIAN_BIG )
+			{
+				byte_stream_copy_to_uint16_big_endian(
+				 &( stream[ unit_index * 2 ] ),
+				 unit_value );
+			}
+			else
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( stream[ unit_index * 2 ] ),
+				 unit_value );
+			}
+		}
+		else
+		{
+			if( byte_order == LIBFVALUE_ENDIAN_BIG )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 &( stream[ unit_index * 4 ] ),
+				 unit_value );
+			}
+			else
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( stream[ unit_index * 4 ] ),
+				 unit_value );
+			}
+		}
+		if( ( unit_value == 0 )
+		 || ( unit_value > 0x7f ) )
+		{
+			break;
+		}
+		if( string != NULL )
+		{
+			if( character_size == 1 )
+			{
+				string[ unit_index ] = (uint8_t) unit_value;
+			}
+			else if( character_size == 2 )
+			{
+				utf16_string[ unit_index ] = (uint16_t) unit_value;
+			}
+			else
+			{
+				utf32_string[ unit_index ] = unit_value;
+			}
+		}
+		unit_index++;
+	}
+	return( unit_index );
+}
+
+/* Determines the size of a string of a stream that only contains ASCII characters
+ * The size is in characters and includes the end of string character
+ * Returns 1 if successful, 0 if the stream contains non-ASCII characters or -1 on error
+ */
+int libfvalue_ascii_string_size_from_stream(
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvalue_ascii_string_size_from_stream";
+	size_t number_of_characters = 0;
+	int byte_order              = 0;
+	uint8_t unit_size           = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_ascii_get_stream_format(
+	     stream,
+	     stream_size,
+	     codepage,
+	     &unit_size,
+	     &byte_order,
+	     &number_of_characters ) == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_ascii_copy_characters(
+	     NULL,
+	     0,
+	     stream,
+	     number_of_characters,
+	     unit_size,
+	     byte_order ) != number_of_characters )
+	{
+		return( 0 );
+	}
+	*string_size = number_of_characters + 1;
+
+	return( 1 );
+}
+
+/* Copies a stream that only contains ASCII characters into an UTF-8 string
+ * The string is terminated by an end of string character
+ * Returns 1 if successful, 0 if the stream contains non-ASCII characters
+ * or the string is too small or -1 on error
+ */
+int libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfvalue_ascii_utf8_string_with_index_copy_from_stream";
+	size_t number_of_characters   = 0;
+	size_t safe_utf8_string_index = 0;
+	int byte_order                = 0;
+	uint8_t unit_size             = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf8_string_index = *utf8_string_index;
+
+	if( libfvalue_ascii_get_stream_format(
+	     stream,
+	     stream_size,
+	     codepage,
+	     &unit_size,
+	     &byte_order,
+	     &number_of_characters ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( safe_utf8_string_index >= utf8_string_size )
+	 || ( number_of_characters >= ( utf8_string_size - safe_utf8_string_index ) ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_ascii_copy_characters(
+	     &( utf8_string[ safe_utf8_string_index ] ),
+	     1,
+	     stream,
+	     number_of_characters,
+	     unit_size,
+	     byte_order ) != number_of_characters )
+	{
+		return( 0 );
+	}
+	safe_utf8_string_index += number_of_characters;
+
+	utf8_string[ safe_utf8_string_index++ ] = 0;
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Copies a stream that only contains ASCII characters into an UTF-16 string
+ * The string is terminated by an end of string character
+ * Returns 1 if successful, 0 if the stream contains non-ASCII characters
+ * or the string is too small or -1 on error
+ */
+int libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvalue_ascii_utf16_string_with_index_copy_from_stream";
+	size_t number_of_characters    = 0;
+	size_t safe_utf16_string_index = 0;
+	int byte_order                 = 0;
+	uint8_t unit_size              = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf16_string_index = *utf16_string_index;
+
+	if( libfvalue_ascii_get_stream_format(
+	     stream,
+	     stream_size,
+	     codepage,
+	     &unit_size,
+	     &byte_order,
+	     &number_of_characters ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( safe_utf16_string_index >= utf16_string_size )
+	 || ( number_of_characters >= ( utf16_string_size - safe_utf16_string_index ) ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_ascii_copy_characters(
+	     (uint8_t *) &( utf16_string[ safe_utf16_string_index ] ),
+	     2,
+	     stream,
+	     number_of_characters,
+	     unit_size,
+	     byte_order ) != number_of_characters )
+	{
+		return( 0 );
+	}
+	safe_utf16_string_index += number_of_characters;
+
+	utf16_string[ safe_utf16_string_index++ ] = 0;
+
+	*utf16_string_index = safe_utf16_string_index;
+
+	return( 1 );
+}
+
+/* Copies a stream that only contains ASCII characters into an UTF-32 string
+ * The string is terminated by an end of string character
+ * Returns 1 if successful, 0 if the stream contains non-ASCII characters
+ * or the string is too small or -1 on error
+ */
+int libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvalue_ascii_utf32_string_with_index_copy_from_stream";
+	size_t number_of_characters    = 0;
+	size_t safe_utf32_string_index = 0;
+	int byte_order                 = 0;
+	uint8_t unit_size              = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_size > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf32_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf32_string_index = *utf32_string_index;
+
+	if( libfvalue_ascii_get_stream_format(
+	     stream,
+	     stream_size,
+	     codepage,
+	     &unit_size,
+	     &byte_order,
+	     &number_of_characters ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( safe_utf32_string_index >= utf32_string_size )
+	 || ( number_of_characters >= ( utf32_string_size - safe_utf32_string_index ) ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_ascii_copy_characters(
+	     (uint8_t *) &( utf32_string[ safe_utf32_string_index ] ),
+	     4,
+	     stream,
+	     number_of_characters,
+	     unit_size,
+	     byte_order ) != number_of_characters )
+	{
+		return( 0 );
+	}
+	safe_utf32_string_index += number_of_characters;
+
+	utf32_string[ safe_utf32_string_index++ ] = 0;
+
+	*utf32_string_index = safe_utf32_string_index;
+
+	return( 1 );
+}
+
+/* Copies ASCII characters into a string with the character size
+ * The characters are widened in bulk, characters outside the ASCII range are zero extended
+ * No end of string character is added other than the ones in the ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_ascii_copy_to_string(
+     const uint8_t *ascii_characters,
+     size_t number_of_characters,
+     uint8_t *string,
+     uint8_t character_size,
+     libcerror_error_t **error )
+{
+	uint16_t *utf16_string = NULL;
+	uint32_t *utf32_string = NULL;
+	static char *function  = "libfvalue_ascii_copy_to_string";
+	size_t character_index = 0;
+
+	if( ascii_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( character_size == 1 )
+	{
+		if( memory_copy(
+		     string,
+		     ascii_characters,
+		     number_of_characters ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy ASCII characters.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The bulk copy stops at the first non-ASCII or zero character
+	 */
+	character_index = libfvalue_ascii_copy_characters(
+	                   string,
+	                   character_size,
+	                   ascii_characters,
+	                   number_of_characters,
+	                   1,
+	                   LIBFVALUE_ENDIAN_LITTLE );
+
+	utf16_string = (uint16_t *) string;
+	utf32_string = (uint32_t *) string;
+
+	while( character_index < number_of_characters )
+	{
+		if( character_size == 2 )
+		{
+			utf16_string[ character_index ] = (uint16_t) ascii_characters[ character_index ];
+		}
+		else
+		{
+			utf32_string[ character_index ] = (uint32_t) ascii_characters[ character_index ];
+		}
+		character_index++;
+	}
+	return( 1 );
+}
+
+/* Copies a string with the character size into ASCII characters
+ * The characters are narrowed in bulk, characters outside the ASCII range are
+ * replaced by 0xff, which is not a valid character in any of the string formats
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_ascii_copy_from_string(
+     uint8_t *ascii_characters,
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t number_of_characters,
+     libcerror_error_t **error )
+{
+	const uint16_t *utf16_string = NULL;
+	const uint32_t *utf32_string = NULL;
+	static char *function        = "libfvalue_ascii_copy_from_string";
+	size_t character_index       = 0;
+	uint32_t character_value     = 0;
+
+	if( ascii_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bulk copy stops at the first non-ASCII or zero character
+	 */
+	character_index = libfvalue_ascii_copy_characters(
+	                   ascii_characters,
+	                   1,
+	                   string,
+	                   number_of_characters,
+	                   character_size,
+	                   LIBFVALUE_ASCII_HOST_BYTE_ORDER );
+
+	utf16_string = (const uint16_t *) string;
+	utf32_string = (const uint32_t *) string;
+
+	while( character_index < number_of_characters )
+	{
+		if( character_size == 1 )
+		{
+			character_value = string[ character_index ];
+		}
+		else if( character_size == 2 )
+		{
+			character_value = utf16_string[ character_index ];
+		}
+		else
+		{
+			character_value = utf32_string[ character_index ];
+		}
+		if( character_value > 0x7f )
+		{
+			ascii_characters[ character_index ] = 0xff;
+		}
+		else
+		{
+			ascii_characters[ character_index ] = (uint8_t) character_value;
+		}
+		character_index++;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * ASCII string functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_ASCII_H )
+#define _LIBFVALUE_ASCII_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfvalue_ascii_string_size_from_stream(
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
+int libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
+int libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     const uint8_t *stream,
+     size_t stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
+int libfvalue_ascii_copy_to_string(
+     const uint8_t *ascii_characters,
+     size_t number_of_characters,
+     uint8_t *string,
+     uint8_t character_size,
+     libcerror_error_t **error );
+
+int libfvalue_ascii_copy_from_string(
+     uint8_t *ascii_characters,
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t number_of_characters,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_ASCII_H ) */
+
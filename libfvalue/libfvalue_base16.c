@@ -0,0 +1,697 @@
+/*
+ * Base16 functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvalue_base16.h"
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_simd.h"
+
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 )
+#define LIBFVALUE_BASE16_HAVE_SSE2
+#elif defined( LIBFVALUE_SIMD_HAVE_NEON )
+#define LIBFVALUE_BASE16_HAVE_NEON
+#endif
+
+/* The base16 kernels convert 16 bytes into 32 characters at a time
+ * using SSE2 or NEON if available. The remaining bytes, or all bytes
+ * if no vector instructions are available, are converted using
+ * a character table.
+ *
+ * Decoding is branchless, a single validity check is done for all
+ * characters and only on error the invalid character is looked up.
+ */
+
+static const uint8_t libfvalue_base16_lower_case_characters[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+static const uint8_t libfvalue_base16_upper_case_characters[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+/* Determines if a character is a base16 character
+ */
+#define libfvalue_base16_character_is_valid( character ) \
+	( ( (uint8_t) ( ( character ) - (uint8_t) '0' ) < 10 ) \
+	 || ( (uint8_t) ( ( ( character ) | 0x20 ) - (uint8_t) 'a' ) < 6 ) )
+
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 )
+
+/* Converts nibbles into characters
+ */
+static __m128i libfvalue_base16_nibbles_to_characters(
+                __m128i nibbles,
+                __m128i letter_offset )
+{
+	__m128i characters = _mm_add_epi8(
+	                      nibbles,
+	                      _mm_set1_epi8( (char) '0' ) );
+
+	/* Nibbles of 10 and above are moved to the letter range
+	 */
+	return( _mm_add_epi8(
+	         characters,
+	         _mm_and_si128(
+	          _mm_cmpgt_epi8( nibbles, _mm_set1_epi8( 9 ) ),
+	          letter_offset ) ) );
+}
+
+#endif /* defined( LIBFVALUE_BASE16_HAVE_SSE2 ) */
+
+/* Copies a byte stream into base16 characters
+ * The string must be of the character size and large enough to contain
+ * 2 characters for every byte
+ */
+static void libfvalue_base16_copy_from_byte_stream(
+             uint8_t *string,
+             uint8_t character_size,
+             const uint8_t *byte_stream,
+             size_t byte_stream_size,
+             uint8_t character_case )
+{
+	const uint8_t *characters_table = libfvalue_base16_lower_case_characters;
+	uint16_t *utf16_string          = NULL;
+	uint32_t *utf32_string          = NULL;
+	size_t byte_stream_index        = 0;
+	size_t string_index             = 0;
+	uint8_t byte_value              = 0;
+
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 )
+	__m128i byte_values             = _mm_setzero_si128();
+	__m128i high_nibbles            = _mm_setzero_si128();
+	__m128i letter_offset           = _mm_setzero_si128();
+	__m128i low_nibbles             = _mm_setzero_si128();
+	__m128i nibble_mask             = _mm_set1_epi8( 0x0f );
+
+#elif defined( LIBFVALUE_BASE16_HAVE_NEON )
+	uint8x16x2_t characters;
+	uint8x16_t byte_values;
+	uint8x16_t characters_lookup_table;
+#endif
+
+	if( character_case == LIBFVALUE_BASE16_CASE_UPPER )
+	{
+		characters_table = libfvalue_base16_upper_case_characters;
+	}
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 )
+	/* The distance between the character after '9' and 'a' or 'A'
+	 */
+	if( character_case == LIBFVALUE_BASE16_CASE_UPPER )
+	{
+		letter_offset = _mm_set1_epi8( (char) ( 'A' - '9' - 1 ) );
+	}
+	else
+	{
+		letter_offset = _mm_set1_epi8( (char) ( 'a' - '9' - 1 ) );
+	}
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		byte_values = _mm_loadu_si128(
+		               (__m128i *) &( byte_stream[ byte_stream_index ] ) );
+
+		high_nibbles = _mm_and_si128(
+		                _mm_srli_epi16( byte_values, 4 ),
+		                nibble_mask );
+
+		low_nibbles = _mm_and_si128(
+		               byte_values,
+		               nibble_mask );
+
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 libfvalue_base16_nibbles_to_characters(
+		  _mm_unpacklo_epi8( high_nibbles, low_nibbles ),
+		  letter_offset ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 16 ) * character_size ] ),
+		 character_size,
+		 libfvalue_base16_nibbles_to_characters(
+		  _mm_unpackhi_epi8( high_nibbles, low_nibbles ),
+		  letter_offset ) );
+
+		byte_stream_index += 16;
+		string_index      += 32;
+	}
+#elif defined( LIBFVALUE_BASE16_HAVE_NEON )
+	characters_lookup_table = vld1q_u8(
+	                           characters_table );
+
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		byte_values = vld1q_u8(
+		               &( byte_stream[ byte_stream_index ] ) );
+
+		characters = vzipq_u8(
+		              vqtbl1q_u8( characters_lookup_table, vshrq_n_u8( byte_values, 4 ) ),
+		              vqtbl1q_u8( characters_lookup_table, vandq_u8( byte_values, vdupq_n_u8( 0x0f ) ) ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 characters.val[ 0 ] );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 16 ) * character_size ] ),
+		 character_size,
+		 characters.val[ 1 ] );
+
+		byte_stream_index += 16;
+		string_index      += 32;
+	}
+#endif /* defined( LIBFVALUE_BASE16_HAVE_SSE2 ) */
+
+	if( character_size == 1 )
+	{
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			string[ string_index++ ] = characters_table[ byte_value >> 4 ];
+			string[ string_index++ ] = characters_table[ byte_value & 0x0f ];
+		}
+	}
+	else if( character_size == 2 )
+	{
+		utf16_string = (uint16_t *) string;
+
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			utf16_string[ string_index++ ] = characters_table[ byte_value >> 4 ];
+			utf16_string[ string_index++ ] = characters_table[ byte_value & 0x0f ];
+		}
+	}
+	else
+	{
+		utf32_string = (uint32_t *) string;
+
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			utf32_string[ string_index++ ] = characters_table[ byte_value >> 4 ];
+			utf32_string[ string_index++ ] = characters_table[ byte_value & 0x0f ];
+		}
+	}
+}
+
+/* Copies a byte stream into a base16 encoded string with the character size
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The string is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base16_string_with_index_copy_from_byte_stream(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvalue_base16_string_with_index_copy_from_byte_stream";
+	size_t safe_string_index = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) ( SSIZE_MAX / character_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index > string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_case != LIBFVALUE_BASE16_CASE_LOWER )
+	 && ( character_case != LIBFVALUE_BASE16_CASE_UPPER ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character case.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size * 2 ) > ( string_size - safe_string_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string size too small.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_base16_copy_from_byte_stream(
+	 &( string[ safe_string_index * character_size ] ),
+	 character_size,
+	 byte_stream,
+	 byte_stream_size,
+	 character_case );
+
+	*string_index = safe_string_index + ( byte_stream_size * 2 );
+
+	return( 1 );
+}
+
+/* Copies a byte stream into an UTF-8 base16 encoded string
+ * The string is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_base16_utf8_string_with_index_copy_from_byte_stream";
+
+	if( libfvalue_base16_string_with_index_copy_from_byte_stream(
+	     utf8_string,
+	     1,
+	     utf8_string_size,
+	     utf8_string_index,
+	     byte_stream,
+	     byte_stream_size,
+	     character_case,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to UTF-8 base16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a byte stream into an UTF-16 base16 encoded string
+ * The string is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_base16_utf16_string_with_index_copy_from_byte_stream";
+
+	if( libfvalue_base16_string_with_index_copy_from_byte_stream(
+	     (uint8_t *) utf16_string,
+	     (uint8_t) sizeof( uint16_t ),
+	     utf16_string_size,
+	     utf16_string_index,
+	     byte_stream,
+	     byte_stream_size,
+	     character_case,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to UTF-16 base16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a byte stream into an UTF-32 base16 encoded string
+ * The string is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_base16_utf32_string_with_index_copy_from_byte_stream";
+
+	if( libfvalue_base16_string_with_index_copy_from_byte_stream(
+	     (uint8_t *) utf32_string,
+	     (uint8_t) sizeof( uint32_t ),
+	     utf32_string_size,
+	     utf32_string_index,
+	     byte_stream,
+	     byte_stream_size,
+	     character_case,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to UTF-32 base16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies base16 characters to an integer value
+ * At most 16 characters are supported, both lower and upper case characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base16_copy_to_integer(
+     const uint8_t *base16_characters,
+     size_t number_of_characters,
+     uint64_t *integer_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfvalue_base16_copy_to_integer";
+	size_t character_index     = 0;
+	uint64_t value_64bit       = 0;
+	uint8_t character_value    = 0;
+	uint8_t is_valid           = 1;
+
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 ) || defined( LIBFVALUE_BASE16_HAVE_NEON )
+	uint8_t characters_block[ 16 ];
+	uint8_t byte_values[ 8 ];
+#else
+	uint8_t is_letter          = 0;
+#endif
+
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 )
+	__m128i characters         = _mm_setzero_si128();
+	__m128i is_digit           = _mm_setzero_si128();
+	__m128i is_letter          = _mm_setzero_si128();
+	__m128i lower_case         = _mm_setzero_si128();
+	__m128i nibbles            = _mm_setzero_si128();
+
+#elif defined( LIBFVALUE_BASE16_HAVE_NEON )
+	uint8x16_t characters;
+	uint8x16_t is_letter;
+	uint8x16_t nibbles;
+	uint8x16_t valid_characters;
+	uint8x8_t even_nibbles;
+	uint8x8_t odd_nibbles;
+#endif
+
+	if( base16_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base16 characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_characters == 0 )
+	 || ( number_of_characters > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of characters value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 ) || defined( LIBFVALUE_BASE16_HAVE_NEON )
+	/* Leading '0' characters do not change the value hence the characters
+	 * are right aligned in a block of 16 characters
+	 */
+	if( memory_set(
+	     characters_block,
+	     (int) '0',
+	     16 - number_of_characters ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear characters block.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( characters_block[ 16 - number_of_characters ] ),
+	     base16_characters,
+	     number_of_characters ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy characters.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBFVALUE_BASE16_HAVE_SSE2 )
+	characters = _mm_loadu_si128(
+	              (__m128i *) characters_block );
+
+	/* The comparisons are signed hence characters of 0x80 and above are invalid
+	 */
+	is_digit = _mm_and_si128(
+	            _mm_cmpgt_epi8( characters, _mm_set1_epi8( (char) ( '0' - 1 ) ) ),
+	            _mm_cmplt_epi8( characters, _mm_set1_epi8( (char) ( '9' + 1 ) ) ) );
+
+	lower_case = _mm_or_si128(
+	              characters,
+	              _mm_set1_epi8( 0x20 ) );
+
+	is_letter = _mm_and_si128(
+	             _mm_cmpgt_epi8( lower_case, _mm_set1_epi8( (char) ( 'a' - 1 ) ) ),
+	             _mm_cmplt_epi8( lower_case, _mm_set1_epi8( (char) ( 'f' + 1 ) ) ) );
+
+	if( _mm_movemask_epi8( _mm_or_si128( is_digit, is_letter ) ) != 0xffff )
+	{
+		is_valid = 0;
+	}
+	/* The lower nibble of 'a' and 'A' is 1 hence letters need 9 to be added
+	 */
+	nibbles = _mm_add_epi8(
+	           _mm_and_si128( characters, _mm_set1_epi8( 0x0f ) ),
+	           _mm_and_si128( is_letter, _mm_set1_epi8( 9 ) ) );
+
+	/* Combine every pair of nibbles into a byte value
+	 */
+	nibbles = _mm_or_si128(
+	           _mm_and_si128( _mm_slli_epi16( nibbles, 4 ), _mm_set1_epi16( 0x00f0 ) ),
+	           _mm_srli_epi16( nibbles, 8 ) );
+
+	_mm_storel_epi64(
+	 (__m128i *) byte_values,
+	 _mm_packus_epi16( nibbles, nibbles ) );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 byte_values,
+	 value_64bit );
+
+#elif defined( LIBFVALUE_BASE16_HAVE_NEON )
+	characters = vld1q_u8(
+	              characters_block );
+
+	is_letter = vcleq_u8(
+	             vsubq_u8( vorrq_u8( characters, vdupq_n_u8( 0x20 ) ), vdupq_n_u8( 'a' ) ),
+	             vdupq_n_u8( 5 ) );
+
+	valid_characters = vorrq_u8(
+	                    vcleq_u8( vsubq_u8( characters, vdupq_n_u8( '0' ) ), vdupq_n_u8( 9 ) ),
+	                    is_letter );
+
+	if( vminvq_u8( valid_characters ) == 0 )
+	{
+		is_valid = 0;
+	}
+	/* The lower nibble of 'a' and 'A' is 1 hence letters need 9 to be added
+	 */
+	nibbles = vaddq_u8(
+	           vandq_u8( characters, vdupq_n_u8( 0x0f ) ),
+	           vandq_u8( is_letter, vdupq_n_u8( 9 ) ) );
+
+	/* Combine every pair of nibbles into a byte value
+	 */
+	even_nibbles = vget_low_u8( vuzp1q_u8( nibbles, nibbles ) );
+	odd_nibbles  = vget_low_u8( vuzp2q_u8( nibbles, nibbles ) );
+
+	vst1_u8(
+	 byte_values,
+	 vorr_u8( vshl_n_u8( even_nibbles, 4 ), odd_nibbles ) );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 byte_values,
+	 value_64bit );
+
+#else
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		character_value = base16_characters[ character_index ];
+
+		is_letter = (uint8_t) ( (uint8_t) ( ( character_value | 0x20 ) - (uint8_t) 'a' ) < 6 );
+
+		is_valid &= (uint8_t) ( ( (uint8_t) ( character_value - (uint8_t) '0' ) < 10 ) | is_letter );
+
+		/* The lower nibble of 'a' and 'A' is 1 hence letters need 9 to be added
+		 */
+		value_64bit <<= 4;
+		value_64bit  |= ( character_value & 0x0f ) + ( 9 * is_letter );
+	}
+#endif /* defined( LIBFVALUE_BASE16_HAVE_SSE2 ) */
+
+	if( is_valid == 0 )
+	{
+		for( character_index = 0;
+		     character_index < number_of_characters;
+		     character_index++ )
+		{
+			character_value = base16_characters[ character_index ];
+
+			if( !libfvalue_base16_character_is_valid( character_value ) )
+			{
+				break;
+			}
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character value: 0x%02" PRIx8 " at index: %" PRIzd ".",
+		 function,
+		 character_value,
+		 character_index );
+
+		return( -1 );
+	}
+	*integer_value = value_64bit;
+
+	return( 1 );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Base16 functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFVALUE_BASE16_H )
+#define _LIBFVALUE_BASE16_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfvalue_base16_string_with_index_copy_from_byte_stream(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error );
+
+int libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error );
+
+int libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error );
+
+int libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_case,
+     libcerror_error_t **error );
+
+int libfvalue_base16_copy_to_integer(
+     const uint8_t *base16_characters,
+     size_t number_of_characters,
+     uint64_t *integer_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_BASE16_H ) */
+
@@ -0,0 +1,506 @@
+/*
+ * Base32 functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSSE3__ )
+#include <tmmintrin.h>
+
+#define LIBFVALUE_BASE32_HAVE_SSSE3
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+
+#define LIBFVALUE_BASE32_HAVE_AVX2
+
+#endif
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#include <arm_neon.h>
+
+#define LIBFVALUE_BASE32_HAVE_NEON
+
+#endif
+
+#include "libfvalue_base32.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_simd.h"
+
+/* The base32 kernels convert 20 bytes into 32 characters at a time
+ * using AVX2 or 10 bytes into 16 characters using SSSE3 or NEON
+ * if available. Every 5-bit index is shifted out of the 16-bit big-endian
+ * word that contains it, after which the indices are translated into
+ * characters by adding the offset of their range in the alphabet.
+ *
+ * The remaining bytes, or all bytes if no vector instructions are available,
+ * are converted using a character table. The last 1 to 4 bytes are padded.
+ */
+
+static const uint8_t libfvalue_base32_characters[ 32 ] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '2', '3', '4', '5', '6', '7' };
+
+/* The number of characters encoded by the last 0 to 4 bytes
+ */
+static const uint8_t libfvalue_base32_remainder_number_of_characters[ 5 ] = {
+	0, 2, 4, 5, 7 };
+
+#if defined( LIBFVALUE_BASE32_HAVE_SSSE3 )
+
+/* Converts the first 10 bytes of a vector into 16 characters
+ */
+static __m128i libfvalue_base32_bytes_to_characters(
+                __m128i byte_values )
+{
+	__m128i indices = _mm_setzero_si128();
+
+	/* Every 16-bit element contains the big-endian word with the bits of
+	 * one index, the multiply high shifts the index into the lower bits
+	 */
+	indices = _mm_packus_epi16(
+	           _mm_and_si128(
+	            _mm_mulhi_epu16(
+	             _mm_shuffle_epi8(
+	              byte_values,
+	              _mm_setr_epi8( 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4 ) ),
+	             _mm_setr_epi16( 32, 1024, 128, 4096, 512, 64, 2048, 256 ) ),
+	            _mm_set1_epi16( 0x1f ) ),
+	           _mm_and_si128(
+	            _mm_mulhi_epu16(
+	             _mm_shuffle_epi8(
+	              byte_values,
+	              _mm_setr_epi8( 6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9 ) ),
+	             _mm_setr_epi16( 32, 1024, 128, 4096, 512, 64, 2048, 256 ) ),
+	            _mm_set1_epi16( 0x1f ) ) );
+
+	/* Indices 26 - 31 are moved from after 'Z' to the digit range
+	 */
+	return( _mm_sub_epi8(
+	         _mm_add_epi8(
+	          indices,
+	          _mm_set1_epi8( (char) 'A' ) ),
+	         _mm_and_si128(
+	          _mm_cmpgt_epi8( indices, _mm_set1_epi8( 25 ) ),
+	          _mm_set1_epi8( (char) ( 'A' + 26 - '2' ) ) ) ) );
+}
+
+#if defined( LIBFVALUE_BASE32_HAVE_AVX2 )
+
+/* Converts the first 10 bytes of both 128-bit lanes of a vector into 32 characters
+ */
+static __m256i libfvalue_base32_bytes_to_characters_avx2(
+                __m256i byte_values )
+{
+	__m256i indices = _mm256_setzero_si256();
+
+	indices = _mm256_packus_epi16(
+	           _mm256_and_si256(
+	            _mm256_mulhi_epu16(
+	             _mm256_shuffle_epi8(
+	              byte_values,
+	              _mm256_setr_epi8( 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4,
+	                                1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4 ) ),
+	             _mm256_setr_epi16( 32, 1024, 128, 4096, 512, 64, 2048, 256,
+	                                32, 1024, 128, 4096, 512, 64, 2048, 256 ) ),
+	            _mm256_set1_epi16( 0x1f ) ),
+	           _mm256_and_si256(
+	            _mm256_mulhi_epu16(
+	             _mm256_shuffle_epi8(
+	              byte_values,
+	              _mm256_setr_epi8( 6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9,
+	                                6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9 ) ),
+	             _mm256_setr_epi16( 32, 1024, 128, 4096, 512, 64, 2048, 256,
+	                                32, 1024, 128, 4096, 512, 64, 2048, 256 ) ),
+	            _mm256_set1_epi16( 0x1f ) ) );
+
+	return( _mm256_sub_epi8(
+	         _mm256_add_epi8(
+	          indices,
+	          _mm256_set1_epi8( (char) 'A' ) ),
+	         _mm256_and_si256(
+	          _mm256_cmpgt_epi8( indices, _mm256_set1_epi8( 25 ) ),
+	          _mm256_set1_epi8( (char) ( 'A' + 26 - '2' ) ) ) ) );
+}
+
+#endif /* defined( LIBFVALUE_BASE32_HAVE_AVX2 ) */
+
+#elif defined( LIBFVALUE_BASE32_HAVE_NEON )
+
+static const uint8_t libfvalue_base32_neon_shuffle_indices[ 32 ] = {
+	1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4,
+	6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9 };
+
+static const int16_t libfvalue_base32_neon_shifts[ 8 ] = {
+	-11, -6, -9, -4, -7, -10, -5, -8 };
+
+#endif /* defined( LIBFVALUE_BASE32_HAVE_SSSE3 ) */
+
+/* Sets a character in a string with the character size
+ */
+static void libfvalue_base32_set_character(
+             uint8_t *string,
+             uint8_t character_size,
+             size_t string_index,
+             uint8_t character )
+{
+	if( character_size == 1 )
+	{
+		string[ string_index ] = character;
+	}
+	else if( character_size == 2 )
+	{
+		( (uint16_t *) string )[ string_index ] = (uint16_t) character;
+	}
+	else
+	{
+		( (uint32_t *) string )[ string_index ] = (uint32_t) character;
+	}
+}
+
+/* Copies a byte stream into base32 characters
+ * The string must be of the character size and large enough to contain
+ * 8 characters for every 5 bytes or part thereof
+ */
+static void libfvalue_base32_copy_from_byte_stream(
+             uint8_t *string,
+             uint8_t character_size,
+             const uint8_t *byte_stream,
+             size_t byte_stream_size )
+{
+	size_t byte_stream_index     = 0;
+	size_t remaining_size        = 0;
+	size_t string_index          = 0;
+	uint64_t value_40bit         = 0;
+	uint8_t character_index      = 0;
+	uint8_t number_of_characters = 0;
+
+#if defined( LIBFVALUE_BASE32_HAVE_AVX2 )
+	__m256i characters_256bit    = _mm256_setzero_si256();
+
+#endif
+#if defined( LIBFVALUE_BASE32_HAVE_NEON )
+	uint16x8_t index_mask;
+	uint8x16_t byte_values;
+	uint8x16_t shuffle_indices1;
+	uint8x16_t shuffle_indices2;
+	int16x8_t shifts;
+#endif
+
+#if defined( LIBFVALUE_BASE32_HAVE_AVX2 )
+	/* The second lane is loaded from 10 bytes further, hence 26 bytes need to be available
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 26 )
+	{
+		characters_256bit = libfvalue_base32_bytes_to_characters_avx2(
+		                     _mm256_inserti128_si256(
+		                      _mm256_castsi128_si256(
+		                       _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index ] ) ) ),
+		                      _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index + 10 ] ) ),
+		                      1 ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 _mm256_castsi256_si128( characters_256bit ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 16 ) * character_size ] ),
+		 character_size,
+		 _mm256_extracti128_si256( characters_256bit, 1 ) );
+
+		byte_stream_index += 20;
+		string_index      += 32;
+	}
+#endif
+#if defined( LIBFVALUE_BASE32_HAVE_SSSE3 )
+	/* Only 10 of the 16 bytes loaded are converted
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 libfvalue_base32_bytes_to_characters(
+		  _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index ] ) ) ) );
+
+		byte_stream_index += 10;
+		string_index      += 16;
+	}
+#elif defined( LIBFVALUE_BASE32_HAVE_NEON )
+	shuffle_indices1 = vld1q_u8( &( libfvalue_base32_neon_shuffle_indices[ 0 ] ) );
+	shuffle_indices2 = vld1q_u8( &( libfvalue_base32_neon_shuffle_indices[ 16 ] ) );
+	shifts           = vld1q_s16( libfvalue_base32_neon_shifts );
+	index_mask       = vdupq_n_u16( 0x1f );
+
+	/* Only 10 of the 16 bytes loaded are converted
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		byte_values = vld1q_u8(
+		               &( byte_stream[ byte_stream_index ] ) );
+
+		byte_values = vcombine_u8(
+		               vmovn_u16(
+		                vandq_u16(
+		                 vshlq_u16(
+		                  vreinterpretq_u16_u8( vqtbl1q_u8( byte_values, shuffle_indices1 ) ),
+		                  shifts ),
+		                 index_mask ) ),
+		               vmovn_u16(
+		                vandq_u16(
+		                 vshlq_u16(
+		                  vreinterpretq_u16_u8( vqtbl1q_u8( byte_values, shuffle_indices2 ) ),
+		                  shifts ),
+		                 index_mask ) ) );
+
+		/* Indices 26 - 31 are moved from after 'Z' to the digit range
+		 */
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 vsubq_u8(
+		  vaddq_u8(
+		   byte_values,
+		   vdupq_n_u8( (uint8_t) 'A' ) ),
+		  vandq_u8(
+		   vcgtq_u8( byte_values, vdupq_n_u8( 25 ) ),
+		   vdupq_n_u8( (uint8_t) ( 'A' + 26 - '2' ) ) ) ) );
+
+		byte_stream_index += 10;
+		string_index      += 16;
+	}
+#endif /* defined( LIBFVALUE_BASE32_HAVE_SSSE3 ) */
+
+	while( byte_stream_index < byte_stream_size )
+	{
+		remaining_size = byte_stream_size - byte_stream_index;
+
+		if( remaining_size >= 5 )
+		{
+			number_of_characters = 8;
+			remaining_size       = 5;
+		}
+		else
+		{
+			number_of_characters = libfvalue_base32_remainder_number_of_characters[ remaining_size ];
+		}
+		value_40bit = 0;
+
+		for( character_index = 0;
+		     character_index < 5;
+		     character_index++ )
+		{
+			value_40bit <<= 8;
+
+			if( character_index < remaining_size )
+			{
+				value_40bit |= byte_stream[ byte_stream_index + character_index ];
+			}
+		}
+		for( character_index = 0;
+		     character_index < 8;
+		     character_index++ )
+		{
+			if( character_index < number_of_characters )
+			{
+				libfvalue_base32_set_character(
+				 string,
+				 character_size,
+				 string_index++,
+				 libfvalue_base32_characters[ ( value_40bit >> ( 35 - ( 5 * character_index ) ) ) & 0x1f ] );
+			}
+			else
+			{
+				libfvalue_base32_set_character(
+				 string,
+				 character_size,
+				 string_index++,
+				 (uint8_t) '=' );
+			}
+		}
+		byte_stream_index += remaining_size;
+	}
+}
+
+/* Determines the size of a base32 encoded string of a byte stream
+ * The size does not include an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base32_string_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_base32_string_size_from_byte_stream";
+
+	if( byte_stream_size > (size_t) ( ( SSIZE_MAX / 8 ) * 5 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = ( ( byte_stream_size + 4 ) / 5 ) * 8;
+
+	return( 1 );
+}
+
+/* Copies a byte stream into a base32 encoded string with the character size
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The string is padded but not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base32_string_with_index_copy_from_byte_stream(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvalue_base32_string_with_index_copy_from_byte_stream";
+	size_t base32_size       = 0;
+	size_t safe_string_index = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) ( SSIZE_MAX / character_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index > string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_base32_string_size_from_byte_stream(
+	     byte_stream_size,
+	     &base32_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base32 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( base32_size > ( string_size - safe_string_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string size too small.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_base32_copy_from_byte_stream(
+	 &( string[ safe_string_index * character_size ] ),
+	 character_size,
+	 byte_stream,
+	 byte_stream_size );
+
+	*string_index = safe_string_index + base32_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,565 @@
+/*
+ * Base64 functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSSE3__ )
+#include <tmmintrin.h>
+
+#define LIBFVALUE_BASE64_HAVE_SSSE3
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+
+#define LIBFVALUE_BASE64_HAVE_AVX2
+
+#endif
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#include <arm_neon.h>
+
+#define LIBFVALUE_BASE64_HAVE_NEON
+
+#endif
+
+#include "libfvalue_base64.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_simd.h"
+
+/* The base64 kernels convert 24 bytes into 32 characters at a time
+ * using AVX2, 12 bytes into 16 characters using SSSE3 or 48 bytes into
+ * 64 characters using NEON if available. The bytes are spread into 6-bit
+ * indices by shuffling and multiplying and the indices are translated into
+ * characters by adding the offset of their range in the alphabet.
+ *
+ * The remaining bytes, or all bytes if no vector instructions are available,
+ * are converted using a character table. The last 1 or 2 bytes are padded.
+ */
+
+static const uint8_t libfvalue_base64_characters[ 64 ] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+	'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+	'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/' };
+
+#if defined( LIBFVALUE_BASE64_HAVE_SSSE3 )
+
+/* Converts the first 12 bytes of a vector into 16 characters
+ */
+static __m128i libfvalue_base64_bytes_to_characters(
+                __m128i byte_values )
+{
+	__m128i indices = _mm_setzero_si128();
+	__m128i offsets = _mm_setzero_si128();
+
+	/* Every 32-bit element contains the bytes 1, 0, 2, 1 of a group of 3 bytes
+	 * so that every 16-bit half contains 2 of the 6-bit indices
+	 */
+	byte_values = _mm_shuffle_epi8(
+	               byte_values,
+	               _mm_setr_epi8( 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 ) );
+
+	/* Index 0 and 2 are moved to the lower bits of their byte by a multiply high
+	 * and index 1 and 3 to the upper bits of their byte by a multiply low
+	 */
+	indices = _mm_or_si128(
+	           _mm_mulhi_epu16(
+	            _mm_and_si128( byte_values, _mm_set1_epi32( 0x0fc0fc00UL ) ),
+	            _mm_set1_epi32( 0x04000040UL ) ),
+	           _mm_mullo_epi16(
+	            _mm_and_si128( byte_values, _mm_set1_epi32( 0x003f03f0UL ) ),
+	            _mm_set1_epi32( 0x01000010UL ) ) );
+
+	/* Indices 0 - 25 map onto offset 13, indices 26 - 51 onto offset 0,
+	 * indices 52 - 61 onto offsets 1 - 10 and indices 62 and 63 onto
+	 * offsets 11 and 12
+	 */
+	offsets = _mm_or_si128(
+	           _mm_subs_epu8( indices, _mm_set1_epi8( 51 ) ),
+	           _mm_and_si128(
+	            _mm_cmpgt_epi8( _mm_set1_epi8( 26 ), indices ),
+	            _mm_set1_epi8( 13 ) ) );
+
+	return( _mm_add_epi8(
+	         indices,
+	         _mm_shuffle_epi8(
+	          _mm_setr_epi8( 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 ),
+	          offsets ) ) );
+}
+
+#if defined( LIBFVALUE_BASE64_HAVE_AVX2 )
+
+/* Converts the first 12 bytes of both 128-bit lanes of a vector into 32 characters
+ */
+static __m256i libfvalue_base64_bytes_to_characters_avx2(
+                __m256i byte_values )
+{
+	__m256i indices = _mm256_setzero_si256();
+	__m256i offsets = _mm256_setzero_si256();
+
+	byte_values = _mm256_shuffle_epi8(
+	               byte_values,
+	               _mm256_setr_epi8( 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+	                                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 ) );
+
+	indices = _mm256_or_si256(
+	           _mm256_mulhi_epu16(
+	            _mm256_and_si256( byte_values, _mm256_set1_epi32( 0x0fc0fc00UL ) ),
+	            _mm256_set1_epi32( 0x04000040UL ) ),
+	           _mm256_mullo_epi16(
+	            _mm256_and_si256( byte_values, _mm256_set1_epi32( 0x003f03f0UL ) ),
+	            _mm256_set1_epi32( 0x01000010UL ) ) );
+
+	offsets = _mm256_or_si256(
+	           _mm256_subs_epu8( indices, _mm256_set1_epi8( 51 ) ),
+	           _mm256_and_si256(
+	            _mm256_cmpgt_epi8( _mm256_set1_epi8( 26 ), indices ),
+	            _mm256_set1_epi8( 13 ) ) );
+
+	return( _mm256_add_epi8(
+	         indices,
+	         _mm256_shuffle_epi8(
+	          _mm256_setr_epi8( 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+	                            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 ),
+	          offsets ) ) );
+}
+
+#endif /* defined( LIBFVALUE_BASE64_HAVE_AVX2 ) */
+
+#endif /* defined( LIBFVALUE_BASE64_HAVE_SSSE3 ) */
+
+/* Sets a character in a string with the character size
+ */
+static void libfvalue_base64_set_character(
+             uint8_t *string,
+             uint8_t character_size,
+             size_t string_index,
+             uint8_t character )
+{
+	if( character_size == 1 )
+	{
+		string[ string_index ] = character;
+	}
+	else if( character_size == 2 )
+	{
+		( (uint16_t *) string )[ string_index ] = (uint16_t) character;
+	}
+	else
+	{
+		( (uint32_t *) string )[ string_index ] = (uint32_t) character;
+	}
+}
+
+/* Copies a byte stream into base64 characters
+ * The string must be of the character size and large enough to contain
+ * 4 characters for every 3 bytes or part thereof
+ */
+static void libfvalue_base64_copy_from_byte_stream(
+             uint8_t *string,
+             uint8_t character_size,
+             const uint8_t *byte_stream,
+             size_t byte_stream_size )
+{
+	size_t byte_stream_index = 0;
+	size_t string_index      = 0;
+	uint32_t value_24bit     = 0;
+
+#if defined( LIBFVALUE_BASE64_HAVE_AVX2 )
+	__m256i characters_256bit = _mm256_setzero_si256();
+
+#endif
+#if defined( LIBFVALUE_BASE64_HAVE_NEON )
+	uint8x16x4_t characters_table;
+	uint8x16x3_t byte_values;
+	uint8x16_t characters1;
+	uint8x16_t characters2;
+	uint8x16_t characters3;
+	uint8x16_t characters4;
+	uint8x16_t interleaved_characters1;
+	uint8x16_t interleaved_characters2;
+	uint8x16_t interleaved_characters3;
+	uint8x16_t interleaved_characters4;
+#endif
+
+#if defined( LIBFVALUE_BASE64_HAVE_AVX2 )
+	/* The second lane is loaded from 12 bytes further, hence 28 bytes need to be available
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 28 )
+	{
+		characters_256bit = libfvalue_base64_bytes_to_characters_avx2(
+		                     _mm256_inserti128_si256(
+		                      _mm256_castsi128_si256(
+		                       _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index ] ) ) ),
+		                      _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index + 12 ] ) ),
+		                      1 ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 _mm256_castsi256_si128( characters_256bit ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 16 ) * character_size ] ),
+		 character_size,
+		 _mm256_extracti128_si256( characters_256bit, 1 ) );
+
+		byte_stream_index += 24;
+		string_index      += 32;
+	}
+#endif
+#if defined( LIBFVALUE_BASE64_HAVE_SSSE3 )
+	/* Only 12 of the 16 bytes loaded are converted
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 libfvalue_base64_bytes_to_characters(
+		  _mm_loadu_si128( (__m128i *) &( byte_stream[ byte_stream_index ] ) ) ) );
+
+		byte_stream_index += 12;
+		string_index      += 16;
+	}
+#elif defined( LIBFVALUE_BASE64_HAVE_NEON )
+	characters_table.val[ 0 ] = vld1q_u8( &( libfvalue_base64_characters[ 0 ] ) );
+	characters_table.val[ 1 ] = vld1q_u8( &( libfvalue_base64_characters[ 16 ] ) );
+	characters_table.val[ 2 ] = vld1q_u8( &( libfvalue_base64_characters[ 32 ] ) );
+	characters_table.val[ 3 ] = vld1q_u8( &( libfvalue_base64_characters[ 48 ] ) );
+
+	while( ( byte_stream_size - byte_stream_index ) >= 48 )
+	{
+		/* The bytes are loaded de-interleaved, the first, second and
+		 * third byte of the 16 groups of 3 bytes each in a vector
+		 */
+		byte_values = vld3q_u8(
+		               &( byte_stream[ byte_stream_index ] ) );
+
+		characters1 = vqtbl4q_u8(
+		               characters_table,
+		               vshrq_n_u8( byte_values.val[ 0 ], 2 ) );
+
+		characters2 = vqtbl4q_u8(
+		               characters_table,
+		               vandq_u8(
+		                vorrq_u8(
+		                 vshlq_n_u8( byte_values.val[ 0 ], 4 ),
+		                 vshrq_n_u8( byte_values.val[ 1 ], 4 ) ),
+		                vdupq_n_u8( 0x3f ) ) );
+
+		characters3 = vqtbl4q_u8(
+		               characters_table,
+		               vandq_u8(
+		                vorrq_u8(
+		                 vshlq_n_u8( byte_values.val[ 1 ], 2 ),
+		                 vshrq_n_u8( byte_values.val[ 2 ], 6 ) ),
+		                vdupq_n_u8( 0x3f ) ) );
+
+		characters4 = vqtbl4q_u8(
+		               characters_table,
+		               vandq_u8(
+		                byte_values.val[ 2 ],
+		                vdupq_n_u8( 0x3f ) ) );
+
+		/* Interleave the characters of the 16 groups into 64 consecutive characters
+		 */
+		interleaved_characters1 = vzip1q_u8( characters1, characters2 );
+		interleaved_characters2 = vzip2q_u8( characters1, characters2 );
+		interleaved_characters3 = vzip1q_u8( characters3, characters4 );
+		interleaved_characters4 = vzip2q_u8( characters3, characters4 );
+
+		libfvalue_simd_store_characters(
+		 &( string[ string_index * character_size ] ),
+		 character_size,
+		 vreinterpretq_u8_u16(
+		  vzip1q_u16(
+		   vreinterpretq_u16_u8( interleaved_characters1 ),
+		   vreinterpretq_u16_u8( interleaved_characters3 ) ) ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 16 ) * character_size ] ),
+		 character_size,
+		 vreinterpretq_u8_u16(
+		  vzip2q_u16(
+		   vreinterpretq_u16_u8( interleaved_characters1 ),
+		   vreinterpretq_u16_u8( interleaved_characters3 ) ) ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 32 ) * character_size ] ),
+		 character_size,
+		 vreinterpretq_u8_u16(
+		  vzip1q_u16(
+		   vreinterpretq_u16_u8( interleaved_characters2 ),
+		   vreinterpretq_u16_u8( interleaved_characters4 ) ) ) );
+
+		libfvalue_simd_store_characters(
+		 &( string[ ( string_index + 48 ) * character_size ] ),
+		 character_size,
+		 vreinterpretq_u8_u16(
+		  vzip2q_u16(
+		   vreinterpretq_u16_u8( interleaved_characters2 ),
+		   vreinterpretq_u16_u8( interleaved_characters4 ) ) ) );
+
+		byte_stream_index += 48;
+		string_index      += 64;
+	}
+#endif /* defined( LIBFVALUE_BASE64_HAVE_SSSE3 ) */
+
+	while( ( byte_stream_size - byte_stream_index ) >= 3 )
+	{
+		value_24bit = ( (uint32_t) byte_stream[ byte_stream_index ] << 16 )
+		            | ( (uint32_t) byte_stream[ byte_stream_index + 1 ] << 8 )
+		            | byte_stream[ byte_stream_index + 2 ];
+
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ value_24bit >> 18 ] );
+
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ ( value_24bit >> 12 ) & 0x3f ] );
+
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ ( value_24bit >> 6 ) & 0x3f ] );
+
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ value_24bit & 0x3f ] );
+
+		byte_stream_index += 3;
+	}
+	if( byte_stream_index < byte_stream_size )
+	{
+		value_24bit = (uint32_t) byte_stream[ byte_stream_index ] << 16;
+
+		if( ( byte_stream_index + 1 ) < byte_stream_size )
+		{
+			value_24bit |= (uint32_t) byte_stream[ byte_stream_index + 1 ] << 8;
+		}
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ value_24bit >> 18 ] );
+
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index++,
+		 libfvalue_base64_characters[ ( value_24bit >> 12 ) & 0x3f ] );
+
+		if( ( byte_stream_index + 1 ) < byte_stream_size )
+		{
+			libfvalue_base64_set_character(
+			 string,
+			 character_size,
+			 string_index++,
+			 libfvalue_base64_characters[ ( value_24bit >> 6 ) & 0x3f ] );
+		}
+		else
+		{
+			libfvalue_base64_set_character(
+			 string,
+			 character_size,
+			 string_index++,
+			 (uint8_t) '=' );
+		}
+		libfvalue_base64_set_character(
+		 string,
+		 character_size,
+		 string_index,
+		 (uint8_t) '=' );
+	}
+}
+
+/* Determines the size of a base64 encoded string of a byte stream
+ * The size does not include an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base64_string_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_base64_string_size_from_byte_stream";
+
+	if( byte_stream_size > (size_t) ( ( SSIZE_MAX / 4 ) * 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = ( ( byte_stream_size + 2 ) / 3 ) * 4;
+
+	return( 1 );
+}
+
+/* Copies a byte stream into a base64 encoded string with the character size
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The string is padded but not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_base64_string_with_index_copy_from_byte_stream(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvalue_base64_string_with_index_copy_from_byte_stream";
+	size_t base64_size       = 0;
+	size_t safe_string_index = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) ( SSIZE_MAX / character_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index > string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_base64_string_size_from_byte_stream(
+	     byte_stream_size,
+	     &base64_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base64 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( base64_size > ( string_size - safe_string_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string size too small.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_base64_copy_from_byte_stream(
+	 &( string[ safe_string_index * character_size ] ),
+	 character_size,
+	 byte_stream,
+	 byte_stream_size );
+
+	*string_index = safe_string_index + base64_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,53 @@
+/*
+ * Base64 functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_BASE64_H )
+#define _LIBFVALUE_BASE64_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfvalue_base64_string_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libfvalue_base64_string_with_index_copy_from_byte_stream(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_BASE64_H ) */
+
@@ -24,10 +24,13 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvalue_base16.h"
+#include "libfvalue_base32.h"
+#include "libfvalue_base64.h"
 #include "libfvalue_binary_data.h"
 #include "libfvalue_definitions.h"
 #include "libfvalue_libcerror.h"
-#include "libfvalue_libuna.h"
+#include "libfvalue_statistics.h"
 
 /* Creates a binary data
  * Make sure the value binary_data is referencing, is set to NULL
@@ -75,6 +78,10 @@ int libfvalue_binary_data_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_binary_data_t ) );
+
 	if( memory_set(
 	     *binary_data,
 	     0,
@@ -184,6 +191,10 @@ int libfvalue_binary_data_clone(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_binary_data_t ) );
+
 	if( memory_copy(
 	     *destination_binary_data,
 	     source_binary_data,
@@ -279,19 +290,17 @@ int libfvalue_binary_data_copy_from_byte_stream(
 	return( 1 );
 }
 
-/* Retrieves the size of an UTF-8 formatted string of the binary data
+/* Copies the binary data to a byte stream
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_binary_data_get_utf8_string_size(
+int libfvalue_binary_data_copy_to_byte_stream(
      libfvalue_binary_data_t *binary_data,
-     size_t *utf8_string_size,
-     uint32_t string_format_flags,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_get_utf8_string_size";
-	uint32_t format_flags       = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
+	static char *function = "libfvalue_binary_data_copy_to_byte_stream";
 
 	if( binary_data == NULL )
 	{
@@ -304,146 +313,93 @@ int libfvalue_binary_data_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( ( binary_data->data == NULL )
+	 && ( binary_data->data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_LOWER
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER;
-
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	string_format_type = string_format_flags & 0x000000ffUL;
-
-	if( ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64 ) )
+	if( encoding != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 "%s: unsupported encoding.",
 		 function );
 
 		return( -1 );
 	}
-	*utf8_string_size = 0;
+	if( byte_stream_size < binary_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
 
-	if( ( binary_data->data != NULL )
-	 && ( binary_data->data_size != 0 ) )
+		return( -1 );
+	}
+	if( ( binary_data->data_size > 0 )
+	 && ( binary_data->data != byte_stream ) )
 	{
-		switch( string_format_type )
+		if( memory_copy(
+		     byte_stream,
+		     binary_data->data,
+		     binary_data->data_size ) == NULL )
 		{
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-				if( libuna_base16_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf8_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-8 string of base16 formatted binary data.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-				if( libuna_base32_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf8_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-8 string of base32 formatted binary data.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-				if( libuna_base64_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf8_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-8 string of base64 formatted binary data.",
-					 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy binary data.",
+			 function );
 
-					return( -1 );
-				}
-				break;
+			return( -1 );
 		}
 	}
-	/* Add space for the end-of-string character
-	 */
-	*utf8_string_size += 1;
-
 	return( 1 );
 }
 
-/* Copies the binary data to an UTF-8 encoded string
+/* Retrieves the size of a byte stream of the binary data
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_binary_data_copy_to_utf8_string_with_index(
+int libfvalue_binary_data_get_byte_stream_size(
      libfvalue_binary_data_t *binary_data,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf8_string_index,
-     uint32_t string_format_flags,
+     size_t *byte_stream_size,
+     int encoding,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_copy_to_utf8_string_with_index";
-	uint32_t format_flags       = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
+	static char *function = "libfvalue_binary_data_get_byte_stream_size";
 
 	if( binary_data == NULL )
 	{
@@ -456,46 +412,81 @@ int libfvalue_binary_data_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( byte_stream_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid byte stream size.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( encoding != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_index == NULL )
+	*byte_stream_size = binary_data->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a string with the character size of the binary data
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The string size is in characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_binary_data_get_string_size(
+     libfvalue_binary_data_t *binary_data,
+     uint8_t character_size,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvalue_binary_data_get_string_size";
+	size_t safe_string_size     = 0;
+	uint32_t string_format_type = 0;
+	uint32_t supported_flags    = 0;
+
+	if( binary_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
+		 "%s: invalid binary data.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf8_string_index >= utf8_string_size )
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string is too small.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
 		 function );
 
 		return( -1 );
@@ -537,48 +528,21 @@ int libfvalue_binary_data_copy_to_utf8_string_with_index(
 		switch( string_format_type )
 		{
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-				if( libuna_base16_stream_with_index_copy_from_byte_stream(
-				     utf8_string,
-				     utf8_string_size,
-				     utf8_string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base16 formatted binary data to UTF-8 string.",
-					 function );
+				safe_string_size = binary_data->data_size * 2;
 
-					return( -1 );
-				}
 				break;
 
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-				if( libuna_base32_stream_with_index_copy_from_byte_stream(
-				     utf8_string,
-				     utf8_string_size,
-				     utf8_string_index,
-				     binary_data->data,
+				if( libfvalue_base32_string_size_from_byte_stream(
 				     binary_data->data_size,
-				     format_flags,
+				     &safe_string_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base32 formatted binary data to UTF-8 string.",
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine size of string of base32 formatted binary data.",
 					 function );
 
 					return( -1 );
@@ -586,24 +550,16 @@ int libfvalue_binary_data_copy_to_utf8_string_with_index(
 				break;
 
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-				if( libuna_base64_stream_with_index_copy_from_byte_stream(
-				     utf8_string,
-				     utf8_string_size,
-				     utf8_string_index,
-				     binary_data->data,
+				if( libfvalue_base64_string_size_from_byte_stream(
 				     binary_data->data_size,
-				     format_flags,
+				     &safe_string_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base64 formatted binary data to UTF-8 string.",
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine size of string of base64 formatted binary data.",
 					 function );
 
 					return( -1 );
@@ -611,26 +567,32 @@ int libfvalue_binary_data_copy_to_utf8_string_with_index(
 				break;
 		}
 	}
-	utf8_string[ *utf8_string_index ] = 0;
-
-	*utf8_string_index += 1;
+	/* Add space for the end-of-string character
+	 */
+	*string_size = safe_string_size + 1;
 
 	return( 1 );
 }
 
-/* Retrieves the size of an UTF-16 formatted string of the binary data
+/* Copies the binary data to a string with the character size
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The string size and index are in characters
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_binary_data_get_utf16_string_size(
+int libfvalue_binary_data_copy_to_string_with_index(
      libfvalue_binary_data_t *binary_data,
-     size_t *utf16_string_size,
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_get_utf16_string_size";
-	uint32_t format_flags       = 0;
+	static char *function       = "libfvalue_binary_data_copy_to_string_with_index";
+	size_t safe_string_index    = 0;
 	uint32_t string_format_type = 0;
 	uint32_t supported_flags    = 0;
+	uint8_t character_case      = LIBFVALUE_BASE16_CASE_UPPER;
 
 	if( binary_data == NULL )
 	{
@@ -643,13 +605,59 @@ int libfvalue_binary_data_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( utf16_string_size == NULL )
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) ( SSIZE_MAX / character_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string size.",
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index >= string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string is too small.",
 		 function );
 
 		return( -1 );
@@ -685,7 +693,7 @@ int libfvalue_binary_data_get_utf16_string_size(
 
 		return( -1 );
 	}
-	*utf16_string_size = 0;
+	safe_string_index = *string_index;
 
 	if( ( binary_data->data != NULL )
 	 && ( binary_data->data_size != 0 ) )
@@ -693,26 +701,25 @@ int libfvalue_binary_data_get_utf16_string_size(
 		switch( string_format_type )
 		{
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base16_stream_size_from_byte_stream(
+				if( ( string_format_flags & LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_LOWER ) != 0 )
+				{
+					character_case = LIBFVALUE_BASE16_CASE_LOWER;
+				}
+				if( libfvalue_base16_string_with_index_copy_from_byte_stream(
+				     string,
+				     character_size,
+				     string_size,
+				     &safe_string_index,
 				     binary_data->data,
 				     binary_data->data_size,
-				     utf16_string_size,
-				     format_flags,
+				     character_case,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-16 string of base16 formatted binary data.",
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy base16 formatted binary data to string.",
 					 function );
 
 					return( -1 );
@@ -720,27 +727,20 @@ int libfvalue_binary_data_get_utf16_string_size(
 				break;
 
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base32_stream_size_from_byte_stream(
+				if( libfvalue_base32_string_with_index_copy_from_byte_stream(
+				     string,
+				     character_size,
+				     string_size,
+				     &safe_string_index,
 				     binary_data->data,
 				     binary_data->data_size,
-				     utf16_string_size,
-				     format_flags,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-16 string of base32 formatted binary data.",
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy base32 formatted binary data to string.",
 					 function );
 
 					return( -1 );
@@ -748,252 +748,180 @@ int libfvalue_binary_data_get_utf16_string_size(
 				break;
 
 			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base64_stream_size_from_byte_stream(
+				if( libfvalue_base64_string_with_index_copy_from_byte_stream(
+				     string,
+				     character_size,
+				     string_size,
+				     &safe_string_index,
 				     binary_data->data,
 				     binary_data->data_size,
-				     utf16_string_size,
-				     format_flags,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-16 string of base64 formatted binary data.",
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy base64 formatted binary data to string.",
 					 function );
 
 					return( -1 );
 				}
 				break;
 		}
-		/* The size returned is the size of the byte stream and the size needed
-		 * should be the number of characters
-		 */
-		*utf16_string_size /= sizeof( uint16_t );
 	}
-	/* Add space for the end-of-string character
-	 */
-	*utf16_string_size += 1;
+	if( safe_string_index >= string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( character_size == 1 )
+	{
+		string[ safe_string_index ] = 0;
+	}
+	else if( character_size == 2 )
+	{
+		( (uint16_t *) string )[ safe_string_index ] = 0;
+	}
+	else
+	{
+		( (uint32_t *) string )[ safe_string_index ] = 0;
+	}
+	*string_index = safe_string_index + 1;
 
 	return( 1 );
 }
 
-/* Copies the binary data to an UTF-16 encoded string
+/* Retrieves the size of an UTF-8 formatted string of the binary data
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_binary_data_copy_to_utf16_string_with_index(
+int libfvalue_binary_data_get_utf8_string_size(
      libfvalue_binary_data_t *binary_data,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     size_t *utf16_string_index,
+     size_t *utf8_string_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_copy_to_utf16_string_with_index";
-	size_t string_index         = 0;
-	size_t string_size          = 0;
-	uint32_t format_flags       = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
+	static char *function = "libfvalue_binary_data_get_utf8_string_size";
 
-	if( binary_data == NULL )
+	if( libfvalue_binary_data_get_string_size(
+	     binary_data,
+	     1,
+	     utf8_string_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
-		 function );
+/* Copies the binary data to an UTF-8 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_binary_data_copy_to_utf8_string_with_index(
+     libfvalue_binary_data_t *binary_data,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_binary_data_copy_to_utf8_string_with_index";
 
-		return( -1 );
-	}
-	if( utf16_string_index == NULL )
+	if( libfvalue_binary_data_copy_to_string_with_index(
+	     binary_data,
+	     utf8_string,
+	     1,
+	     utf8_string_size,
+	     utf8_string_index,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary data to UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf16_string_index >= utf16_string_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string is too small.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_LOWER
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER;
+/* Retrieves the size of an UTF-16 formatted string of the binary data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_binary_data_get_utf16_string_size(
+     libfvalue_binary_data_t *binary_data,
+     size_t *utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_binary_data_get_utf16_string_size";
 
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	if( libfvalue_binary_data_get_string_size(
+	     binary_data,
+	     (uint8_t) sizeof( uint16_t ),
+	     utf16_string_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
 
 		return( -1 );
 	}
-	string_format_type = string_format_flags & 0x000000ffUL;
+	return( 1 );
+}
 
-	if( ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64 ) )
+/* Copies the binary data to an UTF-16 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_binary_data_copy_to_utf16_string_with_index(
+     libfvalue_binary_data_t *binary_data,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_binary_data_copy_to_utf16_string_with_index";
+
+	if( libfvalue_binary_data_copy_to_string_with_index(
+	     binary_data,
+	     (uint8_t *) utf16_string,
+	     (uint8_t) sizeof( uint16_t ),
+	     utf16_string_size,
+	     utf16_string_index,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary data to UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( binary_data->data != NULL )
-	 && ( binary_data->data_size != 0 ) )
-	{
-		string_index = *utf16_string_index * sizeof( uint16_t );
-		string_size  = utf16_string_size * sizeof( uint16_t );
-
-		switch( string_format_type )
-		{
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base16_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf16_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base16 formatted binary data to UTF-16 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base32_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf16_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base32 formatted binary data to UTF-16 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
-#else
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
-#endif
-				if( libuna_base64_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf16_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base64 formatted binary data to UTF-16 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-		}
-		*utf16_string_index = string_index / sizeof( uint16_t );
-	}
-	utf16_string[ *utf16_string_index ] = 0;
-
-	*utf16_string_index += 1;
-
 	return( 1 );
 }
 
@@ -1006,169 +934,24 @@ int libfvalue_binary_data_get_utf32_string_size(
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_get_utf32_string_size";
-	uint32_t format_flags       = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
+	static char *function = "libfvalue_binary_data_get_utf32_string_size";
 
-	if( binary_data == NULL )
+	if( libfvalue_binary_data_get_string_size(
+	     binary_data,
+	     (uint8_t) sizeof( uint32_t ),
+	     utf32_string_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf32_string_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string size.",
-		 function );
-
-		return( -1 );
-	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_LOWER
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER;
-
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
-
-		return( -1 );
-	}
-	string_format_type = string_format_flags & 0x000000ffUL;
-
-	if( ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	*utf32_string_size = 0;
-
-	if( ( binary_data->data != NULL )
-	 && ( binary_data->data_size != 0 ) )
-	{
-		switch( string_format_type )
-		{
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base16_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf32_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-32 string of base16 formatted binary data.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base32_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf32_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-32 string of base32 formatted binary data.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base64_stream_size_from_byte_stream(
-				     binary_data->data,
-				     binary_data->data_size,
-				     utf32_string_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of UTF-32 string of base64 formatted binary data.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-		}
-		/* The size returned is the size of the byte stream and the size needed
-		 * should be the number of characters
-		 */
-		*utf32_string_size /= sizeof( uint32_t );
-	}
-	/* Add space for the end-of-string character
-	 */
-	*utf32_string_size += 1;
-
 	return( 1 );
 }
 
@@ -1183,208 +966,26 @@ int libfvalue_binary_data_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_binary_data_copy_to_utf32_string_with_index";
-	size_t string_index         = 0;
-	size_t string_size          = 0;
-	uint32_t format_flags       = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
-
-	if( binary_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf32_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf32_string_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf32_string_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string index.",
-		 function );
-
-		return( -1 );
-	}
-	if( *utf32_string_index >= utf32_string_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-32 string is too small.",
-		 function );
-
-		return( -1 );
-	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_LOWER
-	                | LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER;
-
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
+	static char *function = "libfvalue_binary_data_copy_to_utf32_string_with_index";
 
-		return( -1 );
-	}
-	string_format_type = string_format_flags & 0x000000ffUL;
-
-	if( ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32 )
-	 && ( string_format_type != LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64 ) )
+	if( libfvalue_binary_data_copy_to_string_with_index(
+	     binary_data,
+	     (uint8_t *) utf32_string,
+	     (uint8_t) sizeof( uint32_t ),
+	     utf32_string_size,
+	     utf32_string_index,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary data to UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( binary_data->data != NULL )
-	 && ( binary_data->data_size != 0 ) )
-	{
-		string_index = *utf32_string_index * sizeof( uint32_t );
-		string_size  = utf32_string_size * sizeof( uint32_t );
-
-		switch( string_format_type )
-		{
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16:
-				format_flags = LIBUNA_BASE16_VARIANT_CASE_UPPER
-					     | LIBUNA_BASE16_VARIANT_CHARACTER_LIMIT_NONE;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE16_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base16_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf32_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base16 formatted binary data to UTF-32 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32:
-				format_flags = LIBUNA_BASE32_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE32_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE32_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE32_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base32_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf32_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base32 formatted binary data to UTF-32 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64:
-				format_flags = LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL
-					     | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE
-					     | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED;
-
-#if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF32_BIG_ENDIAN;
-#elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
-				format_flags |= LIBUNA_BASE64_VARIANT_ENCODING_UTF32_LITTLE_ENDIAN;
-#else
-#error "Unsupported middle-endian host byte-order"
-#endif
-				if( libuna_base64_stream_with_index_copy_from_byte_stream(
-				     (uint8_t *) utf32_string,
-				     string_size,
-				     &string_index,
-				     binary_data->data,
-				     binary_data->data_size,
-				     format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy base64 formatted binary data to UTF-32 string.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-		}
-		*utf32_string_index = string_index / sizeof( uint32_t );
-	}
-	utf32_string[ *utf32_string_index ] = 0;
-
-	*utf32_string_index += 1;
-
 	return( 1 );
 }
 
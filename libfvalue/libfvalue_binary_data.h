@@ -64,6 +64,35 @@ int libfvalue_binary_data_copy_from_byte_stream(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_binary_data_copy_to_byte_stream(
+     libfvalue_binary_data_t *binary_data,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_binary_data_get_byte_stream_size(
+     libfvalue_binary_data_t *binary_data,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_binary_data_get_string_size(
+     libfvalue_binary_data_t *binary_data,
+     uint8_t character_size,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libfvalue_binary_data_copy_to_string_with_index(
+     libfvalue_binary_data_t *binary_data,
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 int libfvalue_binary_data_get_utf8_string_size(
      libfvalue_binary_data_t *binary_data,
      size_t *utf8_string_size,
@@ -23,10 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvalue_arena.h"
 #include "libfvalue_data_handle.h"
 #include "libfvalue_definitions.h"
-#include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_types.h"
 #include "libfvalue_value_entry.h"
 
@@ -44,9 +45,46 @@ int libfvalue_data_handle_initialize(
             uint32_t data_flags,
             libcerror_error_t **error ),
      libcerror_error_t **error )
+{
+	static char *function = "libfvalue_data_handle_initialize";
+
+	if( libfvalue_data_handle_initialize_in_arena(
+	     data_handle,
+	     NULL,
+	     read_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a data handle in an arena
+ * Make sure the value data_handle is referencing, is set to NULL
+ * If arena is NULL the data handle is allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_data_handle_initialize_in_arena(
+     libfvalue_data_handle_t **data_handle,
+     libfvalue_arena_t *arena,
+     int (*read_value_entries)(
+            libfvalue_data_handle_t *data_handle,
+            const uint8_t *data,
+            size_t data_size,
+            int encoding,
+            uint32_t data_flags,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
 {
 	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
-	static char *function                                  = "libfvalue_data_handle_initialize";
+	static char *function                                  = "libfvalue_data_handle_initialize_in_arena";
 
 	if( data_handle == NULL )
 	{
@@ -70,8 +108,9 @@ int libfvalue_data_handle_initialize(
 
 		return( -1 );
 	}
-	internal_data_handle = memory_allocate_structure(
-	                        libfvalue_internal_data_handle_t );
+	internal_data_handle = (libfvalue_internal_data_handle_t *) libfvalue_arena_allocate_memory(
+	                                                             arena,
+	                                                             sizeof( libfvalue_internal_data_handle_t ) );
 
 	if( internal_data_handle == NULL )
 	{
@@ -84,6 +123,10 @@ int libfvalue_data_handle_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_DATA_HANDLE,
+	 sizeof( libfvalue_internal_data_handle_t ) );
+
 	if( memory_set(
 	     internal_data_handle,
 	     0,
@@ -99,6 +142,7 @@ int libfvalue_data_handle_initialize(
 		goto on_error;
 	}
 	internal_data_handle->read_value_entries = read_value_entries;
+	internal_data_handle->arena              = arena;
 
 	*data_handle = (libfvalue_data_handle_t *) internal_data_handle;
 
@@ -107,7 +151,8 @@ int libfvalue_data_handle_initialize(
 on_error:
 	if( internal_data_handle != NULL )
 	{
-		memory_free(
+		libfvalue_arena_free_memory(
+		 arena,
 		 internal_data_handle );
 	}
 	return( -1 );
@@ -122,7 +167,6 @@ int libfvalue_data_handle_free(
 {
 	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
 	static char *function                                  = "libfvalue_data_handle_free";
-	int result                                             = 1;
 
 	if( data_handle == NULL )
 	{
@@ -140,35 +184,28 @@ int libfvalue_data_handle_free(
 		internal_data_handle = (libfvalue_internal_data_handle_t *) *data_handle;
 		*data_handle         = NULL;
 
-		if( internal_data_handle->value_entries != NULL )
+		/* The memory of a data handle in an arena is released when the arena is reset
+		 */
+		if( internal_data_handle->arena == NULL )
 		{
-			if( libcdata_array_free(
-			     &( internal_data_handle->value_entries ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_entry_free,
-			     error ) != 1 )
+			if( internal_data_handle->value_entries != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free value entries array.",
-				 function );
-
-				result = -1;
+				memory_free(
+				 internal_data_handle->value_entries );
 			}
-		}
-		if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
-		{
-			if( internal_data_handle->data != NULL )
+			if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
 			{
-				memory_free(
-				 internal_data_handle->data );
+				if( internal_data_handle->data != NULL )
+				{
+					memory_free(
+					 internal_data_handle->data );
+				}
 			}
+			memory_free(
+			 internal_data_handle );
 		}
-		memory_free(
-		 internal_data_handle );
 	}
-	return( result );
+	return( 1 );
 }
 
 /* Clones a data handle
@@ -179,8 +216,9 @@ int libfvalue_data_handle_clone(
      libfvalue_data_handle_t *source_data_handle,
      libcerror_error_t **error )
 {
-	libfvalue_internal_data_handle_t *internal_source_data_handle = NULL;
-	static char *function                                         = "libfvalue_data_handle_clone";
+	libfvalue_internal_data_handle_t *internal_destination_data_handle = NULL;
+	libfvalue_internal_data_handle_t *internal_source_data_handle      = NULL;
+	static char *function                                              = "libfvalue_data_handle_clone";
 
 	if( destination_data_handle == NULL )
 	{
@@ -256,25 +294,45 @@ int libfvalue_data_handle_clone(
 			goto on_error;
 		}
 	}
-	if( internal_source_data_handle->value_entries != NULL )
+	internal_destination_data_handle = (libfvalue_internal_data_handle_t *) *destination_data_handle;
+
+	internal_destination_data_handle->value_entry.offset = internal_source_data_handle->value_entry.offset;
+	internal_destination_data_handle->value_entry.size   = internal_source_data_handle->value_entry.size;
+
+	if( ( internal_source_data_handle->value_entries != NULL )
+	 && ( internal_source_data_handle->number_of_value_entries > 0 ) )
 	{
-		if( libcdata_array_clone(
-		     &( ( (libfvalue_internal_data_handle_t *) *destination_data_handle )->value_entries ),
-		     internal_source_data_handle->value_entries,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_entry_free,
-		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_value_entry_clone,
+		if( libfvalue_internal_data_handle_resize_value_entries(
+		     internal_destination_data_handle,
+		     internal_source_data_handle->number_of_value_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination value entries array.",
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize destination value entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_destination_data_handle->value_entries,
+		     internal_source_data_handle->value_entries,
+		     sizeof( libfvalue_value_entry_t ) * internal_source_data_handle->number_of_value_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value entries.",
 			 function );
 
 			goto on_error;
 		}
 	}
+	internal_destination_data_handle->number_of_value_entries = internal_source_data_handle->number_of_value_entries;
+
 	return( 1 );
 
 on_error:
@@ -312,33 +370,31 @@ int libfvalue_data_handle_clear(
 
 	if( internal_data_handle->value_entries != NULL )
 	{
-		if( libcdata_array_empty(
-		     internal_data_handle->value_entries,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_entry_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty value instances array.",
-			 function );
+		libfvalue_arena_free_memory(
+		 internal_data_handle->arena,
+		 internal_data_handle->value_entries );
 
-			return( -1 );
-		}
+		internal_data_handle->value_entries = NULL;
 	}
+	internal_data_handle->value_entry.offset                = 0;
+	internal_data_handle->value_entry.size                  = 0;
+	internal_data_handle->number_of_value_entries           = 0;
+	internal_data_handle->number_of_allocated_value_entries = 0;
+
 	if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
 	{
 		if( internal_data_handle->data != NULL )
 		{
-			memory_free(
+			libfvalue_arena_free_memory(
+			 internal_data_handle->arena,
 			 internal_data_handle->data );
 		}
 	}
-	internal_data_handle->data       = NULL;
-	internal_data_handle->data_size  = 0;
-	internal_data_handle->encoding   = 0;
-	internal_data_handle->data_flags = 0;
+	internal_data_handle->data                = NULL;
+	internal_data_handle->data_size           = 0;
+	internal_data_handle->data_allocated_size = 0;
+	internal_data_handle->encoding            = 0;
+	internal_data_handle->data_flags          = 0;
 
 	return( 1 );
 }
@@ -476,11 +532,35 @@ int libfvalue_data_handle_set_data(
 
 		return( -1 );
 	}
+	if( ( internal_data_handle->arena != NULL )
+	 && ( data != NULL )
+	 && ( ( flags & LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE ) != 0 )
+	 && ( ( flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 ) )
+	{
+		/* The data is freed when the arena is reset
+		 */
+		if( libfvalue_arena_append_cleanup(
+		     internal_data_handle->arena,
+		     (intptr_t *) data,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data to arena cleanups.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
 	{
 		if( internal_data_handle->data != NULL )
 		{
-			memory_free(
+			libfvalue_arena_free_memory(
+			 internal_data_handle->arena,
 			 internal_data_handle->data );
 
 			internal_data_handle->data      = NULL;
@@ -506,7 +586,8 @@ int libfvalue_data_handle_set_data(
 	}
 	else
 	{
-		internal_data_handle->data = (uint8_t *) memory_allocate(
+		internal_data_handle->data = (uint8_t *) libfvalue_arena_allocate_memory(
+		                                          internal_data_handle->arena,
 		                                          sizeof( uint8_t ) * data_size );
 
 		if( internal_data_handle->data == NULL )
@@ -520,6 +601,10 @@ int libfvalue_data_handle_set_data(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_DATA_HANDLE,
+		 sizeof( uint8_t ) * data_size );
+
 		if( memory_copy(
 		     internal_data_handle->data,
 		     data,
@@ -536,15 +621,17 @@ int libfvalue_data_handle_set_data(
 		}
 		internal_data_handle->flags |= LIBFVALUE_VALUE_DATA_FLAG_MANAGED;
 	}
-	internal_data_handle->data_size = data_size;
-	internal_data_handle->encoding  = encoding;
+	internal_data_handle->data_size           = data_size;
+	internal_data_handle->data_allocated_size = 0;
+	internal_data_handle->encoding            = encoding;
 
 	return( 1 );
 
 on_error:
 	if( internal_data_handle->data != NULL )
 	{
-		memory_free(
+		libfvalue_arena_free_memory(
+		 internal_data_handle->arena,
 		 internal_data_handle->data );
 
 		internal_data_handle->data = NULL;
@@ -614,7 +701,8 @@ int libfvalue_data_handle_set_data_as_clone(
 	{
 		if( internal_data_handle->data != NULL )
 		{
-			memory_free(
+			libfvalue_arena_free_memory(
+			 internal_data_handle->arena,
 			 internal_data_handle->data );
 
 			internal_data_handle->data      = NULL;
@@ -631,7 +719,8 @@ int libfvalue_data_handle_set_data_as_clone(
 	}
 	else
 	{
-		internal_data_handle->data = (uint8_t *) memory_allocate(
+		internal_data_handle->data = (uint8_t *) libfvalue_arena_allocate_memory(
+		                                          internal_data_handle->arena,
 		                                          sizeof( uint8_t ) * data_size );
 
 		if( internal_data_handle->data == NULL )
@@ -645,6 +734,10 @@ int libfvalue_data_handle_set_data_as_clone(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_DATA_HANDLE,
+		 sizeof( uint8_t ) * data_size );
+
 		if( memory_copy(
 		     internal_data_handle->data,
 		     data,
@@ -661,15 +754,17 @@ int libfvalue_data_handle_set_data_as_clone(
 		}
 		internal_data_handle->flags |= LIBFVALUE_VALUE_DATA_FLAG_MANAGED;
 	}
-	internal_data_handle->data_size = data_size;
-	internal_data_handle->encoding  = encoding;
+	internal_data_handle->data_size           = data_size;
+	internal_data_handle->data_allocated_size = 0;
+	internal_data_handle->encoding            = encoding;
 
 	return( 1 );
 
 on_error:
 	if( internal_data_handle->data != NULL )
 	{
-		memory_free(
+		libfvalue_arena_free_memory(
+		 internal_data_handle->arena,
 		 internal_data_handle->data );
 
 		internal_data_handle->data = NULL;
@@ -701,8 +796,9 @@ static void libfvalue_internal_data_handle_set_data_as_owned(
 		internal_data_handle->data   = *data;
 		internal_data_handle->flags |= LIBFVALUE_VALUE_DATA_FLAG_MANAGED;
 	}
-	internal_data_handle->data_size = data_size;
-	internal_data_handle->encoding  = encoding;
+	internal_data_handle->data_size           = data_size;
+	internal_data_handle->data_allocated_size = 0;
+	internal_data_handle->encoding            = encoding;
 
 	*data = NULL;
 }
@@ -778,11 +874,33 @@ int libfvalue_data_handle_set_data_as_owned(
 			return( -1 );
 		}
 	}
+	if( ( internal_data_handle->arena != NULL )
+	 && ( *data != NULL ) )
+	{
+		/* The data is freed when the arena is reset
+		 */
+		if( libfvalue_arena_append_cleanup(
+		     internal_data_handle->arena,
+		     (intptr_t *) *data,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data to arena cleanups.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
 	{
 		if( internal_data_handle->data != NULL )
 		{
-			memory_free(
+			libfvalue_arena_free_memory(
+			 internal_data_handle->arena,
 			 internal_data_handle->data );
 
 			internal_data_handle->data      = NULL;
@@ -799,6 +917,38 @@ int libfvalue_data_handle_set_data_as_owned(
 	return( 1 );
 }
 
+/* Determines if the data is managed by the data handle
+ * Data that is not managed is owned by the caller, e.g. a memory mapped file,
+ * and remains available during the life-time of the data handle
+ * Returns 1 if the data is managed, 0 if not or -1 on error
+ */
+int libfvalue_data_handle_is_data_managed(
+     libfvalue_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
+	static char *function                                  = "libfvalue_data_handle_is_data_managed";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_handle = (libfvalue_internal_data_handle_t *) data_handle;
+
+	if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
 /* Retrieves the data flags
  * Returns 1 if successful or -1 on error
  */
@@ -907,26 +1057,13 @@ int libfvalue_data_handle_get_number_of_value_entries(
 	{
 		*number_of_value_entries = 0;
 	}
-	else if( internal_data_handle->value_entries == NULL )
+	else if( internal_data_handle->number_of_value_entries == 0 )
 	{
 		*number_of_value_entries = 1;
 	}
 	else
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_data_handle->value_entries,
-		     number_of_value_entries,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from value entries array.",
-			 function );
-
-			return( -1 );
-		}
+		*number_of_value_entries = internal_data_handle->number_of_value_entries;
 	}
 	return( 1 );
 }
@@ -991,40 +1128,32 @@ int libfvalue_data_handle_get_value_entry(
 
 		return( -1 );
 	}
-	if( internal_data_handle->value_entries == NULL )
+	if( internal_data_handle->number_of_value_entries == 0 )
 	{
 		*value_entry_offset = 0;
 		*value_entry_size   = internal_data_handle->data_size;
 	}
 	else
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_data_handle->value_entries,
-		     value_entry_index,
-		     (intptr_t **) &value_entry,
-		     error ) != 1 )
+		if( ( value_entry_index < 0 )
+		 || ( value_entry_index >= internal_data_handle->number_of_value_entries ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from values entries array.",
-			 function,
-			 value_entry_index );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value entry index value out of bounds.",
+			 function );
 
 			return( -1 );
 		}
-		if( value_entry == NULL )
+		if( internal_data_handle->value_entries == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing value entry: %d.",
-			 function,
-			 value_entry_index );
-
-			return( -1 );
+			value_entry = &( internal_data_handle->value_entry );
+		}
+		else
+		{
+			value_entry = &( ( internal_data_handle->value_entries )[ value_entry_index ] );
 		}
 		*value_entry_offset = value_entry->offset;
 		*value_entry_size   = value_entry->size;
@@ -1126,111 +1255,45 @@ int libfvalue_data_handle_set_value_entry(
 
 		return( -1 );
 	}
-	if( internal_data_handle->value_entries == NULL )
+	if( internal_data_handle->number_of_value_entries == 0 )
 	{
-		if( value_entry_index != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid value index value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
 		if( ( value_entry_offset != 0 )
 		 || ( value_entry_size != internal_data_handle->data_size ) )
 		{
-			if( libfvalue_value_entry_initialize(
-			     &value_entry,
-			     error ) != 1 )
+			if( internal_data_handle->value_entries == NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create value entry.",
-				 function );
-
-				return( -1 );
+				value_entry = &( internal_data_handle->value_entry );
 			}
-			value_entry->offset = value_entry_offset;
-			value_entry->size   = value_entry_size;
-
-			if( libcdata_array_initialize(
-			     &( internal_data_handle->value_entries ),
-			     1,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create value entries array.",
-				 function );
-
-				libfvalue_value_entry_free(
-				 &value_entry,
-				 NULL );
-
-				return( -1 );
+				value_entry = internal_data_handle->value_entries;
 			}
-			if( libcdata_array_set_entry_by_index(
-			     internal_data_handle->value_entries,
-			     0,
-			     (intptr_t *) value_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set entry: 0 in values entries array.",
-				 function );
-
-				libfvalue_value_entry_free(
-				 &value_entry,
-				 NULL );
-
-				libcdata_array_free(
-				 &( internal_data_handle->value_entries ),
-				 NULL,
-				 NULL );
+			value_entry->offset = value_entry_offset;
+			value_entry->size   = value_entry_size;
 
-				return( -1 );
-			}
-			value_entry = NULL;
+			internal_data_handle->number_of_value_entries = 1;
 		}
 	}
 	else
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_data_handle->value_entries,
-		     value_entry_index,
-		     (intptr_t **) &value_entry,
-		     error ) != 1 )
+		if( value_entry_index >= internal_data_handle->number_of_value_entries )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from values entries array.",
-			 function,
-			 value_entry_index );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value entry index value out of bounds.",
+			 function );
 
 			return( -1 );
 		}
-		if( value_entry == NULL )
+		if( internal_data_handle->value_entries == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing value entry.",
-			 function );
-
-			return( -1 );
+			value_entry = &( internal_data_handle->value_entry );
+		}
+		else
+		{
+			value_entry = &( ( internal_data_handle->value_entries )[ value_entry_index ] );
 		}
 		value_entry->offset = value_entry_offset;
 		value_entry->size   = value_entry_size;
@@ -1249,7 +1312,6 @@ int libfvalue_data_handle_append_value_entry(
      libcerror_error_t **error )
 {
 	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
-	libfvalue_value_entry_t *value_entry                   = NULL;
 	static char *function                                  = "libfvalue_data_handle_append_value_entry";
 
 	if( data_handle == NULL )
@@ -1321,66 +1383,23 @@ int libfvalue_data_handle_append_value_entry(
 
 		return( -1 );
 	}
-	if( internal_data_handle->value_entries == NULL )
-	{
-		if( libcdata_array_initialize(
-		     &( internal_data_handle->value_entries ),
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value entries array.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( libfvalue_value_entry_initialize(
-	     &value_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create value entry.",
-		 function );
-
-		goto on_error;
-	}
-	value_entry->offset = value_entry_offset;
-	value_entry->size   = value_entry_size;
-
-	if( libcdata_array_append_entry(
-	     internal_data_handle->value_entries,
+	if( libfvalue_internal_data_handle_append_value_entry(
+	     internal_data_handle,
 	     value_entry_index,
-	     (intptr_t *) value_entry,
+	     value_entry_offset,
+	     value_entry_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append entry to values entries array.",
+		 "%s: unable to append value entry.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	value_entry = NULL;
-
 	return( 1 );
-
-on_error:
-	if( value_entry != NULL )
-	{
-		libfvalue_value_entry_free(
-		 &value_entry,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the data of a specific value entry
@@ -1512,21 +1531,27 @@ int libfvalue_data_handle_get_value_entry_data(
 	return( 1 );
 }
 
-/* Sets the data of a specific value entry
- * Returns if successful or -1 on error
+/* Retrieves the data of a range of value entries
+ * The value entries must be stored consecutively and must all be of the same size
+ * Returns 1 if successful, 0 if the value entries are not stored consecutively or -1 on error
  */
-int libfvalue_data_handle_set_value_entry_data(
+int libfvalue_data_handle_get_value_entries_data(
      libfvalue_data_handle_t *data_handle,
-     int value_entry_index,
-     const uint8_t *value_entry_data,
-     size_t value_entry_data_size,
-     int encoding,
+     int first_value_entry_index,
+     int number_of_value_entries,
+     uint8_t **value_entries_data,
+     size_t *value_entry_data_size,
+     int *encoding,
      libcerror_error_t **error )
 {
 	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
-	static char *function                                  = "libfvalue_data_handle_set_value_entry_data";
+	libfvalue_value_entry_t *value_entry                   = NULL;
+	static char *function                                  = "libfvalue_data_handle_get_value_entries_data";
 	size_t value_entry_offset                              = 0;
 	size_t value_entry_size                                = 0;
+	size_t next_value_entry_offset                         = 0;
+	int maximum_number_of_value_entries                    = 1;
+	int value_entry_index                                  = 0;
 
 	if( data_handle == NULL )
 	{
@@ -1552,25 +1577,188 @@ int libfvalue_data_handle_set_value_entry_data(
 
 		return( -1 );
 	}
-/* TODO remove limitation */
-	if( value_entry_index != 0 )
+	if( internal_data_handle->number_of_value_entries != 0 )
+	{
+		maximum_number_of_value_entries = internal_data_handle->number_of_value_entries;
+	}
+	if( ( first_value_entry_index < 0 )
+	 || ( first_value_entry_index >= maximum_number_of_value_entries ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value entry index value out of bounds.",
+		 "%s: invalid first value entry index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_entry_data == NULL )
+	if( ( number_of_value_entries <= 0 )
+	 || ( number_of_value_entries > ( maximum_number_of_value_entries - first_value_entry_index ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value entry data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoding == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_handle->number_of_value_entries == 0 )
+	{
+		value_entry_offset = 0;
+		value_entry_size   = internal_data_handle->data_size;
+	}
+	else
+	{
+		if( internal_data_handle->value_entries == NULL )
+		{
+			value_entry = &( internal_data_handle->value_entry );
+		}
+		else
+		{
+			value_entry = &( ( internal_data_handle->value_entries )[ first_value_entry_index ] );
+		}
+		value_entry_offset = value_entry->offset;
+		value_entry_size   = value_entry->size;
+
+		next_value_entry_offset = value_entry_offset + value_entry_size;
+
+		/* The value entries are stored in a flat array hence the remaining
+		 * value entries can be compared without a lookup per value entry
+		 */
+		for( value_entry_index = 1;
+		     value_entry_index < number_of_value_entries;
+		     value_entry_index++ )
+		{
+			value_entry++;
+
+			if( ( value_entry->offset != next_value_entry_offset )
+			 || ( value_entry->size != value_entry_size ) )
+			{
+				return( 0 );
+			}
+			next_value_entry_offset += value_entry_size;
+		}
+	}
+	if( value_entry_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_entry_offset > internal_data_handle->data_size )
+	 || ( value_entry_size > ( ( internal_data_handle->data_size - value_entry_offset ) / (size_t) number_of_value_entries ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: value entries: %d - %d out of bounds.",
+		 function,
+		 first_value_entry_index,
+		 first_value_entry_index + number_of_value_entries - 1 );
+
+		return( -1 );
+	}
+	*value_entries_data    = &( ( internal_data_handle->data )[ value_entry_offset ] );
+	*value_entry_data_size = value_entry_size;
+	*encoding              = internal_data_handle->encoding;
+
+	return( 1 );
+}
+
+/* Sets the data of a specific value entry
+ * Returns if successful or -1 on error
+ */
+int libfvalue_data_handle_set_value_entry_data(
+     libfvalue_data_handle_t *data_handle,
+     int value_entry_index,
+     const uint8_t *value_entry_data,
+     size_t value_entry_data_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
+	static char *function                                  = "libfvalue_data_handle_set_value_entry_data";
+	size_t value_entry_offset                              = 0;
+	size_t value_entry_size                                = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_handle = (libfvalue_internal_data_handle_t *) data_handle;
+
+	if( internal_data_handle->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing data.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO remove limitation */
+	if( value_entry_index != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry data.",
 		 function );
 
 		return( -1 );
@@ -1682,10 +1870,10 @@ int libfvalue_data_handle_append_value_entry_data(
      libcerror_error_t **error )
 {
 	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
-	libfvalue_value_entry_t *value_entry                   = NULL;
 	static char *function                                  = "libfvalue_data_handle_append_value_entry_data";
-	void *reallocation                                     = NULL;
-	size_t reallocation_data_size                          = 0;
+	size_t data_allocated_size                             = 0;
+	size_t required_data_size                              = 0;
+	size_t value_entry_offset                              = 0;
 
 	if( data_handle == NULL )
 	{
@@ -1733,7 +1921,54 @@ int libfvalue_data_handle_append_value_entry_data(
 
 		return( -1 );
 	}
-	if( internal_data_handle->data == NULL )
+	if( ( internal_data_handle->data == NULL )
+	 && ( value_entry_data_size > 0 )
+	 && ( internal_data_handle->data_allocated_size > value_entry_data_size ) )
+	{
+		/* Use the reserved data size for the first value entry
+		 */
+		if( libfvalue_internal_data_handle_resize_data(
+		     internal_data_handle,
+		     internal_data_handle->data_allocated_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_data_handle->data,
+		     value_entry_data,
+		     value_entry_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value entry data.",
+			 function );
+
+			libfvalue_arena_free_memory(
+			 internal_data_handle->arena,
+			 internal_data_handle->data );
+
+			internal_data_handle->data                = NULL;
+			internal_data_handle->data_allocated_size = 0;
+			internal_data_handle->flags              &= ~( LIBFVALUE_VALUE_DATA_FLAG_MANAGED );
+
+			goto on_error;
+		}
+		internal_data_handle->data_size = value_entry_data_size;
+		internal_data_handle->encoding  = encoding;
+
+		*value_entry_index = 0;
+	}
+	else if( internal_data_handle->data == NULL )
 	{
 		if( libfvalue_data_handle_set_data_as_clone(
 		     data_handle,
@@ -1752,6 +1987,8 @@ int libfvalue_data_handle_append_value_entry_data(
 			goto on_error;
 		}
 		internal_data_handle->encoding = encoding;
+
+		*value_entry_index = 0;
 	}
 	else
 	{
@@ -1777,130 +2014,551 @@ int libfvalue_data_handle_append_value_entry_data(
 
 			return( -1 );
 		}
-		if( internal_data_handle->value_entries == NULL )
+		if( internal_data_handle->number_of_value_entries == 0 )
 		{
-			if( libcdata_array_initialize(
-			     &( internal_data_handle->value_entries ),
-			     1,
+			if( libfvalue_internal_data_handle_append_value_entry(
+			     internal_data_handle,
+			     value_entry_index,
+			     0,
+			     internal_data_handle->data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create value entries array.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value entry: 0.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfvalue_value_entry_initialize(
-			     &value_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create value entry.",
-				 function );
+		}
+		value_entry_offset = internal_data_handle->data_size;
+		required_data_size = internal_data_handle->data_size + value_entry_data_size;
 
-				goto on_error;
+		if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
+		{
+			data_allocated_size = internal_data_handle->data_allocated_size;
+
+			if( data_allocated_size < internal_data_handle->data_size )
+			{
+				data_allocated_size = internal_data_handle->data_size;
 			}
-			value_entry->offset = 0;
-			value_entry->size   = internal_data_handle->data_size;
+		}
+		if( required_data_size > data_allocated_size )
+		{
+			/* Grow the data geometrically so that appending value entries
+			 * does not require a reallocation for every value entry
+			 */
+			data_allocated_size = internal_data_handle->data_size;
 
-			if( libcdata_array_set_entry_by_index(
-			     internal_data_handle->value_entries,
-			     0,
-			     (intptr_t *) value_entry,
+			if( data_allocated_size < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				data_allocated_size *= 2;
+			}
+			if( data_allocated_size < required_data_size )
+			{
+				data_allocated_size = required_data_size;
+			}
+			if( libfvalue_internal_data_handle_resize_data(
+			     internal_data_handle,
+			     data_allocated_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set entry: 0 in values entries array.",
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize data.",
 				 function );
 
 				goto on_error;
 			}
-			value_entry = NULL;
 		}
-		if( libfvalue_value_entry_initialize(
-		     &value_entry,
-		     error ) != 1 )
+		if( memory_copy(
+		     &( ( internal_data_handle->data )[ value_entry_offset ] ),
+		     value_entry_data,
+		     value_entry_data_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value entry.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value entry data.",
 			 function );
 
 			goto on_error;
 		}
-		value_entry->offset    = internal_data_handle->data_size;
-		value_entry->size      = value_entry_data_size;
-		reallocation_data_size = internal_data_handle->data_size + value_entry_data_size;
-
-		reallocation = memory_reallocate(
-		                internal_data_handle->data,
-		                reallocation_data_size );
-
-		if( reallocation == NULL )
+		if( libfvalue_internal_data_handle_append_value_entry(
+		     internal_data_handle,
+		     value_entry_index,
+		     value_entry_offset,
+		     value_entry_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to resize array entries.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value entry.",
 			 function );
 
 			goto on_error;
 		}
-		internal_data_handle->data      = (uint8_t *) reallocation;
-		internal_data_handle->data_size = reallocation_data_size;
+		internal_data_handle->data_size = required_data_size;
+	}
+	return( 1 );
 
-		if( memory_copy(
-		     &( ( internal_data_handle->data )[ value_entry->offset ] ),
-		     value_entry_data,
-		     value_entry->size ) == NULL )
+on_error:
+	return( -1 );
+}
+
+/* Determines if appending value entry data requires the data to be resized
+ * Resizing the data can move it, which invalidates references into the data
+ * Returns 1 if a resize is required, 0 if not or -1 on error
+ */
+int libfvalue_data_handle_append_requires_resize(
+     libfvalue_data_handle_t *data_handle,
+     size_t value_entry_data_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
+	static char *function                                  = "libfvalue_data_handle_append_requires_resize";
+	size_t data_allocated_size                             = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_handle = (libfvalue_internal_data_handle_t *) data_handle;
+
+	if( value_entry_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value entry data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without data there is nothing that can be moved
+	 */
+	if( internal_data_handle->data == NULL )
+	{
+		return( 0 );
+	}
+	/* Data that is not managed is copied into managed data when appending
+	 */
+	if( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) == 0 )
+	{
+		return( 1 );
+	}
+	data_allocated_size = internal_data_handle->data_allocated_size;
+
+	if( data_allocated_size < internal_data_handle->data_size )
+	{
+		data_allocated_size = internal_data_handle->data_size;
+	}
+	if( value_entry_data_size > ( data_allocated_size - internal_data_handle->data_size ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reserves storage for the data and value entries
+ * The data size is the total size of the data of all value entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_data_handle_reserve(
+     libfvalue_data_handle_t *data_handle,
+     size_t data_size,
+     int number_of_value_entries,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_data_handle_t *internal_data_handle = NULL;
+	static char *function                                  = "libfvalue_data_handle_reserve";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_handle = (libfvalue_internal_data_handle_t *) data_handle;
+
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of value entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_handle->data == NULL )
+	{
+		/* The data is allocated when the first value entry is appended
+		 */
+		if( data_size > internal_data_handle->data_allocated_size )
+		{
+			internal_data_handle->data_allocated_size = data_size;
+		}
+	}
+	else if( ( data_size > internal_data_handle->data_size )
+	      && ( ( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) == 0 )
+	       ||  ( data_size > internal_data_handle->data_allocated_size ) ) )
+	{
+		if( libfvalue_internal_data_handle_resize_data(
+		     internal_data_handle,
+		     data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy value entry data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libcdata_array_append_entry(
-		     internal_data_handle->value_entries,
-		     value_entry_index,
-		     (intptr_t *) value_entry,
+	}
+	if( ( number_of_value_entries > 1 )
+	 && ( number_of_value_entries > internal_data_handle->number_of_allocated_value_entries ) )
+	{
+		if( libfvalue_internal_data_handle_resize_value_entries(
+		     internal_data_handle,
+		     number_of_value_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append entry to values entries array.",
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value entries.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		value_entry = NULL;
 	}
 	return( 1 );
+}
 
-on_error:
-	if( value_entry != NULL )
+/* Resizes the allocated value entries
+ * The value entries are stored in the value entries array afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_data_handle_resize_value_entries(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     int number_of_allocated_value_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_data_handle_resize_value_entries";
+	void *reallocation    = NULL;
+
+	if( internal_data_handle == NULL )
 	{
-		libfvalue_value_entry_free(
-		 &value_entry,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( ( number_of_allocated_value_entries <= 0 )
+	 || ( number_of_allocated_value_entries < internal_data_handle->number_of_value_entries )
+	 || ( (size_t) number_of_allocated_value_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvalue_value_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocated value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = libfvalue_arena_reallocate_memory(
+	                internal_data_handle->arena,
+	                internal_data_handle->value_entries,
+	                sizeof( libfvalue_value_entry_t ) * internal_data_handle->number_of_allocated_value_entries,
+	                sizeof( libfvalue_value_entry_t ) * number_of_allocated_value_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value entries.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_ENTRIES,
+	 sizeof( libfvalue_value_entry_t ) * number_of_allocated_value_entries );
+
+	if( ( internal_data_handle->value_entries == NULL )
+	 && ( internal_data_handle->number_of_value_entries == 1 ) )
+	{
+		/* Move the value entry into the value entries array
+		 */
+		( (libfvalue_value_entry_t *) reallocation )[ 0 ].offset = internal_data_handle->value_entry.offset;
+		( (libfvalue_value_entry_t *) reallocation )[ 0 ].size   = internal_data_handle->value_entry.size;
+	}
+	internal_data_handle->value_entries                     = (libfvalue_value_entry_t *) reallocation;
+	internal_data_handle->number_of_allocated_value_entries = number_of_allocated_value_entries;
+
+	return( 1 );
+}
+
+/* Appends a value entry
+ * The value entry is stored inline if it is the only value entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_data_handle_append_value_entry(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     int *value_entry_index,
+     size_t value_entry_offset,
+     size_t value_entry_size,
+     libcerror_error_t **error )
+{
+	libfvalue_value_entry_t *value_entry  = NULL;
+	static char *function                 = "libfvalue_internal_data_handle_append_value_entry";
+	int number_of_allocated_value_entries = 0;
+
+	if( internal_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_handle->number_of_value_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data handle - number of value entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_data_handle->value_entries == NULL )
+	 && ( internal_data_handle->number_of_value_entries == 0 ) )
+	{
+		value_entry = &( internal_data_handle->value_entry );
+	}
+	else
+	{
+		if( internal_data_handle->number_of_value_entries >= internal_data_handle->number_of_allocated_value_entries )
+		{
+			number_of_allocated_value_entries = internal_data_handle->number_of_allocated_value_entries;
+
+			if( number_of_allocated_value_entries < LIBFVALUE_DATA_HANDLE_MINIMUM_NUMBER_OF_ALLOCATED_VALUE_ENTRIES )
+			{
+				number_of_allocated_value_entries = LIBFVALUE_DATA_HANDLE_MINIMUM_NUMBER_OF_ALLOCATED_VALUE_ENTRIES;
+			}
+			else if( number_of_allocated_value_entries <= ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_value_entries *= 2;
+			}
+			else
+			{
+				number_of_allocated_value_entries = INT_MAX;
+			}
+			if( libfvalue_internal_data_handle_resize_value_entries(
+			     internal_data_handle,
+			     number_of_allocated_value_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize value entries.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		value_entry = &( ( internal_data_handle->value_entries )[ internal_data_handle->number_of_value_entries ] );
+	}
+	value_entry->offset = value_entry_offset;
+	value_entry->size   = value_entry_size;
+
+	*value_entry_index = internal_data_handle->number_of_value_entries;
+
+	internal_data_handle->number_of_value_entries += 1;
+
+	return( 1 );
+}
+
+/* Resizes the allocated data
+ * If the data is not managed by the data handle a managed copy is made
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_data_handle_resize_data(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     size_t data_allocated_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libfvalue_internal_data_handle_resize_data";
+	void *reallocation    = NULL;
+	size_t data_size      = 0;
+
+	if( internal_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_allocated_size == 0 )
+	 || ( data_allocated_size < internal_data_handle->data_size )
+	 || ( data_allocated_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data allocated size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_data_handle->data != NULL )
+	 && ( ( internal_data_handle->flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 ) )
+	{
+		data_size = internal_data_handle->data_allocated_size;
+
+		if( data_size == 0 )
+		{
+			data_size = internal_data_handle->data_size;
+		}
+		reallocation = libfvalue_arena_reallocate_memory(
+		                internal_data_handle->arena,
+		                internal_data_handle->data,
+		                sizeof( uint8_t ) * data_size,
+		                sizeof( uint8_t ) * data_allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_DATA_HANDLE,
+		 sizeof( uint8_t ) * data_allocated_size );
+
+		internal_data_handle->data = (uint8_t *) reallocation;
+	}
+	else
+	{
+		data = (uint8_t *) libfvalue_arena_allocate_memory(
+		                    internal_data_handle->arena,
+		                    sizeof( uint8_t ) * data_allocated_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_DATA_HANDLE,
+		 sizeof( uint8_t ) * data_allocated_size );
+
+		if( internal_data_handle->data != NULL )
+		{
+			if( memory_copy(
+			     data,
+			     internal_data_handle->data,
+			     internal_data_handle->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				libfvalue_arena_free_memory(
+				 internal_data_handle->arena,
+				 data );
+
+				return( -1 );
+			}
+		}
+		internal_data_handle->data   = data;
+		internal_data_handle->flags |= LIBFVALUE_VALUE_DATA_FLAG_MANAGED;
+	}
+	internal_data_handle->data_allocated_size = data_allocated_size;
+
+	return( 1 );
 }
 
@@ -26,9 +26,9 @@
 #include <types.h>
 
 #include "libfvalue_extern.h"
-#include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
 #include "libfvalue_types.h"
+#include "libfvalue_value_entry.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -46,6 +46,12 @@ struct libfvalue_internal_data_handle
 	 */
 	size_t data_size;
 
+	/* The allocated data size
+	 * 0 if the allocated size is the data size
+	 * if no data is set this contains the size reserved for the data
+	 */
+	size_t data_allocated_size;
+
 	/* The encoding
 	 */
 	int encoding;
@@ -54,9 +60,25 @@ struct libfvalue_internal_data_handle
 	 */
 	uint32_t data_flags;
 
-	/* The value entries array
+	/* The value entry
+	 * contains the value entry if there is only a single value entry
+	 * that does not span the entire data
+	 */
+	libfvalue_value_entry_t value_entry;
+
+	/* The value entries
+	 * NULL if there are less than 2 value entries
+	 */
+	libfvalue_value_entry_t *value_entries;
+
+	/* The number of value entries
+	 * 0 if the data consists of a single value entry that spans the entire data
 	 */
-	libcdata_array_t *value_entries;
+	int number_of_value_entries;
+
+	/* The number of allocated value entries
+	 */
+	int number_of_allocated_value_entries;
 
 	/* The read value entries function
 	 */
@@ -68,6 +90,11 @@ struct libfvalue_internal_data_handle
 	       uint32_t data_flags,
 	       libcerror_error_t **error );
 
+	/* The arena
+	 * NULL if the memory of the data handle is not allocated in an arena
+	 */
+	libfvalue_arena_t *arena;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -85,6 +112,18 @@ int libfvalue_data_handle_initialize(
             libcerror_error_t **error ),
      libcerror_error_t **error );
 
+int libfvalue_data_handle_initialize_in_arena(
+     libfvalue_data_handle_t **data_handle,
+     libfvalue_arena_t *arena,
+     int (*read_value_entries)(
+            libfvalue_data_handle_t *data_handle,
+            const uint8_t *data,
+            size_t data_size,
+            int encoding,
+            uint32_t data_flags,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_data_handle_free(
      libfvalue_data_handle_t **data_handle,
@@ -134,6 +173,10 @@ int libfvalue_data_handle_set_data_as_owned(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_data_handle_is_data_managed(
+     libfvalue_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_data_handle_get_data_flags(
      libfvalue_data_handle_t *data_handle,
@@ -185,6 +228,16 @@ int libfvalue_data_handle_get_value_entry_data(
      int *encoding,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_data_handle_get_value_entries_data(
+     libfvalue_data_handle_t *data_handle,
+     int first_value_entry_index,
+     int number_of_value_entries,
+     uint8_t **value_entries_data,
+     size_t *value_entry_data_size,
+     int *encoding,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_data_handle_set_value_entry_data(
      libfvalue_data_handle_t *data_handle,
@@ -203,6 +256,35 @@ int libfvalue_data_handle_append_value_entry_data(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_data_handle_append_requires_resize(
+     libfvalue_data_handle_t *data_handle,
+     size_t value_entry_data_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_data_handle_reserve(
+     libfvalue_data_handle_t *data_handle,
+     size_t data_size,
+     int number_of_value_entries,
+     libcerror_error_t **error );
+
+int libfvalue_internal_data_handle_resize_value_entries(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     int number_of_allocated_value_entries,
+     libcerror_error_t **error );
+
+int libfvalue_internal_data_handle_append_value_entry(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     int *value_entry_index,
+     size_t value_entry_offset,
+     size_t value_entry_size,
+     libcerror_error_t **error );
+
+int libfvalue_internal_data_handle_resize_data(
+     libfvalue_internal_data_handle_t *internal_data_handle,
+     size_t data_allocated_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
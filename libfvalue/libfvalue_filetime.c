@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #include "libfvalue_definitions.h"
@@ -29,6 +30,143 @@
 
 #if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
 
+/* Copies the filetime to a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_filetime_copy_to_byte_stream(
+     libfdatetime_filetime_t *filetime,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_filetime_copy_to_byte_stream";
+	uint64_t value_64bit  = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( encoding != LIBFVALUE_ENDIAN_BIG )
+	 && ( encoding != LIBFVALUE_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_to_64bit(
+	     filetime,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoding == LIBFVALUE_ENDIAN_BIG )
+	{
+		byte_stream_copy_from_uint64_big_endian(
+		 byte_stream,
+		 value_64bit );
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 byte_stream,
+		 value_64bit );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a byte stream of the filetime
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_filetime_get_byte_stream_size(
+     libfdatetime_filetime_t *filetime,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_filetime_get_byte_stream_size";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( encoding != LIBFVALUE_ENDIAN_BIG )
+	 && ( encoding != LIBFVALUE_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_size = 8;
+
+	return( 1 );
+}
+
 /* Copies the filetime from an integer value
  * Returns 1 if successful or -1 on error
  */
@@ -34,6 +34,19 @@ extern "C" {
 
 #if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
 
+int libfvalue_filetime_copy_to_byte_stream(
+     libfdatetime_filetime_t *filetime,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_filetime_get_byte_stream_size(
+     libfdatetime_filetime_t *filetime,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
 int libfvalue_filetime_copy_from_integer(
      libfdatetime_filetime_t *filetime,
      uint64_t integer_value,
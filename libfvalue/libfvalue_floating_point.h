@@ -32,6 +32,19 @@
 extern "C" {
 #endif
 
+/* The maximum size of a shortest decimal string: "0.0000000000000000e-000"
+ */
+#define LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE	32
+
+/* The maximum size of a floating point string including the end of string character
+ * The longest string is a signed shortest decimal string
+ */
+#define LIBFVALUE_FLOATING_POINT_MAXIMUM_STRING_SIZE	64
+
+/* The maximum number of 32-bit words of a big integer used to compare decimal strings
+ */
+#define LIBFVALUE_FLOATING_POINT_BIG_INTEGER_MAXIMUM_NUMBER_OF_WORDS	128
+
 typedef struct libfvalue_floating_point libfvalue_floating_point_t;
 
 struct libfvalue_floating_point
@@ -45,6 +58,19 @@ struct libfvalue_floating_point
 	size_t value_size;
 };
 
+typedef struct libfvalue_floating_point_big_integer libfvalue_floating_point_big_integer_t;
+
+struct libfvalue_floating_point_big_integer
+{
+	/* The words, least significant first
+	 */
+	uint32_t words[ LIBFVALUE_FLOATING_POINT_BIG_INTEGER_MAXIMUM_NUMBER_OF_WORDS ];
+
+	/* The number of words in use
+	 */
+	size_t number_of_words;
+};
+
 int libfvalue_floating_point_initialize(
      libfvalue_floating_point_t **floating_point,
      libcerror_error_t **error );
@@ -65,6 +91,19 @@ int libfvalue_floating_point_copy_from_byte_stream(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_floating_point_copy_to_byte_stream(
+     libfvalue_floating_point_t *floating_point,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_get_byte_stream_size(
+     libfvalue_floating_point_t *floating_point,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
 int libfvalue_floating_point_copy_from_integer(
      libfvalue_floating_point_t *floating_point,
      uint64_t integer_value,
@@ -143,6 +182,87 @@ int libfvalue_floating_point_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+uint64_t libfvalue_floating_point_multiply_64bit(
+          uint64_t value1,
+          uint64_t value2,
+          uint64_t *high_value );
+
+uint64_t libfvalue_floating_point_multiply_shift(
+          uint64_t value,
+          const uint64_t *multiplier,
+          int32_t shift );
+
+int libfvalue_floating_point_is_multiple_of_power_of_5(
+     uint64_t value,
+     uint32_t power );
+
+int libfvalue_floating_point_get_shortest_decimal(
+     uint64_t floating_point_value,
+     size_t floating_point_value_size,
+     uint64_t *decimal_significand,
+     int16_t *decimal_exponent,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_copy_to_shortest_decimal_string(
+     uint64_t floating_point_value,
+     size_t floating_point_value_size,
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_length,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_big_integer_multiply_add(
+     libfvalue_floating_point_big_integer_t *big_integer,
+     uint32_t multiplier,
+     uint32_t addend,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_big_integer_multiply_power_of_5(
+     libfvalue_floating_point_big_integer_t *big_integer,
+     uint32_t power,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_big_integer_shift_left(
+     libfvalue_floating_point_big_integer_t *big_integer,
+     uint32_t number_of_bits,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_big_integer_compare(
+     libfvalue_floating_point_big_integer_t *first_big_integer,
+     libfvalue_floating_point_big_integer_t *second_big_integer,
+     libcerror_error_t **error );
+
+uint32_t libfvalue_floating_point_get_character(
+          const uint8_t *string,
+          uint8_t character_size,
+          size_t string_index );
+
+int libfvalue_floating_point_get_value_from_decimal(
+     uint64_t decimal_significand,
+     int32_t decimal_exponent,
+     size_t floating_point_value_size,
+     uint64_t *floating_point_value,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_compare_decimal_string_with_halfway(
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t digits_start_index,
+     size_t digits_end_index,
+     int64_t decimal_exponent,
+     uint64_t floating_point_value,
+     size_t floating_point_value_size,
+     libcerror_error_t **error );
+
+int libfvalue_floating_point_copy_from_decimal_string(
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *floating_point_value,
+     size_t floating_point_value_size,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_string_size_from_floating_point(
      size_t *string_size,
@@ -180,6 +300,26 @@ int libfvalue_utf8_string_with_index_copy_to_floating_point(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+int libfvalue_string_with_index_copy_from_floating_point(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     uint64_t floating_point_value,
+     size_t floating_point_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libfvalue_string_with_index_copy_to_floating_point(
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *floating_point_value,
+     size_t floating_point_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_utf16_string_copy_from_floating_point(
      uint16_t *utf16_string,
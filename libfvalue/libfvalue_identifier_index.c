@@ -0,0 +1,846 @@
+/*
+ * Value identifier index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvalue_identifier_index.h"
+#include "libfvalue_libcdata.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
+#include "libfvalue_value.h"
+
+/* The identifier index is an open addressing hash table with linear probing
+ * that maps the hash of a value identifier to the index of the value in the
+ * values array of a table. The identifier itself is not stored, a candidate
+ * entry is verified against the value in the values array.
+ *
+ * The number of allocated entries is kept at least twice the number of
+ * used entries so that probe sequences remain short.
+ */
+
+/* Allocates the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_allocate_entries(
+     libfvalue_identifier_index_t *identifier_index,
+     int number_of_allocated_entries,
+     libcerror_error_t **error )
+{
+	libfvalue_identifier_index_entry_t *entries = NULL;
+	static char *function                       = "libfvalue_identifier_index_allocate_entries";
+	int entry_index                             = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocated_entries <= 0 )
+	 || ( (size_t) number_of_allocated_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvalue_identifier_index_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocated entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries = (libfvalue_identifier_index_entry_t *) memory_allocate(
+	                                                   sizeof( libfvalue_identifier_index_entry_t ) * number_of_allocated_entries );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+	 sizeof( libfvalue_identifier_index_entry_t ) * number_of_allocated_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_allocated_entries;
+	     entry_index++ )
+	{
+		entries[ entry_index ].hash        = 0;
+		entries[ entry_index ].value_index = -1;
+	}
+	if( identifier_index->entries != NULL )
+	{
+		memory_free(
+		 identifier_index->entries );
+	}
+	identifier_index->entries                     = entries;
+	identifier_index->number_of_allocated_entries = number_of_allocated_entries;
+	identifier_index->number_of_entries           = 0;
+
+	return( 1 );
+}
+
+/* Creates an identifier index
+ * Make sure the value identifier_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_initialize(
+     libfvalue_identifier_index_t **identifier_index,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfvalue_identifier_index_initialize";
+	int number_of_allocated_entries = 16;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_allocated_entries < ( number_of_values * 2 ) )
+	{
+		number_of_allocated_entries *= 2;
+	}
+	*identifier_index = memory_allocate_structure(
+	                     libfvalue_identifier_index_t );
+
+	if( *identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+	 sizeof( libfvalue_identifier_index_t ) );
+
+	if( memory_set(
+	     *identifier_index,
+	     0,
+	     sizeof( libfvalue_identifier_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier index.",
+		 function );
+
+		memory_free(
+		 *identifier_index );
+
+		*identifier_index = NULL;
+
+		return( -1 );
+	}
+	if( libfvalue_identifier_index_allocate_entries(
+	     *identifier_index,
+	     number_of_allocated_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *identifier_index != NULL )
+	{
+		memory_free(
+		 *identifier_index );
+
+		*identifier_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an identifier index
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_free(
+     libfvalue_identifier_index_t **identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_identifier_index_free";
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_index != NULL )
+	{
+		if( ( *identifier_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *identifier_index )->entries );
+		}
+		memory_free(
+		 *identifier_index );
+
+		*identifier_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones an identifier index
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_clone(
+     libfvalue_identifier_index_t **destination_identifier_index,
+     libfvalue_identifier_index_t *source_identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_identifier_index_clone";
+
+	if( destination_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_identifier_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination identifier index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_identifier_index == NULL )
+	{
+		*destination_identifier_index = NULL;
+
+		return( 1 );
+	}
+	if( libfvalue_identifier_index_initialize(
+	     destination_identifier_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_identifier_index_allocate_entries(
+	     *destination_identifier_index,
+	     source_identifier_index->number_of_allocated_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *destination_identifier_index )->entries,
+	     source_identifier_index->entries,
+	     sizeof( libfvalue_identifier_index_entry_t ) * source_identifier_index->number_of_allocated_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_identifier_index )->number_of_entries = source_identifier_index->number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *destination_identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 destination_identifier_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Empties an identifier index
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_empty(
+     libfvalue_identifier_index_t *identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_identifier_index_empty";
+	int entry_index       = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < identifier_index->number_of_allocated_entries;
+	     entry_index++ )
+	{
+		identifier_index->entries[ entry_index ].hash        = 0;
+		identifier_index->entries[ entry_index ].value_index = -1;
+	}
+	identifier_index->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an identifier
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash of the identifier data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_calculate_hash(
+     const uint8_t *identifier,
+     size_t identifier_size,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvalue_identifier_index_calculate_hash";
+	size_t identifier_offset  = 0;
+	uint32_t calculated_hash  = 0x811c9dc5UL;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid identifier size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( identifier_offset = 0;
+	     identifier_offset < identifier_size;
+	     identifier_offset++ )
+	{
+		calculated_hash ^= identifier[ identifier_offset ];
+		calculated_hash *= 0x01000193UL;
+	}
+	*hash = calculated_hash;
+
+	return( 1 );
+}
+
+/* Sets the value index of an identifier
+ * The value indexes of the other entries are not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_set_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error )
+{
+	libfvalue_identifier_index_entry_t *entries = NULL;
+	static char *function                       = "libfvalue_identifier_index_set_value_index";
+	uint32_t entry_index                        = 0;
+	uint32_t hash                               = 0;
+	uint32_t index_mask                         = 0;
+	int number_of_allocated_entries             = 0;
+	int number_of_entries                       = 0;
+	int old_entry_index                         = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_identifier_index_calculate_hash(
+	     identifier,
+	     identifier_size,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate identifier hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at or below 50 percent
+	 */
+	if( ( ( identifier_index->number_of_entries + 1 ) * 2 ) > identifier_index->number_of_allocated_entries )
+	{
+		if( identifier_index->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier index - number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries                     = identifier_index->entries;
+		number_of_allocated_entries = identifier_index->number_of_allocated_entries;
+		number_of_entries           = identifier_index->number_of_entries;
+
+		identifier_index->entries = NULL;
+
+		if( libfvalue_identifier_index_allocate_entries(
+		     identifier_index,
+		     number_of_allocated_entries * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize entries.",
+			 function );
+
+			identifier_index->entries                     = entries;
+			identifier_index->number_of_allocated_entries = number_of_allocated_entries;
+			identifier_index->number_of_entries           = number_of_entries;
+
+			return( -1 );
+		}
+		index_mask = (uint32_t) identifier_index->number_of_allocated_entries - 1;
+
+		/* The stored hashes are used to redistribute the entries
+		 */
+		for( old_entry_index = 0;
+		     old_entry_index < number_of_allocated_entries;
+		     old_entry_index++ )
+		{
+			if( entries[ old_entry_index ].value_index < 0 )
+			{
+				continue;
+			}
+			entry_index = entries[ old_entry_index ].hash & index_mask;
+
+			while( identifier_index->entries[ entry_index ].value_index >= 0 )
+			{
+				entry_index = ( entry_index + 1 ) & index_mask;
+			}
+			identifier_index->entries[ entry_index ] = entries[ old_entry_index ];
+		}
+		identifier_index->number_of_entries = number_of_entries;
+
+		memory_free(
+		 entries );
+	}
+	index_mask  = (uint32_t) identifier_index->number_of_allocated_entries - 1;
+	entry_index = hash & index_mask;
+
+	while( identifier_index->entries[ entry_index ].value_index >= 0 )
+	{
+		entry_index = ( entry_index + 1 ) & index_mask;
+	}
+	identifier_index->entries[ entry_index ].hash        = hash;
+	identifier_index->entries[ entry_index ].value_index = value_index;
+
+	identifier_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Inserts the value index of an identifier
+ * The value indexes of the other entries that are equal or greater than
+ * the value index are increased by 1, which corresponds with inserting
+ * the value into the values array
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_identifier_index_insert_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_identifier_index_insert_value_index";
+	int entry_index       = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < identifier_index->number_of_allocated_entries;
+	     entry_index++ )
+	{
+		if( identifier_index->entries[ entry_index ].value_index >= value_index )
+		{
+			identifier_index->entries[ entry_index ].value_index += 1;
+		}
+	}
+	if( libfvalue_identifier_index_set_value_index(
+	     identifier_index,
+	     identifier,
+	     identifier_size,
+	     value_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value index: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes the value index of an identifier
+ * Returns 1 if successful, 0 if no such value index was found or -1 on error
+ */
+int libfvalue_identifier_index_remove_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_identifier_index_remove_value_index";
+	uint32_t entry_index  = 0;
+	uint32_t hash         = 0;
+	uint32_t hash_index   = 0;
+	uint32_t index_mask   = 0;
+	uint32_t next_index   = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_identifier_index_calculate_hash(
+	     identifier,
+	     identifier_size,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate identifier hash.",
+		 function );
+
+		return( -1 );
+	}
+	index_mask  = (uint32_t) identifier_index->number_of_allocated_entries - 1;
+	entry_index = hash & index_mask;
+
+	while( identifier_index->entries[ entry_index ].value_index >= 0 )
+	{
+		if( ( identifier_index->entries[ entry_index ].hash == hash )
+		 && ( identifier_index->entries[ entry_index ].value_index == value_index ) )
+		{
+			break;
+		}
+		entry_index = ( entry_index + 1 ) & index_mask;
+	}
+	if( identifier_index->entries[ entry_index ].value_index < 0 )
+	{
+		return( 0 );
+	}
+	/* Move the entries that follow in the probe sequence backwards
+	 * so that no tombstone entries are needed
+	 */
+	next_index = entry_index;
+
+	for( ;; )
+	{
+		next_index = ( next_index + 1 ) & index_mask;
+
+		if( identifier_index->entries[ next_index ].value_index < 0 )
+		{
+			break;
+		}
+		hash_index = identifier_index->entries[ next_index ].hash & index_mask;
+
+		/* Determine if the hash index lies cyclically outside ( entry_index, next_index ]
+		 */
+		if( ( ( next_index - hash_index ) & index_mask ) >= ( ( next_index - entry_index ) & index_mask ) )
+		{
+			identifier_index->entries[ entry_index ] = identifier_index->entries[ next_index ];
+
+			entry_index = next_index;
+		}
+	}
+	identifier_index->entries[ entry_index ].hash        = 0;
+	identifier_index->entries[ entry_index ].value_index = -1;
+
+	identifier_index->number_of_entries -= 1;
+
+	return( 1 );
+}
+
+/* Retrieves the value index of an identifier
+ * The values array is used to verify the identifier of candidate values,
+ * if multiple values have the same identifier the lowest value index is returned
+ * Returns 1 if successful, 0 if no value index was found or -1 on error
+ */
+int libfvalue_identifier_index_get_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     libcdata_array_t *values_array,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	static char *function                      = "libfvalue_identifier_index_get_value_index";
+	uint32_t entry_index                       = 0;
+	uint32_t hash                              = 0;
+	uint32_t index_mask                        = 0;
+	int candidate_value_index                  = 0;
+	int result                                 = 0;
+
+	if( identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_identifier_index_calculate_hash(
+	     identifier,
+	     identifier_size,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate identifier hash.",
+		 function );
+
+		return( -1 );
+	}
+	index_mask  = (uint32_t) identifier_index->number_of_allocated_entries - 1;
+	entry_index = hash & index_mask;
+
+	while( identifier_index->entries[ entry_index ].value_index >= 0 )
+	{
+		libfvalue_statistics_count_lookup_scan_length(
+		 1 );
+
+		candidate_value_index = identifier_index->entries[ entry_index ].value_index;
+
+		if( ( identifier_index->entries[ entry_index ].hash == hash )
+		 && ( ( result == 0 )
+		  ||  ( candidate_value_index < *value_index ) ) )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     values_array,
+			     candidate_value_index,
+			     (intptr_t **) &internal_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from values array.",
+				 function,
+				 candidate_value_index );
+
+				return( -1 );
+			}
+			if( ( internal_value != NULL )
+			 && ( internal_value->identifier != NULL )
+			 && ( internal_value->identifier_size == identifier_size )
+			 && ( memory_compare(
+			       internal_value->identifier,
+			       identifier,
+			       identifier_size ) == 0 ) )
+			{
+				*value_index = candidate_value_index;
+				result       = 1;
+			}
+		}
+		entry_index = ( entry_index + 1 ) & index_mask;
+	}
+	return( result );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Value identifier index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_IDENTIFIER_INDEX_H )
+#define _LIBFVALUE_IDENTIFIER_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_libcdata.h"
+#include "libfvalue_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvalue_identifier_index_entry libfvalue_identifier_index_entry_t;
+
+struct libfvalue_identifier_index_entry
+{
+	/* The identifier hash
+	 */
+	uint32_t hash;
+
+	/* The value index
+	 * -1 if the entry is not used
+	 */
+	int value_index;
+};
+
+typedef struct libfvalue_identifier_index libfvalue_identifier_index_t;
+
+struct libfvalue_identifier_index
+{
+	/* The entries
+	 */
+	libfvalue_identifier_index_entry_t *entries;
+
+	/* The number of allocated entries
+	 * this is always a power of 2
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_entries;
+};
+
+int libfvalue_identifier_index_allocate_entries(
+     libfvalue_identifier_index_t *identifier_index,
+     int number_of_allocated_entries,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_initialize(
+     libfvalue_identifier_index_t **identifier_index,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_free(
+     libfvalue_identifier_index_t **identifier_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_clone(
+     libfvalue_identifier_index_t **destination_identifier_index,
+     libfvalue_identifier_index_t *source_identifier_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_empty(
+     libfvalue_identifier_index_t *identifier_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_calculate_hash(
+     const uint8_t *identifier,
+     size_t identifier_size,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_set_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_insert_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_remove_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int value_index,
+     libcerror_error_t **error );
+
+int libfvalue_identifier_index_get_value_index(
+     libfvalue_identifier_index_t *identifier_index,
+     libcdata_array_t *values_array,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     int *value_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_IDENTIFIER_INDEX_H ) */
+
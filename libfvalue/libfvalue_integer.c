@@ -24,26 +24,59 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvalue_ascii.h"
+#include "libfvalue_base16.h"
 #include "libfvalue_definitions.h"
 #include "libfvalue_integer.h"
 #include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
 
 #if _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_BIG
 #define byte_stream_copy_to_uint16_native_endian byte_stream_copy_to_uint16_big_endian
 #define byte_stream_copy_to_uint32_native_endian byte_stream_copy_to_uint32_big_endian
 #define byte_stream_copy_to_uint64_native_endian byte_stream_copy_to_uint64_big_endian
 
+#define byte_stream_copy_from_uint16_native_endian byte_stream_copy_from_uint16_big_endian
+#define byte_stream_copy_from_uint32_native_endian byte_stream_copy_from_uint32_big_endian
+#define byte_stream_copy_from_uint64_native_endian byte_stream_copy_from_uint64_big_endian
+
 #elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE
 #define byte_stream_copy_to_uint16_native_endian byte_stream_copy_to_uint16_little_endian
 #define byte_stream_copy_to_uint32_native_endian byte_stream_copy_to_uint32_little_endian
 #define byte_stream_copy_to_uint64_native_endian byte_stream_copy_to_uint64_little_endian
 
+#define byte_stream_copy_from_uint16_native_endian byte_stream_copy_from_uint16_little_endian
+#define byte_stream_copy_from_uint32_native_endian byte_stream_copy_from_uint32_little_endian
+#define byte_stream_copy_from_uint64_native_endian byte_stream_copy_from_uint64_little_endian
+
 #elif _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_MIDDLE
 #define byte_stream_copy_to_uint16_native_endian byte_stream_copy_to_uint16_little_endian
 
 #error "Unsupported middle-endian host byte-order"
 #endif
 
+/* The decimal digit pairs "00" to "99" used to format 2 digits at a time
+ */
+static const uint8_t libfvalue_integer_decimal_digit_pairs[ 200 ] = {
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+	'1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+	'2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+	'3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+	'4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+	'5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+	'6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+	'7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+	'8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+	'9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9' };
+
+/* The powers of 10 that fit in 64-bit
+ */
+static const uint64_t libfvalue_integer_decimal_powers_of_10[ 20 ] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+	100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+	10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL };
+
 /* Creates an integer
  * Make sure the value integer is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -90,6 +123,10 @@ int libfvalue_integer_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_integer_t ) );
+
 	if( memory_set(
 	     *integer,
 	     0,
@@ -199,6 +236,10 @@ int libfvalue_integer_clone(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_integer_t ) );
+
 	if( memory_copy(
 	     *destination_integer,
 	     source_integer,
@@ -370,152 +411,259 @@ int libfvalue_integer_copy_from_byte_stream(
 	return( 1 );
 }
 
-/* Copies the integer from an integer value
+/* Copies integer values from a byte stream
+ * The byte stream must contain consecutive integers of the same size
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_integer_copy_from_integer(
-     libfvalue_integer_t *integer,
-     uint64_t integer_value,
-     size_t integer_value_size,
+int libfvalue_integer_copy_from_byte_stream_array(
+     uint64_t *integer_values,
+     size_t number_of_integer_values,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_integer_copy_from_integer";
+	static char *function     = "libfvalue_integer_copy_from_byte_stream_array";
+	size_t byte_stream_offset = 0;
+	size_t integer_size       = 0;
+	size_t value_index        = 0;
 
-	if( integer == NULL )
+	if( integer_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer.",
+		 "%s: invalid integer values.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( integer_value_size != 8 )
-	 && ( integer_value_size != 16 )
-	 && ( integer_value_size != 32 )
-	 && ( integer_value_size != 64 ) )
+	if( ( number_of_integer_values == 0 )
+	 || ( number_of_integer_values > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported integer value size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of integer values value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	integer->value      = integer_value;
-	integer->value_size = integer_value_size;
-
-	return( 1 );
-}
-
-/* Copies the integer to an integer value
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_integer_copy_to_integer(
-     libfvalue_integer_t *integer,
-     uint64_t *integer_value,
-     size_t *integer_value_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_integer_copy_to_integer";
-
-	if( integer == NULL )
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer.",
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( integer_value == NULL )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer value.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( integer_value_size == NULL )
+	if( ( encoding != LIBFVALUE_ENDIAN_BIG )
+	 && ( encoding != LIBFVALUE_ENDIAN_LITTLE )
+	 && ( encoding != LIBFVALUE_ENDIAN_NATIVE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer value size.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
 		 function );
 
 		return( -1 );
 	}
-	*integer_value      = integer->value;
-	*integer_value_size = integer->value_size;
-
-	return( 1 );
-}
-
-/* Retrieves the size of a string of the integer
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_integer_get_string_size(
-     libfvalue_integer_t *integer,
-     size_t *string_size,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_integer_get_string_size";
+	integer_size = byte_stream_size / number_of_integer_values;
 
-	if( integer == NULL )
+	if( ( integer_size * number_of_integer_values ) != byte_stream_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_string_size_from_integer(
-	     string_size,
-	     integer->value,
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	/* The loops below are kept free of function calls and branches
+	 * so that the compiler can vectorize the byte swapping
+	 */
+	switch( integer_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to determine size of string of %" PRIzd "-bit integer.",
-		 function,
-		 integer->value_size );
+		case 1:
+			for( value_index = 0;
+			     value_index < number_of_integer_values;
+			     value_index++ )
+			{
+				integer_values[ value_index ] = (uint64_t) byte_stream[ value_index ];
+			}
+			break;
 
-		return( -1 );
+		case 2:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint16_big_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 2;
+				}
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 2;
+				}
+			}
+			else
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint16_native_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 2;
+				}
+			}
+			break;
+
+		case 4:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint32_big_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 4;
+				}
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint32_little_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 4;
+				}
+			}
+			else
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint32_native_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 4;
+				}
+			}
+			break;
+
+		case 8:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint64_big_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 8;
+				}
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint64_little_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 8;
+				}
+			}
+			else
+			{
+				for( value_index = 0;
+				     value_index < number_of_integer_values;
+				     value_index++ )
+				{
+					byte_stream_copy_to_uint64_native_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 integer_values[ value_index ] );
+
+					byte_stream_offset += 8;
+				}
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported integer size: %" PRIzd ".",
+			 function,
+			 integer_size );
+
+			return( -1 );
 	}
 	return( 1 );
 }
 
-/* Copies the integer from an UTF-8 encoded string
+/* Copies the integer to a byte stream
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_integer_copy_from_utf8_string_with_index(
+int libfvalue_integer_copy_to_byte_stream(
      libfvalue_integer_t *integer,
-     uint8_t *utf8_string,
-     size_t utf8_string_length,
-     size_t *utf8_string_index,
-     uint32_t string_format_flags,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_integer_copy_from_utf8_string_with_index";
+	static char *function = "libfvalue_integer_copy_to_byte_stream";
 
 	if( integer == NULL )
 	{
@@ -528,132 +676,199 @@ int libfvalue_integer_copy_from_utf8_string_with_index(
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_with_index_copy_to_integer(
-	     utf8_string,
-	     utf8_string_length,
-	     utf8_string_index,
-	     &( integer->value ),
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer from UTF-8 string.",
-		 function,
-		 integer->value_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies the integer to an UTF-8 encoded string
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_integer_copy_to_utf8_string_with_index(
-     libfvalue_integer_t *integer,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf8_string_index,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_integer_copy_to_utf8_string_with_index";
-
-	if( integer == NULL )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_with_index_copy_from_integer(
-	     utf8_string,
-	     utf8_string_size,
-	     utf8_string_index,
-	     integer->value,
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( ( encoding != LIBFVALUE_ENDIAN_BIG )
+	 && ( encoding != LIBFVALUE_ENDIAN_LITTLE )
+	 && ( encoding != LIBFVALUE_ENDIAN_NATIVE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer to UTF-8 string.",
-		 function,
-		 integer->value_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies the integer from an UTF-16 encoded string
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_integer_copy_from_utf16_string_with_index(
-     libfvalue_integer_t *integer,
-     uint16_t *utf16_string,
-     size_t utf16_string_length,
-     size_t *utf16_string_index,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_integer_copy_from_utf16_string_with_index";
-
-	if( integer == NULL )
+	if( byte_stream_size < ( integer->value_size / 8 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	switch( integer->value_size )
+	{
+		case 8:
+			byte_stream[ 0 ] = (uint8_t) integer->value;
+
+			break;
+
+		case 16:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				byte_stream_copy_from_uint16_big_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else
+			{
+				byte_stream_copy_from_uint16_native_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			break;
+
+		case 32:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				byte_stream_copy_from_uint32_big_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else
+			{
+				byte_stream_copy_from_uint32_native_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			break;
+
+		case 64:
+			if( encoding == LIBFVALUE_ENDIAN_BIG )
+			{
+				byte_stream_copy_from_uint64_big_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else if( encoding == LIBFVALUE_ENDIAN_LITTLE )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			else
+			{
+				byte_stream_copy_from_uint64_native_endian(
+				 byte_stream,
+				 integer->value );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value size: %" PRIzd ".",
+			 function,
+			 integer->value_size );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a byte stream of the integer
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_get_byte_stream_size(
+     libfvalue_integer_t *integer,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_get_byte_stream_size";
+
+	if( integer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_utf16_string_with_index_copy_to_integer(
-	     utf16_string,
-	     utf16_string_length,
-	     utf16_string_index,
-	     &( integer->value ),
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( integer->value_size != 8 )
+	 && ( integer->value_size != 16 )
+	 && ( integer->value_size != 32 )
+	 && ( integer->value_size != 64 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer from UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value size: %" PRIzd ".",
 		 function,
 		 integer->value_size );
 
 		return( -1 );
 	}
+	*byte_stream_size = integer->value_size / 8;
+
 	return( 1 );
 }
 
-/* Copies the integer to an UTF-16 encoded string
+/* Copies the integer from an integer value
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_integer_copy_to_utf16_string_with_index(
+int libfvalue_integer_copy_from_integer(
      libfvalue_integer_t *integer,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     size_t *utf16_string_index,
-     uint32_t string_format_flags,
+     uint64_t integer_value,
+     size_t integer_value_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_integer_copy_to_utf16_string_with_index";
+	static char *function = "libfvalue_integer_copy_from_integer";
 
 	if( integer == NULL )
 	{
@@ -666,40 +881,36 @@ int libfvalue_integer_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
-	if( libfvalue_utf16_string_with_index_copy_from_integer(
-	     utf16_string,
-	     utf16_string_size,
-	     utf16_string_index,
-	     integer->value,
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( ( integer_value_size != 8 )
+	 && ( integer_value_size != 16 )
+	 && ( integer_value_size != 32 )
+	 && ( integer_value_size != 64 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer to UTF-16 string.",
-		 function,
-		 integer->value_size );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported integer value size.",
+		 function );
 
 		return( -1 );
 	}
+	integer->value      = integer_value;
+	integer->value_size = integer_value_size;
+
 	return( 1 );
 }
 
-/* Copies the integer from an UTF-32 encoded string
+/* Copies the integer to an integer value
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_integer_copy_from_utf32_string_with_index(
+int libfvalue_integer_copy_to_integer(
      libfvalue_integer_t *integer,
-     uint32_t *utf32_string,
-     size_t utf32_string_length,
-     size_t *utf32_string_index,
-     uint32_t string_format_flags,
+     uint64_t *integer_value,
+     size_t *integer_value_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_integer_copy_from_utf32_string_with_index";
+	static char *function = "libfvalue_integer_copy_to_integer";
 
 	if( integer == NULL )
 	{
@@ -712,40 +923,44 @@ int libfvalue_integer_copy_from_utf32_string_with_index(
 
 		return( -1 );
 	}
-	if( libfvalue_utf32_string_with_index_copy_to_integer(
-	     utf32_string,
-	     utf32_string_length,
-	     utf32_string_index,
-	     &( integer->value ),
-	     integer->value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( integer_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer from UTF-32 string.",
-		 function,
-		 integer->value_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value size.",
+		 function );
 
 		return( -1 );
 	}
+	*integer_value      = integer->value;
+	*integer_value_size = integer->value_size;
+
 	return( 1 );
 }
 
-/* Copies the integer to an UTF-32 encoded string
+/* Retrieves the size of a string of the integer
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_integer_copy_to_utf32_string_with_index(
+int libfvalue_integer_get_string_size(
      libfvalue_integer_t *integer,
-     uint32_t *utf32_string,
-     size_t utf32_string_size,
-     size_t *utf32_string_index,
+     size_t *string_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_integer_copy_to_utf32_string_with_index";
+	static char *function = "libfvalue_integer_get_string_size";
 
 	if( integer == NULL )
 	{
@@ -758,10 +973,8 @@ int libfvalue_integer_copy_to_utf32_string_with_index(
 
 		return( -1 );
 	}
-	if( libfvalue_utf32_string_with_index_copy_from_integer(
-	     utf32_string,
-	     utf32_string_size,
-	     utf32_string_index,
+	if( libfvalue_string_size_from_integer(
+	     string_size,
 	     integer->value,
 	     integer->value_size,
 	     string_format_flags,
@@ -771,7 +984,7 @@ int libfvalue_integer_copy_to_utf32_string_with_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy %" PRIzd "-bit integer to UTF-32 string.",
+		 "%s: unable to determine size of string of %" PRIzd "-bit integer.",
 		 function,
 		 integer->value_size );
 
@@ -780,158 +993,82 @@ int libfvalue_integer_copy_to_utf32_string_with_index(
 	return( 1 );
 }
 
-/* Determines the size of a string of an integer value
- * The integer value size is in bits
+/* Copies the integer from an UTF-8 encoded string
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_string_size_from_integer(
-     size_t *string_size,
-     uint64_t integer_value,
-     size_t integer_value_size,
+int libfvalue_integer_copy_from_utf8_string_with_index(
+     libfvalue_integer_t *integer,
+     uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *utf8_string_index,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libfvalue_string_size_from_integer";
-	uint64_t divider            = 0;
-	uint32_t string_format_type = 0;
-	uint32_t supported_flags    = 0;
-	uint8_t is_signed           = 0;
-	int8_t bit_shift            = 0;
+	static char *function = "libfvalue_integer_copy_from_utf8_string_with_index";
 
-	if( string_size == NULL )
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string size.",
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( integer_value_size != 8 )
-	 && ( integer_value_size != 16 )
-	 && ( integer_value_size != 32 )
-	 && ( integer_value_size != 64 ) )
+	if( libfvalue_utf8_string_with_index_copy_to_integer(
+	     utf8_string,
+	     utf8_string_length,
+	     utf8_string_index,
+	     &( integer->value ),
+	     integer->value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported integer value size.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy %" PRIzd "-bit integer from UTF-8 string.",
+		 function,
+		 integer->value_size );
 
 		return( -1 );
 	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR;
+	return( 1 );
+}
 
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
-
-		return( -1 );
-	}
-	string_format_type = string_format_flags & 0x000000ffUL;
+/* Copies the integer to an UTF-8 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_copy_to_utf8_string_with_index(
+     libfvalue_integer_t *integer,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_copy_to_utf8_string_with_index";
 
-	if( ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN ) )
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-		if( integer_value == 0 )
-		{
-			*string_size = 6;
-		}
-		else
-		{
-			*string_size = 5;
-		}
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		*string_size = ( integer_value_size >> 2 ) + 1;
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			*string_size += 2;
-		}
-	}
-	else
-	{
-		/* The string is at least a single digit with an end of string character
-		 */
-		*string_size = 2;
-
-		bit_shift = (uint8_t) ( integer_value_size - 1 );
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
-		{
-			is_signed = (uint8_t) ( integer_value >> bit_shift );
-
-			if( is_signed != 0 )
-			{
-				*string_size += 1;
-
-				integer_value &= ~( (uint64_t) 1 << bit_shift );
-
-				if( integer_value == 0 )
-				{
-					integer_value |= (uint64_t) 1 << bit_shift;
-				}
-			}
-		}
-		divider = 1;
-
-		while( ( integer_value / divider ) >= 10 )
-		{
-			divider *= 10;
-
-			*string_size += 1;
-		}
-	}
-	return( 1 );
-}
-
-/* Copies an UTF-8 encoded string from an integer value
- * The integer value size is in bits
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_utf8_string_copy_from_integer(
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     uint64_t integer_value,
-     size_t integer_value_size,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function    = "libfvalue_utf8_string_copy_from_integer";
-	size_t utf8_string_index = 0;
-
 	if( libfvalue_utf8_string_with_index_copy_from_integer(
 	     utf8_string,
 	     utf8_string_size,
-	     &utf8_string_index,
-	     integer_value,
-	     integer_value_size,
+	     utf8_string_index,
+	     integer->value,
+	     integer->value_size,
 	     string_format_flags,
 	     error ) != 1 )
 	{
@@ -939,374 +1076,408 @@ int libfvalue_utf8_string_copy_from_integer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy integer value to UTF-8 string.",
-		 function );
+		 "%s: unable to copy %" PRIzd "-bit integer to UTF-8 string.",
+		 function,
+		 integer->value_size );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Copies an UTF-8 encoded string of from integer value
- * The integer value size is in bits
+/* Copies the integer from an UTF-16 encoded string
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf8_string_with_index_copy_from_integer(
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf8_string_index,
-     uint64_t integer_value,
-     size_t integer_value_size,
+int libfvalue_integer_copy_from_utf16_string_with_index(
+     libfvalue_integer_t *integer,
+     uint16_t *utf16_string,
+     size_t utf16_string_length,
+     size_t *utf16_string_index,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function         = "libfvalue_utf8_string_with_index_copy_from_integer";
-	size_t safe_utf8_string_index = 0;
-	uint64_t divider              = 0;
-	uint32_t string_format_type   = 0;
-	uint32_t supported_flags      = 0;
-	uint8_t byte_value            = 0;
-	uint8_t is_signed             = 0;
-	uint8_t number_of_characters  = 0;
-	int8_t bit_shift              = 0;
+	static char *function = "libfvalue_integer_copy_from_utf16_string_with_index";
 
-	if( utf8_string == NULL )
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( libfvalue_utf16_string_with_index_copy_to_integer(
+	     utf16_string,
+	     utf16_string_length,
+	     utf16_string_index,
+	     &( integer->value ),
+	     integer->value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy %" PRIzd "-bit integer from UTF-16 string.",
+		 function,
+		 integer->value_size );
 
 		return( -1 );
 	}
-	if( utf8_string_index == NULL )
+	return( 1 );
+}
+
+/* Copies the integer to an UTF-16 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_copy_to_utf16_string_with_index(
+     libfvalue_integer_t *integer,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_copy_to_utf16_string_with_index";
+
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf8_string_index >= utf8_string_size )
+	if( libfvalue_utf16_string_with_index_copy_from_integer(
+	     utf16_string,
+	     utf16_string_size,
+	     utf16_string_index,
+	     integer->value,
+	     integer->value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-8 string index value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy %" PRIzd "-bit integer to UTF-16 string.",
+		 function,
+		 integer->value_size );
 
 		return( -1 );
 	}
-	safe_utf8_string_index = *utf8_string_index;
+	return( 1 );
+}
 
-	if( ( integer_value_size != 8 )
-	 && ( integer_value_size != 16 )
-	 && ( integer_value_size != 32 )
-	 && ( integer_value_size != 64 ) )
+/* Copies the integer from an UTF-32 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_copy_from_utf32_string_with_index(
+     libfvalue_integer_t *integer,
+     uint32_t *utf32_string,
+     size_t utf32_string_length,
+     size_t *utf32_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_copy_from_utf32_string_with_index";
+
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported integer value size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR;
-
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	if( libfvalue_utf32_string_with_index_copy_to_integer(
+	     utf32_string,
+	     utf32_string_length,
+	     utf32_string_index,
+	     &( integer->value ),
+	     integer->value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy %" PRIzd "-bit integer from UTF-32 string.",
 		 function,
-		 string_format_flags );
+		 integer->value_size );
 
 		return( -1 );
 	}
-	string_format_type = string_format_flags & 0x000000ffUL;
+	return( 1 );
+}
 
-	if( ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN ) )
+/* Copies the integer to an UTF-32 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_copy_to_utf32_string_with_index(
+     libfvalue_integer_t *integer,
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_copy_to_utf32_string_with_index";
+
+	if( integer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-		if( integer_value == 0 )
-		{
-			number_of_characters = 6;
-		}
-		else
-		{
-			number_of_characters = 5;
-		}
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
+	if( libfvalue_utf32_string_with_index_copy_from_integer(
+	     utf32_string,
+	     utf32_string_size,
+	     utf32_string_index,
+	     integer->value,
+	     integer->value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
-		number_of_characters = (uint8_t) ( integer_value_size >> 2 ) + 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy %" PRIzd "-bit integer to UTF-32 string.",
+		 function,
+		 integer->value_size );
 
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			number_of_characters += 2;
-		}
+		return( -1 );
 	}
-	else
-	{
-		/* The string is at least a single digit with an end of string character
-		 */
-		number_of_characters = 2;
-
-		bit_shift = (uint8_t) ( integer_value_size - 1 );
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
-		{
-			is_signed = (uint8_t) ( integer_value >> bit_shift );
-
-			if( is_signed != 0 )
-			{
-				number_of_characters += 1;
-
-				integer_value &= ~( (uint64_t) 1 << bit_shift );
-
-				if( integer_value == 0 )
-				{
-					integer_value |= (uint64_t) 1 << bit_shift;
-				}
-			}
-		}
-		divider = 1;
+	return( 1 );
+}
 
-		while( ( integer_value / divider ) >= 10 )
-		{
-			divider *= 10;
+/* Determines the number of decimal digits of an integer value
+ * The number of digits is estimated from the number of significant bits
+ * and corrected with a single comparison, which avoids repeated divisions
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_integer_get_number_of_decimal_digits(
+     uint64_t integer_value,
+     uint8_t *number_of_digits,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvalue_integer_get_number_of_decimal_digits";
+	uint8_t number_of_bits  = 0;
+	uint8_t digits_estimate = 0;
 
-			number_of_characters += 1;
-		}
-	}
-	if( ( number_of_characters > utf8_string_size )
-	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters ) ) )
+	if( number_of_digits == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string size too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of digits.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
+#if defined( __GNUC__ )
+	number_of_bits = (uint8_t) ( 64 - __builtin_clzll( (unsigned long long) ( integer_value | 1 ) ) );
+#else
+	number_of_bits = 1;
+
+	while( ( number_of_bits < 64 )
+	    && ( ( integer_value >> number_of_bits ) != 0 ) )
 	{
-		if( integer_value == 0 )
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'f';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'a';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'l';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 's';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'e';
-		}
-		else
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 't';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'r';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'u';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'e';
-		}
+		number_of_bits++;
 	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0';
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'x';
-		}
-		bit_shift = (uint8_t) ( integer_value_size - 4 );
-
-		do
-		{
-			byte_value = (uint8_t) ( ( integer_value >> bit_shift ) & 0x0f );
+#endif
+	/* 1233 / 4096 approximates log10( 2 )
+	 */
+	digits_estimate = (uint8_t) ( ( (uint16_t) number_of_bits * 1233 ) >> 12 );
 
-			if( byte_value <= 9 )
-			{
-				utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + byte_value;
-			}
-			else
-			{
-				utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'a' + byte_value - 10;
-			}
-			bit_shift -= 4;
-		}
-		while( bit_shift >= 0 );
+	/* The lowest bit is set so that 0 is formatted as a single digit,
+	 * since the powers of 10 are even this does not affect other values
+	 */
+	if( ( integer_value | 1 ) < libfvalue_integer_decimal_powers_of_10[ digits_estimate ] )
+	{
+		*number_of_digits = digits_estimate;
 	}
 	else
 	{
-		if( is_signed != 0 )
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '-';
-		}
-		while( divider > 1 )
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
-
-			integer_value %= divider;
-
-			divider /= 10;
-		}
-		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
+		*number_of_digits = digits_estimate + 1;
 	}
-	utf8_string[ safe_utf8_string_index++ ] = 0;
-
-	*utf8_string_index = safe_utf8_string_index;
-
 	return( 1 );
 }
 
-/* Copies an UTF-8 encoded string to an integer value
- * The integer value size is in bits
+/* Copies the decimal digits of an integer value to a buffer
+ * The digits are written as ASCII characters, 2 at a time, from the least
+ * significant digit backwards, without an end of string character
+ * If number of digits exceeds the number of digits of the integer value
+ * the digits are padded with leading zeros
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf8_string_copy_to_integer(
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     uint64_t *integer_value,
-     size_t integer_value_size,
-     uint32_t string_format_flags,
+int libfvalue_integer_copy_to_decimal_digits(
+     uint64_t integer_value,
+     uint8_t *digits,
+     uint8_t number_of_digits,
      libcerror_error_t **error )
 {
-	static char *function    = "libfvalue_utf8_string_copy_to_integer";
-	size_t utf8_string_index = 0;
+	static char *function = "libfvalue_integer_copy_to_decimal_digits";
+	size_t pair_index     = 0;
+	uint8_t digit_index   = 0;
 
-	if( libfvalue_utf8_string_with_index_copy_to_integer(
-	     utf8_string,
-	     utf8_string_length,
-	     &utf8_string_index,
-	     integer_value,
-	     integer_value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	if( digits == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-8 string to integer value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digits.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies an UTF-8 encoded string to an integer value
- * The integer value size is in bits
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_utf8_string_with_index_copy_to_integer(
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     size_t *utf8_string_index,
-     uint64_t *integer_value,
-     size_t integer_value_size,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function         = "libfvalue_utf8_string_with_index_copy_to_integer";
-	size_t maximum_string_index   = 0;
-	size_t safe_utf8_string_index = 0;
-	uint64_t divider              = 0;
-	uint64_t value_64bit          = 0;
-	uint32_t string_format_type   = 0;
-	uint32_t supported_flags      = 0;
-	uint8_t byte_value            = 0;
-	uint8_t character_value       = 0;
-	int8_t bit_shift              = 0;
-	int8_t sign                   = 1;
-
-	if( utf8_string == NULL )
+	if( ( number_of_digits == 0 )
+	 || ( number_of_digits > 20 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of digits value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+	if( ( number_of_digits < 20 )
+	 && ( integer_value >= libfvalue_integer_decimal_powers_of_10[ number_of_digits ] ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: number of digits value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_index == NULL )
+	digit_index = number_of_digits;
+
+	while( digit_index >= 2 )
+	{
+		pair_index     = (size_t) ( integer_value % 100 ) * 2;
+		integer_value /= 100;
+
+		digits[ --digit_index ] = libfvalue_integer_decimal_digit_pairs[ pair_index + 1 ];
+		digits[ --digit_index ] = libfvalue_integer_decimal_digit_pairs[ pair_index ];
+	}
+	if( digit_index == 1 )
+	{
+		digits[ 0 ] = (uint8_t) '0' + (uint8_t) integer_value;
+	}
+	return( 1 );
+}
+
+/* Copies 8 decimal digits to an integer value
+ * The digits are validated and converted at the same time using SIMD
+ * within a register (SWAR) operations on a 64-bit value
+ * Returns 1 if successful, 0 if not all characters are decimal digits or -1 on error
+ */
+int libfvalue_integer_copy_from_eight_decimal_digits(
+     const uint8_t *decimal_digits,
+     uint32_t *integer_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_integer_copy_from_eight_decimal_digits";
+	uint64_t value_64bit  = 0;
+
+	if( decimal_digits == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
+		 "%s: invalid decimal digits.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf8_string_index >= utf8_string_length )
+	if( integer_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-8 string index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
 		 function );
 
 		return( -1 );
 	}
-	safe_utf8_string_index = *utf8_string_index;
+	/* The first digit is stored in the least significant byte
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 decimal_digits,
+	 value_64bit );
 
-	if( integer_value == NULL )
+	/* A byte is a decimal digit if its upper nibble is 3 and adding 6
+	 * to it does not carry into the upper nibble
+	 */
+	if( ( ( value_64bit & 0xf0f0f0f0f0f0f0f0ULL )
+	    | ( ( ( value_64bit + 0x0606060606060606ULL ) & 0xf0f0f0f0f0f0f0f0ULL ) >> 4 ) ) != 0x3333333333333333ULL )
+	{
+		return( 0 );
+	}
+	/* Combine adjacent digits into 4 values of 2 digits, then into 2 values
+	 * of 4 digits and finally into a single value of 8 digits
+	 */
+	value_64bit = ( ( value_64bit & 0x0f0f0f0f0f0f0f0fULL ) * ( 1 + ( 10 << 8 ) ) ) >> 8;
+	value_64bit = ( ( value_64bit & 0x00ff00ff00ff00ffULL ) * ( 1 + ( 100 << 16 ) ) ) >> 16;
+	value_64bit = ( ( value_64bit & 0x0000ffff0000ffffULL ) * ( 1 + ( 10000ULL << 32 ) ) ) >> 32;
+
+	*integer_value = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Determines the size of a string of an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_size_from_integer(
+     size_t *string_size,
+     uint64_t integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvalue_string_size_from_integer";
+	uint32_t string_format_type = 0;
+	uint32_t supported_flags    = 0;
+	uint8_t is_signed           = 0;
+	uint8_t number_of_digits    = 0;
+	int8_t bit_shift            = 0;
+
+	if( string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer value.",
+		 "%s: invalid string size.",
 		 function );
 
 		return( -1 );
@@ -1361,240 +1532,84 @@ int libfvalue_utf8_string_with_index_copy_to_integer(
 	{
 		if( integer_value == 0 )
 		{
-			maximum_string_index = 5;
+			*string_size = 6;
 		}
 		else
 		{
-			maximum_string_index = 4;
+			*string_size = 5;
 		}
 	}
 	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
 	{
-		maximum_string_index = (size_t) ( integer_value_size >> 2 );
+		*string_size = ( integer_value_size >> 2 ) + 1;
 
 		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
 		{
-			maximum_string_index += 2;
+			*string_size += 2;
 		}
 	}
 	else
 	{
 		/* The string is at least a single digit with an end of string character
 		 */
-		maximum_string_index = 2;
+		*string_size = 2;
 
 		bit_shift = (uint8_t) ( integer_value_size - 1 );
 
-		divider = 1;
+		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
+		{
+			is_signed = (uint8_t) ( integer_value >> bit_shift );
 
-		value_64bit = ~( ( ~( (uint64_t) 1 << bit_shift ) >> bit_shift ) << bit_shift );
+			if( is_signed != 0 )
+			{
+				*string_size += 1;
+
+				integer_value &= ~( (uint64_t) 1 << bit_shift );
 
-		while( ( value_64bit / divider ) >= 10 )
+				if( integer_value == 0 )
+				{
+					integer_value |= (uint64_t) 1 << bit_shift;
+				}
+			}
+		}
+		if( libfvalue_integer_get_number_of_decimal_digits(
+		     integer_value,
+		     &number_of_digits,
+		     error ) != 1 )
 		{
-			divider *= 10;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of decimal digits.",
+			 function );
 
-			maximum_string_index += 1;
+			return( -1 );
 		}
+		*string_size += number_of_digits - 1;
 	}
-	maximum_string_index += safe_utf8_string_index;
-
-	if( maximum_string_index > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid maximum string index value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	value_64bit = 0;
-
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-/* TODO */
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			character_value = utf8_string[ safe_utf8_string_index++ ];
-
-			if( character_value != (uint8_t) '0' )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf8_string_index );
-
-				return( -1 );
-			}
-			character_value = utf8_string[ safe_utf8_string_index++ ];
-
-			if( character_value != (uint8_t) 'x' )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf8_string_index );
-
-				return( -1 );
-			}
-		}
-		while( safe_utf8_string_index < utf8_string_length )
-		{
-			character_value = utf8_string[ safe_utf8_string_index ];
-
-			if( character_value == 0 )
-			{
-				break;
-			}
-			if( safe_utf8_string_index > (size_t) maximum_string_index )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-				 "%s: string too large.",
-				 function );
-
-				return( -1 );
-			}
-			value_64bit <<= 4;
-
-			if( ( character_value >= (uint8_t) '0' )
-			 && ( character_value <= (uint8_t) '9' ) )
-			{
-				byte_value = character_value - (uint8_t) '0';
-			}
-			else if( ( character_value >= (uint8_t) 'A' )
-			      && ( character_value <= (uint8_t) 'F' ) )
-			{
-				byte_value = character_value - (uint8_t) 'A' + 10;
-			}
-			else if( ( character_value >= (uint8_t) 'a' )
-			      && ( character_value <= (uint8_t) 'f' ) )
-			{
-				byte_value = character_value - (uint8_t) 'a' + 10;
-			}
-			else
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf8_string_index );
-
-				return( -1 );
-			}
-			value_64bit += byte_value;
-
-			safe_utf8_string_index++;
-		}
-	}
-	else
-	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
-		{
-			character_value = utf8_string[ safe_utf8_string_index ];
-
-			/* In the maximum possible string one character is substituted for the sign
-			 */
-			if( character_value == (uint8_t) '-' )
-			{
-				safe_utf8_string_index++;
-
-				sign = -1;
-			}
-			else if( character_value == (uint8_t) '+' )
-			{
-				safe_utf8_string_index++;
-			}
-		}
-		while( safe_utf8_string_index < utf8_string_length )
-		{
-			character_value = utf8_string[ safe_utf8_string_index ];
-
-			if( character_value == 0 )
-			{
-				break;
-			}
-			if( safe_utf8_string_index > (size_t) maximum_string_index )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-				 "%s: string too large.",
-				 function );
-
-				return( -1 );
-			}
-			value_64bit *= 10;
-
-			if( ( character_value < (uint8_t) '0' )
-			 || ( character_value > (uint8_t) '9' ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf8_string_index );
-
-				return( -1 );
-			}
-			character_value -= (uint8_t) '0';
-
-			value_64bit += character_value;
-
-			safe_utf8_string_index++;
-		}
-		if( ( sign == -1 )
-		 && ( value_64bit != 0 ) )
-		{
-			value_64bit = ~( value_64bit - 1 );
-		}
-	}
-	*utf8_string_index = safe_utf8_string_index;
-	*integer_value     = value_64bit;
-
 	return( 1 );
 }
 
-/* Copies an UTF-16 encoded string of an integer value
+/* Copies an UTF-8 encoded string from an integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf16_string_copy_from_integer(
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+int libfvalue_utf8_string_copy_from_integer(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      uint64_t integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function     = "libfvalue_utf16_string_copy_from_integer";
-	size_t utf16_string_index = 0;
+	static char *function    = "libfvalue_utf8_string_copy_from_integer";
+	size_t utf8_string_index = 0;
 
-	if( libfvalue_utf16_string_with_index_copy_from_integer(
-	     utf16_string,
-	     utf16_string_size,
-	     &utf16_string_index,
+	if( libfvalue_utf8_string_with_index_copy_from_integer(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
 	     integer_value,
 	     integer_value_size,
 	     string_format_flags,
@@ -1604,7 +1619,7 @@ int libfvalue_utf16_string_copy_from_integer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy integer value to UTF-16 string.",
+		 "%s: unable to copy integer value to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -1612,74 +1627,75 @@ int libfvalue_utf16_string_copy_from_integer(
 	return( 1 );
 }
 
-/* Copies an UTF-16 encoded string of an integer value
+/* Copies an UTF-8 encoded string of from integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf16_string_with_index_copy_from_integer(
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     size_t *utf16_string_index,
+int libfvalue_utf8_string_with_index_copy_from_integer(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
      uint64_t integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function          = "libfvalue_utf16_string_with_index_copy_from_integer";
-	size_t safe_utf16_string_index = 0;
-	uint64_t divider               = 0;
-	uint32_t string_format_type    = 0;
-	uint32_t supported_flags       = 0;
-	uint8_t byte_value             = 0;
-	uint8_t is_signed              = 0;
-	uint8_t number_of_characters   = 0;
-	int8_t bit_shift               = 0;
+	uint8_t byte_values[ 8 ];
+
+	static char *function         = "libfvalue_utf8_string_with_index_copy_from_integer";
+	size_t safe_utf8_string_index = 0;
+	uint32_t string_format_type   = 0;
+	uint32_t supported_flags      = 0;
+	uint8_t is_signed             = 0;
+	uint8_t number_of_characters  = 0;
+	uint8_t number_of_digits      = 0;
+	int8_t bit_shift              = 0;
 
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_index == NULL )
+	if( utf8_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string index.",
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf16_string_index >= utf16_string_size )
+	if( *utf8_string_index >= utf8_string_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-16 string index value out of bounds.",
+		 "%s: invalid UTF-8 string index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	safe_utf16_string_index = *utf16_string_index;
+	safe_utf8_string_index = *utf8_string_index;
 
 	if( ( integer_value_size != 8 )
 	 && ( integer_value_size != 16 )
@@ -1771,23 +1787,30 @@ int libfvalue_utf16_string_with_index_copy_from_integer(
 				}
 			}
 		}
-		divider = 1;
-
-		while( ( integer_value / divider ) >= 10 )
+		if( libfvalue_integer_get_number_of_decimal_digits(
+		     integer_value,
+		     &number_of_digits,
+		     error ) != 1 )
 		{
-			divider *= 10;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of decimal digits.",
+			 function );
 
-			number_of_characters += 1;
+			return( -1 );
 		}
+		number_of_characters += number_of_digits - 1;
 	}
-	if( ( number_of_characters > utf16_string_size )
-	 || ( safe_utf16_string_index > ( utf16_string_size - number_of_characters ) ) )
+	if( ( number_of_characters > utf8_string_size )
+	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string size too small.",
+		 "%s: UTF-8 string size too small.",
 		 function );
 
 		return( -1 );
@@ -1796,87 +1819,99 @@ int libfvalue_utf16_string_with_index_copy_from_integer(
 	{
 		if( integer_value == 0 )
 		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'f';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'a';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'l';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 's';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'e';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'f';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'a';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'l';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 's';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'e';
 		}
 		else
 		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 't';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'r';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'u';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'e';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 't';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'r';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'u';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'e';
 		}
 	}
 	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
 	{
 		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
 		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0';
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'x';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'x';
 		}
-		bit_shift = (uint8_t) ( integer_value_size - 4 );
+		byte_stream_copy_from_uint64_big_endian(
+		 byte_values,
+		 integer_value );
 
-		do
+		if( libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+		     utf8_string,
+		     utf8_string_size,
+		     &safe_utf8_string_index,
+		     &( byte_values[ 8 - ( integer_value_size >> 3 ) ] ),
+		     integer_value_size >> 3,
+		     LIBFVALUE_BASE16_CASE_LOWER,
+		     error ) != 1 )
 		{
-			byte_value = (uint16_t) ( ( integer_value >> bit_shift ) & 0x0f );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy hexadecimal digits.",
+			 function );
 
-			if( byte_value <= 9 )
-			{
-				utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + byte_value;
-			}
-			else
-			{
-				utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'a' + byte_value - 10;
-			}
-			bit_shift -= 4;
+			return( -1 );
 		}
-		while( bit_shift >= 0 );
 	}
 	else
 	{
 		if( is_signed != 0 )
 		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '-';
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '-';
 		}
-		while( divider > 1 )
+		if( libfvalue_integer_copy_to_decimal_digits(
+		     integer_value,
+		     &( utf8_string[ safe_utf8_string_index ] ),
+		     number_of_digits,
+		     error ) != 1 )
 		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
-
-			integer_value %= divider;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy decimal digits.",
+			 function );
 
-			divider /= 10;
+			return( -1 );
 		}
-		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
+		safe_utf8_string_index += number_of_digits;
 	}
-	utf16_string[ safe_utf16_string_index++ ] = 0;
+	utf8_string[ safe_utf8_string_index++ ] = 0;
 
-	*utf16_string_index = safe_utf16_string_index;
+	*utf8_string_index = safe_utf8_string_index;
 
 	return( 1 );
 }
 
-/* Copies an UTF-16 encoded string to an integer value
+/* Copies an UTF-8 encoded string to an integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf16_string_copy_to_integer(
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+int libfvalue_utf8_string_copy_to_integer(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      uint64_t *integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function     = "libfvalue_utf16_string_copy_to_integer";
-	size_t utf16_string_index = 0;
+	static char *function    = "libfvalue_utf8_string_copy_to_integer";
+	size_t utf8_string_index = 0;
 
-	if( libfvalue_utf16_string_with_index_copy_to_integer(
-	     utf16_string,
-	     utf16_string_length,
-	     &utf16_string_index,
+	if( libfvalue_utf8_string_with_index_copy_to_integer(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf8_string_index,
 	     integer_value,
 	     integer_value_size,
 	     string_format_flags,
@@ -1886,7 +1921,7 @@ int libfvalue_utf16_string_copy_to_integer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-16 string to integer value.",
+		 "%s: unable to copy UTF-8 string to integer value.",
 		 function );
 
 		return( -1 );
@@ -1894,76 +1929,78 @@ int libfvalue_utf16_string_copy_to_integer(
 	return( 1 );
 }
 
-/* Copies an UTF-16 encoded string to an integer value
+/* Copies an UTF-8 encoded string to an integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf16_string_with_index_copy_to_integer(
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     size_t *utf16_string_index,
+int libfvalue_utf8_string_with_index_copy_to_integer(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *utf8_string_index,
      uint64_t *integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function          = "libfvalue_utf16_string_with_index_copy_to_integer";
-	size_t maximum_string_index    = 0;
-	size_t safe_utf16_string_index = 0;
-	uint64_t divider               = 0;
-	uint64_t value_64bit           = 0;
-	uint32_t string_format_type    = 0;
-	uint32_t supported_flags       = 0;
-	uint16_t character_value       = 0;
-	uint8_t byte_value             = 0;
-	int8_t bit_shift               = 0;
-	int8_t sign                    = 1;
+	static char *function         = "libfvalue_utf8_string_with_index_copy_to_integer";
+	size_t maximum_string_index   = 0;
+	size_t number_of_characters   = 0;
+	size_t safe_utf8_string_index = 0;
+	uint64_t value_64bit          = 0;
+	uint32_t string_format_type   = 0;
+	uint32_t supported_flags      = 0;
+	uint32_t value_32bit          = 0;
+	uint8_t character_value       = 0;
+	uint8_t number_of_digits      = 0;
+	int8_t bit_shift              = 0;
+	int8_t sign                   = 1;
+	int result                    = 0;
 
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_index == NULL )
+	if( utf8_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string index.",
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf16_string_index >= utf16_string_length )
+	if( *utf8_string_index >= utf8_string_length )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-16 string index value out of bounds.",
+		 "%s: invalid UTF-8 string index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	safe_utf16_string_index = *utf16_string_index;
+	safe_utf8_string_index = *utf8_string_index;
 
 	if( integer_value == NULL )
 	{
@@ -2044,24 +2081,29 @@ int libfvalue_utf16_string_with_index_copy_to_integer(
 	}
 	else
 	{
-		/* The string is at least a single digit with an end of string character
-		 */
-		maximum_string_index = 2;
-
 		bit_shift = (uint8_t) ( integer_value_size - 1 );
 
-		divider = 1;
-
 		value_64bit = ~( ( ~( (uint64_t) 1 << bit_shift ) >> bit_shift ) << bit_shift );
 
-		while( ( value_64bit / divider ) >= 10 )
+		if( libfvalue_integer_get_number_of_decimal_digits(
+		     value_64bit,
+		     &number_of_digits,
+		     error ) != 1 )
 		{
-			divider *= 10;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of decimal digits.",
+			 function );
 
-			maximum_string_index += 1;
+			return( -1 );
 		}
+		/* The string is at least a single digit with an end of string character
+		 */
+		maximum_string_index = (size_t) number_of_digits + 1;
 	}
-	maximum_string_index += safe_utf16_string_index;
+	maximum_string_index += safe_utf8_string_index;
 
 	if( maximum_string_index > (size_t) SSIZE_MAX )
 	{
@@ -2084,46 +2126,44 @@ int libfvalue_utf16_string_with_index_copy_to_integer(
 	{
 		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
 		{
-			character_value = utf16_string[ safe_utf16_string_index++ ];
+			character_value = utf8_string[ safe_utf8_string_index++ ];
 
-			if( character_value != (uint16_t) '0' )
+			if( character_value != (uint8_t) '0' )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x04%" PRIx16 " at index: %d.",
+				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
 				 function,
 				 character_value,
-				 safe_utf16_string_index );
+				 safe_utf8_string_index );
 
 				return( -1 );
 			}
-			character_value = utf16_string[ safe_utf16_string_index++ ];
+			character_value = utf8_string[ safe_utf8_string_index++ ];
 
-			if( character_value != (uint16_t) 'x' )
+			if( character_value != (uint8_t) 'x' )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x04%" PRIx16 " at index: %d.",
+				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
 				 function,
 				 character_value,
-				 safe_utf16_string_index );
+				 safe_utf8_string_index );
 
 				return( -1 );
 			}
 		}
-		while( safe_utf16_string_index < utf16_string_length )
+		while( ( safe_utf8_string_index + number_of_characters ) < utf8_string_length )
 		{
-			character_value = utf16_string[ safe_utf16_string_index ];
-
-			if( character_value == 0 )
+			if( utf8_string[ safe_utf8_string_index + number_of_characters ] == 0 )
 			{
 				break;
 			}
-			if( safe_utf16_string_index > (size_t) maximum_string_index )
+			if( number_of_characters >= (size_t) ( integer_value_size >> 2 ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -2134,69 +2174,87 @@ int libfvalue_utf16_string_with_index_copy_to_integer(
 
 				return( -1 );
 			}
-			value_64bit <<= 4;
-
-			if( ( character_value >= (uint16_t) '0' )
-			 && ( character_value <= (uint16_t) '9' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint16_t) '0' );
-			}
-			else if( ( character_value >= (uint16_t) 'A' )
-			      && ( character_value <= (uint16_t) 'F' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint16_t) 'A' + 10 );
-			}
-			else if( ( character_value >= (uint16_t) 'a' )
-			      && ( character_value <= (uint16_t) 'f' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint16_t) 'a' + 10 );
-			}
-			else
+			number_of_characters++;
+		}
+		if( number_of_characters > 0 )
+		{
+			if( libfvalue_base16_copy_to_integer(
+			     &( utf8_string[ safe_utf8_string_index ] ),
+			     number_of_characters,
+			     &value_64bit,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x04%" PRIx16 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf16_string_index );
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy hexadecimal digits to integer value.",
+				 function );
 
 				return( -1 );
 			}
-			value_64bit += byte_value;
-
-			safe_utf16_string_index++;
+			safe_utf8_string_index += number_of_characters;
 		}
 	}
 	else
 	{
 		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
 		{
-			character_value = utf16_string[ safe_utf16_string_index ];
+			character_value = utf8_string[ safe_utf8_string_index ];
 
 			/* In the maximum possible string one character is substituted for the sign
 			 */
-			if( character_value == (uint16_t) '-' )
+			if( character_value == (uint8_t) '-' )
 			{
-				safe_utf16_string_index++;
+				safe_utf8_string_index++;
 
 				sign = -1;
 			}
-			else if( character_value == (uint16_t) '+' )
+			else if( character_value == (uint8_t) '+' )
 			{
-				safe_utf16_string_index++;
+				safe_utf8_string_index++;
 			}
 		}
-		while( safe_utf16_string_index < utf16_string_length )
+		while( safe_utf8_string_index < utf8_string_length )
 		{
-			character_value = utf16_string[ safe_utf16_string_index ];
+			/* Convert 8 digits at a time while they fit in the string
+			 */
+			if( ( ( utf8_string_length - safe_utf8_string_index ) >= 8 )
+			 && ( ( safe_utf8_string_index + 7 ) <= maximum_string_index ) )
+			{
+				result = libfvalue_integer_copy_from_eight_decimal_digits(
+				          &( utf8_string[ safe_utf8_string_index ] ),
+				          &value_32bit,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy decimal digits to integer value.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					value_64bit *= 100000000UL;
+					value_64bit += value_32bit;
+
+					safe_utf8_string_index += 8;
+
+					continue;
+				}
+			}
+			character_value = utf8_string[ safe_utf8_string_index ];
 
 			if( character_value == 0 )
 			{
 				break;
 			}
-			if( safe_utf16_string_index > (size_t) maximum_string_index )
+			if( safe_utf8_string_index > (size_t) maximum_string_index )
 			{
 				libcerror_error_set(
 				 error,
@@ -2209,25 +2267,25 @@ int libfvalue_utf16_string_with_index_copy_to_integer(
 			}
 			value_64bit *= 10;
 
-			if( ( character_value < (uint16_t) '0' )
-			 || ( character_value > (uint16_t) '9' ) )
+			if( ( character_value < (uint8_t) '0' )
+			 || ( character_value > (uint8_t) '9' ) )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x04%" PRIx16 " at index: %d.",
+				 "%s: unsupported character value: 0x%02" PRIx8 " at index: %d.",
 				 function,
 				 character_value,
-				 safe_utf16_string_index );
+				 safe_utf8_string_index );
 
 				return( -1 );
 			}
-			character_value = (uint8_t) ( character_value - (uint16_t) '0' );
+			character_value -= (uint8_t) '0';
 
 			value_64bit += character_value;
 
-			safe_utf16_string_index++;
+			safe_utf8_string_index++;
 		}
 		if( ( sign == -1 )
 		 && ( value_64bit != 0 ) )
@@ -2235,313 +2293,314 @@ int libfvalue_utf16_string_with_index_copy_to_integer(
 			value_64bit = ~( value_64bit - 1 );
 		}
 	}
-	*utf16_string_index = safe_utf16_string_index;
-	*integer_value      = value_64bit;
+	*utf8_string_index = safe_utf8_string_index;
+	*integer_value     = value_64bit;
 
 	return( 1 );
 }
 
-/* Copies an UTF-32 encoded string of an integer value
+/* Copies a string with the character size of an integer value
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The value is formatted in an UTF-8 string that is widened to the character size
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf32_string_copy_from_integer(
-     uint32_t *utf32_string,
-     size_t utf32_string_size,
+int libfvalue_string_with_index_copy_from_integer(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
      uint64_t integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function     = "libfvalue_utf32_string_copy_from_integer";
-	size_t utf32_string_index = 0;
+	uint8_t utf8_string[ LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE ];
 
-	if( libfvalue_utf32_string_with_index_copy_from_integer(
-	     utf32_string,
-	     utf32_string_size,
-	     &utf32_string_index,
-	     integer_value,
-	     integer_value_size,
-	     string_format_flags,
-	     error ) != 1 )
+	static char *function    = "libfvalue_string_with_index_copy_from_integer";
+	size_t safe_string_index = 0;
+	size_t utf8_string_index = 0;
+
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy integer value to UTF-32 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Copies an UTF-32 encoded string of an integer value
- * The integer value size is in bits
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_utf32_string_with_index_copy_from_integer(
-     uint32_t *utf32_string,
-     size_t utf32_string_size,
-     size_t *utf32_string_index,
-     uint64_t integer_value,
-     size_t integer_value_size,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function          = "libfvalue_utf32_string_with_index_copy_from_integer";
-	size_t safe_utf32_string_index = 0;
-	uint64_t divider               = 0;
-	uint32_t string_format_type    = 0;
-	uint32_t supported_flags       = 0;
-	uint8_t byte_value             = 0;
-	uint8_t is_signed              = 0;
-	uint8_t number_of_characters   = 0;
-	int8_t bit_shift               = 0;
-
-	if( utf32_string == NULL )
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_size > (size_t) SSIZE_MAX )
+	if( string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
+		 "%s: invalid string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_index == NULL )
+	if( string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string index.",
+		 "%s: invalid string index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *utf32_string_index >= utf32_string_size )
+	if( *string_index >= string_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-32 string index value out of bounds.",
+		 "%s: invalid string index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	safe_utf32_string_index = *utf32_string_index;
+	if( character_size == 1 )
+	{
+		return( libfvalue_utf8_string_with_index_copy_from_integer(
+		         string,
+		         string_size,
+		         string_index,
+		         integer_value,
+		         integer_value_size,
+		         string_format_flags,
+		         error ) );
+	}
+	safe_string_index = *string_index;
 
-	if( ( integer_value_size != 8 )
-	 && ( integer_value_size != 16 )
-	 && ( integer_value_size != 32 )
-	 && ( integer_value_size != 64 ) )
+	if( libfvalue_utf8_string_with_index_copy_from_integer(
+	     utf8_string,
+	     LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE,
+	     &utf8_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported integer value size.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy integer value to UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR;
-
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	/* The UTF-8 string index includes the end of string character
+	 */
+	if( utf8_string_index > ( string_size - safe_string_index ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string size too small.",
+		 function );
 
 		return( -1 );
 	}
-	string_format_type = string_format_flags & 0x000000ffUL;
-
-	if( ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN ) )
+	if( libfvalue_ascii_copy_to_string(
+	     utf8_string,
+	     utf8_string_index,
+	     &( string[ safe_string_index * character_size ] ),
+	     character_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to string.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-		if( integer_value == 0 )
-		{
-			number_of_characters = 6;
-		}
-		else
-		{
-			number_of_characters = 5;
-		}
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		number_of_characters = (uint8_t) ( integer_value_size >> 2 ) + 1;
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			number_of_characters += 2;
-		}
-	}
-	else
-	{
-		/* The string is at least a single digit with an end of string character
-		 */
-		number_of_characters = 2;
+	*string_index = safe_string_index + utf8_string_index;
 
-		bit_shift = (uint8_t) ( integer_value_size - 1 );
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
-		{
-			is_signed = (uint8_t) ( integer_value >> bit_shift );
+	return( 1 );
+}
 
-			if( is_signed != 0 )
-			{
-				number_of_characters += 1;
+/* Copies a string with the character size to an integer value
+ * The character size is 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32 strings
+ * The characters are narrowed to an UTF-8 string that is parsed, since parsing
+ * stops within the first LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE characters
+ * only these characters are narrowed
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_with_index_copy_to_integer(
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE ];
 
-				integer_value &= ~( (uint64_t) 1 << bit_shift );
+	static char *function     = "libfvalue_string_with_index_copy_to_integer";
+	size_t safe_string_index  = 0;
+	size_t utf8_string_index  = 0;
+	size_t utf8_string_length = 0;
 
-				if( integer_value == 0 )
-				{
-					integer_value |= (uint64_t) 1 << bit_shift;
-				}
-			}
-		}
-		divider = 1;
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
 
-		while( ( integer_value / divider ) >= 10 )
-		{
-			divider *= 10;
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size.",
+		 function );
 
-			number_of_characters += 1;
-		}
+		return( -1 );
 	}
-	if( ( number_of_characters > utf32_string_size )
-	 || ( safe_utf32_string_index > ( utf32_string_size - number_of_characters ) ) )
+	if( string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-32 string size too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
+	if( string_index == NULL )
 	{
-		if( integer_value == 0 )
-		{
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'f';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'a';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'l';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 's';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'e';
-		}
-		else
-		{
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 't';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'r';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'u';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'e';
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
 	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
+	if( *string_index >= string_length )
 	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) '0';
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'x';
-		}
-		bit_shift = (uint8_t) ( integer_value_size - 4 );
-
-		do
-		{
-			byte_value = (uint32_t) ( ( integer_value >> bit_shift ) & 0x0f );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
 
-			if( byte_value <= 9 )
-			{
-				utf32_string[ safe_utf32_string_index++ ] = (uint32_t) '0' + byte_value;
-			}
-			else
-			{
-				utf32_string[ safe_utf32_string_index++ ] = (uint32_t) 'a' + byte_value - 10;
-			}
-			bit_shift -= 4;
-		}
-		while( bit_shift >= 0 );
+		return( -1 );
 	}
-	else
+	if( character_size == 1 )
 	{
-		if( is_signed != 0 )
-		{
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) '-';
-		}
-		while( divider > 1 )
-		{
-			utf32_string[ safe_utf32_string_index++ ] = (uint32_t) '0' + (uint32_t) ( integer_value / divider );
+		return( libfvalue_utf8_string_with_index_copy_to_integer(
+		         string,
+		         string_length,
+		         string_index,
+		         integer_value,
+		         integer_value_size,
+		         string_format_flags,
+		         error ) );
+	}
+	safe_string_index  = *string_index;
+	utf8_string_length = string_length - safe_string_index;
 
-			integer_value %= divider;
+	if( utf8_string_length > LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE )
+	{
+		utf8_string_length = LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE;
+	}
+	if( libfvalue_ascii_copy_from_string(
+	     utf8_string,
+	     &( string[ safe_string_index * character_size ] ),
+	     character_size,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to UTF-8 string.",
+		 function );
 
-			divider /= 10;
-		}
-		utf32_string[ safe_utf32_string_index++ ] = (uint32_t) '0' + (uint32_t) ( integer_value / divider );
+		return( -1 );
 	}
-	utf32_string[ safe_utf32_string_index++ ] = 0;
+	if( libfvalue_utf8_string_with_index_copy_to_integer(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf8_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to integer value.",
+		 function );
 
-	*utf32_string_index = safe_utf32_string_index;
+		return( -1 );
+	}
+	*string_index = safe_string_index + utf8_string_index;
 
 	return( 1 );
 }
 
-/* Copies an UTF-32 encoded string to an integer value
+/* Copies an UTF-16 encoded string of an integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf32_string_copy_to_integer(
-     const uint32_t *utf32_string,
-     size_t utf32_string_length,
-     uint64_t *integer_value,
+int libfvalue_utf16_string_copy_from_integer(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint64_t integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function     = "libfvalue_utf32_string_copy_to_integer";
-	size_t utf32_string_index = 0;
+	static char *function     = "libfvalue_utf16_string_copy_from_integer";
+	size_t utf16_string_index = 0;
 
-	if( libfvalue_utf32_string_with_index_copy_to_integer(
-	     utf32_string,
-	     utf32_string_length,
-	     &utf32_string_index,
+	if( libfvalue_utf16_string_with_index_copy_from_integer(
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_string_index,
 	     integer_value,
 	     integer_value_size,
 	     string_format_flags,
@@ -2551,7 +2610,7 @@ int libfvalue_utf32_string_copy_to_integer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UTF-32 string to integer value.",
+		 "%s: unable to copy integer value to UTF-16 string.",
 		 function );
 
 		return( -1 );
@@ -2559,350 +2618,259 @@ int libfvalue_utf32_string_copy_to_integer(
 	return( 1 );
 }
 
-/* Copies an UTF-32 encoded string to an integer value
+/* Copies an UTF-16 encoded string of an integer value
  * The integer value size is in bits
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_utf32_string_with_index_copy_to_integer(
-     const uint32_t *utf32_string,
-     size_t utf32_string_length,
-     size_t *utf32_string_index,
-     uint64_t *integer_value,
+int libfvalue_utf16_string_with_index_copy_from_integer(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint64_t integer_value,
      size_t integer_value_size,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function          = "libfvalue_utf32_string_with_index_copy_to_integer";
-	size_t maximum_string_index    = 0;
-	size_t safe_utf32_string_index = 0;
-	uint64_t divider               = 0;
-	uint64_t value_64bit           = 0;
-	uint32_t character_value       = 0;
-	uint32_t string_format_type    = 0;
-	uint32_t supported_flags       = 0;
-	uint8_t byte_value             = 0;
-	int8_t bit_shift               = 0;
-	int8_t sign                    = 1;
+	static char *function = "libfvalue_utf16_string_with_index_copy_from_integer";
 
-	if( utf32_string == NULL )
+	if( libfvalue_string_with_index_copy_from_integer(
+	     (uint8_t *) utf16_string,
+	     (uint8_t) sizeof( uint16_t ),
+	     utf16_string_size,
+	     utf16_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy integer value to UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf32_string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-32 string size value exceeds maximum.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	if( utf32_string_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-32 string index.",
-		 function );
+/* Copies an UTF-16 encoded string to an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf16_string_copy_to_integer(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvalue_utf16_string_copy_to_integer";
+	size_t utf16_string_index = 0;
 
-		return( -1 );
-	}
-	if( *utf32_string_index >= utf32_string_length )
+	if( libfvalue_utf16_string_with_index_copy_to_integer(
+	     utf16_string,
+	     utf16_string_length,
+	     &utf16_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-32 string index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string to integer value.",
 		 function );
 
 		return( -1 );
 	}
-	safe_utf32_string_index = *utf32_string_index;
+	return( 1 );
+}
 
-	if( integer_value == NULL )
+/* Copies an UTF-16 encoded string to an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf16_string_with_index_copy_to_integer(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     size_t *utf16_string_index,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_utf16_string_with_index_copy_to_integer";
+
+	if( libfvalue_string_with_index_copy_to_integer(
+	     (const uint8_t *) utf16_string,
+	     (uint8_t) sizeof( uint16_t ),
+	     utf16_string_length,
+	     utf16_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid integer value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string to integer value.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( integer_value_size != 8 )
-	 && ( integer_value_size != 16 )
-	 && ( integer_value_size != 32 )
-	 && ( integer_value_size != 64 ) )
+	return( 1 );
+}
+
+/* Copies an UTF-32 encoded string of an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf32_string_copy_from_integer(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint64_t integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvalue_utf32_string_copy_from_integer";
+	size_t utf32_string_index = 0;
+
+	if( libfvalue_utf32_string_with_index_copy_from_integer(
+	     utf32_string,
+	     utf32_string_size,
+	     &utf32_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported integer value size.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy integer value to UTF-32 string.",
 		 function );
 
 		return( -1 );
 	}
-	supported_flags = 0x000000ffUL
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED
-	                | LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR;
+	return( 1 );
+}
 
-	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+/* Copies an UTF-32 encoded string of an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf32_string_with_index_copy_from_integer(
+     uint32_t *utf32_string,
+     size_t utf32_string_size,
+     size_t *utf32_string_index,
+     uint64_t integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_utf32_string_with_index_copy_from_integer";
+
+	if( libfvalue_string_with_index_copy_from_integer(
+	     (uint8_t *) utf32_string,
+	     (uint8_t) sizeof( uint32_t ),
+	     utf32_string_size,
+	     utf32_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
-		 function,
-		 string_format_flags );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy integer value to UTF-32 string.",
+		 function );
 
 		return( -1 );
 	}
-	string_format_type = string_format_flags & 0x000000ffUL;
+	return( 1 );
+}
 
-	if( ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	 && ( string_format_type != LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN ) )
+/* Copies an UTF-32 encoded string to an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf32_string_copy_to_integer(
+     const uint32_t *utf32_string,
+     size_t utf32_string_length,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvalue_utf32_string_copy_to_integer";
+	size_t utf32_string_index = 0;
+
+	if( libfvalue_utf32_string_with_index_copy_to_integer(
+	     utf32_string,
+	     utf32_string_length,
+	     &utf32_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format type.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-32 string to integer value.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-		if( integer_value == 0 )
-		{
-			maximum_string_index = 5;
-		}
-		else
-		{
-			maximum_string_index = 4;
-		}
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		maximum_string_index = (size_t) ( integer_value_size >> 2 );
-
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			maximum_string_index += 2;
-		}
-	}
-	else
-	{
-		/* The string is at least a single digit with an end of string character
-		 */
-		maximum_string_index = 2;
-
-		bit_shift = (uint8_t) ( integer_value_size - 1 );
-
-		divider = 1;
-
-		value_64bit = ~( ( ~( (uint64_t) 1 << bit_shift ) >> bit_shift ) << bit_shift );
-
-		while( ( value_64bit / divider ) >= 10 )
-		{
-			divider *= 10;
+	return( 1 );
+}
 
-			maximum_string_index += 1;
-		}
-	}
-	maximum_string_index += safe_utf32_string_index;
+/* Copies an UTF-32 encoded string to an integer value
+ * The integer value size is in bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_utf32_string_with_index_copy_to_integer(
+     const uint32_t *utf32_string,
+     size_t utf32_string_length,
+     size_t *utf32_string_index,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_utf32_string_with_index_copy_to_integer";
 
-	if( maximum_string_index > (size_t) SSIZE_MAX )
+	if( libfvalue_string_with_index_copy_to_integer(
+	     (const uint8_t *) utf32_string,
+	     (uint8_t) sizeof( uint32_t ),
+	     utf32_string_length,
+	     utf32_string_index,
+	     integer_value,
+	     integer_value_size,
+	     string_format_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid maximum string index value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-32 string to integer value.",
 		 function );
 
 		return( -1 );
 	}
-	value_64bit = 0;
-
-	if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_BOOLEAN )
-	{
-/* TODO */
-	}
-	else if( string_format_type == LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL )
-	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_NO_BASE_INDICATOR ) == 0 )
-		{
-			character_value = utf32_string[ safe_utf32_string_index++ ];
-
-			if( character_value != (uint32_t) '0' )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x08%" PRIx32 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf32_string_index );
-
-				return( -1 );
-			}
-			character_value = utf32_string[ safe_utf32_string_index++ ];
-
-			if( character_value != (uint32_t) 'x' )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x08%" PRIx32 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf32_string_index );
-
-				return( -1 );
-			}
-		}
-		while( safe_utf32_string_index < utf32_string_length )
-		{
-			character_value = utf32_string[ safe_utf32_string_index ];
-
-			if( character_value == 0 )
-			{
-				break;
-			}
-			if( safe_utf32_string_index > (size_t) maximum_string_index )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-				 "%s: string too large.",
-				 function );
-
-				return( -1 );
-			}
-			value_64bit <<= 4;
-
-			if( ( character_value >= (uint32_t) '0' )
-			 && ( character_value <= (uint32_t) '9' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint32_t) '0' );
-			}
-			else if( ( character_value >= (uint32_t) 'A' )
-			      && ( character_value <= (uint32_t) 'F' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint32_t) 'A' + 10 );
-			}
-			else if( ( character_value >= (uint32_t) 'a' )
-			      && ( character_value <= (uint32_t) 'f' ) )
-			{
-				byte_value = (uint8_t) ( character_value - (uint32_t) 'a' + 10 );
-			}
-			else
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x08%" PRIx32 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf32_string_index );
-
-				return( -1 );
-			}
-			value_64bit += byte_value;
-
-			safe_utf32_string_index++;
-		}
-	}
-	else
-	{
-		if( ( string_format_flags & LIBFVALUE_INTEGER_FORMAT_FLAG_SIGNED ) != 0 )
-		{
-			character_value = utf32_string[ safe_utf32_string_index ];
-
-			/* In the maximum possible string one character is substituted for the sign
-			 */
-			if( character_value == (uint32_t) '-' )
-			{
-				safe_utf32_string_index++;
-
-				sign = -1;
-			}
-			else if( character_value == (uint32_t) '+' )
-			{
-				safe_utf32_string_index++;
-			}
-		}
-		while( safe_utf32_string_index < utf32_string_length )
-		{
-			character_value = utf32_string[ safe_utf32_string_index ];
-
-			if( character_value == 0 )
-			{
-				break;
-			}
-			if( safe_utf32_string_index > (size_t) maximum_string_index )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-				 "%s: string too large.",
-				 function );
-
-				return( -1 );
-			}
-			value_64bit *= 10;
-
-			if( ( character_value < (uint32_t) '0' )
-			 || ( character_value > (uint32_t) '9' ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported character value: 0x08%" PRIx32 " at index: %d.",
-				 function,
-				 character_value,
-				 safe_utf32_string_index );
-
-				return( -1 );
-			}
-			character_value = (uint8_t) ( character_value - (uint32_t) '0' );
-
-			value_64bit += character_value;
-
-			safe_utf32_string_index++;
-		}
-		if( ( sign == -1 )
-		 && ( value_64bit != 0 ) )
-		{
-			value_64bit = ~( value_64bit - 1 );
-		}
-	}
-	*utf32_string_index = safe_utf32_string_index;
-	*integer_value      = value_64bit;
-
 	return( 1 );
 }
 
@@ -32,6 +32,11 @@
 extern "C" {
 #endif
 
+/* The maximum size of an integer string including the end of string character
+ * The longest string is a signed 64-bit decimal "-9223372036854775808"
+ */
+#define LIBFVALUE_INTEGER_MAXIMUM_STRING_SIZE	32
+
 typedef struct libfvalue_integer libfvalue_integer_t;
 
 struct libfvalue_integer
@@ -65,6 +70,27 @@ int libfvalue_integer_copy_from_byte_stream(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_integer_copy_from_byte_stream_array(
+     uint64_t *integer_values,
+     size_t number_of_integer_values,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_integer_copy_to_byte_stream(
+     libfvalue_integer_t *integer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_integer_get_byte_stream_size(
+     libfvalue_integer_t *integer,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
 int libfvalue_integer_copy_from_integer(
      libfvalue_integer_t *integer,
      uint64_t integer_value,
@@ -131,6 +157,22 @@ int libfvalue_integer_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+int libfvalue_integer_get_number_of_decimal_digits(
+     uint64_t integer_value,
+     uint8_t *number_of_digits,
+     libcerror_error_t **error );
+
+int libfvalue_integer_copy_to_decimal_digits(
+     uint64_t integer_value,
+     uint8_t *digits,
+     uint8_t number_of_digits,
+     libcerror_error_t **error );
+
+int libfvalue_integer_copy_from_eight_decimal_digits(
+     const uint8_t *decimal_digits,
+     uint32_t *integer_value,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_string_size_from_integer(
      size_t *string_size,
@@ -177,6 +219,26 @@ int libfvalue_utf8_string_with_index_copy_to_integer(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+int libfvalue_string_with_index_copy_from_integer(
+     uint8_t *string,
+     uint8_t character_size,
+     size_t string_size,
+     size_t *string_index,
+     uint64_t integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libfvalue_string_with_index_copy_to_integer(
+     const uint8_t *string,
+     uint8_t character_size,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *integer_value,
+     size_t integer_value_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_utf16_string_copy_from_integer(
      uint16_t *utf16_string,
@@ -0,0 +1,133 @@
+/*
+ * SIMD functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvalue_simd.h"
+
+/* The vector kernels of the base16, base32 and base64 encoders produce
+ * 16 characters at a time, which are widened into the character size
+ * of the string when stored.
+ */
+
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 )
+
+/* Stores 16 characters into a string with the character size
+ * The string must be large enough to contain 16 characters of the character size
+ */
+void libfvalue_simd_store_characters(
+      uint8_t *string,
+      uint8_t character_size,
+      __m128i characters )
+{
+	__m128i characters_16bit = _mm_setzero_si128();
+	__m128i zero             = _mm_setzero_si128();
+
+	if( character_size == 1 )
+	{
+		_mm_storeu_si128(
+		 (__m128i *) string,
+		 characters );
+	}
+	else if( character_size == 2 )
+	{
+		_mm_storeu_si128(
+		 (__m128i *) string,
+		 _mm_unpacklo_epi8( characters, zero ) );
+		_mm_storeu_si128(
+		 (__m128i *) &( string[ 16 ] ),
+		 _mm_unpackhi_epi8( characters, zero ) );
+	}
+	else
+	{
+		characters_16bit = _mm_unpacklo_epi8( characters, zero );
+
+		_mm_storeu_si128(
+		 (__m128i *) string,
+		 _mm_unpacklo_epi16( characters_16bit, zero ) );
+		_mm_storeu_si128(
+		 (__m128i *) &( string[ 16 ] ),
+		 _mm_unpackhi_epi16( characters_16bit, zero ) );
+
+		characters_16bit = _mm_unpackhi_epi8( characters, zero );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( string[ 32 ] ),
+		 _mm_unpacklo_epi16( characters_16bit, zero ) );
+		_mm_storeu_si128(
+		 (__m128i *) &( string[ 48 ] ),
+		 _mm_unpackhi_epi16( characters_16bit, zero ) );
+	}
+}
+
+#elif defined( LIBFVALUE_SIMD_HAVE_NEON )
+
+/* Stores 16 characters into a string with the character size
+ * The string must be large enough to contain 16 characters of the character size
+ */
+void libfvalue_simd_store_characters(
+      uint8_t *string,
+      uint8_t character_size,
+      uint8x16_t characters )
+{
+	uint16x8_t characters_16bit;
+
+	if( character_size == 1 )
+	{
+		vst1q_u8(
+		 string,
+		 characters );
+	}
+	else if( character_size == 2 )
+	{
+		vst1q_u16(
+		 (uint16_t *) string,
+		 vmovl_u8( vget_low_u8( characters ) ) );
+		vst1q_u16(
+		 (uint16_t *) &( string[ 16 ] ),
+		 vmovl_high_u8( characters ) );
+	}
+	else
+	{
+		characters_16bit = vmovl_u8( vget_low_u8( characters ) );
+
+		vst1q_u32(
+		 (uint32_t *) string,
+		 vmovl_u16( vget_low_u16( characters_16bit ) ) );
+		vst1q_u32(
+		 (uint32_t *) &( string[ 16 ] ),
+		 vmovl_high_u16( characters_16bit ) );
+
+		characters_16bit = vmovl_high_u8( characters );
+
+		vst1q_u32(
+		 (uint32_t *) &( string[ 32 ] ),
+		 vmovl_u16( vget_low_u16( characters_16bit ) ) );
+		vst1q_u32(
+		 (uint32_t *) &( string[ 48 ] ),
+		 vmovl_high_u16( characters_16bit ) );
+	}
+}
+
+#endif /* defined( LIBFVALUE_SIMD_HAVE_SSE2 ) */
+
@@ -0,0 +1,65 @@
+/*
+ * SIMD functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_SIMD_H )
+#define _LIBFVALUE_SIMD_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+
+#define LIBFVALUE_SIMD_HAVE_SSE2
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#include <arm_neon.h>
+
+#define LIBFVALUE_SIMD_HAVE_NEON
+
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 )
+
+void libfvalue_simd_store_characters(
+      uint8_t *string,
+      uint8_t character_size,
+      __m128i characters );
+
+#elif defined( LIBFVALUE_SIMD_HAVE_NEON )
+
+void libfvalue_simd_store_characters(
+      uint8_t *string,
+      uint8_t character_size,
+      uint8x16_t characters );
+
+#endif /* defined( LIBFVALUE_SIMD_HAVE_SSE2 ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_SIMD_H ) */
+
@@ -25,6 +25,7 @@
 
 #include "libfvalue_libcerror.h"
 #include "libfvalue_split_utf8_string.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_types.h"
 
 /* Creates a split UTF-8 string
@@ -88,6 +89,10 @@ int libfvalue_split_utf8_string_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_SPLIT_STRING,
+	 sizeof( libfvalue_internal_split_utf8_string_t ) );
+
 	if( memory_set(
 	     internal_split_string,
 	     0,
@@ -122,6 +127,10 @@ int libfvalue_split_utf8_string_initialize(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_SPLIT_STRING,
+		 sizeof( uint8_t ) * utf8_string_size );
+
 		if( memory_copy(
 		     internal_split_string->string,
 		     utf8_string,
@@ -155,6 +164,10 @@ int libfvalue_split_utf8_string_initialize(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_SPLIT_STRING,
+		 sizeof( uint8_t * ) * number_of_segments );
+
 		if( memory_set(
 		     internal_split_string->segments,
 		     0,
@@ -183,6 +196,10 @@ int libfvalue_split_utf8_string_initialize(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_SPLIT_STRING,
+		 sizeof( size_t ) * number_of_segments );
+
 		if( memory_set(
 		     internal_split_string->segment_sizes,
 		     0,
@@ -0,0 +1,259 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
+#include "libfvalue_unused.h"
+
+#if defined( HAVE_LIBFVALUE_STATISTICS )
+
+/* The counters are updated with relaxed atomic operations where supported
+ * by the compiler, otherwise the counters are not synchronized between threads
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define libfvalue_statistics_counter_add( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define libfvalue_statistics_counter_get( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#define libfvalue_statistics_counter_reset( counter ) \
+	__atomic_store_n( &( counter ), (uint64_t) 0, __ATOMIC_RELAXED )
+
+#else
+#define libfvalue_statistics_counter_add( counter, value ) \
+	counter += (uint64_t) ( value )
+
+#define libfvalue_statistics_counter_get( counter ) \
+	counter
+
+#define libfvalue_statistics_counter_reset( counter ) \
+	counter = 0
+
+#endif /* defined( __GNUC__ ) || defined( __clang__ ) */
+
+static uint64_t libfvalue_statistics_number_of_allocations[ LIBFVALUE_STATISTICS_NUMBER_OF_SUBSYSTEMS ];
+static uint64_t libfvalue_statistics_allocated_size[ LIBFVALUE_STATISTICS_NUMBER_OF_SUBSYSTEMS ];
+static uint64_t libfvalue_statistics_number_of_conversions[ LIBFVALUE_STATISTICS_NUMBER_OF_VALUE_TYPES ];
+static uint64_t libfvalue_statistics_number_of_lookups    = 0;
+static uint64_t libfvalue_statistics_lookup_scan_length   = 0;
+
+/* Counts an allocation of a subsystem
+ */
+void libfvalue_statistics_add_allocation(
+      int subsystem,
+      size_t size )
+{
+	if( ( subsystem >= 0 )
+	 && ( subsystem < LIBFVALUE_STATISTICS_NUMBER_OF_SUBSYSTEMS ) )
+	{
+		libfvalue_statistics_counter_add(
+		 libfvalue_statistics_number_of_allocations[ subsystem ],
+		 1 );
+
+		libfvalue_statistics_counter_add(
+		 libfvalue_statistics_allocated_size[ subsystem ],
+		 size );
+	}
+}
+
+/* Counts a conversion of a value type
+ */
+void libfvalue_statistics_add_conversion(
+      int value_type )
+{
+	if( ( value_type >= 0 )
+	 && ( value_type < LIBFVALUE_STATISTICS_NUMBER_OF_VALUE_TYPES ) )
+	{
+		libfvalue_statistics_counter_add(
+		 libfvalue_statistics_number_of_conversions[ value_type ],
+		 1 );
+	}
+}
+
+/* Counts a table lookup
+ */
+void libfvalue_statistics_add_lookup(
+      void )
+{
+	libfvalue_statistics_counter_add(
+	 libfvalue_statistics_number_of_lookups,
+	 1 );
+}
+
+/* Counts the number of values or identifier index entries scanned by a table lookup
+ */
+void libfvalue_statistics_add_lookup_scan_length(
+      uint64_t scan_length )
+{
+	libfvalue_statistics_counter_add(
+	 libfvalue_statistics_lookup_scan_length,
+	 scan_length );
+}
+
+#endif /* defined( HAVE_LIBFVALUE_STATISTICS ) */
+
+/* Retrieves a statistics counter
+ * The counter index is the subsystem for the allocation counters,
+ * the value type for the conversion counter and 0 for the lookup counters
+ * Returns 1 if successful, 0 if statistics are not enabled or -1 on error
+ */
+int libfvalue_statistics_get(
+     int counter_type,
+     int counter_index,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvalue_statistics_get";
+	int number_of_counters = 0;
+
+	switch( counter_type )
+	{
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS:
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_ALLOCATED_SIZE:
+			number_of_counters = LIBFVALUE_STATISTICS_NUMBER_OF_SUBSYSTEMS;
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_CONVERSIONS:
+			number_of_counters = LIBFVALUE_STATISTICS_NUMBER_OF_VALUE_TYPES;
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_LOOKUPS:
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_LOOKUP_SCAN_LENGTH:
+			number_of_counters = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported counter type: %d.",
+			 function,
+			 counter_type );
+
+			return( -1 );
+	}
+	if( ( counter_index < 0 )
+	 || ( counter_index >= number_of_counters ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVALUE_STATISTICS )
+	switch( counter_type )
+	{
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS:
+			*value = libfvalue_statistics_counter_get(
+			          libfvalue_statistics_number_of_allocations[ counter_index ] );
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_ALLOCATED_SIZE:
+			*value = libfvalue_statistics_counter_get(
+			          libfvalue_statistics_allocated_size[ counter_index ] );
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_CONVERSIONS:
+			*value = libfvalue_statistics_counter_get(
+			          libfvalue_statistics_number_of_conversions[ counter_index ] );
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_LOOKUPS:
+			*value = libfvalue_statistics_counter_get(
+			          libfvalue_statistics_number_of_lookups );
+			break;
+
+		case LIBFVALUE_STATISTICS_COUNTER_TYPE_LOOKUP_SCAN_LENGTH:
+			*value = libfvalue_statistics_counter_get(
+			          libfvalue_statistics_lookup_scan_length );
+			break;
+	}
+	return( 1 );
+#else
+	*value = 0;
+
+	return( 0 );
+#endif
+}
+
+/* Resets the statistics counters
+ * Returns 1 if successful, 0 if statistics are not enabled or -1 on error
+ */
+int libfvalue_statistics_reset(
+     libcerror_error_t **error LIBFVALUE_ATTRIBUTE_UNUSED )
+{
+#if defined( HAVE_LIBFVALUE_STATISTICS )
+	int counter_index = 0;
+#endif
+
+	LIBFVALUE_UNREFERENCED_PARAMETER( error )
+
+#if defined( HAVE_LIBFVALUE_STATISTICS )
+	for( counter_index = 0;
+	     counter_index < LIBFVALUE_STATISTICS_NUMBER_OF_SUBSYSTEMS;
+	     counter_index++ )
+	{
+		libfvalue_statistics_counter_reset(
+		 libfvalue_statistics_number_of_allocations[ counter_index ] );
+
+		libfvalue_statistics_counter_reset(
+		 libfvalue_statistics_allocated_size[ counter_index ] );
+	}
+	for( counter_index = 0;
+	     counter_index < LIBFVALUE_STATISTICS_NUMBER_OF_VALUE_TYPES;
+	     counter_index++ )
+	{
+		libfvalue_statistics_counter_reset(
+		 libfvalue_statistics_number_of_conversions[ counter_index ] );
+	}
+	libfvalue_statistics_counter_reset(
+	 libfvalue_statistics_number_of_lookups );
+
+	libfvalue_statistics_counter_reset(
+	 libfvalue_statistics_lookup_scan_length );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,93 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_STATISTICS_H )
+#define _LIBFVALUE_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_definitions.h"
+#include "libfvalue_extern.h"
+#include "libfvalue_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFVALUE_STATISTICS )
+
+void libfvalue_statistics_add_allocation(
+      int subsystem,
+      size_t size );
+
+void libfvalue_statistics_add_conversion(
+      int value_type );
+
+void libfvalue_statistics_add_lookup(
+      void );
+
+void libfvalue_statistics_add_lookup_scan_length(
+      uint64_t scan_length );
+
+#define libfvalue_statistics_count_allocation( subsystem, size ) \
+	libfvalue_statistics_add_allocation( subsystem, size )
+
+#define libfvalue_statistics_count_conversion( value_type ) \
+	libfvalue_statistics_add_conversion( value_type )
+
+#define libfvalue_statistics_count_lookup() \
+	libfvalue_statistics_add_lookup()
+
+#define libfvalue_statistics_count_lookup_scan_length( scan_length ) \
+	libfvalue_statistics_add_lookup_scan_length( scan_length )
+
+#else
+
+/* The counters compile to nothing when statistics are not enabled
+ */
+#define libfvalue_statistics_count_allocation( subsystem, size )
+
+#define libfvalue_statistics_count_conversion( value_type )
+
+#define libfvalue_statistics_count_lookup()
+
+#define libfvalue_statistics_count_lookup_scan_length( scan_length )
+
+#endif /* defined( HAVE_LIBFVALUE_STATISTICS ) */
+
+LIBFVALUE_EXTERN \
+int libfvalue_statistics_get(
+     int counter_type,
+     int counter_index,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_statistics_reset(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_STATISTICS_H ) */
+
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvalue_ascii.h"
 #include "libfvalue_codepage.h"
 #include "libfvalue_definitions.h"
 #include "libfvalue_libcerror.h"
@@ -30,6 +31,7 @@
 #include "libfvalue_libuna.h"
 #include "libfvalue_split_utf16_string.h"
 #include "libfvalue_split_utf8_string.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_string.h"
 #include "libfvalue_types.h"
 
@@ -79,6 +81,10 @@ int libfvalue_string_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_string_t ) );
+
 	if( memory_set(
 	     *string,
 	     0,
@@ -130,6 +136,11 @@ int libfvalue_string_free(
 	}
 	if( *string != NULL )
 	{
+		if( ( *string )->utf8_string != NULL )
+		{
+			memory_free(
+			 ( *string )->utf8_string );
+		}
 		if( ( *string )->data != NULL )
 		{
 			if( ( ( *string )->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ) != 0 )
@@ -198,6 +209,10 @@ int libfvalue_string_clone(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( libfvalue_string_t ) );
+
 	if( memory_set(
 	     *destination_string,
 	     0,
@@ -238,6 +253,10 @@ int libfvalue_string_clone(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+		 sizeof( uint8_t ) * source_string->data_size );
+
 		( *destination_string )->data_size = source_string->data_size;
 
 		( *destination_string )->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
@@ -257,7 +276,8 @@ int libfvalue_string_clone(
 			goto on_error;
 		}
 	}
-	( *destination_string )->codepage = source_string->codepage;
+	( *destination_string )->codepage          = source_string->codepage;
+	( *destination_string )->resolved_codepage = source_string->resolved_codepage;
 
 	return( 1 );
 
@@ -290,6 +310,42 @@ int libfvalue_string_copy_from_byte_stream(
 {
 	static char *function = "libfvalue_string_copy_from_byte_stream";
 
+	if( libfvalue_string_set_byte_stream(
+	     string,
+	     byte_stream,
+	     byte_stream_size,
+	     encoding,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the string from a byte stream
+ * If the flag LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE is set the string
+ * references the byte stream, which must remain available during the life-time
+ * of the string, otherwise the byte stream is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_set_byte_stream(
+     libfvalue_string_t *string,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_string_set_byte_stream";
+
 	if( string == NULL )
 	{
 		libcerror_error_set(
@@ -323,6 +379,18 @@ int libfvalue_string_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	if( ( flags & ~( LIBFVALUE_VALUE_DATA_FLAG_MANAGED | LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	if( ( encoding != LIBFVALUE_CODEPAGE_ASCII )
 	 && ( encoding != LIBFVALUE_CODEPAGE_ISO_8859_1 )
 	 && ( encoding != LIBFVALUE_CODEPAGE_ISO_8859_2 )
@@ -373,6 +441,16 @@ int libfvalue_string_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	if( string->utf8_string != NULL )
+	{
+		memory_free(
+		 string->utf8_string );
+
+		string->utf8_string      = NULL;
+		string->utf8_string_size = 0;
+	}
+	string->resolved_codepage = 0;
+
 	if( string->data != NULL )
 	{
 		if( ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ) != 0 )
@@ -385,53 +463,307 @@ int libfvalue_string_copy_from_byte_stream(
 		string->data      = NULL;
 		string->data_size = 0;
 	}
-	string->data_size = byte_stream_size;
+	if( ( flags & LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE ) != 0 )
+	{
+		string->data      = (uint8_t *) byte_stream;
+		string->data_size = byte_stream_size;
 
-	string->data = (uint8_t *) memory_allocate(
-	                            sizeof( uint8_t ) * string->data_size );
+		if( ( flags & LIBFVALUE_VALUE_DATA_FLAG_MANAGED ) != 0 )
+		{
+			string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
+		}
+	}
+	else
+	{
+		string->data_size = byte_stream_size;
 
-	if( string->data == NULL )
+		string->data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * string->data_size );
+
+		if( string->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string data.",
+			 function );
+
+			goto on_error;
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+		 sizeof( uint8_t ) * string->data_size );
+
+		string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
+
+		if( memory_copy(
+		     string->data,
+		     byte_stream,
+		     sizeof( uint8_t ) * string->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	string->codepage = encoding;
+
+	return( 1 );
+
+on_error:
+	if( string->data != NULL )
+	{
+		memory_free(
+		 string->data );
+
+		string->data = NULL;
+	}
+	string->data_size = 0;
+
+	return( -1 );
+}
+
+/* Copies the string to a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_copy_to_byte_stream(
+     libfvalue_string_t *string,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_string_copy_to_byte_stream";
+
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create string data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
+	if( ( string->data == NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid string - missing data.",
+		 function );
 
-	if( memory_copy(
-	     string->data,
-	     byte_stream,
-	     sizeof( uint8_t ) * string->data_size ) == NULL )
+		return( -1 );
+	}
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy byte stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	string->codepage = encoding;
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
+	if( encoding != string->codepage )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < string->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string->data_size > 0 )
+	 && ( string->data != byte_stream ) )
+	{
+		if( memory_copy(
+		     byte_stream,
+		     string->data,
+		     string->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
+}
 
-on_error:
-	if( string->data != NULL )
+/* Retrieves the size of a byte stream of the string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_get_byte_stream_size(
+     libfvalue_string_t *string,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_string_get_byte_stream_size";
+
+	if( string == NULL )
 	{
-		memory_free(
-		 string->data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
 
-		string->data = NULL;
+		return( -1 );
 	}
-	string->data_size = 0;
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	if( encoding != string->codepage )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_size = string->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the resolved codepage
+ * The data of the LIBFVALUE_CODEPAGE_1200_MIXED codepage is resolved once,
+ * as LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN if it is a valid UTF-16 stream
+ * up to the first end-of-string character or LIBFVALUE_CODEPAGE_ASCII otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_get_resolved_codepage(
+     libfvalue_string_t *string,
+     int *codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_string_get_resolved_codepage";
+	size_t data_offset    = 0;
+	uint8_t high_byte     = 0;
+	uint8_t low_byte      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( string->codepage != LIBFVALUE_CODEPAGE_1200_MIXED )
+	{
+		*codepage = string->codepage;
+
+		return( 1 );
+	}
+	if( string->resolved_codepage == 0 )
+	{
+		string->resolved_codepage = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
+
+		if( ( string->data_size % 2 ) != 0 )
+		{
+			string->resolved_codepage = LIBFVALUE_CODEPAGE_ASCII;
+		}
+		/* Validate the surrogate pairs, which is the only reason an even sized
+		 * UTF-16 little-endian stream can fail to decode, up to the first
+		 * end-of-string character since decoding stops there
+		 */
+		else while( data_offset < string->data_size )
+		{
+			low_byte  = string->data[ data_offset ];
+			high_byte = string->data[ data_offset + 1 ];
+
+			data_offset += 2;
+
+			if( ( low_byte == 0 )
+			 && ( high_byte == 0 ) )
+			{
+				break;
+			}
+			if( ( high_byte & 0xf8 ) != 0xd8 )
+			{
+				continue;
+			}
+			if( ( high_byte >= 0xdc )
+			 || ( data_offset >= string->data_size )
+			 || ( ( string->data[ data_offset + 1 ] & 0xfc ) != 0xdc ) )
+			{
+				string->resolved_codepage = LIBFVALUE_CODEPAGE_ASCII;
+
+				break;
+			}
+			data_offset += 2;
+		}
+	}
+	*codepage = string->resolved_codepage;
+
+	return( 1 );
 }
 
 /* Copies the string from an UTF-8 encoded string
@@ -615,6 +947,16 @@ int libfvalue_string_copy_from_utf8_string_with_index(
 			break;
 
 	}
+	if( string->utf8_string != NULL )
+	{
+		memory_free(
+		 string->utf8_string );
+
+		string->utf8_string      = NULL;
+		string->utf8_string_size = 0;
+	}
+	string->resolved_codepage = 0;
+
 	if( string->data != NULL )
 	{
 		if( ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ) != 0 )
@@ -643,6 +985,10 @@ int libfvalue_string_copy_from_utf8_string_with_index(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( uint8_t ) * string->data_size );
+
 	string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
 
 	switch( string->codepage )
@@ -793,6 +1139,7 @@ int libfvalue_string_get_utf8_string_size(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_get_utf8_string_size";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -819,6 +1166,49 @@ int libfvalue_string_get_utf8_string_size(
 
 		return( -1 );
 	}
+	if( string->utf8_string != NULL )
+	{
+		if( utf8_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_size = string->utf8_string_size;
+
+		return( 1 );
+	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_string_size_from_stream(
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of ASCII stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -838,16 +1228,28 @@ int libfvalue_string_get_utf8_string_size(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
 			{
-				result = libuna_utf8_string_size_from_utf16_stream(
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          utf8_string_size,
-				          error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
 
-				if( result != 1 )
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf8_string_size_from_utf16_stream(
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     utf8_string_size,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -856,19 +1258,10 @@ int libfvalue_string_get_utf8_string_size(
 					 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf8_string_size_from_byte_stream(
 				     string->data,
@@ -995,30 +1388,213 @@ int libfvalue_string_get_utf8_string_size(
 				 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
 				 function );
 
-				return( -1 );
-			}
-			break;
+				return( -1 );
+			}
+			break;
+
+		default:
+			if( libuna_utf8_string_size_from_byte_stream(
+			     string->data,
+			     string->data_size,
+			     string->codepage,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine UTF-8 string size of byte stream.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded string of the string
+ * The string data is converted only once, the resulting UTF-8 string is cached
+ * and owned by the string until the string data changes or the string is freed
+ * The UTF-8 string size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_string_get_utf8_string(
+     libfvalue_string_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint8_t *cached_utf8_string     = NULL;
+	uint8_t *reallocation           = NULL;
+	static char *function           = "libfvalue_string_get_utf8_string";
+	size_t cached_utf8_string_size  = 0;
+	size_t maximum_utf8_string_size = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	if( string->utf8_string == NULL )
+	{
+		if( string->data_size > (size_t) ( ( SSIZE_MAX - 1 ) / 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid string - data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		/* Use an upper bound of the UTF-8 string size instead of determining
+		 * the exact size so that the string data is converted only once
+		 */
+		switch( string->codepage )
+		{
+			case LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN:
+			case LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN:
+				/* A 16-bit character requires at most 3 bytes, a surrogate pair 4 bytes
+				 */
+				maximum_utf8_string_size = ( ( string->data_size + 1 ) / 2 ) * 3;
+				break;
+
+			case LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN:
+			case LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN:
+				maximum_utf8_string_size = ( ( string->data_size + 3 ) / 4 ) * 4;
+				break;
+
+			case LIBFVALUE_CODEPAGE_SCSU:
+				/* A single SCSU byte can represent a supplementary plane character
+				 */
+				maximum_utf8_string_size = string->data_size * 4;
+				break;
+
+			default:
+				maximum_utf8_string_size = string->data_size * 3;
+				break;
+		}
+		/* Add space for the end-of-string character
+		 */
+		maximum_utf8_string_size += 1;
+
+		cached_utf8_string = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * maximum_utf8_string_size );
+
+		if( cached_utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+		 sizeof( uint8_t ) * maximum_utf8_string_size );
+
+		if( libfvalue_string_copy_to_utf8_string_with_index(
+		     string,
+		     cached_utf8_string,
+		     maximum_utf8_string_size,
+		     &cached_utf8_string_size,
+		     string_format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to UTF-8 string.",
+			 function );
 
-		default:
-			if( libuna_utf8_string_size_from_byte_stream(
-			     string->data,
-			     string->data_size,
-			     string->codepage,
-			     utf8_string_size,
-			     error ) != 1 )
+			goto on_error;
+		}
+		if( cached_utf8_string_size < maximum_utf8_string_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            cached_utf8_string,
+			                            sizeof( uint8_t ) * cached_utf8_string_size );
+
+			if( reallocation == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine UTF-8 string size of byte stream.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize UTF-8 string.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-			break;
+			libfvalue_statistics_count_allocation(
+			 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+			 sizeof( uint8_t ) * cached_utf8_string_size );
+
+			cached_utf8_string = reallocation;
+		}
+		string->utf8_string      = cached_utf8_string;
+		string->utf8_string_size = cached_utf8_string_size;
 	}
+	*utf8_string      = string->utf8_string;
+	*utf8_string_size = string->utf8_string_size;
+
 	return( 1 );
+
+on_error:
+	if( cached_utf8_string != NULL )
+	{
+		memory_free(
+		 cached_utf8_string );
+	}
+	return( -1 );
 }
 
 /* Copies the string to an UTF-8 encoded string
@@ -1033,6 +1609,7 @@ int libfvalue_string_copy_to_utf8_string_with_index(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_copy_to_utf8_string_with_index";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -1059,6 +1636,99 @@ int libfvalue_string_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
+	if( string->utf8_string != NULL )
+	{
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string index.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( *utf8_string_index > utf8_string_size )
+		 || ( string->utf8_string_size > ( utf8_string_size - *utf8_string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string is too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( utf8_string[ *utf8_string_index ] ),
+		     string->utf8_string,
+		     string->utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_index += string->utf8_string_size;
+
+		return( 1 );
+	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          utf8_string_index,
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy ASCII stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -1113,18 +1783,30 @@ int libfvalue_string_copy_to_utf8_string_with_index(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
-			{
-				result = libuna_utf8_string_with_index_copy_from_utf16_stream(
-				          utf8_string,
-				          utf8_string_size,
-				          utf8_string_index,
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          error );
-
-				if( result != 1 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
+
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+				     utf8_string,
+				     utf8_string_size,
+				     utf8_string_index,
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -1133,19 +1815,10 @@ int libfvalue_string_copy_to_utf8_string_with_index(
 					 "%s: unable to copy UTF-16 stream to UTF-8 string.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf8_string_with_index_copy_from_byte_stream(
 				     utf8_string,
@@ -1493,6 +2166,16 @@ int libfvalue_string_copy_from_utf16_string_with_index(
 			break;
 
 	}
+	if( string->utf8_string != NULL )
+	{
+		memory_free(
+		 string->utf8_string );
+
+		string->utf8_string      = NULL;
+		string->utf8_string_size = 0;
+	}
+	string->resolved_codepage = 0;
+
 	if( string->data != NULL )
 	{
 		if( ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ) != 0 )
@@ -1521,6 +2204,10 @@ int libfvalue_string_copy_from_utf16_string_with_index(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( uint8_t ) * string->data_size );
+
 	string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
 
 	switch( string->codepage )
@@ -1671,6 +2358,7 @@ int libfvalue_string_get_utf16_string_size(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_get_utf16_string_size";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -1697,6 +2385,32 @@ int libfvalue_string_get_utf16_string_size(
 
 		return( -1 );
 	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_string_size_from_stream(
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of ASCII stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -1716,16 +2430,28 @@ int libfvalue_string_get_utf16_string_size(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
 			{
-				result = libuna_utf16_string_size_from_utf16_stream(
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          utf16_string_size,
-				          error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
 
-				if( result != 1 )
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf16_string_size_from_utf16_stream(
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     utf16_string_size,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -1734,19 +2460,10 @@ int libfvalue_string_get_utf16_string_size(
 					 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf16_string_size_from_byte_stream(
 				     string->data,
@@ -1911,6 +2628,7 @@ int libfvalue_string_copy_to_utf16_string_with_index(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_copy_to_utf16_string_with_index";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -1937,6 +2655,34 @@ int libfvalue_string_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          utf16_string_index,
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy ASCII stream to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -1991,18 +2737,30 @@ int libfvalue_string_copy_to_utf16_string_with_index(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
-			{
-				result = libuna_utf16_string_with_index_copy_from_utf16_stream(
-				          utf16_string,
-				          utf16_string_size,
-				          utf16_string_index,
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          error );
-
-				if( result != 1 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
+
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf16_string_with_index_copy_from_utf16_stream(
+				     utf16_string,
+				     utf16_string_size,
+				     utf16_string_index,
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -2011,19 +2769,10 @@ int libfvalue_string_copy_to_utf16_string_with_index(
 					 "%s: unable to copy UTF-16 stream to UTF-16 string.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf16_string_with_index_copy_from_byte_stream(
 				     utf16_string,
@@ -2371,6 +3120,16 @@ int libfvalue_string_copy_from_utf32_string_with_index(
 			break;
 
 	}
+	if( string->utf8_string != NULL )
+	{
+		memory_free(
+		 string->utf8_string );
+
+		string->utf8_string      = NULL;
+		string->utf8_string_size = 0;
+	}
+	string->resolved_codepage = 0;
+
 	if( string->data != NULL )
 	{
 		if( ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ) != 0 )
@@ -2399,6 +3158,10 @@ int libfvalue_string_copy_from_utf32_string_with_index(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_INSTANCES,
+	 sizeof( uint8_t ) * string->data_size );
+
 	string->flags |= LIBFVALUE_VALUE_FLAG_DATA_MANAGED;
 
 	switch( string->codepage )
@@ -2549,6 +3312,7 @@ int libfvalue_string_get_utf32_string_size(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_get_utf32_string_size";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -2575,6 +3339,32 @@ int libfvalue_string_get_utf32_string_size(
 
 		return( -1 );
 	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_string_size_from_stream(
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          utf32_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-32 string size of ASCII stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -2594,16 +3384,28 @@ int libfvalue_string_get_utf32_string_size(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
 			{
-				result = libuna_utf32_string_size_from_utf16_stream(
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          utf32_string_size,
-				          error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
 
-				if( result != 1 )
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf32_string_size_from_utf16_stream(
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     utf32_string_size,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -2612,19 +3414,10 @@ int libfvalue_string_get_utf32_string_size(
 					 "%s: unable to determine UTF-32 string size of UTF-16 stream.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf32_string_size_from_byte_stream(
 				     string->data,
@@ -2789,6 +3582,7 @@ int libfvalue_string_copy_to_utf32_string_with_index(
      libcerror_error_t **error )
 {
 	static char *function = "libfvalue_string_copy_to_utf32_string_with_index";
+	int codepage          = 0;
 	int byte_order        = 0;
 	int result            = 0;
 
@@ -2815,6 +3609,34 @@ int libfvalue_string_copy_to_utf32_string_with_index(
 
 		return( -1 );
 	}
+	if( ( string->data != NULL )
+	 && ( string->data_size != 0 ) )
+	{
+		result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+		          utf32_string,
+		          utf32_string_size,
+		          utf32_string_index,
+		          string->data,
+		          string->data_size,
+		          string->codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy ASCII stream to UTF-32 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( ( string->data == NULL )
 	 || ( string->data_size == 0 ) )
 	{
@@ -2869,18 +3691,30 @@ int libfvalue_string_copy_to_utf32_string_with_index(
 	else switch( string->codepage )
 	{
 		case LIBFVALUE_CODEPAGE_1200_MIXED:
-			if( ( string->data_size % 2 ) == 0 )
-			{
-				result = libuna_utf32_string_with_index_copy_from_utf16_stream(
-				          utf32_string,
-				          utf32_string_size,
-				          utf32_string_index,
-				          string->data,
-				          string->data_size,
-				          LIBFVALUE_ENDIAN_LITTLE,
-				          error );
-
-				if( result != 1 )
+			if( libfvalue_string_get_resolved_codepage(
+			     string,
+			     &codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine resolved codepage.",
+				 function );
+
+				return( -1 );
+			}
+			if( codepage == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+			{
+				if( libuna_utf32_string_with_index_copy_from_utf16_stream(
+				     utf32_string,
+				     utf32_string_size,
+				     utf32_string_index,
+				     string->data,
+				     string->data_size,
+				     LIBFVALUE_ENDIAN_LITTLE,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -2889,19 +3723,10 @@ int libfvalue_string_copy_to_utf32_string_with_index(
 					 "%s: unable to copy UTF-32 stream to UTF-16 string.",
 					 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-#endif
-					libcerror_error_free(
-					 error );
+					return( -1 );
 				}
 			}
-			if( result != 1 )
+			else
 			{
 				if( libuna_utf32_string_with_index_copy_from_byte_stream(
 				     utf32_string,
@@ -50,6 +50,22 @@ struct libfvalue_string
 	 */
 	int codepage;
 
+	/* The resolved codepage
+	 * LIBFVALUE_CODEPAGE_1200_MIXED data is resolved to either
+	 * LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN or LIBFVALUE_CODEPAGE_ASCII
+	 * 0 if not resolved
+	 */
+	int resolved_codepage;
+
+	/* The cached UTF-8 string
+	 * NULL if the string data has not been converted
+	 */
+	uint8_t *utf8_string;
+
+	/* The cached UTF-8 string size
+	 */
+	size_t utf8_string_size;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -75,6 +91,32 @@ int libfvalue_string_copy_from_byte_stream(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_string_set_byte_stream(
+     libfvalue_string_t *string,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfvalue_string_copy_to_byte_stream(
+     libfvalue_string_t *string,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_string_get_byte_stream_size(
+     libfvalue_string_t *string,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_string_get_resolved_codepage(
+     libfvalue_string_t *string,
+     int *codepage,
+     libcerror_error_t **error );
+
 int libfvalue_string_copy_from_utf8_string_with_index(
      libfvalue_string_t *string,
      const uint8_t *utf8_string,
@@ -89,6 +131,13 @@ int libfvalue_string_get_utf8_string_size(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+int libfvalue_string_get_utf8_string(
+     libfvalue_string_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 int libfvalue_string_copy_to_utf8_string_with_index(
      libfvalue_string_t *string,
      uint8_t *utf8_string,
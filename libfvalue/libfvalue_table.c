@@ -26,12 +26,15 @@
 
 #include "libfvalue_codepage.h"
 #include "libfvalue_definitions.h"
+#include "libfvalue_identifier_index.h"
 #include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_table.h"
 #include "libfvalue_types.h"
 #include "libfvalue_value.h"
 #include "libfvalue_value_type.h"
+#include "libfvalue_xml_reader.h"
 
 /* Creates a values table
  * Make sure the value table is referencing, is set to NULL
@@ -81,6 +84,10 @@ int libfvalue_table_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+	 sizeof( libfvalue_internal_table_t ) );
+
 	if( memory_set(
 	     internal_table,
 	     0,
@@ -166,6 +173,22 @@ int libfvalue_table_free(
 
 			result = -1;
 		}
+		if( internal_table->identifier_index != NULL )
+		{
+			if( libfvalue_identifier_index_free(
+			     &( internal_table->identifier_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the identifier index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_table );
 	}
@@ -209,6 +232,22 @@ int libfvalue_table_empty(
 
 		return( -1 );
 	}
+	if( internal_table->identifier_index != NULL )
+	{
+		if( libfvalue_identifier_index_free(
+		     &( internal_table->identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the identifier index.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -251,6 +290,24 @@ int libfvalue_table_resize(
 
 		return( -1 );
 	}
+	/* The identifier index is rebuilt when needed
+	 */
+	if( internal_table->identifier_index != NULL )
+	{
+		if( libfvalue_identifier_index_free(
+		     &( internal_table->identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the identifier index.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -310,6 +367,10 @@ int libfvalue_table_clone(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+	 sizeof( libfvalue_internal_table_t ) );
+
 	if( memory_set(
 	     internal_destination_table,
 	     0,
@@ -340,6 +401,20 @@ int libfvalue_table_clone(
 
 		goto on_error;
 	}
+	if( libfvalue_identifier_index_clone(
+	     &( internal_destination_table->identifier_index ),
+	     internal_source_table->identifier_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination identifier index.",
+		 function );
+
+		goto on_error;
+	}
 	*destination_table = (libfvalue_table_t *) internal_destination_table;
 
 	return( 1 );
@@ -347,12 +422,149 @@ int libfvalue_table_clone(
 on_error:
 	if( internal_destination_table != NULL )
 	{
+		if( internal_destination_table->values != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_destination_table->values ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+			 NULL );
+		}
 		memory_free(
 		 internal_destination_table );
 	}
 	return( -1 );
 }
 
+/* Builds the identifier index
+ * The identifier index is not built if the table contains unset values
+ * Returns 1 if successful, 0 if the identifier index was not built or -1 on error
+ */
+int libfvalue_internal_table_build_identifier_index(
+     libfvalue_internal_table_t *internal_table,
+     libcerror_error_t **error )
+{
+	libfvalue_identifier_index_t *identifier_index = NULL;
+	libfvalue_internal_value_t *internal_value     = NULL;
+	static char *function                          = "libfvalue_internal_table_build_identifier_index";
+	int number_of_values                           = 0;
+	int value_index                                = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->identifier_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid values table - identifier index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_table->values,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in the values array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_identifier_index_initialize(
+	     &identifier_index,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_table->values,
+		     value_index,
+		     (intptr_t **) &internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values array.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		/* Unset values are reported by the linear search
+		 */
+		if( internal_value == NULL )
+		{
+			libfvalue_identifier_index_free(
+			 &identifier_index,
+			 NULL );
+
+			return( 0 );
+		}
+		if( internal_value->identifier == NULL )
+		{
+			continue;
+		}
+		if( libfvalue_identifier_index_set_value_index(
+		     identifier_index,
+		     internal_value->identifier,
+		     internal_value->identifier_size,
+		     value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value index: %d in identifier index.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	internal_table->identifier_index = identifier_index;
+
+	return( 1 );
+
+on_error:
+	if( identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &identifier_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves the number of values
  * Returns 1 if successful or -1 on error
  */
@@ -475,6 +687,8 @@ int libfvalue_table_get_index_by_identifier(
 
 		return( -1 );
 	}
+	libfvalue_statistics_count_lookup();
+
 	if( libcdata_array_get_number_of_entries(
 	     internal_table->values,
 	     &number_of_values,
@@ -489,10 +703,56 @@ int libfvalue_table_get_index_by_identifier(
 
 		return( -1 );
 	}
+	if( ( flags & LIBFVALUE_TABLE_FLAG_ALLOW_PARTIAL_MATCH ) == 0 )
+	{
+		if( ( internal_table->identifier_index == NULL )
+		 && ( number_of_values >= LIBFVALUE_TABLE_IDENTIFIER_INDEX_MINIMUM_NUMBER_OF_VALUES ) )
+		{
+			if( libfvalue_internal_table_build_identifier_index(
+			     internal_table,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build identifier index.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( internal_table->identifier_index != NULL )
+		{
+			result = libfvalue_identifier_index_get_value_index(
+			          internal_table->identifier_index,
+			          internal_table->values,
+			          identifier,
+			          identifier_size,
+			          value_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value index from identifier index.",
+				 function );
+
+				return( -1 );
+			}
+			return( result );
+		}
+	}
 	for( *value_index = 0;
 	     *value_index < number_of_values;
 	     *value_index += 1 )
 	{
+		libfvalue_statistics_count_lookup_scan_length(
+		 1 );
+
 		if( libcdata_array_get_entry_by_index(
 		     internal_table->values,
 		     *value_index,
@@ -689,6 +949,7 @@ int libfvalue_table_set_value_by_index(
      libcerror_error_t **error )
 {
 	libfvalue_internal_table_t *internal_table = NULL;
+	libfvalue_internal_value_t *internal_value = NULL;
 	libfvalue_value_t *stored_value            = NULL;
 	static char *function                      = "libfvalue_table_set_value_by_index";
 
@@ -721,6 +982,73 @@ int libfvalue_table_set_value_by_index(
 
 		return( -1 );
 	}
+	if( ( internal_table->identifier_index != NULL )
+	 && ( stored_value != value ) )
+	{
+		internal_value = (libfvalue_internal_value_t *) stored_value;
+
+		if( ( internal_value != NULL )
+		 && ( internal_value->identifier != NULL ) )
+		{
+			if( libfvalue_identifier_index_remove_value_index(
+			     internal_table->identifier_index,
+			     internal_value->identifier,
+			     internal_value->identifier_size,
+			     value_index,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove value index: %d from identifier index.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		internal_value = (libfvalue_internal_value_t *) value;
+
+		/* The identifier index is not used when the table contains unset values
+		 */
+		if( internal_value == NULL )
+		{
+			if( libfvalue_identifier_index_free(
+			     &( internal_table->identifier_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the identifier index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( internal_value->identifier != NULL )
+		{
+			if( libfvalue_identifier_index_set_value_index(
+			     internal_table->identifier_index,
+			     internal_value->identifier,
+			     internal_value->identifier_size,
+			     value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value index: %d in identifier index.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+	}
 	if( ( stored_value != NULL )
 	 && ( stored_value != value ) )
 	{
@@ -736,7 +1064,7 @@ int libfvalue_table_set_value_by_index(
 			 function,
 			 value_index );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	if( libcdata_array_set_entry_by_index(
@@ -753,28 +1081,41 @@ int libfvalue_table_set_value_by_index(
 		 function,
 		 value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	/* Make sure the identifier index is rebuilt when needed
+	 */
+	if( internal_table->identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &( internal_table->identifier_index ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Sets a value in the values table
- * This function appends a new value or replaces an existing value
+/* Inserts a value that is not yet stored in the table
+ * The values are kept sorted by identifier. A value with an identifier
+ * that sorts after the last value is appended, which prevents a scan of
+ * the values when the values are added in sorted order
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_table_set_value(
-     libfvalue_table_t *table,
+int libfvalue_internal_table_insert_value(
+     libfvalue_internal_table_t *internal_table,
      libfvalue_value_t *value,
+     int *value_index,
      libcerror_error_t **error )
 {
-	libfvalue_internal_table_t *internal_table = NULL;
 	libfvalue_internal_value_t *internal_value = NULL;
-	libfvalue_value_t *stored_value            = NULL;
-	static char *function                      = "libfvalue_table_set_value";
-	int value_index                            = 0;
-	int result                                 = 0;
+	libfvalue_value_t *last_value              = NULL;
+	static char *function                      = "libfvalue_internal_table_insert_value";
+	int number_of_values                       = 0;
+	int result                                 = LIBCDATA_COMPARE_LESS;
 
-	if( table == NULL )
+	if( internal_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -785,8 +1126,6 @@ int libfvalue_table_set_value(
 
 		return( -1 );
 	}
-	internal_table = (libfvalue_internal_table_t *) table;
-
 	if( value == NULL )
 	{
 		libcerror_error_set(
@@ -800,41 +1139,237 @@ int libfvalue_table_set_value(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	result = libfvalue_table_get_index_by_identifier(
-	          table,
-	          internal_value->identifier,
-	          internal_value->identifier_size,
-	          &value_index,
-	          0,
-	          error );
-
-	if( result == -1 )
+	if( value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to find index for: %s.",
-		 function,
-		 (char *) internal_value->identifier );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
 
 		return( -1 );
 	}
-	else if( result == 0 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_table->values,
+	     &number_of_values,
+	     error ) != 1 )
 	{
-		if( libcdata_array_insert_entry(
-		     internal_table->values,
-		     &value_index,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in the values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_table->values,
+		     number_of_values - 1,
+		     (intptr_t **) &last_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values array.",
+			 function,
+			 number_of_values - 1 );
+
+			return( -1 );
+		}
+		if( last_value != NULL )
+		{
+			result = libfvalue_compare_identifier(
+			          (intptr_t *) value,
+			          (intptr_t *) last_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare value with last value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		result = LIBCDATA_COMPARE_GREATER;
+	}
+	if( result == LIBCDATA_COMPARE_GREATER )
+	{
+		if( libcdata_array_append_entry(
+		     internal_table->values,
+		     value_index,
 		     (intptr_t *) value,
-		     &libfvalue_compare_identifier,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert value: %s in values array.",
+			 "%s: unable to append value to values array.",
+			 function );
+
+			return( -1 );
+		}
+		/* The value indexes of the other values are not affected by an append
+		 */
+		if( internal_table->identifier_index != NULL )
+		{
+			if( libfvalue_identifier_index_set_value_index(
+			     internal_table->identifier_index,
+			     internal_value->identifier,
+			     internal_value->identifier_size,
+			     *value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value index: %d in identifier index.",
+				 function,
+				 *value_index );
+
+				libfvalue_identifier_index_free(
+				 &( internal_table->identifier_index ),
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	if( libcdata_array_insert_entry(
+	     internal_table->values,
+	     value_index,
+	     (intptr_t *) value,
+	     &libfvalue_compare_identifier,
+	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value in values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->identifier_index != NULL )
+	{
+		if( libfvalue_identifier_index_insert_value_index(
+		     internal_table->identifier_index,
+		     internal_value->identifier,
+		     internal_value->identifier_size,
+		     *value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert value index: %d in identifier index.",
+			 function,
+			 *value_index );
+
+			libfvalue_identifier_index_free(
+			 &( internal_table->identifier_index ),
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets a value in the values table
+ * This function appends a new value or replaces an existing value
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_table_set_value(
+     libfvalue_table_t *table,
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_table_t *internal_table = NULL;
+	libfvalue_internal_value_t *internal_value = NULL;
+	libfvalue_value_t *stored_value            = NULL;
+	static char *function                      = "libfvalue_table_set_value";
+	int value_index                            = 0;
+	int result                                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libfvalue_internal_table_t *) table;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	result = libfvalue_table_get_index_by_identifier(
+	          table,
+	          internal_value->identifier,
+	          internal_value->identifier_size,
+	          &value_index,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find index for: %s.",
+		 function,
+		 (char *) internal_value->identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfvalue_internal_table_insert_value(
+		     internal_table,
+		     value,
+		     &value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert value: %s.",
 			 function,
 			 (char *) internal_value->identifier );
 
@@ -897,11 +1432,147 @@ int libfvalue_table_set_value(
 	return( 1 );
 }
 
-enum LIBFVALUE_XML_TAG_TYPES
+/* Copies a value entry from the character data of an UTF-8 encoded XML string
+ * The character data is copied into the string, which is resized if needed,
+ * and the XML entities are decoded
+ * A value entry that does not exist in a value of a non-string type is added
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_table_copy_value_entry_from_utf8_xml_string(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     const uint8_t *xml_string,
+     size_t xml_string_length,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
 {
-	LIBFVALUE_XML_TAG_TYPE_CLOSE	= (uint8_t) 'c',
-	LIBFVALUE_XML_TAG_TYPE_OPEN	= (uint8_t) 'o'
-};
+	libfvalue_internal_value_t *internal_value = NULL;
+	void *reallocation                         = NULL;
+	static char *function                      = "libfvalue_internal_table_copy_value_entry_from_utf8_xml_string";
+	size_t string_length                       = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( xml_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML string.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid XML string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_string_length + 1 ) > *string_size )
+	{
+		reallocation = memory_reallocate(
+		                *string,
+		                sizeof( uint8_t ) * ( xml_string_length + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			return( -1 );
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+		 sizeof( uint8_t ) * ( xml_string_length + 1 ) );
+
+		*string      = (uint8_t *) reallocation;
+		*string_size = xml_string_length + 1;
+	}
+	if( xml_string_length > 0 )
+	{
+		if( memory_copy(
+		     *string,
+		     xml_string,
+		     xml_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	( *string )[ xml_string_length ] = 0;
+
+	string_length = xml_string_length;
+
+	if( libfvalue_xml_reader_copy_value_entry_from_text(
+	     internal_value,
+	     value_entry_index,
+	     *string,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value entry: %d from string.",
+		 function,
+		 value_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
 
 /* Copies the values table from an UTF-8 encoded XML string
  * Returns 1 if successful, 0 if the requested section could not be found or -1 on error
@@ -913,22 +1584,86 @@ int libfvalue_table_copy_from_utf8_xml_string(
      const uint8_t *table_name,
      size_t table_name_length,
      libcerror_error_t **error )
+{
+	static char *function = "libfvalue_table_copy_from_utf8_xml_string";
+	int result            = 0;
+
+	result = libfvalue_table_copy_from_utf8_xml_string_with_flags(
+	          table,
+	          utf8_string,
+	          utf8_string_size,
+	          table_name,
+	          table_name_length,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy values table from UTF-8 XML string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Copies the values table from an UTF-8 encoded XML string
+ * The XML string is parsed in a single pass. A value that does not exist
+ * in the table is added with the value type of its type attribute, if supported,
+ * otherwise as an UTF-8 string value. Multiple value entries are read from
+ * value_entry elements and XML entities in the character data are decoded
+ * If LIBFVALUE_TABLE_FLAG_REFERENCE_DATA is set the data of string values
+ * without XML entities references the XML string instead of a copy,
+ * the XML string must remain valid while the values are used
+ * Returns 1 if successful, 0 if the requested section could not be found or -1 on error
+ */
+int libfvalue_table_copy_from_utf8_xml_string_with_flags(
+     libfvalue_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     uint8_t flags,
+     libcerror_error_t **error )
 {
 	libfvalue_internal_table_t *internal_table = NULL;
+	libfvalue_internal_value_t *internal_value = NULL;
 	libfvalue_value_t *value                   = NULL;
 	uint8_t *value_data                        = NULL;
 	uint8_t *value_identifier                  = NULL;
+	uint8_t *value_string                      = NULL;
+	void *reallocation                         = NULL;
+	const uint8_t *type_string                 = NULL;
+	const uint8_t *value_entry_data            = NULL;
+	const uint8_t *value_tag_name              = NULL;
 	const uint8_t *xml_table_name              = NULL;
 	const uint8_t *xml_tag_data                = NULL;
 	const uint8_t *xml_tag_name                = NULL;
-	static char *function                      = "libfvalue_table_copy_from_utf8_xml_string";
+	const uint8_t *xml_tag_start               = NULL;
+	const uint8_t *attribute_name              = NULL;
+	const uint8_t *attribute_value             = NULL;
+	static char *function                      = "libfvalue_table_copy_from_utf8_xml_string_with_flags";
+	size_t attribute_name_length               = 0;
+	size_t attribute_value_length              = 0;
 	size_t string_index                        = 0;
-	size_t value_identifier_length             = 0;
+	size_t type_string_length                  = 0;
 	size_t value_data_length                   = 0;
+	size_t value_identifier_size               = 0;
+	size_t value_string_size                   = 0;
+	size_t value_tag_name_length               = 0;
 	size_t xml_table_name_length               = 0;
 	size_t xml_tag_name_length                 = 0;
+	uint8_t character                          = 0;
+	uint8_t has_entities                       = 0;
+	uint8_t has_value_entries                  = 0;
+	uint8_t in_value_entry                     = 0;
+	uint8_t is_string_value                    = 0;
+	uint8_t quote_character                    = 0;
 	uint8_t xml_tag_type                       = 0;
 	int result                                 = 0;
+	int value_entry_index                      = 0;
 	int value_index                            = 0;
 
 	if( table == NULL )
@@ -989,6 +1724,18 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 		return( -1 );
 	}
+	if( ( flags & ~( LIBFVALUE_TABLE_FLAG_REFERENCE_DATA ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 #ifdef TODO
 	if( libcdata_array_empty(
 	     internal_table->values,
@@ -1005,6 +1752,25 @@ int libfvalue_table_copy_from_utf8_xml_string(
 		return( -1 );
 	}
 #endif
+	/* Build the identifier index upfront, so that the identifier of every
+	 * value is looked up in the identifier index and not by a scan of the values
+	 */
+	if( internal_table->identifier_index == NULL )
+	{
+		if( libfvalue_internal_table_build_identifier_index(
+		     internal_table,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build identifier index.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	/* TODO check for "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"; */
 
 	/* Note that below numeric values for the characters are used to prevent
@@ -1013,15 +1779,24 @@ int libfvalue_table_copy_from_utf8_xml_string(
 	while( string_index < utf8_string_size )
 	{
 		/* Look for the start of the XML tag: '<'
+		 * and keep track of XML entities in the character data: '&'
 		 */
-		if( utf8_string[ string_index++ ] != 0x3c )
+		character = utf8_string[ string_index++ ];
+
+		if( character != 0x3c )
 		{
+			if( character == 0x26 )
+			{
+				has_entities = 1;
+			}
 			continue;
 		}
 		if( string_index >= utf8_string_size )
 		{
 			break;
 		}
+		xml_tag_start = &( utf8_string[ string_index - 1 ] );
+
 		/* Determine if the XML tag is an open or close tag: '/'
 		 */
 		if( utf8_string[ string_index ] != 0x2f )
@@ -1066,16 +1841,96 @@ int libfvalue_table_copy_from_utf8_xml_string(
 		{
 			break;
 		}
-		/* TODO add support for XML tag attributes but ignore them for now
+		/* Look for the end of the XML tag: '>'
+		 * and determine the XML tag attributes
 		 */
+		attribute_name        = NULL;
+		attribute_name_length = 0;
+		type_string           = NULL;
+		type_string_length    = 0;
+
 		while( string_index < utf8_string_size )
 		{
-			/* Look for the end of the XML tag: '>'
-			 */
-			if( utf8_string[ string_index ] == 0x3e )
+			character = utf8_string[ string_index ];
+
+			if( character == 0x3e )
 			{
 				break;
 			}
+			/* The attribute value is enclosed in: '"' or '\''
+			 */
+			if( ( character == 0x22 )
+			 || ( character == 0x27 ) )
+			{
+				quote_character = character;
+
+				string_index++;
+
+				attribute_value        = &( utf8_string[ string_index ] );
+				attribute_value_length = 0;
+
+				while( string_index < utf8_string_size )
+				{
+					if( utf8_string[ string_index ] == quote_character )
+					{
+						break;
+					}
+					attribute_value_length++;
+
+					string_index++;
+				}
+				if( ( attribute_name_length == 4 )
+				 && ( memory_compare(
+				       attribute_name,
+				       "type",
+				       4 ) == 0 ) )
+				{
+					type_string        = attribute_value;
+					type_string_length = attribute_value_length;
+				}
+				attribute_name        = NULL;
+				attribute_name_length = 0;
+			}
+			/* The attribute name should only consists of: [A-Za-z0-9_]
+			 */
+			else if( ( ( character >= 0x41 )
+			       &&  ( character <= 0x5a ) )
+			      || ( ( character >= 0x61 )
+			       &&  ( character <= 0x7a ) )
+			      || ( ( character >= 0x30 )
+			       &&  ( character <= 0x39 ) )
+			      ||   ( character == 0x5f ) )
+			{
+				attribute_name        = &( utf8_string[ string_index ] );
+				attribute_name_length = 0;
+
+				while( string_index < utf8_string_size )
+				{
+					character = utf8_string[ string_index ];
+
+					if( ( ( character < 0x41 )
+					   || ( character > 0x5a ) )
+					 && ( ( character < 0x61 )
+					   || ( character > 0x7a ) )
+					 && ( ( character < 0x30 )
+					   || ( character > 0x39 ) )
+					 &&   ( character != 0x5f ) )
+					{
+						break;
+					}
+					attribute_name_length++;
+
+					string_index++;
+				}
+				continue;
+			}
+			/* Determine if the XML tag is an empty element tag: '/'
+			 */
+			else if( ( character == 0x2f )
+			      && ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN ) )
+			{
+				xml_tag_type = LIBFVALUE_XML_TAG_TYPE_EMPTY;
+			}
 			string_index++;
 		}
 		if( string_index >= utf8_string_size )
@@ -1088,29 +1943,31 @@ int libfvalue_table_copy_from_utf8_xml_string(
 		{
 			continue;
 		}
-		if( string_index >= utf8_string_size )
-		{
-			break;
-		}
-		if( ( xml_tag_name == NULL )
-		 || ( xml_tag_name_length == 0 ) )
+		if( xml_tag_name_length == 0 )
 		{
 			continue;
 		}
 		if( xml_table_name == NULL )
 		{
-			if( ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN )
+			if( ( ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN )
+			  ||  ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY ) )
 			 && ( xml_tag_name_length == table_name_length )
 			 && ( narrow_string_compare(
 			       table_name,
 			       xml_tag_name,
 			       xml_tag_name_length ) == 0 ) )
 			{
+				if( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY )
+				{
+					result = 1;
+
+					break;
+				}
 				xml_table_name        = xml_tag_name;
 				xml_table_name_length = xml_tag_name_length;
 			}
 		}
-		else if( value_identifier == NULL )
+		else if( value == NULL )
 		{
 			if( ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE )
 			 && ( xml_tag_name_length == xml_table_name_length )
@@ -1124,56 +1981,56 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 				break;
 			}
-			else if( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN )
+			else if( ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN )
+			      || ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY ) )
 			{
-				value_identifier_length = xml_tag_name_length;
+				/* The value identifier is end-of-string terminated, it is
+				 * stored in a buffer that is reused for every value
+				 */
+				if( ( xml_tag_name_length + 1 ) > value_identifier_size )
+				{
+					reallocation = memory_reallocate(
+					                value_identifier,
+					                sizeof( uint8_t ) * ( xml_tag_name_length + 1 ) );
 
-				value_identifier = (uint8_t *) memory_allocate(
-				                                sizeof( uint8_t ) * ( value_identifier_length + 1 ) );
+					if( reallocation == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize value identifier.",
+						 function );
 
-				if( value_identifier == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value identifier.",
-					 function );
+						goto on_error;
+					}
+					libfvalue_statistics_count_allocation(
+					 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+					 sizeof( uint8_t ) * ( xml_tag_name_length + 1 ) );
 
-					goto on_error;
+					value_identifier      = (uint8_t *) reallocation;
+					value_identifier_size = xml_tag_name_length + 1;
 				}
 				if( memory_copy(
 				     value_identifier,
 				     xml_tag_name,
-				     value_identifier_length ) == NULL )
+				     xml_tag_name_length ) == NULL )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to clear values table.",
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value identifier.",
 					 function );
 
 					goto on_error;
 				}
-				value_identifier[ value_identifier_length ] = 0;
+				value_identifier[ xml_tag_name_length ] = 0;
 
-				xml_tag_data = &( utf8_string[ string_index ] );
-			}
-		}
-		else
-		{
-			if( ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE )
-			 && ( xml_tag_name_length == value_identifier_length )
-			 && ( narrow_string_compare(
-			       value_identifier,
-			       xml_tag_name,
-			       xml_tag_name_length ) == 0 ) )
-			{
 				result = libfvalue_table_get_index_by_identifier(
 				          table,
 				          value_identifier,
-				          value_identifier_length + 1,
+				          xml_tag_name_length + 1,
 				          &value_index,
 				          0,
 				          error );
@@ -1192,9 +2049,10 @@ int libfvalue_table_copy_from_utf8_xml_string(
 				}
 				else if( result == 0 )
 				{
-					if( libfvalue_value_type_initialize(
+					if( libfvalue_xml_reader_initialize_value(
 					     &value,
-					     LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+					     type_string,
+					     type_string_length,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
@@ -1210,7 +2068,7 @@ int libfvalue_table_copy_from_utf8_xml_string(
 					if( libfvalue_value_set_identifier(
 					     value,
 					     value_identifier,
-					     value_identifier_length + 1,
+					     xml_tag_name_length + 1,
 					     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
 					     error ) != 1 )
 					{
@@ -1228,19 +2086,17 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 						goto on_error;
 					}
-					if( libcdata_array_insert_entry(
-					     internal_table->values,
+					if( libfvalue_internal_table_insert_value(
+					     internal_table,
+					     value,
 					     &value_index,
-					     (intptr_t *) value,
-					     &libfvalue_compare_identifier,
-					     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to insert value: %s in values array.",
+						 "%s: unable to insert value: %s.",
 						 function,
 						 (char *) value_identifier );
 
@@ -1250,6 +2106,7 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 						goto on_error;
 					}
+					internal_value = (libfvalue_internal_value_t *) value;
 				}
 				else
 				{
@@ -1269,12 +2126,165 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 						goto on_error;
 					}
+					if( value == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing value: %d.",
+						 function,
+						 value_index );
+
+						goto on_error;
+					}
+					internal_value = (libfvalue_internal_value_t *) value;
+
+					/* The value entries of a string value are replaced
+					 */
+					if( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+					 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+					 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+					 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+					{
+						if( libfvalue_internal_value_clear_value_entries(
+						     internal_value,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+							 "%s: unable to clear value entries of: %s.",
+							 function,
+							 (char *) value_identifier );
+
+							goto on_error;
+						}
+					}
 				}
-				/* Note that the XML tag name of the closing tag is preceded by
-				 * 2 characters '</' which are not part of the data
+				result = 0;
+
+				if( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY )
+				{
+					value = NULL;
+				}
+				else
+				{
+					/* The tag name is referenced in the UTF-8 string until
+					 * the corresponding close tag is found
+					 */
+					value_tag_name        = xml_tag_name;
+					value_tag_name_length = xml_tag_name_length;
+
+					xml_tag_data      = &( utf8_string[ string_index ] );
+					has_entities      = 0;
+					has_value_entries = 0;
+					in_value_entry    = 0;
+					value_entry_index = 0;
+				}
+			}
+		}
+		else if( ( xml_tag_name_length == 11 )
+		      && ( memory_compare(
+		            xml_tag_name,
+		            "value_entry",
+		            11 ) == 0 ) )
+		{
+			if( ( in_value_entry == 0 )
+			 && ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN ) )
+			{
+				value_entry_data  = &( utf8_string[ string_index ] );
+				has_value_entries = 1;
+				in_value_entry    = 1;
+			}
+			else if( ( ( in_value_entry == 0 )
+			       &&  ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY ) )
+			      || ( ( in_value_entry != 0 )
+			       &&  ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE ) ) )
+			{
+				if( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY )
+				{
+					value_entry_data  = xml_tag_start;
+					value_data_length = 0;
+				}
+				else
+				{
+					value_data_length = (size_t) ( xml_tag_start - value_entry_data );
+				}
+				if( libfvalue_internal_table_copy_value_entry_from_utf8_xml_string(
+				     value,
+				     value_entry_index,
+				     value_entry_data,
+				     value_data_length,
+				     &value_string,
+				     &value_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value: %s entry: %d.",
+					 function,
+					 (char *) value_identifier,
+					 value_entry_index );
+
+					goto on_error;
+				}
+				has_value_entries = 1;
+				in_value_entry    = 0;
+
+				value_entry_index++;
+			}
+		}
+		else if( ( in_value_entry == 0 )
+		      && ( xml_tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE )
+		      && ( xml_tag_name_length == value_tag_name_length )
+		      && ( memory_compare(
+		            value_tag_name,
+		            xml_tag_name,
+		            xml_tag_name_length ) == 0 ) )
+		{
+			value_data_length = (size_t) ( xml_tag_start - xml_tag_data );
+
+			is_string_value = (uint8_t) ( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+			                           || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+			                           || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+			                           || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) );
+
+			if( has_value_entries != 0 )
+			{
+				/* The character data around the value entries is ignored
 				 */
-				value_data_length = (size_t) ( xml_tag_name - ( xml_tag_data + 2 ) );
+			}
+			else if( ( is_string_value != 0 )
+			      && ( has_entities == 0 )
+			      && ( ( flags & LIBFVALUE_TABLE_FLAG_REFERENCE_DATA ) != 0 )
+			      && ( value_data_length > 0 ) )
+			{
+				if( libfvalue_value_set_data(
+				     value,
+				     xml_tag_data,
+				     value_data_length,
+				     LIBFVALUE_CODEPAGE_UTF8,
+				     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set value: %s data.",
+					 function,
+					 (char *) value_identifier );
 
+					goto on_error;
+				}
+			}
+			else if( ( is_string_value != 0 )
+			      && ( has_entities == 0 ) )
+			{
 				value_data = (uint8_t *) memory_allocate(
 				                          sizeof( uint8_t ) * ( value_data_length + 1 ) );
 
@@ -1289,6 +2299,10 @@ int libfvalue_table_copy_from_utf8_xml_string(
 
 					goto on_error;
 				}
+				libfvalue_statistics_count_allocation(
+				 LIBFVALUE_STATISTICS_SUBSYSTEM_TABLE,
+				 sizeof( uint8_t ) * ( value_data_length + 1 ) );
+
 				if( memory_copy(
 				     value_data,
 				     xml_tag_data,
@@ -1297,8 +2311,8 @@ int libfvalue_table_copy_from_utf8_xml_string(
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to clear values table.",
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value data.",
 					 function );
 
 					goto on_error;
@@ -1324,14 +2338,60 @@ int libfvalue_table_copy_from_utf8_xml_string(
 				}
 				/* value_data is now managed by the value
 				 */
-				memory_free(
-				 value_identifier );
+			}
+			else
+			{
+				result = libfvalue_xml_reader_element_text_is_value_entry(
+				          internal_value,
+				          value_data_length,
+				          error );
 
-				value_identifier = NULL;
-				value            = NULL;
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if value: %s text is a value entry.",
+					 function,
+					 (char *) value_identifier );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					if( libfvalue_internal_table_copy_value_entry_from_utf8_xml_string(
+					     value,
+					     0,
+					     xml_tag_data,
+					     value_data_length,
+					     &value_string,
+					     &value_string_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+						 "%s: unable to copy value: %s entry: 0.",
+						 function,
+						 (char *) value_identifier );
+
+						goto on_error;
+					}
+				}
+				result = 0;
 			}
+			value_tag_name = NULL;
+			value          = NULL;
+			internal_value = NULL;
 		}
 	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
 	if( value_identifier != NULL )
 	{
 		memory_free(
@@ -1345,6 +2405,11 @@ on_error:
 		memory_free(
 		 value_data );
 	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
 	if( value_identifier != NULL )
 	{
 		memory_free(
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfvalue_extern.h"
+#include "libfvalue_identifier_index.h"
 #include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
 #include "libfvalue_types.h"
@@ -41,6 +42,10 @@ struct libfvalue_internal_table
 	/* The values array
 	 */
 	libcdata_array_t *values;
+
+	/* The identifier index
+	 */
+	libfvalue_identifier_index_t *identifier_index;
 };
 
 LIBFVALUE_EXTERN \
@@ -75,6 +80,10 @@ int libfvalue_table_clone(
      libfvalue_table_t *source_table,
      libcerror_error_t **error );
 
+int libfvalue_internal_table_build_identifier_index(
+     libfvalue_internal_table_t *internal_table,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_table_get_number_of_values(
      libfvalue_table_t *table,
@@ -113,12 +122,27 @@ int libfvalue_table_set_value_by_index(
      libfvalue_value_t *value,
      libcerror_error_t **error );
 
+int libfvalue_internal_table_insert_value(
+     libfvalue_internal_table_t *internal_table,
+     libfvalue_value_t *value,
+     int *value_index,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_table_set_value(
      libfvalue_table_t *table,
      libfvalue_value_t *value,
      libcerror_error_t **error );
 
+int libfvalue_internal_table_copy_value_entry_from_utf8_xml_string(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     const uint8_t *xml_string,
+     size_t xml_string_length,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_table_copy_from_utf8_xml_string(
      libfvalue_table_t *table,
@@ -128,6 +152,16 @@ int libfvalue_table_copy_from_utf8_xml_string(
      size_t table_name_length,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_table_copy_from_utf8_xml_string_with_flags(
+     libfvalue_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
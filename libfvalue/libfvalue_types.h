@@ -34,18 +34,26 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfvalue_arena {}		libfvalue_arena_t;
 typedef struct libfvalue_data_handle {}		libfvalue_data_handle_t;
 typedef struct libfvalue_split_utf16_string {}	libfvalue_split_utf16_string_t;
 typedef struct libfvalue_split_utf8_string {}	libfvalue_split_utf8_string_t;
 typedef struct libfvalue_table {}		libfvalue_table_t;
 typedef struct libfvalue_value {}		libfvalue_value_t;
+typedef struct libfvalue_value_type_descriptor {}	libfvalue_value_type_descriptor_t;
+typedef struct libfvalue_xml_reader {}		libfvalue_xml_reader_t;
+typedef struct libfvalue_xml_writer {}		libfvalue_xml_writer_t;
 
 #else
+typedef intptr_t libfvalue_arena_t;
 typedef intptr_t libfvalue_data_handle_t;
 typedef intptr_t libfvalue_split_utf16_string_t;
 typedef intptr_t libfvalue_split_utf8_string_t;
 typedef intptr_t libfvalue_table_t;
 typedef intptr_t libfvalue_value_t;
+typedef intptr_t libfvalue_value_type_descriptor_t;
+typedef intptr_t libfvalue_xml_reader_t;
+typedef intptr_t libfvalue_xml_writer_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -27,13 +27,19 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfvalue_arena.h"
+#include "libfvalue_codepage.h"
 #include "libfvalue_data_handle.h"
 #include "libfvalue_definitions.h"
+#include "libfvalue_integer.h"
 #include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
 #include "libfvalue_libcnotify.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_types.h"
 #include "libfvalue_value.h"
+#include "libfvalue_xml_reader.h"
+#include "libfvalue_xml_writer.h"
 
 /* Creates a value
  * Make sure the value value is referencing, is set to NULL
@@ -145,9 +151,124 @@ int libfvalue_value_initialize(
            libcerror_error_t **error ),
      uint8_t flags,
      libcerror_error_t **error )
+{
+	libfvalue_value_type_descriptor_t *type_descriptor = NULL;
+	static char *function                              = "libfvalue_value_initialize";
+
+	if( libfvalue_value_type_descriptor_initialize(
+	     &type_descriptor,
+	     type_string,
+	     type_description,
+	     initialize_instance,
+	     free_instance,
+	     clone_instance,
+	     copy_from_byte_stream,
+	     copy_to_byte_stream,
+	     NULL,
+	     copy_from_integer,
+	     copy_to_integer,
+	     copy_from_floating_point,
+	     copy_to_floating_point,
+	     copy_from_utf8_string_with_index,
+	     get_utf8_string_size,
+	     copy_to_utf8_string_with_index,
+	     copy_from_utf16_string_with_index,
+	     get_utf16_string_size,
+	     copy_to_utf16_string_with_index,
+	     copy_from_utf32_string_with_index,
+	     get_utf32_string_size,
+	     copy_to_utf32_string_with_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create type descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	/* The type descriptor is specific to this value hence it is managed by the value
+	 */
+	if( libfvalue_internal_value_initialize(
+	     value,
+	     NULL,
+	     (libfvalue_internal_value_type_descriptor_t *) type_descriptor,
+	     data_handle,
+	     flags | LIBFVALUE_VALUE_FLAG_TYPE_DESCRIPTOR_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &type_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a value of a specific type descriptor
+ * The type descriptor must remain available during the life-time of the value
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_initialize_with_type_descriptor(
+     libfvalue_value_t **value,
+     libfvalue_value_type_descriptor_t *type_descriptor,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_initialize_with_type_descriptor";
+
+	if( libfvalue_internal_value_initialize(
+	     value,
+	     NULL,
+	     (libfvalue_internal_value_type_descriptor_t *) type_descriptor,
+	     data_handle,
+	     flags & ~( LIBFVALUE_VALUE_FLAG_TYPE_DESCRIPTOR_MANAGED ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a value of a specific type descriptor in an arena
+ * The value is allocated on the heap if arena is NULL
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_initialize(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     const libfvalue_internal_value_type_descriptor_t *type_descriptor,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
-	static char *function                      = "libfvalue_value_initialize";
+	static char *function                      = "libfvalue_internal_value_initialize";
 
 	if( value == NULL )
 	{
@@ -171,19 +292,20 @@ int libfvalue_value_initialize(
 
 		return( -1 );
 	}
-	if( type_string == NULL )
+	if( type_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type string",
+		 "%s: invalid type descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	internal_value = memory_allocate_structure(
-	                  libfvalue_internal_value_t );
+	internal_value = (libfvalue_internal_value_t *) libfvalue_arena_allocate_memory(
+	                                                 arena,
+	                                                 sizeof( libfvalue_internal_value_t ) );
 
 	if( internal_value == NULL )
 	{
@@ -196,6 +318,10 @@ int libfvalue_value_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	 sizeof( libfvalue_internal_value_t ) );
+
 	if( memory_set(
 	     internal_value,
 	     0,
@@ -208,12 +334,16 @@ int libfvalue_value_initialize(
 		 "%s: unable to clear value.",
 		 function );
 
-		memory_free(
+		libfvalue_arena_free_memory(
+		 arena,
 		 internal_value );
 
 		return( -1 );
 	}
-	if( free_instance != NULL )
+	/* The value instances array of a value in an arena is created on demand
+	 */
+	if( ( arena == NULL )
+	 && ( type_descriptor->free_instance != NULL ) )
 	{
 		if( libcdata_array_initialize(
 		     &( internal_value->value_instances ),
@@ -233,8 +363,9 @@ int libfvalue_value_initialize(
 	if( data_handle == NULL )
 	{
 /* TODO add read function ? */
-		if( libfvalue_data_handle_initialize(
+		if( libfvalue_data_handle_initialize_in_arena(
 		     &( internal_value->data_handle ),
+		     arena,
 		     NULL,
 		     error ) != 1 )
 		{
@@ -253,35 +384,9 @@ int libfvalue_value_initialize(
 	{
 		internal_value->data_handle = data_handle;
 	}
-	internal_value->type_string                       = type_string;
-	internal_value->type_description                  = type_description;
-
-	internal_value->initialize_instance               = initialize_instance;
-	internal_value->free_instance                     = free_instance;
-	internal_value->clone_instance                    = clone_instance;
-
-	internal_value->copy_from_byte_stream             = copy_from_byte_stream;
-	internal_value->copy_to_byte_stream               = copy_to_byte_stream;
-
-	internal_value->copy_from_integer                 = copy_from_integer;
-	internal_value->copy_to_integer                   = copy_to_integer;
-
-	internal_value->copy_from_floating_point          = copy_from_floating_point;
-	internal_value->copy_to_floating_point            = copy_to_floating_point;
-
-	internal_value->copy_from_utf8_string_with_index  = copy_from_utf8_string_with_index;
-	internal_value->get_utf8_string_size              = get_utf8_string_size;
-	internal_value->copy_to_utf8_string_with_index    = copy_to_utf8_string_with_index;
-
-	internal_value->copy_from_utf16_string_with_index = copy_from_utf16_string_with_index;
-	internal_value->get_utf16_string_size             = get_utf16_string_size;
-	internal_value->copy_to_utf16_string_with_index   = copy_to_utf16_string_with_index;
-
-	internal_value->copy_from_utf32_string_with_index = copy_from_utf32_string_with_index;
-	internal_value->get_utf32_string_size             = get_utf32_string_size;
-	internal_value->copy_to_utf32_string_with_index   = copy_to_utf32_string_with_index;
-
-	internal_value->flags                            |= flags;
+	internal_value->type_descriptor = type_descriptor;
+	internal_value->arena           = arena;
+	internal_value->flags          |= flags;
 
 	*value = (libfvalue_value_t *) internal_value;
 
@@ -297,7 +402,8 @@ on_error:
 			 NULL,
 			 NULL );
 		}
-		memory_free(
+		libfvalue_arena_free_memory(
+		 arena,
 		 internal_value );
 	}
 	return( -1 );
@@ -347,7 +453,7 @@ int libfvalue_value_free(
 		{
 			if( libcdata_array_free(
 			     &( internal_value->value_instances ),
-			     internal_value->free_instance,
+			     internal_value->type_descriptor->free_instance,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -360,6 +466,22 @@ int libfvalue_value_free(
 				result = -1;
 			}
 		}
+		if( internal_value->scratch_instance != NULL )
+		{
+			if( internal_value->type_descriptor->free_instance(
+			     &( internal_value->scratch_instance ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scratch value instance.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( internal_value->flags & LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED ) != 0 )
 		{
 			if( libfvalue_data_handle_free(
@@ -377,7 +499,25 @@ int libfvalue_value_free(
 			}
 			internal_value->flags &= ~( LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED );
 		}
-		memory_free(
+		if( ( internal_value->flags & LIBFVALUE_VALUE_FLAG_TYPE_DESCRIPTOR_MANAGED ) != 0 )
+		{
+			if( libfvalue_value_type_descriptor_free(
+			     (libfvalue_value_type_descriptor_t **) &( internal_value->type_descriptor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free type descriptor.",
+				 function );
+
+				result = -1;
+			}
+			internal_value->flags &= ~( LIBFVALUE_VALUE_FLAG_TYPE_DESCRIPTOR_MANAGED );
+		}
+		libfvalue_arena_free_memory(
+		 internal_value->arena,
 		 internal_value );
 	}
 	return( result );
@@ -391,9 +531,10 @@ int libfvalue_value_clone(
      libfvalue_value_t *source_value,
      libcerror_error_t **error )
 {
-	libfvalue_internal_value_t *internal_source_value = NULL;
-	libfvalue_data_handle_t *destination_data_handle  = NULL;
-	static char *function                             = "libfvalue_value_clone";
+	libfvalue_internal_value_t *internal_source_value              = NULL;
+	libfvalue_data_handle_t *destination_data_handle               = NULL;
+	libfvalue_value_type_descriptor_t *destination_type_descriptor = NULL;
+	static char *function                                          = "libfvalue_value_clone";
 
 	if( destination_value == NULL )
 	{
@@ -439,31 +580,51 @@ int libfvalue_value_clone(
 
 		goto on_error;
 	}
-	if( libfvalue_value_initialize(
-	     destination_value,
-	     internal_source_value->type_string,
-	     internal_source_value->type_description,
-	     destination_data_handle,
-	     internal_source_value->initialize_instance,
-	     internal_source_value->free_instance,
-	     internal_source_value->clone_instance,
-	     internal_source_value->copy_from_byte_stream,
-	     internal_source_value->copy_to_byte_stream,
-	     internal_source_value->copy_from_integer,
-	     internal_source_value->copy_to_integer,
-	     internal_source_value->copy_from_floating_point,
-	     internal_source_value->copy_to_floating_point,
-	     internal_source_value->copy_from_utf8_string_with_index,
-	     internal_source_value->get_utf8_string_size,
-	     internal_source_value->copy_to_utf8_string_with_index,
-	     internal_source_value->copy_from_utf16_string_with_index,
-	     internal_source_value->get_utf16_string_size,
-	     internal_source_value->copy_to_utf16_string_with_index,
-	     internal_source_value->copy_from_utf32_string_with_index,
-	     internal_source_value->get_utf32_string_size,
-	     internal_source_value->copy_to_utf32_string_with_index,
-	     internal_source_value->flags | LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-	     error ) != 1 )
+	/* A type descriptor that is managed by the source value is specific to that value
+	 * hence the destination value requires its own copy
+	 */
+	if( ( internal_source_value->flags & LIBFVALUE_VALUE_FLAG_TYPE_DESCRIPTOR_MANAGED ) != 0 )
+	{
+		if( libfvalue_value_type_descriptor_clone(
+		     &destination_type_descriptor,
+		     (libfvalue_value_type_descriptor_t *) internal_source_value->type_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination type descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_internal_value_initialize(
+		     destination_value,
+		     NULL,
+		     (libfvalue_internal_value_type_descriptor_t *) destination_type_descriptor,
+		     destination_data_handle,
+		     internal_source_value->flags | LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination value.",
+			 function );
+
+			goto on_error;
+		}
+		destination_type_descriptor = NULL;
+	}
+	else if( libfvalue_internal_value_initialize(
+	          destination_value,
+	          NULL,
+	          internal_source_value->type_descriptor,
+	          destination_data_handle,
+	          internal_source_value->flags | LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -507,10 +668,31 @@ int libfvalue_value_clone(
 		}
 	}
 	/* The value instances are not cloned and are re-created on demand
+	 * or immediately with the eager instance policy
 	 */
+	if( libfvalue_value_set_instance_policy(
+	     *destination_value,
+	     internal_source_value->instance_policy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set instance policy in destination value.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( destination_type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &destination_type_descriptor,
+		 NULL );
+	}
 	if( destination_data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -555,9 +737,48 @@ int libfvalue_value_clear(
 		{
 			memory_free(
 			 internal_value->identifier );
+
+			internal_value->identifier      = NULL;
+			internal_value->identifier_size = 0;
 		}
 		internal_value->flags &= ~( LIBFVALUE_VALUE_FLAG_IDENTIFIER_MANAGED );
 	}
+	if( libfvalue_internal_value_clear_value_entries(
+	     internal_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear value entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears the value entries of a value
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_clear_value_entries(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_value_clear_value_entries";
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfvalue_data_handle_clear(
 	     internal_value->data_handle,
 	     error ) != 1 )
@@ -573,7 +794,7 @@ int libfvalue_value_clear(
 	}
 	if( internal_value->value_instances != NULL )
 	{
-		if( internal_value->free_instance == NULL )
+		if( internal_value->type_descriptor->free_instance == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -586,7 +807,7 @@ int libfvalue_value_clear(
 		}
 		if( libcdata_array_empty(
 		     internal_value->value_instances,
-		     internal_value->free_instance,
+		     internal_value->type_descriptor->free_instance,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -637,7 +858,7 @@ int libfvalue_value_get_type(
 
 		return( -1 );
 	}
-	*value_type = internal_value->type;
+	*value_type = internal_value->type_descriptor->type;
 
 	return( 1 );
 }
@@ -883,12 +1104,38 @@ int libfvalue_value_set_identifier(
 
 		if( ( flags & LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED ) != 0 )
 		{
-			internal_value->flags |= LIBFVALUE_VALUE_FLAG_IDENTIFIER_MANAGED;
+			/* A managed identifier of a value in an arena is freed when the arena is reset
+			 */
+			if( internal_value->arena != NULL )
+			{
+				if( libfvalue_arena_append_cleanup(
+				     internal_value->arena,
+				     (intptr_t *) identifier,
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append identifier to arena cleanups.",
+					 function );
+
+					internal_value->identifier = NULL;
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				internal_value->flags |= LIBFVALUE_VALUE_FLAG_IDENTIFIER_MANAGED;
+			}
 		}
 	}
 	else
 	{
-		internal_value->identifier = (uint8_t *) memory_allocate(
+		internal_value->identifier = (uint8_t *) libfvalue_arena_allocate_memory(
+		                                          internal_value->arena,
 		                                          sizeof( uint8_t ) * identifier_size );
 
 		if( internal_value->identifier == NULL )
@@ -902,6 +1149,10 @@ int libfvalue_value_set_identifier(
 
 			goto on_error;
 		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+		 sizeof( uint8_t ) * identifier_size );
+
 		if( memory_copy(
 		     internal_value->identifier,
 		     identifier,
@@ -916,7 +1167,12 @@ int libfvalue_value_set_identifier(
 
 			goto on_error;
 		}
-		internal_value->flags |= LIBFVALUE_VALUE_FLAG_IDENTIFIER_MANAGED;
+		/* An identifier copied into an arena is released when the arena is reset
+		 */
+		if( internal_value->arena == NULL )
+		{
+			internal_value->flags |= LIBFVALUE_VALUE_FLAG_IDENTIFIER_MANAGED;
+		}
 	}
 	internal_value->identifier_size = identifier_size;
 
@@ -925,7 +1181,8 @@ int libfvalue_value_set_identifier(
 on_error:
 	if( internal_value->identifier != NULL )
 	{
-		memory_free(
+		libfvalue_arena_free_memory(
+		 internal_value->arena,
 		 internal_value->identifier );
 
 		internal_value->identifier = NULL;
@@ -1142,6 +1399,10 @@ int libfvalue_value_initialize_data(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	 sizeof( uint8_t ) * data_size );
+
 	if( libfvalue_data_handle_set_data_as_owned(
 	     internal_value->data_handle,
 	     &data,
@@ -1318,6 +1579,22 @@ int libfvalue_value_set_data(
 
 		return( -1 );
 	}
+	if( internal_value->instance_policy == LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER )
+	{
+		if( libfvalue_internal_value_materialize_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value instances.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1367,6 +1644,22 @@ int libfvalue_value_set_data_as_clone(
 
 		return( -1 );
 	}
+	if( internal_value->instance_policy == LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER )
+	{
+		if( libfvalue_internal_value_materialize_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value instances.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1418,6 +1711,22 @@ int libfvalue_value_set_data_as_owned(
 
 		return( -1 );
 	}
+	if( internal_value->instance_policy == LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER )
+	{
+		if( libfvalue_internal_value_materialize_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value instances.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1596,25 +1905,16 @@ int libfvalue_value_set_format_flags(
 	return( 1 );
 }
 
-/* Value instance functions
- */
-
-/* Retrieves the value instance
- * The value instance is created if it does not exist
+/* Retrieves the value instance policy
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_value_get_value_instance_by_index(
+int libfvalue_value_get_instance_policy(
      libfvalue_value_t *value,
-     int value_entry_index,
-     intptr_t **value_instance,
+     uint8_t *instance_policy,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
-	uint8_t *value_entry_data                  = NULL;
-	static char *function                      = "libfvalue_value_get_value_instance_by_index";
-	size_t value_entry_data_size               = 0;
-	int encoding                               = 0;
-	int result                                 = 0;
+	static char *function                      = "libfvalue_value_get_instance_policy";
 
 	if( value == NULL )
 	{
@@ -1629,31 +1929,140 @@ int libfvalue_value_get_value_instance_by_index(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->initialize_instance == NULL )
+	if( instance_policy == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing initialize instance function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instance policy.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_value->value_instances != NULL )
-	{
-		if( internal_value->free_instance == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid value - missing free instance function.",
-			 function );
+	*instance_policy = internal_value->instance_policy;
+
+	return( 1 );
+}
+
+/* Sets the value instance policy
+ * With the eager policy the value instances of the current data are created immediately
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_set_instance_policy(
+     libfvalue_value_t *value,
+     uint8_t instance_policy,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	static char *function                      = "libfvalue_value_set_instance_policy";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( ( instance_policy != LIBFVALUE_VALUE_INSTANCE_POLICY_LAZY )
+	 && ( instance_policy != LIBFVALUE_VALUE_INSTANCE_POLICY_NO_CACHE )
+	 && ( instance_policy != LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported instance policy: %" PRIu8 ".",
+		 function,
+		 instance_policy );
+
+		return( -1 );
+	}
+	internal_value->instance_policy = instance_policy;
+
+	if( instance_policy == LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER )
+	{
+		if( libfvalue_internal_value_materialize_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value instances.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Value instance functions
+ */
+
+/* Retrieves the value instance
+ * The value instance is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_get_value_instance_by_index(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     intptr_t **value_instance,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	uint8_t *value_entry_data                  = NULL;
+	static char *function                      = "libfvalue_value_get_value_instance_by_index";
+	size_t value_entry_data_size               = 0;
+	int encoding                               = 0;
+	int result                                 = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( internal_value->type_descriptor->initialize_instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing initialize instance function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		if( internal_value->type_descriptor->free_instance == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid value - missing free instance function.",
+			 function );
 
 			return( -1 );
 		}
-		if( internal_value->copy_from_byte_stream == NULL )
+		if( internal_value->type_descriptor->copy_from_byte_stream == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -1687,6 +2096,19 @@ int libfvalue_value_get_value_instance_by_index(
 
 		return( -1 );
 	}
+	if( libfvalue_internal_value_initialize_instances(
+	     internal_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value instances array.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_value->value_instances,
 	     value_entry_index,
@@ -1727,7 +2149,7 @@ int libfvalue_value_get_value_instance_by_index(
 		}
 		else if( result != 0 )
 		{
-			if( internal_value->initialize_instance(
+			if( internal_value->type_descriptor->initialize_instance(
 			     value_instance,
 			     error ) != 1 )
 			{
@@ -1740,12 +2162,55 @@ int libfvalue_value_get_value_instance_by_index(
 
 				goto on_error;
 			}
-			if( internal_value->copy_from_byte_stream(
-			     *value_instance,
-			     value_entry_data,
-			     value_entry_data_size,
-			     encoding,
-			     error ) != 1 )
+			result = 1;
+
+			if( internal_value->type_descriptor->set_byte_stream != NULL )
+			{
+				result = libfvalue_data_handle_is_data_managed(
+				          internal_value->data_handle,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if data handle data is managed.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* Data that is not managed by the data handle outlives the value
+			 * hence the value instance can reference it instead of making a copy
+			 */
+			if( result == 0 )
+			{
+				if( internal_value->type_descriptor->set_byte_stream(
+				     *value_instance,
+				     value_entry_data,
+				     value_entry_data_size,
+				     encoding,
+				     LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set value instance from byte stream.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( internal_value->type_descriptor->copy_from_byte_stream(
+			          *value_instance,
+			          value_entry_data,
+			          value_entry_data_size,
+			          encoding,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -1783,30 +2248,32 @@ int libfvalue_value_get_value_instance_by_index(
 on_error:
 	if( *value_instance != NULL )
 	{
-		internal_value->free_instance(
+		internal_value->type_descriptor->free_instance(
 		 value_instance,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Value entry functions
- */
-
-/* Retrieves the number of values entries
+/* Retrieves the value instance used to read a value entry
+ * With the no-cache instance policy the value entry is decoded into a value instance
+ * that is reused for every read, unless a retained value instance exists
+ * The value instance is valid until the next read of the value
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_value_get_number_of_value_entries(
-     libfvalue_value_t *value,
-     int *number_of_value_entries,
+int libfvalue_internal_value_get_read_instance_by_index(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     intptr_t **value_instance,
      libcerror_error_t **error )
 {
-	libfvalue_internal_value_t *internal_value = NULL;
-	static char *function                      = "libfvalue_value_get_number_of_value_entries";
-	int safe_number_of_value_entries           = 0;
-	int result                                 = 0;
+	uint8_t *value_entry_data    = NULL;
+	static char *function        = "libfvalue_internal_value_get_read_instance_by_index";
+	size_t value_entry_data_size = 0;
+	int encoding                 = 0;
+	int result                   = 0;
 
-	if( value == NULL )
+	if( internal_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1817,22 +2284,91 @@ int libfvalue_value_get_number_of_value_entries(
 
 		return( -1 );
 	}
-	internal_value = (libfvalue_internal_value_t *) value;
+	if( internal_value->instance_policy != LIBFVALUE_VALUE_INSTANCE_POLICY_NO_CACHE )
+	{
+		return( libfvalue_value_get_value_instance_by_index(
+		         (libfvalue_value_t *) internal_value,
+		         value_entry_index,
+		         value_instance,
+		         error ) );
+	}
+	if( internal_value->type_descriptor->initialize_instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing initialize instance function.",
+		 function );
 
-	if( number_of_value_entries == NULL )
+		return( -1 );
+	}
+	if( internal_value->type_descriptor->copy_from_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing copy from byte stream function.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of value entries.",
+		 "%s: invalid value instance.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfvalue_value_has_data(
-		  value,
-		  error );
+	if( *value_instance != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value instance value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A value instance that was created by a write, such as copy from,
+	 * holds the value and cannot be re-created from the data
+	 */
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_value->value_instances,
+		     value_entry_index,
+		     value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values instances array.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( *value_instance != NULL )
+		{
+			return( 1 );
+		}
+	}
+	result = libfvalue_value_get_entry_data(
+	          (libfvalue_value_t *) internal_value,
+	          value_entry_index,
+	          &value_entry_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          error );
 
 	if( result == -1 )
 	{
@@ -1840,52 +2376,190 @@ int libfvalue_value_get_number_of_value_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value has data.",
-		 function );
+		 "%s: unable to retrieve entry data: %d.",
+		 function,
+		 value_entry_index );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libfvalue_data_handle_get_number_of_value_entries(
-		     internal_value->data_handle,
-		     &safe_number_of_value_entries,
+		return( 1 );
+	}
+	if( internal_value->scratch_instance == NULL )
+	{
+		/* The arena cleanup of the value instances array also frees the scratch instance
+		 */
+		if( internal_value->arena != NULL )
+		{
+			if( libfvalue_internal_value_initialize_instances(
+			     internal_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create value instances array.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( internal_value->type_descriptor->initialize_instance(
+		     &( internal_value->scratch_instance ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of value entries from data handle.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scratch value instance.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	else if( internal_value->value_instances != NULL )
+	/* The scratch value instance is decoded again on every read
+	 * hence it can reference the data instead of making a copy
+	 */
+	if( internal_value->type_descriptor->set_byte_stream != NULL )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_value->value_instances,
-		     &safe_number_of_value_entries,
+		if( internal_value->type_descriptor->set_byte_stream(
+		     internal_value->scratch_instance,
+		     value_entry_data,
+		     value_entry_data_size,
+		     encoding,
+		     LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from values instances array.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scratch value instance from byte stream.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( safe_number_of_value_entries < 0 )
+	else if( internal_value->type_descriptor->copy_from_byte_stream(
+	          internal_value->scratch_instance,
+	          value_entry_data,
+	          value_entry_data_size,
+	          encoding,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of value entries value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy scratch value instance from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	*value_instance = internal_value->scratch_instance;
+
+	return( 1 );
+}
+
+/* Value entry functions
+ */
+
+/* Retrieves the number of values entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_get_number_of_value_entries(
+     libfvalue_value_t *value,
+     int *number_of_value_entries,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	static char *function                      = "libfvalue_value_get_number_of_value_entries";
+	int safe_number_of_value_entries           = 0;
+	int result                                 = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( number_of_value_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of value entries.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_value_has_data(
+		  value,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfvalue_data_handle_get_number_of_value_entries(
+		     internal_value->data_handle,
+		     &safe_number_of_value_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value entries from data handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_value->value_instances,
+		     &safe_number_of_value_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from values instances array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( safe_number_of_value_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -2018,7 +2692,7 @@ int libfvalue_value_set_entry(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2029,53 +2703,58 @@ int libfvalue_value_set_entry(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_value->value_instances,
-	     value_entry_index,
-	     &value_instance,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from values instances array.",
-		 function,
-		 value_entry_index );
-
-		return( -1 );
-	}
-	if( value_instance != NULL )
+	/* The value instances array is created on demand for a value in an arena
+	 */
+	if( internal_value->value_instances != NULL )
 	{
-		if( libcdata_array_set_entry_by_index(
+		if( libcdata_array_get_entry_by_index(
 		     internal_value->value_instances,
 		     value_entry_index,
-		     NULL,
+		     &value_instance,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set entry: %d in values instances array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values instances array.",
 			 function,
 			 value_entry_index );
 
 			return( -1 );
 		}
-		if( internal_value->free_instance(
-		     &value_instance,
-		     error ) != 1 )
+		if( value_instance != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free value instance: %d.",
-			 function,
-			 value_entry_index );
+			if( libcdata_array_set_entry_by_index(
+			     internal_value->value_instances,
+			     value_entry_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entry: %d in values instances array.",
+				 function,
+				 value_entry_index );
 
-			return( -1 );
+				return( -1 );
+			}
+			if( internal_value->type_descriptor->free_instance(
+			     &value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value instance: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
 		}
 	}
 	if( libfvalue_data_handle_set_value_entry(
@@ -2109,9 +2788,7 @@ int libfvalue_value_append_entry(
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
-	intptr_t *value_instance                   = NULL;
 	static char *function                      = "libfvalue_value_append_entry";
-	int entry_index                            = 0;
 	int number_of_value_entries                = 0;
 
 	if( value == NULL )
@@ -2127,7 +2804,7 @@ int libfvalue_value_append_entry(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2167,74 +2844,36 @@ int libfvalue_value_append_entry(
 	 * and the value instances reference this data make sure that no stale
 	 * value instances are kept around.
 	 */
-	for( entry_index = 0;
-	     entry_index < number_of_value_entries;
-	     entry_index += 1 )
+	if( libfvalue_internal_value_free_instances(
+	     internal_value,
+	     error ) != 1 )
 	{
-		if( libcdata_array_get_entry_by_index(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value instances.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_resize(
 		     internal_value->value_instances,
-		     entry_index,
-		     &value_instance,
+		     number_of_value_entries + 1,
+		     internal_value->type_descriptor->free_instance,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from values instances array.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to resize value instances array.",
+			 function );
 
 			return( -1 );
 		}
-		if( value_instance != NULL )
-		{
-			if( libcdata_array_set_entry_by_index(
-			     internal_value->value_instances,
-			     entry_index,
-			     NULL,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set entry: %d in values instances array.",
-				 function,
-				 entry_index );
-
-				return( -1 );
-			}
-			if( internal_value->free_instance(
-			     &value_instance,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free value instance: %d.",
-				 function,
-				 entry_index );
-
-				return( -1 );
-			}
-		}
-	}
-	if( libcdata_array_resize(
-	     internal_value->value_instances,
-	     number_of_value_entries + 1,
-	     internal_value->free_instance,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to resize value instances array.",
-		 function );
-
-		return( -1 );
 	}
 	if( libfvalue_data_handle_append_value_entry(
 	     internal_value->data_handle,
@@ -2393,7 +3032,7 @@ int libfvalue_value_set_entry_data(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2404,53 +3043,58 @@ int libfvalue_value_set_entry_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_value->value_instances,
-	     value_entry_index,
-	     &value_instance,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from values instances array.",
-		 function,
-		 value_entry_index );
-
-		return( -1 );
-	}
-	if( value_instance != NULL )
+	/* The value instances array is created on demand for a value in an arena
+	 */
+	if( internal_value->value_instances != NULL )
 	{
-		if( libcdata_array_set_entry_by_index(
+		if( libcdata_array_get_entry_by_index(
 		     internal_value->value_instances,
 		     value_entry_index,
-		     NULL,
+		     &value_instance,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set entry: %d data in values instances array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values instances array.",
 			 function,
 			 value_entry_index );
 
 			return( -1 );
 		}
-		if( internal_value->free_instance(
-		     &value_instance,
-		     error ) != 1 )
+		if( value_instance != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free value instance: %d.",
-			 function,
-			 value_entry_index );
+			if( libcdata_array_set_entry_by_index(
+			     internal_value->value_instances,
+			     value_entry_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entry: %d data in values instances array.",
+				 function,
+				 value_entry_index );
 
-			return( -1 );
+				return( -1 );
+			}
+			if( internal_value->type_descriptor->free_instance(
+			     &value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value instance: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
 		}
 	}
 	if( libfvalue_data_handle_set_value_entry_data(
@@ -2486,8 +3130,11 @@ int libfvalue_value_append_entry_data(
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
-	intptr_t *value_instance                   = NULL;
+	uint8_t *data                              = NULL;
+	uint8_t *previous_data                     = NULL;
 	static char *function                      = "libfvalue_value_append_entry_data";
+	size_t data_size                           = 0;
+	int data_encoding                          = 0;
 	int number_of_value_entries                = 0;
 
 	if( value == NULL )
@@ -2503,7 +3150,7 @@ int libfvalue_value_append_entry_data(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2539,114 +3186,1360 @@ int libfvalue_value_append_entry_data(
 
 		return( -1 );
 	}
-	/* Since the data handle can reallocate the buffer used to store the data
-	 * and the value instances reference this data make sure that no stale
-	 * value instances are kept around.
-	 */
-	for( *value_entry_index = 0;
-	     *value_entry_index < number_of_value_entries;
-	     *value_entry_index += 1 )
+	if( libfvalue_data_handle_get_data(
+	     internal_value->data_handle,
+	     &previous_data,
+	     &data_size,
+	     &data_encoding,
+	     error ) != 1 )
 	{
-		if( libcdata_array_get_entry_by_index(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data from data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_resize(
 		     internal_value->value_instances,
-		     *value_entry_index,
-		     &value_instance,
+		     number_of_value_entries + 1,
+		     internal_value->type_descriptor->free_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to resize value instances array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfvalue_data_handle_append_value_entry_data(
+	     internal_value->data_handle,
+	     value_entry_index,
+	     entry_data,
+	     entry_data_size,
+	     encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry to data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_data_handle_get_data(
+	     internal_value->data_handle,
+	     &data,
+	     &data_size,
+	     &data_encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data from data handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data handle reallocates the buffer used to store the data when
+	 * it needs to grow and the value instances can reference this data
+	 * hence make sure that no stale value instances are kept around.
+	 */
+	if( ( previous_data != NULL )
+	 && ( data != previous_data ) )
+	{
+		if( libfvalue_internal_value_free_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value instances.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies entry data
+ * Returns 1 if successful, 0 if the value has no data or -1 on error
+ */
+int libfvalue_value_copy_entry_data(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     uint8_t *entry_data,
+     size_t entry_data_size,
+     int *encoding,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	uint8_t *value_entry_data                  = NULL;
+	static char *function                      = "libfvalue_value_copy_entry_data";
+	size_t value_entry_data_size               = 0;
+	int result                                 = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entry data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_value_has_data(
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfvalue_data_handle_get_value_entry_data(
+		     internal_value->data_handle,
+		     value_entry_index,
+		     &value_entry_data,
+		     &value_entry_data_size,
+		     encoding,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from values instances array.",
+			 "%s: unable to retrieve entry: %d data from data handle.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( ( value_entry_data == NULL )
+		 || ( value_entry_data_size == 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		if( entry_data_size < value_entry_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d data size value out of bounds.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     entry_data,
+		     value_entry_data,
+		     value_entry_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry: %d data.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Creates the value instances array
+ * The value instances array of a value in an arena is created on demand
+ * and freed when the arena is reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_initialize_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvalue_internal_value_initialize_instances";
+	int number_of_value_entries = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		return( 1 );
+	}
+	if( internal_value->type_descriptor->free_instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing free instance function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_data_handle_get_number_of_value_entries(
+	     internal_value->data_handle,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries from data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries < 1 )
+	{
+		number_of_value_entries = 1;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_value->value_instances ),
+	     number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value instances array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->arena != NULL )
+	{
+		if( libfvalue_arena_append_cleanup(
+		     internal_value->arena,
+		     (intptr_t *) internal_value,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_internal_value_free_instances_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value instances array to arena cleanups.",
+			 function );
+
+			libcdata_array_free(
+			 &( internal_value->value_instances ),
+			 NULL,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Frees the value instances array of a value in an arena
+ * Unlike libfvalue_value_free the value itself is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_free_instances_array(
+     libfvalue_internal_value_t **internal_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_value_free_instances_array";
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *internal_value != NULL )
+	 && ( ( *internal_value )->value_instances != NULL ) )
+	{
+		if( libcdata_array_free(
+		     &( ( *internal_value )->value_instances ),
+		     ( *internal_value )->type_descriptor->free_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value instances array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( *internal_value != NULL )
+	 && ( ( *internal_value )->scratch_instance != NULL ) )
+	{
+		if( ( *internal_value )->type_descriptor->free_instance(
+		     &( ( *internal_value )->scratch_instance ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scratch value instance.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*internal_value = NULL;
+
+	return( 1 );
+}
+
+/* Frees the value instances
+ * The value instances are re-created on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_free_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error )
+{
+	intptr_t *value_instance       = NULL;
+	static char *function          = "libfvalue_internal_value_free_instances";
+	int instance_index             = 0;
+	int number_of_value_instances  = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances == NULL )
+	{
+		return( 1 );
+	}
+	if( internal_value->type_descriptor->free_instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing free instance function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_value->value_instances,
+	     &number_of_value_instances,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from values instances array.",
+		 function );
+
+		return( -1 );
+	}
+	for( instance_index = 0;
+	     instance_index < number_of_value_instances;
+	     instance_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_value->value_instances,
+		     instance_index,
+		     &value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from values instances array.",
+			 function,
+			 instance_index );
+
+			return( -1 );
+		}
+		if( value_instance != NULL )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_value->value_instances,
+			     instance_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entry: %d in values instances array.",
+				 function,
+				 instance_index );
+
+				return( -1 );
+			}
+			if( internal_value->type_descriptor->free_instance(
+			     &value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value instance: %d.",
+				 function,
+				 instance_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Creates the value instances of all value entries
+ * Used by the eager instance policy
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_materialize_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error )
+{
+	intptr_t *value_instance    = NULL;
+	static char *function       = "libfvalue_internal_value_materialize_instances";
+	int number_of_value_entries = 0;
+	int value_entry_index       = 0;
+	int result                  = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_value_has_data(
+	          (libfvalue_value_t *) internal_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libfvalue_data_handle_get_number_of_value_entries(
+	     internal_value->data_handle,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries from data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries < 1 )
+	{
+		number_of_value_entries = 1;
+	}
+	/* The value instances of previous data can reference data that is no longer valid
+	 */
+	if( libfvalue_internal_value_free_instances(
+	     internal_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value instances.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_resize(
+		     internal_value->value_instances,
+		     number_of_value_entries,
+		     internal_value->type_descriptor->free_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value instances array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		value_instance = NULL;
+
+		if( libfvalue_value_get_value_instance_by_index(
+		     (libfvalue_value_t *) internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value instance: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific entry when serialized
+ * The size of the value instance is used if it was created, otherwise the size of the entry data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_get_entry_serialized_size(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     intptr_t **value_instance,
+     uint8_t **entry_data,
+     size_t *entry_data_size,
+     int *encoding,
+     size_t *serialized_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfvalue_internal_value_get_entry_serialized_size";
+	int number_of_value_instances = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_instance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value instance.",
+		 function );
+
+		return( -1 );
+	}
+	if( serialized_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_data_handle_get_value_entry_data(
+	     internal_value->data_handle,
+	     value_entry_index,
+	     entry_data,
+	     entry_data_size,
+	     encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d data from data handle.",
+		 function,
+		 value_entry_index );
+
+		return( -1 );
+	}
+	*value_instance = NULL;
+
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_value->value_instances,
+		     &number_of_value_instances,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from values instances array.",
+			 function );
+
+			return( -1 );
+		}
+		/* The value instances array can contain less entries than the data handle
+		 * when the data was set directly
+		 */
+		if( value_entry_index < number_of_value_instances )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_value->value_instances,
+			     value_entry_index,
+			     value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from values instances array.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( *value_instance != NULL )
+	 && ( internal_value->type_descriptor->get_byte_stream_size != NULL ) )
+	{
+		if( internal_value->type_descriptor->get_byte_stream_size(
+		     *value_instance,
+		     serialized_size,
+		     *encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve byte stream size of value instance: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*serialized_size = *entry_data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the data when the value instances are serialized
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_get_serialized_size(
+     libfvalue_value_t *value,
+     size_t *serialized_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	intptr_t *value_instance                   = NULL;
+	uint8_t *entry_data                        = NULL;
+	static char *function                      = "libfvalue_value_get_serialized_size";
+	size_t entry_data_size                     = 0;
+	size_t entry_serialized_size               = 0;
+	size_t safe_serialized_size                = 0;
+	int encoding                               = 0;
+	int number_of_value_entries                = 0;
+	int value_entry_index                      = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( serialized_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_data_handle_get_number_of_value_entries(
+	     internal_value->data_handle,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries from data handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		if( libfvalue_internal_value_get_entry_serialized_size(
+		     internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     &entry_serialized_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serialized size of entry: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( entry_serialized_size > ( (size_t) SSIZE_MAX - safe_serialized_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid serialized size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_serialized_size += entry_serialized_size;
+	}
+	*serialized_size = safe_serialized_size;
+
+	return( 1 );
+}
+
+/* Writes the value instances back into the data of the data handle
+ * The data is updated in place when it is managed by the data handle and
+ * the size of every value instance matches the size of its entry, otherwise
+ * the data and value entries are rebuilt in data owned by the data handle
+ * and the value instances are re-created on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_flush_to_data_handle(
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	intptr_t *value_instance                   = NULL;
+	size_t *entry_serialized_sizes             = NULL;
+	uint8_t *data                              = NULL;
+	uint8_t *entry_data                        = NULL;
+	static char *function                      = "libfvalue_value_flush_to_data_handle";
+	size_t data_offset                         = 0;
+	size_t data_size                           = 0;
+	size_t entry_data_size                     = 0;
+	size_t entry_serialized_size               = 0;
+	uint32_t data_flags                        = 0;
+	int encoding                               = 0;
+	int entry_index                            = 0;
+	int has_value_instances                    = 0;
+	int number_of_value_entries                = 0;
+	int requires_rebuild                       = 0;
+	int result                                 = 0;
+	int value_entry_index                      = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	/* Without value instances or a copy to byte stream function
+	 * the data of the data handle is always up to date
+	 */
+	if( ( internal_value->value_instances == NULL )
+	 || ( internal_value->type_descriptor->copy_to_byte_stream == NULL ) )
+	{
+		return( 1 );
+	}
+	if( libfvalue_data_handle_get_number_of_value_entries(
+	     internal_value->data_handle,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries from data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_value_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_value_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of value entries value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	entry_serialized_sizes = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_value_entries );
+
+	if( entry_serialized_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry serialized sizes.",
+		 function );
+
+		goto on_error;
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	 sizeof( size_t ) * number_of_value_entries );
+
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		if( libfvalue_internal_value_get_entry_serialized_size(
+		     internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     &entry_serialized_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serialized size of entry: %d.",
+			 function,
+			 value_entry_index );
+
+			goto on_error;
+		}
+		if( value_instance != NULL )
+		{
+			has_value_instances = 1;
+		}
+		if( entry_serialized_size != entry_data_size )
+		{
+			requires_rebuild = 1;
+		}
+		if( entry_serialized_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		entry_serialized_sizes[ value_entry_index ] = entry_serialized_size;
+
+		data_size += entry_serialized_size;
+	}
+	if( has_value_instances == 0 )
+	{
+		memory_free(
+		 entry_serialized_sizes );
+
+		return( 1 );
+	}
+	/* Data that is not managed is owned by the caller, e.g. a read-only
+	 * memory mapped file, and is never written in place
+	 */
+	if( requires_rebuild == 0 )
+	{
+		result = libfvalue_data_handle_is_data_managed(
+		          internal_value->data_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if data handle data is managed.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			requires_rebuild = 1;
+		}
+	}
+	if( ( requires_rebuild != 0 )
+	 && ( data_size > 0 ) )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		libfvalue_statistics_count_allocation(
+		 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+		 sizeof( uint8_t ) * data_size );
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		if( libfvalue_internal_value_get_entry_serialized_size(
+		     internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     &entry_serialized_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serialized size of entry: %d.",
+			 function,
+			 value_entry_index );
+
+			goto on_error;
+		}
+		if( requires_rebuild == 0 )
+		{
+			/* Write the value instance in place
+			 */
+			if( value_instance != NULL )
+			{
+				if( internal_value->type_descriptor->copy_to_byte_stream(
+				     value_instance,
+				     entry_data,
+				     entry_data_size,
+				     encoding,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value instance: %d to byte stream.",
+					 function,
+					 value_entry_index );
+
+					goto on_error;
+				}
+			}
+		}
+		else if( entry_serialized_size > 0 )
+		{
+			if( value_instance != NULL )
+			{
+				if( internal_value->type_descriptor->copy_to_byte_stream(
+				     value_instance,
+				     &( data[ data_offset ] ),
+				     entry_serialized_size,
+				     encoding,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value instance: %d to byte stream.",
+					 function,
+					 value_entry_index );
+
+					goto on_error;
+				}
+			}
+			else if( memory_copy(
+			          &( data[ data_offset ] ),
+			          entry_data,
+			          entry_serialized_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy entry: %d data.",
+				 function,
+				 value_entry_index );
+
+				goto on_error;
+			}
+			data_offset += entry_serialized_size;
+		}
+	}
+	if( requires_rebuild != 0 )
+	{
+		/* The value instances can reference the data that is about to be freed
+		 */
+		if( libfvalue_internal_value_free_instances(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value instances.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_data_handle_get_data_flags(
+		     internal_value->data_handle,
+		     &data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data flags from data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_data_handle_clear(
+		     internal_value->data_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_data_handle_set_data_as_owned(
+		     internal_value->data_handle,
+		     &data,
+		     data_size,
+		     encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_data_handle_set_data_flags(
+		     internal_value->data_handle,
+		     data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data flags in data handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_value_entries > 1 )
+		{
+			if( libfvalue_data_handle_reserve(
+			     internal_value->data_handle,
+			     data_size,
+			     number_of_value_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reserve value entries in data handle.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset = 0;
+
+			for( value_entry_index = 0;
+			     value_entry_index < number_of_value_entries;
+			     value_entry_index++ )
+			{
+				entry_serialized_size = entry_serialized_sizes[ value_entry_index ];
+
+				if( libfvalue_data_handle_append_value_entry(
+				     internal_value->data_handle,
+				     &entry_index,
+				     data_offset,
+				     entry_serialized_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append value entry: %d to data handle.",
+					 function,
+					 value_entry_index );
+
+					goto on_error;
+				}
+				data_offset += entry_serialized_size;
+			}
+		}
+	}
+	memory_free(
+	 entry_serialized_sizes );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( entry_serialized_sizes != NULL )
+	{
+		memory_free(
+		 entry_serialized_sizes );
+	}
+	return( -1 );
+}
+
+/* Boolean value functions
+ */
+
+/* Copies the value data from a boolean value
+ * Returns 1 if successful, 0 if value could not be set or -1 on error
+ */
+int libfvalue_value_copy_from_boolean(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     uint8_t value_boolean,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	intptr_t *value_instance                   = NULL;
+	static char *function                      = "libfvalue_value_copy_from_boolean";
+	int result                                 = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_integer != NULL )
+	{
+		if( libfvalue_value_get_value_instance_by_index(
+		     value,
+		     value_entry_index,
+		     &value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value instance: %d.",
 			 function,
-			 *value_entry_index );
+			 value_entry_index );
 
 			return( -1 );
 		}
 		if( value_instance != NULL )
 		{
-			if( libcdata_array_set_entry_by_index(
-			     internal_value->value_instances,
-			     *value_entry_index,
-			     NULL,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set entry: %d in values instances array.",
-				 function,
-				 *value_entry_index );
-
-				return( -1 );
-			}
-			if( internal_value->free_instance(
-			     &value_instance,
+			if( internal_value->type_descriptor->copy_from_integer(
+			     value_instance,
+			     (uint64_t) value_boolean,
+			     1,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free value instance: %d.",
-				 function,
-				 *value_entry_index );
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy instance from boolean.",
+				 function );
 
 				return( -1 );
 			}
+			result = 1;
 		}
 	}
-	if( libcdata_array_resize(
-	     internal_value->value_instances,
-	     number_of_value_entries + 1,
-	     internal_value->free_instance,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to resize value instances array.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfvalue_data_handle_append_value_entry_data(
-	     internal_value->data_handle,
-	     value_entry_index,
-	     entry_data,
-	     entry_data_size,
-	     encoding,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append entry to data handle.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
+	return( result );
 }
 
-/* Copies entry data
- * Returns 1 if successful, 0 if the value has no data or -1 on error
+/* Copies the value data to a boolean value
+ * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
-int libfvalue_value_copy_entry_data(
+int libfvalue_value_copy_to_boolean(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint8_t *entry_data,
-     size_t entry_data_size,
-     int *encoding,
+     uint8_t *value_boolean,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
-	uint8_t *value_entry_data                  = NULL;
-	static char *function                      = "libfvalue_value_copy_entry_data";
-	size_t value_entry_data_size               = 0;
+	intptr_t *value_instance                   = NULL;
+	static char *function                      = "libfvalue_value_copy_to_boolean";
+	size_t integer_value_size                  = 0;
+	uint64_t integer_value                     = 0;
 	int result                                 = 0;
 
 	if( value == NULL )
@@ -2662,117 +4555,84 @@ int libfvalue_value_copy_entry_data(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( entry_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry data.",
-		 function );
-
-		return( -1 );
-	}
-	if( entry_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	result = libfvalue_value_has_data(
-	          value,
-	          error );
-
-	if( result == -1 )
+	if( value_boolean == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if value has data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing value boolean.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer != NULL )
 	{
-		if( libfvalue_data_handle_get_value_entry_data(
-		     internal_value->data_handle,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
-		     &value_entry_data,
-		     &value_entry_data_size,
-		     encoding,
+		     &value_instance,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d data from data handle.",
-			 function,
-			 value_entry_index );
-
-			return( -1 );
-		}
-		if( ( value_entry_data == NULL )
-		 || ( value_entry_data_size == 0 ) )
-		{
-			result = 0;
-		}
-	}
-	if( result != 0 )
-	{
-		if( entry_data_size < value_entry_data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid entry: %d data size value out of bounds.",
+			 "%s: unable to retrieve value instance: %d.",
 			 function,
 			 value_entry_index );
 
 			return( -1 );
 		}
-		if( memory_copy(
-		     entry_data,
-		     value_entry_data,
-		     value_entry_data_size ) == NULL )
+		if( value_instance != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy entry: %d data.",
-			 function,
-			 value_entry_index );
+			if( internal_value->type_descriptor->copy_to_integer(
+			     value_instance,
+			     &integer_value,
+			     &integer_value_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy instance to boolean.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
+			if( integer_value != 0 )
+			{
+				*value_boolean = 1;
+			}
+			else
+			{
+				*value_boolean = 0;
+			}
+			result = 1;
 		}
 	}
 	return( result );
 }
 
-/* Boolean value functions
+/* Integer value functions
  */
 
-/* Copies the value data from a boolean value
+/* Copies the value data from an 8-bit value
  * Returns 1 if successful, 0 if value could not be set or -1 on error
  */
-int libfvalue_value_copy_from_boolean(
+int libfvalue_value_copy_from_8bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint8_t value_boolean,
+     uint8_t value_8bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_from_boolean";
+	static char *function                      = "libfvalue_value_copy_from_8bit";
 	int result                                 = 0;
 
 	if( value == NULL )
@@ -2788,7 +4648,10 @@ int libfvalue_value_copy_from_boolean(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_integer != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -2808,17 +4671,17 @@ int libfvalue_value_copy_from_boolean(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_integer(
+			if( internal_value->type_descriptor->copy_from_integer(
 			     value_instance,
-			     (uint64_t) value_boolean,
-			     1,
+			     (uint64_t) value_8bit,
+			     8,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance from boolean.",
+				 "%s: unable to copy instance from 8-bit integer.",
 				 function );
 
 				return( -1 );
@@ -2829,18 +4692,18 @@ int libfvalue_value_copy_from_boolean(
 	return( result );
 }
 
-/* Copies the value data to a boolean value
+/* Copies the value data to an 8-bit value
  * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
-int libfvalue_value_copy_to_boolean(
+int libfvalue_value_copy_to_8bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint8_t *value_boolean,
+     uint8_t *value_8bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_to_boolean";
+	static char *function                      = "libfvalue_value_copy_to_8bit";
 	size_t integer_value_size                  = 0;
 	uint64_t integer_value                     = 0;
 	int result                                 = 0;
@@ -2858,21 +4721,24 @@ int libfvalue_value_copy_to_boolean(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( value_boolean == NULL )
+	if( value_8bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value boolean.",
+		 "%s: missing value 8-bit.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -2889,7 +4755,7 @@ int libfvalue_value_copy_to_boolean(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_integer(
+			if( internal_value->type_descriptor->copy_to_integer(
 			     value_instance,
 			     &integer_value,
 			     &integer_value_size,
@@ -2899,40 +4765,42 @@ int libfvalue_value_copy_to_boolean(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance to boolean.",
+				 "%s: unable to copy instance to integer value.",
 				 function );
 
 				return( -1 );
 			}
-			if( integer_value != 0 )
-			{
-				*value_boolean = 1;
-			}
-			else
+			if( integer_value > (uint64_t) UINT8_MAX )
 			{
-				*value_boolean = 0;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: integer value out of bounds.",
+				 function );
+
+				return( -1 );
 			}
+			*value_8bit = (uint8_t) integer_value;
+
 			result = 1;
 		}
 	}
 	return( result );
 }
 
-/* Integer value functions
- */
-
-/* Copies the value data from an 8-bit value
+/* Copies the value data from a 16-bit value
  * Returns 1 if successful, 0 if value could not be set or -1 on error
  */
-int libfvalue_value_copy_from_8bit(
+int libfvalue_value_copy_from_16bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint8_t value_8bit,
+     uint16_t value_16bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_from_8bit";
+	static char *function                      = "libfvalue_value_copy_from_16bit";
 	int result                                 = 0;
 
 	if( value == NULL )
@@ -2948,7 +4816,10 @@ int libfvalue_value_copy_from_8bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_integer != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -2968,17 +4839,17 @@ int libfvalue_value_copy_from_8bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_integer(
+			if( internal_value->type_descriptor->copy_from_integer(
 			     value_instance,
-			     (uint64_t) value_8bit,
-			     8,
+			     (uint64_t) value_16bit,
+			     16,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance from 8-bit integer.",
+				 "%s: unable to copy instance from 16-bit integer.",
 				 function );
 
 				return( -1 );
@@ -2989,18 +4860,18 @@ int libfvalue_value_copy_from_8bit(
 	return( result );
 }
 
-/* Copies the value data to an 8-bit value
+/* Copies the value data to a 16-bit value
  * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
-int libfvalue_value_copy_to_8bit(
+int libfvalue_value_copy_to_16bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint8_t *value_8bit,
+     uint16_t *value_16bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_to_8bit";
+	static char *function                      = "libfvalue_value_copy_to_16bit";
 	size_t integer_value_size                  = 0;
 	uint64_t integer_value                     = 0;
 	int result                                 = 0;
@@ -3018,21 +4889,24 @@ int libfvalue_value_copy_to_8bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( value_8bit == NULL )
+	if( value_16bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value 8-bit.",
+		 "%s: missing value 16-bit.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_integer != NULL )
-	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer != NULL )
+	{
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -3049,7 +4923,7 @@ int libfvalue_value_copy_to_8bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_integer(
+			if( internal_value->type_descriptor->copy_to_integer(
 			     value_instance,
 			     &integer_value,
 			     &integer_value_size,
@@ -3064,7 +4938,7 @@ int libfvalue_value_copy_to_8bit(
 
 				return( -1 );
 			}
-			if( integer_value > (uint64_t) UINT8_MAX )
+			if( integer_value > (uint64_t) UINT16_MAX )
 			{
 				libcerror_error_set(
 				 error,
@@ -3075,7 +4949,7 @@ int libfvalue_value_copy_to_8bit(
 
 				return( -1 );
 			}
-			*value_8bit = (uint8_t) integer_value;
+			*value_16bit = (uint16_t) integer_value;
 
 			result = 1;
 		}
@@ -3083,18 +4957,18 @@ int libfvalue_value_copy_to_8bit(
 	return( result );
 }
 
-/* Copies the value data from a 16-bit value
+/* Copies the value data from a 32-bit value
  * Returns 1 if successful, 0 if value could not be set or -1 on error
  */
-int libfvalue_value_copy_from_16bit(
+int libfvalue_value_copy_from_32bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint16_t value_16bit,
+     uint32_t value_32bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_from_16bit";
+	static char *function                      = "libfvalue_value_copy_from_32bit";
 	int result                                 = 0;
 
 	if( value == NULL )
@@ -3110,7 +4984,10 @@ int libfvalue_value_copy_from_16bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_integer != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -3130,17 +5007,17 @@ int libfvalue_value_copy_from_16bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_integer(
+			if( internal_value->type_descriptor->copy_from_integer(
 			     value_instance,
-			     (uint64_t) value_16bit,
-			     16,
+			     (uint64_t) value_32bit,
+			     32,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance from 16-bit integer.",
+				 "%s: unable to copy instance from 32-bit integer.",
 				 function );
 
 				return( -1 );
@@ -3151,18 +5028,18 @@ int libfvalue_value_copy_from_16bit(
 	return( result );
 }
 
-/* Copies the value data to a 16-bit value
+/* Copies the value data to a 32-bit value
  * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
-int libfvalue_value_copy_to_16bit(
+int libfvalue_value_copy_to_32bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint16_t *value_16bit,
+     uint32_t *value_32bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_to_16bit";
+	static char *function                      = "libfvalue_value_copy_to_32bit";
 	size_t integer_value_size                  = 0;
 	uint64_t integer_value                     = 0;
 	int result                                 = 0;
@@ -3180,21 +5057,24 @@ int libfvalue_value_copy_to_16bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( value_16bit == NULL )
+	if( value_32bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value 16-bit.",
+		 "%s: missing value 32-bit.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -3211,7 +5091,7 @@ int libfvalue_value_copy_to_16bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_integer(
+			if( internal_value->type_descriptor->copy_to_integer(
 			     value_instance,
 			     &integer_value,
 			     &integer_value_size,
@@ -3226,7 +5106,7 @@ int libfvalue_value_copy_to_16bit(
 
 				return( -1 );
 			}
-			if( integer_value > (uint64_t) UINT16_MAX )
+			if( integer_value > (uint64_t) UINT32_MAX )
 			{
 				libcerror_error_set(
 				 error,
@@ -3237,7 +5117,7 @@ int libfvalue_value_copy_to_16bit(
 
 				return( -1 );
 			}
-			*value_16bit = (uint16_t) integer_value;
+			*value_32bit = (uint32_t) integer_value;
 
 			result = 1;
 		}
@@ -3245,18 +5125,18 @@ int libfvalue_value_copy_to_16bit(
 	return( result );
 }
 
-/* Copies the value data from a 32-bit value
+/* Copies the value data from a 64-bit value
  * Returns 1 if successful, 0 if value could not be set or -1 on error
  */
-int libfvalue_value_copy_from_32bit(
+int libfvalue_value_copy_from_64bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint32_t value_32bit,
+     uint64_t value_64bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_from_32bit";
+	static char *function                      = "libfvalue_value_copy_from_64bit";
 	int result                                 = 0;
 
 	if( value == NULL )
@@ -3272,7 +5152,10 @@ int libfvalue_value_copy_from_32bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_integer != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -3292,17 +5175,17 @@ int libfvalue_value_copy_from_32bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_integer(
+			if( internal_value->type_descriptor->copy_from_integer(
 			     value_instance,
-			     (uint64_t) value_32bit,
-			     32,
+			     (uint64_t) value_64bit,
+			     64,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance from 32-bit integer.",
+				 "%s: unable to copy instance from 64-bit integer.",
 				 function );
 
 				return( -1 );
@@ -3313,18 +5196,18 @@ int libfvalue_value_copy_from_32bit(
 	return( result );
 }
 
-/* Copies the value data to a 32-bit value
+/* Copies the value data to a 64-bit value
  * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
-int libfvalue_value_copy_to_32bit(
+int libfvalue_value_copy_to_64bit(
      libfvalue_value_t *value,
      int value_entry_index,
-     uint32_t *value_32bit,
+     uint64_t *value_64bit,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_to_32bit";
+	static char *function                      = "libfvalue_value_copy_to_64bit";
 	size_t integer_value_size                  = 0;
 	uint64_t integer_value                     = 0;
 	int result                                 = 0;
@@ -3342,21 +5225,24 @@ int libfvalue_value_copy_to_32bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( value_32bit == NULL )
+	if( value_64bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value 32-bit.",
+		 "%s: missing value 64-bit.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_integer != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -3373,7 +5259,7 @@ int libfvalue_value_copy_to_32bit(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_integer(
+			if( internal_value->type_descriptor->copy_to_integer(
 			     value_instance,
 			     &integer_value,
 			     &integer_value_size,
@@ -3388,18 +5274,7 @@ int libfvalue_value_copy_to_32bit(
 
 				return( -1 );
 			}
-			if( integer_value > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: integer value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			*value_32bit = (uint32_t) integer_value;
+			*value_64bit = (uint64_t) integer_value;
 
 			result = 1;
 		}
@@ -3407,19 +5282,35 @@ int libfvalue_value_copy_to_32bit(
 	return( result );
 }
 
-/* Copies the value data from a 64-bit value
- * Returns 1 if successful, 0 if value could not be set or -1 on error
+/* Copies the value data of a range of value entries to integer values
+ * Value entries of an integer type that have no value instance are decoded
+ * directly from the data handle without creating a value instance
+ * Returns 1 if successful, 0 if the values could not be retrieved or -1 on error
  */
-int libfvalue_value_copy_from_64bit(
+int libfvalue_value_copy_to_integer_array(
      libfvalue_value_t *value,
-     int value_entry_index,
-     uint64_t value_64bit,
+     int first_value_entry_index,
+     int number_of_value_entries,
+     uint64_t *integer_values,
+     size_t number_of_integer_values,
      libcerror_error_t **error )
 {
 	libfvalue_internal_value_t *internal_value = NULL;
 	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_from_64bit";
+	uint8_t *entry_data                        = NULL;
+	static char *function                      = "libfvalue_value_copy_to_integer_array";
+	size_t entry_data_size                     = 0;
+	size_t integer_value_size                  = 0;
+	uint64_t integer_value                     = 0;
+	int encoding                               = 0;
+	int has_data                               = 0;
+	int has_value_instances                    = 0;
+	int is_integer_type                        = 0;
+	int number_of_value_instances              = 0;
 	int result                                 = 0;
+	int safe_number_of_value_entries           = 0;
+	int value_entry_index                      = 0;
+	int value_index                            = 0;
 
 	if( value == NULL )
 	{
@@ -3434,108 +5325,312 @@ int libfvalue_value_copy_from_64bit(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_integer != NULL )
+	if( integer_values == NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
-		     value_entry_index,
-		     &value_instance,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_integer_values < (size_t) number_of_value_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of integer values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_integer == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_number_of_value_entries(
+	     value,
+	     &safe_number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_value_entry_index < 0 )
+	 || ( first_value_entry_index >= safe_number_of_value_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first value entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries > ( safe_number_of_value_entries - first_value_entry_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	has_data = libfvalue_value_has_data(
+	            value,
+	            error );
+
+	if( has_data == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->value_instances != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_value->value_instances,
+		     &number_of_value_instances,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value instance: %d.",
-			 function,
-			 value_entry_index );
+			 "%s: unable to retrieve number of entries from values instances array.",
+			 function );
 
 			return( -1 );
 		}
-		if( value_instance != NULL )
+	}
+	switch( internal_value->type_descriptor->type )
+	{
+		case LIBFVALUE_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_64BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+			is_integer_type = has_data;
+			break;
+
+		default:
+			break;
+	}
+	if( is_integer_type != 0 )
+	{
+		/* A value instance can contain a value that differs from the data
+		 * hence the data can only be decoded in bulk if none of the value
+		 * entries has a value instance
+		 */
+		for( value_entry_index = first_value_entry_index;
+		     value_entry_index < ( first_value_entry_index + number_of_value_entries );
+		     value_entry_index++ )
 		{
-			if( internal_value->copy_from_integer(
-			     value_instance,
-			     (uint64_t) value_64bit,
-			     64,
+			if( value_entry_index >= number_of_value_instances )
+			{
+				break;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     internal_value->value_instances,
+			     value_entry_index,
+			     &value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from values instances array.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			if( value_instance != NULL )
+			{
+				has_value_instances = 1;
+
+				break;
+			}
+		}
+		if( has_value_instances == 0 )
+		{
+			result = libfvalue_data_handle_get_value_entries_data(
+			          internal_value->data_handle,
+			          first_value_entry_index,
+			          number_of_value_entries,
+			          &entry_data,
+			          &entry_data_size,
+			          &encoding,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entries: %d - %d data from data handle.",
+				 function,
+				 first_value_entry_index,
+				 first_value_entry_index + number_of_value_entries - 1 );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( libfvalue_integer_copy_from_byte_stream_array(
+				     integer_values,
+				     (size_t) number_of_value_entries,
+				     entry_data,
+				     entry_data_size * number_of_value_entries,
+				     encoding,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value entries data to integer values.",
+					 function );
+
+					return( -1 );
+				}
+				return( 1 );
+			}
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_value_entries;
+	     value_index++ )
+	{
+		value_entry_index = first_value_entry_index + value_index;
+		value_instance    = NULL;
+
+		if( ( is_integer_type != 0 )
+		 && ( value_entry_index < number_of_value_instances ) )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_value->value_instances,
+			     value_entry_index,
+			     &value_instance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from values instances array.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( ( is_integer_type != 0 )
+		 && ( value_instance == NULL ) )
+		{
+			if( libfvalue_data_handle_get_value_entry_data(
+			     internal_value->data_handle,
+			     value_entry_index,
+			     &entry_data,
+			     &entry_data_size,
+			     &encoding,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d data from data handle.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			if( entry_data == NULL )
+			{
+				return( 0 );
+			}
+			if( libfvalue_integer_copy_from_byte_stream_array(
+			     &( integer_values[ value_index ] ),
+			     1,
+			     entry_data,
+			     entry_data_size,
+			     encoding,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance from 64-bit integer.",
-				 function );
+				 "%s: unable to copy entry: %d data to integer value.",
+				 function,
+				 value_entry_index );
 
 				return( -1 );
 			}
-			result = 1;
 		}
-	}
-	return( result );
-}
-
-/* Copies the value data to a 64-bit value
- * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
- */
-int libfvalue_value_copy_to_64bit(
-     libfvalue_value_t *value,
-     int value_entry_index,
-     uint64_t *value_64bit,
-     libcerror_error_t **error )
-{
-	libfvalue_internal_value_t *internal_value = NULL;
-	intptr_t *value_instance                   = NULL;
-	static char *function                      = "libfvalue_value_copy_to_64bit";
-	size_t integer_value_size                  = 0;
-	uint64_t integer_value                     = 0;
-	int result                                 = 0;
-
-	if( value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
-		 function );
-
-		return( -1 );
-	}
-	internal_value = (libfvalue_internal_value_t *) value;
-
-	if( value_64bit == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value 64-bit.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_value->copy_to_integer != NULL )
-	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
-		     value_entry_index,
-		     &value_instance,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value instance: %d.",
-			 function,
-			 value_entry_index );
+			if( value_instance == NULL )
+			{
+				if( libfvalue_internal_value_get_read_instance_by_index(
+				     internal_value,
+				     value_entry_index,
+				     &value_instance,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value instance: %d.",
+					 function,
+					 value_entry_index );
 
-			return( -1 );
-		}
-		if( value_instance != NULL )
-		{
-			if( internal_value->copy_to_integer(
+					return( -1 );
+				}
+				if( value_instance == NULL )
+				{
+					return( 0 );
+				}
+			}
+			if( internal_value->type_descriptor->copy_to_integer(
 			     value_instance,
 			     &integer_value,
 			     &integer_value_size,
@@ -3545,17 +5640,16 @@ int libfvalue_value_copy_to_64bit(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy instance to integer value.",
-				 function );
+				 "%s: unable to copy instance: %d to integer value.",
+				 function,
+				 value_entry_index );
 
 				return( -1 );
 			}
-			*value_64bit = (uint64_t) integer_value;
-
-			result = 1;
+			integer_values[ value_index ] = integer_value;
 		}
 	}
-	return( result );
+	return( 1 );
 }
 
 /* Floating point value functions
@@ -3588,7 +5682,10 @@ int libfvalue_value_copy_from_float(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_floating_point != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_floating_point != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -3608,7 +5705,7 @@ int libfvalue_value_copy_from_float(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_floating_point(
+			if( internal_value->type_descriptor->copy_from_floating_point(
 			     value_instance,
 			     (double) value_float,
 			     32,
@@ -3669,10 +5766,13 @@ int libfvalue_value_copy_to_float(
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_floating_point != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_floating_point != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -3689,7 +5789,7 @@ int libfvalue_value_copy_to_float(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_floating_point(
+			if( internal_value->type_descriptor->copy_to_floating_point(
 			     value_instance,
 			     &floating_point_value,
 			     &floating_point_value_size,
@@ -3739,7 +5839,10 @@ int libfvalue_value_copy_from_double(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_floating_point != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_from_floating_point != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -3759,7 +5862,7 @@ int libfvalue_value_copy_from_double(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_from_floating_point(
+			if( internal_value->type_descriptor->copy_from_floating_point(
 			     value_instance,
 			     (double) value_double,
 			     64,
@@ -3820,10 +5923,13 @@ int libfvalue_value_copy_to_double(
 
 		return( -1 );
 	}
-	if( internal_value->copy_to_floating_point != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_floating_point != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -3840,7 +5946,7 @@ int libfvalue_value_copy_to_double(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_floating_point(
+			if( internal_value->type_descriptor->copy_to_floating_point(
 			     value_instance,
 			     &floating_point_value,
 			     &floating_point_value_size,
@@ -3895,7 +6001,10 @@ int libfvalue_value_copy_from_utf8_string(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->initialize_instance == NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->initialize_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3906,7 +6015,7 @@ int libfvalue_value_copy_from_utf8_string(
 
 		return( -1 );
 	}
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3917,7 +6026,7 @@ int libfvalue_value_copy_from_utf8_string(
 
 		return( -1 );
 	}
-	if( internal_value->copy_from_utf8_string_with_index != NULL )
+	if( internal_value->type_descriptor->copy_from_utf8_string_with_index != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -3937,7 +6046,7 @@ int libfvalue_value_copy_from_utf8_string(
 		}
 		if( value_instance == NULL )
 		{
-			if( internal_value->initialize_instance(
+			if( internal_value->type_descriptor->initialize_instance(
 			     &value_instance,
 			     error ) != 1 )
 			{
@@ -3964,14 +6073,14 @@ int libfvalue_value_copy_from_utf8_string(
 				 function,
 				 value_entry_index );
 
-				internal_value->free_instance(
+				internal_value->type_descriptor->free_instance(
 				 &value_instance,
 				 NULL );
 
 				return( -1 );
 			}
 		}
-		if( internal_value->copy_from_utf8_string_with_index(
+		if( internal_value->type_descriptor->copy_from_utf8_string_with_index(
 		     value_instance,
 		     utf8_string,
 		     utf8_string_length,
@@ -4020,10 +6129,10 @@ int libfvalue_value_get_utf8_string_size(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->get_utf8_string_size != NULL )
+	if( internal_value->type_descriptor->get_utf8_string_size != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4040,7 +6149,7 @@ int libfvalue_value_get_utf8_string_size(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->get_utf8_string_size(
+			if( internal_value->type_descriptor->get_utf8_string_size(
 			     value_instance,
 			     utf8_string_size,
 			     internal_value->format_flags,
@@ -4061,6 +6170,80 @@ int libfvalue_value_get_utf8_string_size(
 	return( result );
 }
 
+/* Retrieves the UTF-8 encoded string of the value data
+ * The UTF-8 string is converted once and owned by the value, it remains
+ * valid until the value data is changed or the value is freed
+ * With the no-cache instance policy it only remains valid until the next read of the value
+ * The UTF-8 string size includes the end of string character
+ * Returns 1 if successful, 0 if the UTF-8 string is not available or -1 on error
+ */
+int libfvalue_value_get_utf8_string(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value = NULL;
+	intptr_t *value_instance                   = NULL;
+	static char *function                      = "libfvalue_value_get_utf8_string";
+	int result                                 = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( internal_value->type_descriptor->get_utf8_string != NULL )
+	{
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value instance: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( value_instance != NULL )
+		{
+			if( internal_value->type_descriptor->get_utf8_string(
+			     value_instance,
+			     utf8_string,
+			     utf8_string_size,
+			     internal_value->format_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string of instance.",
+				 function );
+
+				return( -1 );
+			}
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Copies the value data to an UTF-8 encoded string
  * Returns 1 if successful, 0 if size value not be retrieved or -1 on error
  */
@@ -4127,10 +6310,13 @@ int libfvalue_value_copy_to_utf8_string_with_index(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_to_utf8_string_with_index != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_utf8_string_with_index != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4147,7 +6333,7 @@ int libfvalue_value_copy_to_utf8_string_with_index(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_utf8_string_with_index(
+			if( internal_value->type_descriptor->copy_to_utf8_string_with_index(
 			     value_instance,
 			     utf8_string,
 			     utf8_string_size,
@@ -4199,7 +6385,10 @@ int libfvalue_value_copy_from_utf16_string(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->initialize_instance == NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->initialize_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4210,7 +6399,7 @@ int libfvalue_value_copy_from_utf16_string(
 
 		return( -1 );
 	}
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4221,7 +6410,7 @@ int libfvalue_value_copy_from_utf16_string(
 
 		return( -1 );
 	}
-	if( internal_value->copy_from_utf16_string_with_index != NULL )
+	if( internal_value->type_descriptor->copy_from_utf16_string_with_index != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -4241,7 +6430,7 @@ int libfvalue_value_copy_from_utf16_string(
 		}
 		if( value_instance == NULL )
 		{
-			if( internal_value->initialize_instance(
+			if( internal_value->type_descriptor->initialize_instance(
 			     &value_instance,
 			     error ) != 1 )
 			{
@@ -4268,14 +6457,14 @@ int libfvalue_value_copy_from_utf16_string(
 				 function,
 				 value_entry_index );
 
-				internal_value->free_instance(
+				internal_value->type_descriptor->free_instance(
 				 &value_instance,
 				 NULL );
 
 				return( -1 );
 			}
 		}
-		if( internal_value->copy_from_utf16_string_with_index(
+		if( internal_value->type_descriptor->copy_from_utf16_string_with_index(
 		     value_instance,
 		     utf16_string,
 		     utf16_string_length,
@@ -4324,10 +6513,10 @@ int libfvalue_value_get_utf16_string_size(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->get_utf16_string_size != NULL )
+	if( internal_value->type_descriptor->get_utf16_string_size != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4344,7 +6533,7 @@ int libfvalue_value_get_utf16_string_size(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->get_utf16_string_size(
+			if( internal_value->type_descriptor->get_utf16_string_size(
 			     value_instance,
 			     utf16_string_size,
 			     internal_value->format_flags,
@@ -4431,10 +6620,13 @@ int libfvalue_value_copy_to_utf16_string_with_index(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_to_utf16_string_with_index != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_utf16_string_with_index != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4451,7 +6643,7 @@ int libfvalue_value_copy_to_utf16_string_with_index(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_utf16_string_with_index(
+			if( internal_value->type_descriptor->copy_to_utf16_string_with_index(
 			     value_instance,
 			     utf16_string,
 			     utf16_string_size,
@@ -4503,7 +6695,10 @@ int libfvalue_value_copy_from_utf32_string(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->initialize_instance == NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->initialize_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4514,7 +6709,7 @@ int libfvalue_value_copy_from_utf32_string(
 
 		return( -1 );
 	}
-	if( internal_value->free_instance == NULL )
+	if( internal_value->type_descriptor->free_instance == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4527,7 +6722,7 @@ int libfvalue_value_copy_from_utf32_string(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_from_utf32_string_with_index != NULL )
+	if( internal_value->type_descriptor->copy_from_utf32_string_with_index != NULL )
 	{
 		if( libfvalue_value_get_value_instance_by_index(
 		     value,
@@ -4547,7 +6742,7 @@ int libfvalue_value_copy_from_utf32_string(
 		}
 		if( value_instance == NULL )
 		{
-			if( internal_value->initialize_instance(
+			if( internal_value->type_descriptor->initialize_instance(
 			     &value_instance,
 			     error ) != 1 )
 			{
@@ -4574,14 +6769,14 @@ int libfvalue_value_copy_from_utf32_string(
 				 function,
 				 value_entry_index );
 
-				internal_value->free_instance(
+				internal_value->type_descriptor->free_instance(
 				 &value_instance,
 				 NULL );
 
 				return( -1 );
 			}
 		}
-		if( internal_value->copy_from_utf32_string_with_index(
+		if( internal_value->type_descriptor->copy_from_utf32_string_with_index(
 		     value_instance,
 		     utf32_string,
 		     utf32_string_length,
@@ -4630,10 +6825,10 @@ int libfvalue_value_get_utf32_string_size(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->get_utf32_string_size != NULL )
+	if( internal_value->type_descriptor->get_utf32_string_size != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4650,7 +6845,7 @@ int libfvalue_value_get_utf32_string_size(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->get_utf32_string_size(
+			if( internal_value->type_descriptor->get_utf32_string_size(
 			     value_instance,
 			     utf32_string_size,
 			     internal_value->format_flags,
@@ -4737,10 +6932,13 @@ int libfvalue_value_copy_to_utf32_string_with_index(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->copy_to_utf32_string_with_index != NULL )
+	libfvalue_statistics_count_conversion(
+	 internal_value->type_descriptor->type );
+
+	if( internal_value->type_descriptor->copy_to_utf32_string_with_index != NULL )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -4757,7 +6955,7 @@ int libfvalue_value_copy_to_utf32_string_with_index(
 		}
 		if( value_instance != NULL )
 		{
-			if( internal_value->copy_to_utf32_string_with_index(
+			if( internal_value->type_descriptor->copy_to_utf32_string_with_index(
 			     value_instance,
 			     utf32_string,
 			     utf32_string_size,
@@ -4772,29 +6970,139 @@ int libfvalue_value_copy_to_utf32_string_with_index(
 				 "%s: unable to copy instance to UTF-32 string.",
 				 function );
 
-				return( -1 );
-			}
-			result = 1;
-		}
+				return( -1 );
+			}
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Marshalling functions
+ */
+
+/* Copies a value entry from an UTF-8 encoded string
+ * The UTF-8 string must be followed by an end-of-string character
+ * A value of a string type stores the UTF-8 string as the data of a new value entry,
+ * other value types require the value entry to exist and set its value instance
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_copy_entry_from_utf8_string(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvalue_internal_value_copy_entry_from_utf8_string";
+	int appended_value_entry_index = 0;
+	int result                     = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+	{
+		if( libfvalue_value_append_entry_data(
+		     (libfvalue_value_t *) internal_value,
+		     &appended_value_entry_index,
+		     utf8_string,
+		     utf8_string_length + 1,
+		     LIBFVALUE_CODEPAGE_UTF8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value entry data.",
+			 function );
+
+			return( -1 );
+		}
+		if( appended_value_entry_index != value_entry_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libfvalue_value_copy_from_utf8_string(
+	          (libfvalue_value_t *) internal_value,
+	          value_entry_index,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value entry: %d from UTF-8 string.",
+		 function,
+		 value_entry_index );
+
+		return( -1 );
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Marshalling functions
- */
-
-#ifdef TODO
-
 /* Reads the value data from a file stream
- * Returns the number of bytes read or -1 on error
+ * The value is read as XML, as written by libfvalue_value_write_to_file_stream,
+ * using a buffered XML reader. Data that was read ahead from the file stream
+ * is given back by seeking the file stream to the end of the value
+ * Returns the number of bytes read, 0 if no value was found or -1 on error
  */
 ssize_t libfvalue_value_read_from_file_stream(
          libfvalue_value_t *value,
          FILE *file_stream,
          libcerror_error_t **error )
 {
-	libfvalue_internal_value_t *internal_value = NULL;
-	static char *function                      = "libfvalue_value_read_from_file_stream";
+	libfvalue_xml_reader_t *xml_reader = NULL;
+	static char *function              = "libfvalue_value_read_from_file_stream";
+	size_t read_count                  = 0;
+	int result                         = 0;
 
 	if( value == NULL )
 	{
@@ -4807,37 +7115,119 @@ ssize_t libfvalue_value_read_from_file_stream(
 
 		return( -1 );
 	}
-	internal_value = (libfvalue_internal_value_t *) value;
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
 
-	if( internal_value->copy_from_utf8_string_with_index == NULL )
+		return( -1 );
+	}
+	if( libfvalue_xml_reader_initialize(
+	     &xml_reader,
+	     (intptr_t *) file_stream,
+	     &libfvalue_xml_reader_read_file_stream,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing copy from UTF-8 string function.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML reader.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( file_stream == NULL )
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file stream.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_xml_reader_unread_file_stream(
+	     xml_reader,
+	     file_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file stream to end of value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_xml_reader_get_offset(
+	     xml_reader,
+	     &read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_xml_reader_free(
+	     &xml_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free XML reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( read_count > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read count value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement function */
+	return( (ssize_t) read_count );
+
+on_error:
+	if( xml_reader != NULL )
+	{
+		libfvalue_xml_reader_free(
+		 &xml_reader,
+		 NULL );
+	}
 	return( -1 );
 }
 
-#endif /* TODO */
-
 /* Writes the value data to a file stream
+ * The value is written as XML using a buffered XML writer
  * Returns the number of bytes written or -1 on error
  */
 ssize_t libfvalue_value_write_to_file_stream(
@@ -4845,16 +7235,9 @@ ssize_t libfvalue_value_write_to_file_stream(
          FILE *file_stream,
          libcerror_error_t **error )
 {
-	libfvalue_internal_value_t *internal_value = NULL;
-	intptr_t *value_instance                   = NULL;
-	uint8_t *value_string                      = NULL;
-	static char *function                      = "libfvalue_value_write_to_file_stream";
-	size_t value_string_index                  = 0;
-	size_t value_string_size                   = 0;
-	ssize_t write_count                        = 0;
-	int print_count                            = 0;
-	int number_of_value_entries                = 0;
-	int value_entry_index                      = 0;
+	libfvalue_xml_writer_t *xml_writer = NULL;
+	static char *function              = "libfvalue_value_write_to_file_stream";
+	size_t write_count                 = 0;
 
 	if( value == NULL )
 	{
@@ -4867,254 +7250,106 @@ ssize_t libfvalue_value_write_to_file_stream(
 
 		return( -1 );
 	}
-	internal_value = (libfvalue_internal_value_t *) value;
-
-	if( internal_value->type_string == NULL )
+	if( file_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing type string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_value->identifier == NULL )
-	 || ( internal_value->identifier[ 0 ] == 0 ) )
+	if( libfvalue_xml_writer_initialize(
+	     &xml_writer,
+	     (intptr_t *) file_stream,
+	     &libfvalue_xml_writer_write_file_stream,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing identifier.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML writer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_value->get_utf8_string_size == NULL )
+	if( libfvalue_xml_writer_write_value(
+	     xml_writer,
+	     value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing get UTF-8 string size function.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_value->copy_to_utf8_string_with_index == NULL )
+	if( libfvalue_xml_writer_flush(
+	     xml_writer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid value - missing copy to UTF-8 string function.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush XML writer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( file_stream == NULL )
+	if( libfvalue_xml_writer_get_number_of_bytes_written(
+	     xml_writer,
+	     &write_count,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes written.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfvalue_value_get_number_of_value_entries(
-	     value,
-	     &number_of_value_entries,
+	if( libfvalue_xml_writer_free(
+	     &xml_writer,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of value entries.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free XML writer.",
 		 function );
 
 		goto on_error;
 	}
-	for( value_entry_index = 0;
-	     value_entry_index < number_of_value_entries;
-	     value_entry_index++ )
+	if( write_count > (size_t) SSIZE_MAX )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
-		     value_entry_index,
-		     &value_instance,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value instance: %d.",
-			 function,
-			 value_entry_index );
-
-			goto on_error;
-		}
-		print_count = fprintf(
-			       file_stream,
-			       "<%s type=\"%s\">",
-			       (char *) internal_value->identifier,
-			       internal_value->type_string );
-
-		if( print_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to file stream.",
-			 function );
-
-			goto on_error;
-		}
-		write_count += print_count;
-
-		if( number_of_value_entries > 1 )
-		{
-			print_count = fprintf(
-				       file_stream,
-				       "<value_entry>" );
-
-			if( print_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write to file stream.",
-				 function );
-
-				goto on_error;
-			}
-			write_count += print_count;
-		}
-		if( value_instance != NULL )
-		{
-			if( internal_value->get_utf8_string_size(
-			     value_instance,
-			     &value_string_size,
-			     internal_value->format_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine size UTF-8 string of instance.",
-				 function );
-
-				goto on_error;
-			}
-			if( value_string_size > 0 )
-			{
-				value_string = (uint8_t *) memory_allocate(
-							    sizeof( uint8_t ) * value_string_size );
-
-				if( value_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to value string.",
-					 function );
-
-					goto on_error;
-				}
-				if( internal_value->copy_to_utf8_string_with_index(
-				     value_instance,
-				     value_string,
-				     value_string_size,
-				     &value_string_index,
-				     internal_value->format_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy instance to UTF-8 string.",
-					 function );
-
-					goto on_error;
-				}
-				print_count = fprintf(
-					       file_stream,
-					       "%s",
-					       value_string );
-
-				if( print_count < 0 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to write to file stream.",
-					 function );
-
-					goto on_error;
-				}
-				write_count += print_count;
-
-				memory_free(
-				 value_string );
-
-				value_string = NULL;
-			}
-		}
-		if( number_of_value_entries > 1 )
-		{
-			print_count = fprintf(
-				       file_stream,
-				       "</value_entry>" );
-
-			if( print_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write to file stream.",
-				 function );
-
-				goto on_error;
-			}
-			write_count += print_count;
-		}
-		print_count = fprintf(
-			       file_stream,
-			       "</%s>",
-			       (char *) internal_value->identifier );
-
-		if( print_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to file stream.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid write count value exceeds maximum.",
+		 function );
 
-			goto on_error;
-		}
-		write_count += print_count;
+		return( -1 );
 	}
-	return( write_count );
+	return( (ssize_t) write_count );
 
 on_error:
-	if( value_string != NULL )
+	if( xml_writer != NULL )
 	{
-		memory_free(
-		 value_string );
+		libfvalue_xml_writer_free(
+		 &xml_writer,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -5149,7 +7384,7 @@ int libfvalue_value_print(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( internal_value->type_description == NULL )
+	if( internal_value->type_descriptor->type_description == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5161,9 +7396,9 @@ int libfvalue_value_print(
 		return( -1 );
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( internal_value->get_utf16_string_size == NULL )
+	if( internal_value->type_descriptor->get_utf16_string_size == NULL )
 #else
-	if( internal_value->get_utf8_string_size == NULL )
+	if( internal_value->type_descriptor->get_utf8_string_size == NULL )
 #endif
 	{
 		libcerror_error_set(
@@ -5176,9 +7411,9 @@ int libfvalue_value_print(
 		return( -1 );
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( internal_value->copy_to_utf16_string_with_index == NULL )
+	if( internal_value->type_descriptor->copy_to_utf16_string_with_index == NULL )
 #else
-	if( internal_value->copy_to_utf8_string_with_index == NULL )
+	if( internal_value->type_descriptor->copy_to_utf8_string_with_index == NULL )
 #endif
 	{
 		libcerror_error_set(
@@ -5206,7 +7441,7 @@ int libfvalue_value_print(
 	{
 		libcnotify_printf(
 		 "%s\t: ",
-		internal_value->type_description );
+		internal_value->type_descriptor->type_description );
 	}
 	result = libfvalue_value_has_data(
 	          value,
@@ -5225,8 +7460,8 @@ int libfvalue_value_print(
 	}
 	else if( result != 0 )
 	{
-		if( libfvalue_value_get_value_instance_by_index(
-		     value,
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
 		     value_entry_index,
 		     &value_instance,
 		     error ) != 1 )
@@ -5244,13 +7479,13 @@ int libfvalue_value_print(
 		if( value_instance != NULL )
 		{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = internal_value->get_utf16_string_size(
+			result = internal_value->type_descriptor->get_utf16_string_size(
 				  value_instance,
 				  &value_string_size,
 				  internal_value->format_flags,
 				  error );
 #else
-			result = internal_value->get_utf8_string_size(
+			result = internal_value->type_descriptor->get_utf8_string_size(
 				  value_instance,
 				  &value_string_size,
 				  internal_value->format_flags,
@@ -5284,7 +7519,7 @@ int libfvalue_value_print(
 					goto on_error;
 				}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = internal_value->copy_to_utf16_string_with_index(
+				result = internal_value->type_descriptor->copy_to_utf16_string_with_index(
 					  value_instance,
 					  (uint16_t *) value_string,
 					  value_string_size,
@@ -5292,7 +7527,7 @@ int libfvalue_value_print(
 					  internal_value->format_flags,
 					  error );
 #else
-				result = internal_value->copy_to_utf8_string_with_index(
+				result = internal_value->type_descriptor->copy_to_utf8_string_with_index(
 					  value_instance,
 					  (uint8_t *) value_string,
 					  value_string_size,
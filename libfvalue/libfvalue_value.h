@@ -31,6 +31,7 @@
 #include "libfvalue_libcdata.h"
 #include "libfvalue_libcerror.h"
 #include "libfvalue_types.h"
+#include "libfvalue_value_type_descriptor.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,18 +41,6 @@ typedef struct libfvalue_internal_value libfvalue_internal_value_t;
 
 struct libfvalue_internal_value
 {
-	/* The type
-	 */
-	int type;
-
-	/* The type string
-	 */
-	const char *type_string;
-
-	/* The type description
-	 */
-	const char *type_description;
-
 	/* The identifier
 	 */
 	uint8_t *identifier;
@@ -68,162 +57,27 @@ struct libfvalue_internal_value
 	 */
 	libcdata_array_t *value_instances;
 
-	/* The initialize instance function
-	 */
-	int (*initialize_instance)(
-	      intptr_t **instance,
-	      libcerror_error_t **error );
-
-	/* The free instance function
-	 */
-	int (*free_instance)(
-	      intptr_t **instance,
-	      libcerror_error_t **error );
-
-	/* The clone (duplicate) instance function
-	 */
-	int (*clone_instance)(
-	      intptr_t **destination_instance,
-	      intptr_t *source_instance,
-	      libcerror_error_t **error );
-
-	/* The instance copy from byte stream
+	/* The value instance used to decode value entries
+	 * with the no-cache instance policy
 	 */
-	int (*copy_from_byte_stream)(
-	      intptr_t *instance,
-	      const uint8_t *byte_stream,
-	      size_t byte_stream_size,
-	      int encoding,
-	      libcerror_error_t **error );
-
-	/* The instance copy to byte stream
-	 */
-	int (*copy_to_byte_stream)(
-	      intptr_t *instance,
-	      uint8_t *byte_stream,
-	      size_t byte_stream_size,
-	      int encoding,
-	      libcerror_error_t **error );
-
-	/* The instance copy from integer function
-	 */
-	int (*copy_from_integer)(
-	      intptr_t *instance,
-	      uint64_t integer_value,
-	      size_t integer_value_size,
-	      libcerror_error_t **error );
-
-	/* The instance copy to integer function
-	 */
-	int (*copy_to_integer)(
-	      intptr_t *instance,
-	      uint64_t *integer_value,
-	      size_t *integer_value_size,
-	      libcerror_error_t **error );
-
-	/* The instance copy from floating point function
-	 */
-	int (*copy_from_floating_point)(
-	      intptr_t *instance,
-	      double floating_point_value,
-	      size_t floating_point_value_size,
-	      libcerror_error_t **error );
+	intptr_t *scratch_instance;
 
-	/* The instance copy to floating point function
+	/* The type descriptor
 	 */
-	int (*copy_to_floating_point)(
-	      intptr_t *instance,
-	      double *floating_point_value,
-	      size_t *floating_point_value_size,
-	      libcerror_error_t **error );
+	const libfvalue_internal_value_type_descriptor_t *type_descriptor;
 
-	/* The instance copy from UTF-8 string with index function
-	 */
-	int (*copy_from_utf8_string_with_index)(
-	      intptr_t *instance,
-	      const uint8_t *utf8_string,
-	      size_t utf8_string_length,
-	      size_t *utf8_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance get UTF-8 string size function
-	 */
-	int (*get_utf8_string_size)(
-	      intptr_t *instance,
-	      size_t *utf8_string_size,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance copy to UTF-8 string with index function
-	 */
-	int (*copy_to_utf8_string_with_index)(
-	      intptr_t *instance,
-	      uint8_t *utf8_string,
-	      size_t utf8_string_size,
-	      size_t *utf8_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance copy from UTF-16 string with index function
-	 */
-	int (*copy_from_utf16_string_with_index)(
-	      intptr_t *instance,
-	      const uint16_t *utf16_string,
-	      size_t utf16_string_length,
-	      size_t *utf16_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance get UTF-16 string size function
-	 */
-	int (*get_utf16_string_size)(
-	      intptr_t *instance,
-	      size_t *utf16_string_size,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance copy to UTF-16 string with index function
-	 */
-	int (*copy_to_utf16_string_with_index)(
-	      intptr_t *instance,
-	      uint16_t *utf16_string,
-	      size_t utf16_string_size,
-	      size_t *utf16_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance copy from UTF-32 string with index function
-	 */
-	int (*copy_from_utf32_string_with_index)(
-	      intptr_t *instance,
-	      const uint32_t *utf32_string,
-	      size_t utf32_string_length,
-	      size_t *utf32_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
-
-	/* The instance get UTF-32 string size function
+	/* The format flags
 	 */
-	int (*get_utf32_string_size)(
-	      intptr_t *instance,
-	      size_t *utf32_string_size,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
+	uint32_t format_flags;
 
-	/* The instance copy to UTF-32 string with index function
+	/* The arena
+	 * NULL if the memory of the value is not allocated in an arena
 	 */
-	int (*copy_to_utf32_string_with_index)(
-	      intptr_t *instance,
-	      uint32_t *utf32_string,
-	      size_t utf32_string_size,
-	      size_t *utf32_string_index,
-	      uint32_t string_format_flags,
-	      libcerror_error_t **error );
+	libfvalue_arena_t *arena;
 
-	/* The format flags
+	/* The value instance policy
 	 */
-	uint32_t format_flags;
+	uint8_t instance_policy;
 
 	/* The flags
 	 */
@@ -338,6 +192,22 @@ int libfvalue_value_initialize(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_value_initialize_with_type_descriptor(
+     libfvalue_value_t **value,
+     libfvalue_value_type_descriptor_t *type_descriptor,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_initialize(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     const libfvalue_internal_value_type_descriptor_t *type_descriptor,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_value_free(
      libfvalue_value_t **value,
@@ -354,6 +224,10 @@ int libfvalue_value_clear(
      libfvalue_value_t *value,
      libcerror_error_t **error );
 
+int libfvalue_internal_value_clear_value_entries(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error );
+
 int libfvalue_compare_identifier(
      intptr_t *first_value,
      intptr_t *second_value,
@@ -461,6 +335,18 @@ int libfvalue_value_set_format_flags(
      uint32_t format_flags,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_value_get_instance_policy(
+     libfvalue_value_t *value,
+     uint8_t *instance_policy,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_value_set_instance_policy(
+     libfvalue_value_t *value,
+     uint8_t instance_policy,
+     libcerror_error_t **error );
+
 /* Value instance functions
  */
 int libfvalue_value_get_value_instance_by_index(
@@ -469,6 +355,12 @@ int libfvalue_value_get_value_instance_by_index(
      intptr_t **value_instance,
      libcerror_error_t **error );
 
+int libfvalue_internal_value_get_read_instance_by_index(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     intptr_t **value_instance,
+     libcerror_error_t **error );
+
 /* Value entry functions
  */
 LIBFVALUE_EXTERN \
@@ -537,6 +429,43 @@ int libfvalue_value_copy_entry_data(
      int *encoding,
      libcerror_error_t **error );
 
+int libfvalue_internal_value_initialize_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_free_instances_array(
+     libfvalue_internal_value_t **internal_value,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_free_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_materialize_instances(
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_get_entry_serialized_size(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     intptr_t **value_instance,
+     uint8_t **entry_data,
+     size_t *entry_data_size,
+     int *encoding,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_value_get_serialized_size(
+     libfvalue_value_t *value,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_value_flush_to_data_handle(
+     libfvalue_value_t *value,
+     libcerror_error_t **error );
+
 /* Boolean value functions
  */
 LIBFVALUE_EXTERN \
@@ -614,6 +543,15 @@ int libfvalue_value_copy_to_64bit(
 /* Floating point value functions
  */
 LIBFVALUE_EXTERN \
+int libfvalue_value_copy_to_integer_array(
+     libfvalue_value_t *value,
+     int first_value_entry_index,
+     int number_of_value_entries,
+     uint64_t *integer_values,
+     size_t number_of_integer_values,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
 int libfvalue_value_copy_from_float(
      libfvalue_value_t *value,
      int value_entry_index,
@@ -658,6 +596,14 @@ int libfvalue_value_get_utf8_string_size(
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_value_get_utf8_string(
+     libfvalue_value_t *value,
+     int value_entry_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 int libfvalue_value_copy_to_utf8_string(
      libfvalue_value_t *value,
@@ -741,6 +687,13 @@ int libfvalue_value_copy_to_utf32_string_with_index(
 
 /* Marshalling functions
  */
+int libfvalue_internal_value_copy_entry_from_utf8_string(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
 LIBFVALUE_EXTERN \
 ssize_t libfvalue_value_read_from_file_stream(
          libfvalue_value_t *value,
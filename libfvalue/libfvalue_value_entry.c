@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
 #include "libfvalue_value_entry.h"
 
 /* Creates a value entry
@@ -72,6 +73,10 @@ int libfvalue_value_entry_initialize(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_ENTRIES,
+	 sizeof( libfvalue_value_entry_t ) );
+
 	if( memory_set(
 	     *value_entry,
 	     0,
@@ -181,6 +186,10 @@ int libfvalue_value_entry_clone(
 
 		goto on_error;
 	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE_ENTRIES,
+	 sizeof( libfvalue_value_entry_t ) );
+
 	if( memory_copy(
 	     *destination_value_entry,
 	     source_value_entry,
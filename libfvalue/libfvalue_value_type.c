@@ -20,6 +20,8 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #include "libfvalue_binary_data.h"
@@ -48,678 +50,1328 @@
 #include "libfvalue_libfwnt.h"
 #endif
 
-static const char *libfvalue_value_type_strings[ 28 ] = {
-	NULL,
-
+/* The binary data value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_binary_data = {
+	LIBFVALUE_VALUE_TYPE_BINARY_DATA,
 	"binary-data",
+	"Binary data",
 
-	"boolean",
-
-	"enum",
-
-	"int8",
-	"uint8",
-	"int16",
-	"uint16",
-	"int32",
-	"uint32",
-	"int64",
-	"uint64",
-
-	"float32",
-	"float64",
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_binary_data_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_binary_data_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_binary_data_clone,
 
-	"NULL",
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_binary_data_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_binary_data_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_binary_data_get_byte_stream_size,
 
-	"byte-stream-string",
-	"utf8-string",
-	"utf16-string",
-	"utf32-string",
+	NULL,
+	NULL,
 
-	"fat-date-time",
-	"filetime",
-	"floatingtime",
-	"nsf-timedate",
-	"hfs-time",
-	"posix-time",
-	"systemtime",
+	NULL,
+	NULL,
 
-	"guid",
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf8_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf8_string_with_index,
 
-	"nt-sid",
-};
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf16_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf16_string_with_index,
 
-static const char *libfvalue_value_type_descriptions[ 28 ] = {
 	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf32_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf32_string_with_index,
 
-	"Binary data",
+	NULL,
+	NULL
+};
 
-	"Boolean",
+/* The floating point 32-bit (single precision) value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_floating_point_32bit = {
+	LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT,
+	"float32",
+	"Floating point 32-bit (single precision)",
 
-	"Enumeration",
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_floating_point_clone,
 
-	"Integer 8-bit signed",
-	"Integer 8-bit unsigned",
-	"Integer 16-bit signed",
-	"Integer 16-bit unsigned",
-	"Integer 32-bit signed",
-	"Integer 32-bit unsigned",
-	"Integer 64-bit signed",
-	"Integer 64-bit unsigned",
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_floating_point_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_floating_point_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_floating_point_get_byte_stream_size,
 
-	"Floating point 32-bit (single precision)",
-	"Floating point 64-bit (double precision)",
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_integer,
 
-	"Null (None)",
+	(int (*)(intptr_t *, double, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_floating_point,
+	(int (*)(intptr_t *, double *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_floating_point,
 
-	"Byte stream string",
-	"UTF-8 string",
-	"UTF-16 string",
-	"UTF-32 string",
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf8_string_with_index,
 
-	"FAT date time",
-	"Filetime",
-	"FLoatingtime",
-	"NSF timedate",
-	"HFS time",
-	"POSIX time",
-	"Systemtime",
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf16_string_with_index,
 
-	"Globally Unique Identifier (GUID)",
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf32_string_with_index,
 
-	"NT Security Identifier (SID)",
+	NULL,
+	NULL
 };
 
-/* Creates a value of a specific type
- * Make sure the value value is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+/* The floating point 64-bit (double precision) value type descriptor
  */
-int libfvalue_value_type_initialize(
-     libfvalue_value_t **value,
-     int type,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_value_type_initialize";
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_floating_point_64bit = {
+	LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT,
+	"float64",
+	"Floating point 64-bit (double precision)",
 
-	if( libfvalue_value_type_initialize_with_data_handle(
-	     value,
-	     type,
-	     NULL,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create value with data handle.",
-		 function );
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_floating_point_clone,
 
-		return( -1 );
-	}
-	return( 1 );
-}
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_floating_point_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_floating_point_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_floating_point_get_byte_stream_size,
 
-/* Initialize a value of a specific type with a custom data handle
- * Returns 1 if successful or -1 on error
- */
-int libfvalue_value_type_initialize_with_data_handle(
-     libfvalue_value_t **value,
-     int type,
-     libfvalue_data_handle_t *data_handle,
-     uint8_t flags,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvalue_value_type_initialize_with_data_handle";
-	int result            = 0;
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_integer,
 
-	if( value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
-		 function );
+	(int (*)(intptr_t *, double, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_floating_point,
+	(int (*)(intptr_t *, double *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_floating_point,
 
-		return( -1 );
-	}
-	switch( type )
-	{
-		case LIBFVALUE_VALUE_TYPE_BINARY_DATA:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf8_string_with_index,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf16_string_with_index,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_binary_data_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_binary_data_free,
-			          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_binary_data_clone,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf32_string_with_index,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_binary_data_copy_from_byte_stream,
-			          NULL,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          NULL,
+/* The boolean value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_boolean = {
+	LIBFVALUE_VALUE_TYPE_BOOLEAN,
+	"boolean",
+	"Boolean",
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf8_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf8_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf16_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf16_string_with_index,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_get_utf32_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_binary_data_copy_to_utf32_string_with_index,
+	NULL,
+	NULL,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT:
-		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_floating_point_free,
-			          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_floating_point_clone,
+	NULL,
+	NULL
+};
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_floating_point_copy_from_byte_stream,
-			          NULL,
+/* The integer 8-bit signed value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_integer_8bit = {
+	LIBFVALUE_VALUE_TYPE_INTEGER_8BIT,
+	"int8",
+	"Integer 8-bit signed",
 
-			          (int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_integer,
-			          (int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_integer,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          (int (*)(intptr_t *, double, size_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_floating_point,
-			          (int (*)(intptr_t *, double *, size_t *, libcerror_error_t **)) &libfvalue_floating_point_copy_to_floating_point,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf8_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf8_string_with_index,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          (int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf16_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf16_string_with_index,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_from_utf32_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_floating_point_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-		case LIBFVALUE_VALUE_TYPE_BOOLEAN:
-		case LIBFVALUE_VALUE_TYPE_INTEGER_8BIT:
-		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
-		case LIBFVALUE_VALUE_TYPE_INTEGER_16BIT:
-		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
-		case LIBFVALUE_VALUE_TYPE_INTEGER_32BIT:
-		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
-		case LIBFVALUE_VALUE_TYPE_INTEGER_64BIT:
-		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          data_handle,
+	NULL,
+	NULL
+};
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
-			          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
+/* The integer 8-bit unsigned value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_unsigned_integer_8bit = {
+	LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT,
+	"uint8",
+	"Integer 8-bit unsigned",
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          (int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
-			          (int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-		case LIBFVALUE_VALUE_TYPE_NULL:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	NULL,
+	NULL
+};
 
-			          data_handle,
+/* The integer 16-bit signed value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_integer_16bit = {
+	LIBFVALUE_VALUE_TYPE_INTEGER_16BIT,
+	"int16",
+	"Integer 16-bit signed",
 
-			          NULL,
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          NULL,
-			          NULL,
+	NULL,
+	NULL,
 
-			          NULL,
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          NULL,
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          NULL,
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          flags,
-			          error );
-			break;
+	NULL,
+	NULL
+};
 
-		case LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM:
-		case LIBFVALUE_VALUE_TYPE_STRING_UTF8:
-		case LIBFVALUE_VALUE_TYPE_STRING_UTF16:
-		case LIBFVALUE_VALUE_TYPE_STRING_UTF32:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+/* The integer 16-bit unsigned value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_unsigned_integer_16bit = {
+	LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT,
+	"uint16",
+	"Integer 16-bit unsigned",
 
-			          data_handle,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_free,
-			          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_string_clone,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          NULL,
-			          NULL,
+	NULL,
+	NULL,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf8_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf8_string_with_index,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          (int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf16_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf16_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf16_string_with_index,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          (int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf32_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf32_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf32_string_with_index,
+	NULL,
+	NULL
+};
 
-			          flags,
-			          error );
-			break;
+/* The integer 32-bit signed value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_integer_32bit = {
+	LIBFVALUE_VALUE_TYPE_INTEGER_32BIT,
+	"int32",
+	"Integer 32-bit signed",
 
-#if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
-		case LIBFVALUE_VALUE_TYPE_FAT_DATE_TIME:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_fat_date_time_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_fat_date_time_free,
-			          NULL,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_from_byte_stream,
-			          NULL,
+	NULL,
+	NULL,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf8_string_with_index,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf16_string_with_index,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf32_string_with_index,
+/* The integer 32-bit unsigned value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_unsigned_integer_32bit = {
+	LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	"uint32",
+	"Integer 32-bit unsigned",
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-		case LIBFVALUE_VALUE_TYPE_FILETIME:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          data_handle,
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_filetime_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_filetime_free,
-			          NULL,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_filetime_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_filetime_copy_from_integer,
-			          (int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_filetime_copy_to_integer,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf8_string_with_index,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf16_string_with_index,
+/* The integer 64-bit signed value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_integer_64bit = {
+	LIBFVALUE_VALUE_TYPE_INTEGER_64BIT,
+	"int64",
+	"Integer 64-bit signed",
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-		case LIBFVALUE_VALUE_TYPE_FLOATINGTIME:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-			          data_handle,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_floatingtime_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_floatingtime_free,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_floatingtime_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          NULL,
-			          NULL,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf8_string_with_index,
+/* The integer 64-bit unsigned value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_unsigned_integer_64bit = {
+	LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT,
+	"uint64",
+	"Integer 64-bit unsigned",
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf16_string_with_index,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_integer_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_integer_clone,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_integer_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_integer_get_byte_stream_size,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_integer_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_integer_copy_to_integer,
 
-		case LIBFVALUE_VALUE_TYPE_NSF_TIMEDATE:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	NULL,
+	NULL,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_nsf_timedate_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_nsf_timedate_free,
-			          NULL,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf16_string_with_index,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_integer_copy_to_utf32_string_with_index,
 
-			          NULL,
-			          NULL,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          NULL,
+/* The null value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_null = {
+	LIBFVALUE_VALUE_TYPE_NULL,
+	"NULL",
+	"Null (None)",
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf8_string_with_index,
+	NULL,
+	NULL,
+	NULL,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf16_string_with_index,
+	NULL,
+	NULL,
+	NULL,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf32_string_with_index,
+	NULL,
+	NULL,
 
-			          flags,
-			          error );
-			break;
+	NULL,
+	NULL,
 
-		case LIBFVALUE_VALUE_TYPE_POSIX_TIME:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	NULL,
+	NULL,
+	NULL,
 
-			          data_handle,
+	NULL,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_posix_time_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_posix_time_free,
-			          NULL,
+	NULL,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_value_type_posix_time_copy_from_byte_stream,
-			          NULL,
+	NULL,
+	NULL
+};
 
-			          NULL,
-			          NULL,
+/* The byte stream string value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_string_byte_stream = {
+	LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
+	"byte-stream-string",
+	"Byte stream string",
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_string_clone,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf8_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_string_get_byte_stream_size,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf16_string_with_index,
+	NULL,
+	NULL,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf32_string_with_index,
+	NULL,
+	NULL,
 
-			          flags,
-			          error );
-			break;
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf8_string_with_index,
 
-		case LIBFVALUE_VALUE_TYPE_SYSTEMTIME:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf16_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf16_string_with_index,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf32_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf32_string_with_index,
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_systemtime_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_systemtime_free,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, uint8_t, libcerror_error_t **)) &libfvalue_string_set_byte_stream,
+	(int (*)(intptr_t *, const uint8_t **, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string
+};
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_systemtime_copy_from_byte_stream,
-			          NULL,
+/* The UTF-8 string value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_string_utf8 = {
+	LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	"utf8-string",
+	"UTF-8 string",
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_string_clone,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_string_get_byte_stream_size,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf8_string_with_index,
+	NULL,
+	NULL,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf16_string_with_index,
+	NULL,
+	NULL,
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf8_string_with_index,
 
-			          flags,
-			          error );
-			break;
-#endif /* defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME ) */
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf16_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf16_string_with_index,
 
-#if defined( HAVE_LIBFGUID ) || defined( HAVE_LOCAL_LIBFGUID )
-		case LIBFVALUE_VALUE_TYPE_GUID:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf32_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf32_string_with_index,
 
-			          data_handle,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, uint8_t, libcerror_error_t **)) &libfvalue_string_set_byte_stream,
+	(int (*)(intptr_t *, const uint8_t **, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string
+};
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfguid_identifier_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfguid_identifier_free,
-			          NULL,
+/* The UTF-16 string value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_string_utf16 = {
+	LIBFVALUE_VALUE_TYPE_STRING_UTF16,
+	"utf16-string",
+	"UTF-16 string",
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfguid_identifier_copy_from_byte_stream,
-			          (int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfguid_identifier_copy_to_byte_stream,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_string_clone,
 
-			          NULL,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_string_get_byte_stream_size,
 
-			          NULL,
-			          NULL,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf8_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf8_string_with_index,
+	NULL,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf16_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf16_string_with_index,
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf8_string_with_index,
 
-			          (int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf32_string_with_index,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf32_string_with_index,
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf16_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf16_string_with_index,
+
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf32_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf32_string_with_index,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, uint8_t, libcerror_error_t **)) &libfvalue_string_set_byte_stream,
+	(int (*)(intptr_t *, const uint8_t **, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string
+};
+
+/* The UTF-32 string value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_string_utf32 = {
+	LIBFVALUE_VALUE_TYPE_STRING_UTF32,
+	"utf32-string",
+	"UTF-32 string",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_string_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvalue_string_clone,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_string_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_string_get_byte_stream_size,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf8_string_with_index,
+
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf16_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf16_string_with_index,
+
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf32_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_copy_to_utf32_string_with_index,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, uint8_t, libcerror_error_t **)) &libfvalue_string_set_byte_stream,
+	(int (*)(intptr_t *, const uint8_t **, size_t *, uint32_t, libcerror_error_t **)) &libfvalue_string_get_utf8_string
+};
+
+#if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
+
+/* The FAT date time value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_fat_date_time = {
+	LIBFVALUE_VALUE_TYPE_FAT_DATE_TIME,
+	"fat-date-time",
+	"FAT date time",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_fat_date_time_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_fat_date_time_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_from_byte_stream,
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_fat_date_time_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+/* The filetime value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_filetime = {
+	LIBFVALUE_VALUE_TYPE_FILETIME,
+	"filetime",
+	"Filetime",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_filetime_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_filetime_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_filetime_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_filetime_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_filetime_get_byte_stream_size,
+
+	(int (*)(intptr_t *, uint64_t, size_t, libcerror_error_t **)) &libfvalue_filetime_copy_from_integer,
+	(int (*)(intptr_t *, uint64_t *, size_t *, libcerror_error_t **)) &libfvalue_filetime_copy_to_integer,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_filetime_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+/* The floatingtime value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_floatingtime = {
+	LIBFVALUE_VALUE_TYPE_FLOATINGTIME,
+	"floatingtime",
+	"FLoatingtime",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_floatingtime_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_floatingtime_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_floatingtime_copy_from_byte_stream,
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_floatingtime_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+/* The NSF timedate value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_nsf_timedate = {
+	LIBFVALUE_VALUE_TYPE_NSF_TIMEDATE,
+	"nsf-timedate",
+	"NSF timedate",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_nsf_timedate_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_nsf_timedate_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_from_byte_stream,
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_nsf_timedate_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+/* The POSIX time value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_posix_time = {
+	LIBFVALUE_VALUE_TYPE_POSIX_TIME,
+	"posix-time",
+	"POSIX time",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_posix_time_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_posix_time_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_value_type_posix_time_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfvalue_value_type_posix_time_copy_to_byte_stream,
+	(int (*)(intptr_t *, size_t *, int, libcerror_error_t **)) &libfvalue_value_type_posix_time_get_byte_stream_size,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_posix_time_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+/* The systemtime value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_systemtime = {
+	LIBFVALUE_VALUE_TYPE_SYSTEMTIME,
+	"systemtime",
+	"Systemtime",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_systemtime_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfdatetime_systemtime_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfdatetime_systemtime_copy_from_byte_stream,
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfdatetime_systemtime_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+#endif /* defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME ) */
+
+#if defined( HAVE_LIBFGUID ) || defined( HAVE_LOCAL_LIBFGUID )
+
+/* The GUID value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_guid = {
+	LIBFVALUE_VALUE_TYPE_GUID,
+	"guid",
+	"Globally Unique Identifier (GUID)",
+
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfguid_identifier_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfguid_identifier_free,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfguid_identifier_copy_from_byte_stream,
+	(int (*)(intptr_t *, uint8_t *, size_t, int, libcerror_error_t **)) &libfguid_identifier_copy_to_byte_stream,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	(int (*)(intptr_t *, const uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf8_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf8_string_with_index,
+
+	(int (*)(intptr_t *, const uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf16_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf16_string_with_index,
+
+	(int (*)(intptr_t *, const uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_from_utf32_string_with_index,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfguid_identifier_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
 
-			          flags,
-			          error );
-			break;
 #endif /* defined( HAVE_LIBFGUID ) || defined( HAVE_LOCAL_LIBFGUID ) */
 
 #if defined( HAVE_LIBFWNT ) || defined( HAVE_LOCAL_LIBFWNT )
-		case LIBFVALUE_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
-			result = libfvalue_value_initialize(
-			          value,
-			          libfvalue_value_type_strings[ type ],
-			          libfvalue_value_type_descriptions[ type ],
 
-			          data_handle,
+/* The NT Security Identifier (SID) value type descriptor
+ */
+static const libfvalue_internal_value_type_descriptor_t libfvalue_value_type_descriptor_nt_security_identifier = {
+	LIBFVALUE_VALUE_TYPE_NT_SECURITY_IDENTIFIER,
+	"nt-sid",
+	"NT Security Identifier (SID)",
 
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_security_identifier_initialize,
-			          (int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_security_identifier_free,
-			          NULL,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_security_identifier_initialize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_security_identifier_free,
+	NULL,
 
-			          (int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfwnt_security_identifier_copy_from_byte_stream,
-			          NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, int, libcerror_error_t **)) &libfwnt_security_identifier_copy_from_byte_stream,
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	NULL,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
+	(int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf8_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
+	(int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf16_string_with_index,
+
+	NULL,
+	(int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
+	(int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf32_string_with_index,
+
+	NULL,
+	NULL
+};
+
+#endif /* defined( HAVE_LIBFWNT ) || defined( HAVE_LOCAL_LIBFWNT ) */
+
+/* The value type descriptors, indexed by the value type
+ * NULL if the value type is not supported
+ */
+static const libfvalue_internal_value_type_descriptor_t *libfvalue_value_type_descriptors[ 28 ] = {
+	NULL,
+	&libfvalue_value_type_descriptor_null,
+	&libfvalue_value_type_descriptor_binary_data,
+	&libfvalue_value_type_descriptor_boolean,
+	NULL,
+	&libfvalue_value_type_descriptor_integer_8bit,
+	&libfvalue_value_type_descriptor_unsigned_integer_8bit,
+	&libfvalue_value_type_descriptor_integer_16bit,
+	&libfvalue_value_type_descriptor_unsigned_integer_16bit,
+	&libfvalue_value_type_descriptor_integer_32bit,
+	&libfvalue_value_type_descriptor_unsigned_integer_32bit,
+	&libfvalue_value_type_descriptor_integer_64bit,
+	&libfvalue_value_type_descriptor_unsigned_integer_64bit,
+	&libfvalue_value_type_descriptor_floating_point_32bit,
+	&libfvalue_value_type_descriptor_floating_point_64bit,
+	&libfvalue_value_type_descriptor_string_byte_stream,
+	&libfvalue_value_type_descriptor_string_utf8,
+	&libfvalue_value_type_descriptor_string_utf16,
+	&libfvalue_value_type_descriptor_string_utf32,
+#if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
+	&libfvalue_value_type_descriptor_fat_date_time,
+	&libfvalue_value_type_descriptor_filetime,
+	&libfvalue_value_type_descriptor_floatingtime,
+	&libfvalue_value_type_descriptor_nsf_timedate,
+	NULL,
+	&libfvalue_value_type_descriptor_posix_time,
+	&libfvalue_value_type_descriptor_systemtime,
+#else
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+#endif
+#if defined( HAVE_LIBFGUID ) || defined( HAVE_LOCAL_LIBFGUID )
+	&libfvalue_value_type_descriptor_guid,
+#else
+	NULL,
+#endif
+#if defined( HAVE_LIBFWNT ) || defined( HAVE_LOCAL_LIBFWNT )
+	&libfvalue_value_type_descriptor_nt_security_identifier,
+#else
+	NULL,
+#endif
+};
 
-			          NULL,
-			          NULL,
+/* Creates a value of a specific type
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_initialize(
+     libfvalue_value_t **value,
+     int type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_initialize";
+
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     value,
+	     type,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value with data handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initialize a value of a specific type with a custom data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_initialize_with_data_handle(
+     libfvalue_value_t **value,
+     int type,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_initialize_with_data_handle";
+
+	if( libfvalue_internal_value_type_initialize(
+	     value,
+	     NULL,
+	     type,
+	     data_handle,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a value of a specific type in an arena
+ * The memory of the value is released when the arena is reset or freed
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_initialize_in_arena(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     int type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_initialize_in_arena";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_internal_value_type_initialize(
+	     value,
+	     arena,
+	     type,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initialize a value of a specific type in an arena with a custom data handle
+ * The value is allocated on the heap if arena is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_value_type_initialize(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     int type,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	const libfvalue_internal_value_type_descriptor_t *type_descriptor = NULL;
+	static char *function                                             = "libfvalue_internal_value_type_initialize";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type >= 0 )
+	 && ( type < 28 ) )
+	{
+		type_descriptor = libfvalue_value_type_descriptors[ type ];
+	}
+	if( type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	if( libfvalue_internal_value_initialize(
+	     value,
+	     arena,
+	     type_descriptor,
+	     data_handle,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value type of a type string
+ * The type string is not required to be terminated by an end-of-string character
+ * Returns 1 if successful, 0 if the type string is not supported or -1 on error
+ */
+int libfvalue_value_type_get_type_by_type_string(
+     const uint8_t *type_string,
+     size_t type_string_length,
+     int *type,
+     libcerror_error_t **error )
+{
+	const libfvalue_internal_value_type_descriptor_t *type_descriptor = NULL;
+	static char *function                                             = "libfvalue_value_type_get_type_by_type_string";
+	int descriptor_index                                              = 0;
+
+	if( type_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type string.",
+		 function );
 
-			          NULL,
-			          NULL,
+		return( -1 );
+	}
+	if( type_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid type string length value exceeds maximum.",
+		 function );
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint8_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf8_string_with_index,
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint16_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf16_string_with_index,
+		return( -1 );
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < 28;
+	     descriptor_index++ )
+	{
+		type_descriptor = libfvalue_value_type_descriptors[ descriptor_index ];
 
-			          NULL,
-			          (int (*)(intptr_t *, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_get_string_size,
-			          (int (*)(intptr_t *, uint32_t *, size_t, size_t *, uint32_t, libcerror_error_t **)) &libfwnt_security_identifier_copy_to_utf32_string_with_index,
+		if( ( type_descriptor == NULL )
+		 || ( type_descriptor->type_string == NULL ) )
+		{
+			continue;
+		}
+		if( ( narrow_string_length(
+		       type_descriptor->type_string ) == type_string_length )
+		 && ( memory_compare(
+		       type_descriptor->type_string,
+		       type_string,
+		       type_string_length ) == 0 ) )
+		{
+			*type = type_descriptor->type;
 
-			          flags,
-			          error );
-			break;
-#endif /* defined( HAVE_LIBFWNT ) || defined( HAVE_LOCAL_LIBFWNT ) */
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
 
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported type: 0x%02" PRIx8 ".",
-			 function,
-			 type );
+/* Retrieves the data size and format flags of a value of a specific type
+ * that is copied from a string, such as a value read from XML
+ * Note that boolean values are not supported since the integer string
+ * functions cannot copy a boolean from a string
+ * Returns 1 if successful, 0 if the value type cannot be copied from a string into a fixed size or -1 on error
+ */
+int libfvalue_value_type_get_string_copy_defaults(
+     int type,
+     size_t *data_size,
+     uint32_t *format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_get_string_copy_defaults";
 
-			break;
-	}
-	if( result != 1 )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *value == NULL )
+	if( format_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format flags.",
 		 function );
 
 		return( -1 );
 	}
-	( (libfvalue_internal_value_t *) *value )->type = type;
+	switch( type )
+	{
+		case LIBFVALUE_VALUE_TYPE_INTEGER_8BIT:
+			*data_size    = 1;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+			*data_size    = 1;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_INTEGER_16BIT:
+			*data_size    = 2;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+			*data_size    = 2;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_INTEGER_32BIT:
+			*data_size    = 4;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+			*data_size    = 4;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_INTEGER_64BIT:
+			*data_size    = 8;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+			*data_size    = 8;
+			*format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT:
+			*data_size    = 4;
+			*format_flags = LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT:
+			*data_size    = 8;
+			*format_flags = LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL;
+			break;
 
+		default:
+			return( 0 );
+	}
 	return( 1 );
 }
 
@@ -751,10 +1403,10 @@ ssize_t libfvalue_value_type_get_string_size(
 	}
 	internal_value = (libfvalue_internal_value_t *) value;
 
-	if( ( internal_value->type != LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
-	 && ( internal_value->type != LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
-	 && ( internal_value->type != LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
-	 && ( internal_value->type != LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+	if( ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -762,7 +1414,7 @@ ssize_t libfvalue_value_type_get_string_size(
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
 		 "%s: unsupported type: 0x%02" PRIx8 ".",
 		 function,
-		 internal_value->type );
+		 internal_value->type_descriptor->type );
 
 		return( -1 );
 	}
@@ -779,8 +1431,8 @@ ssize_t libfvalue_value_type_get_string_size(
 	}
 	if( data != NULL )
 	{
-		if( ( internal_value->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
-		 || ( internal_value->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 ) )
+		if( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+		 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 ) )
 		{
 			while( data_index < data_size )
 			{
@@ -793,7 +1445,7 @@ ssize_t libfvalue_value_type_get_string_size(
 				data_index += 1;
 			}
 		}
-		else if( internal_value->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+		else if( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
 		{
 			if( data_size < 2 )
 			{
@@ -818,7 +1470,7 @@ ssize_t libfvalue_value_type_get_string_size(
 				data_index += 2;
 			}
 		}
-		else if( internal_value->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 )
+		else if( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 )
 		{
 			if( data_size < 4 )
 			{
@@ -1001,10 +1653,14 @@ ssize_t libfvalue_value_type_set_data_strings_array(
          int encoding,
          libcerror_error_t **error )
 {
-	static char *function   = "libfvalue_value_type_set_data_strings_array";
-	ssize_t data_index      = 0;
-	ssize_t last_data_index = 0;
-	int value_entry_index   = 0;
+	libfvalue_internal_value_t *internal_value = NULL;
+	uint8_t *value_data                        = NULL;
+	static char *function                      = "libfvalue_value_type_set_data_strings_array";
+	size_t value_data_size                     = 0;
+	ssize_t data_index                         = 0;
+	ssize_t last_data_index                    = 0;
+	int value_encoding                         = 0;
+	int value_entry_index                      = 0;
 
 	if( value == NULL )
 	{
@@ -1017,6 +1673,60 @@ ssize_t libfvalue_value_type_set_data_strings_array(
 
 		return( -1 );
 	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The strings are stored consecutively in the data handle
+	 * so reserve the data upfront to prevent a reallocation per string
+	 */
+	if( internal_value->data_handle != NULL )
+	{
+		if( libfvalue_data_handle_get_data(
+		     internal_value->data_handle,
+		     &value_data,
+		     &value_data_size,
+		     &value_encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data from data handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( data_size <= ( (size_t) SSIZE_MAX - value_data_size ) )
+		 && ( ( value_data_size + data_size ) <= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			if( libfvalue_data_handle_reserve(
+			     internal_value->data_handle,
+			     value_data_size + data_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reserve data in data handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
 	while( (size_t) last_data_index < data_size )
 	{
 		data_index = libfvalue_value_type_get_string_size(
@@ -1083,24 +1793,44 @@ ssize_t libfvalue_value_type_set_data_strings_array(
 
 #if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
 
-/* Helper function for libfvalue value type to covert a byte stream into a POSIX time using libfdatetime
+/* Helper function for libfvalue value type to determine the libfdatetime byte order and POSIX time value type from the encoding
  * Returns 1 if successful or -1 on error
  */
-int libfvalue_value_type_posix_time_copy_from_byte_stream(
-     libfdatetime_posix_time_t *posix_time,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
+int libfvalue_value_type_posix_time_get_value_type(
      int encoding,
+     int *byte_order,
+     uint8_t *value_type,
      libcerror_error_t **error )
 {
-	static char *function = "libfvalue_value_type_posix_time_copy_from_byte_stream";
-	int byte_order        = 0;
-	uint8_t value_type    = 0;
+	static char *function = "libfvalue_value_type_posix_time_get_value_type";
+	int safe_byte_order   = 0;
+
+	if( byte_order == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
 
-	byte_order = encoding & 0xff;
+		return( -1 );
+	}
+	safe_byte_order = encoding & 0xff;
 
-	if( ( byte_order != LIBFVALUE_ENDIAN_BIG )
-	 && ( byte_order != LIBFVALUE_ENDIAN_LITTLE ) )
+	if( ( safe_byte_order != LIBFVALUE_ENDIAN_BIG )
+	 && ( safe_byte_order != LIBFVALUE_ENDIAN_LITTLE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1108,7 +1838,7 @@ int libfvalue_value_type_posix_time_copy_from_byte_stream(
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
 		 "%s: unsupported byte order: 0x%02x in encoding: 0x%08x.",
 		 function,
-		 byte_order,
+		 safe_byte_order,
 		 encoding );
 
 		return( -1 );
@@ -1116,35 +1846,35 @@ int libfvalue_value_type_posix_time_copy_from_byte_stream(
 	switch( encoding & 0xffffff00UL )
 	{
 		case LIBFVALUE_POSIX_TIME_ENCODING_SECONDS_32BIT_SIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_SECONDS_32BIT_UNSIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_SECONDS_64BIT_SIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_SIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_SECONDS_64BIT_UNSIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_64BIT_UNSIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_MICRO_SECONDS_64BIT_SIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_SIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_MICRO_SECONDS_64BIT_UNSIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_MICRO_SECONDS_64BIT_UNSIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_NANO_SECONDS_64BIT_SIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_SIGNED;
 			break;
 
 		case LIBFVALUE_POSIX_TIME_ENCODING_NANO_SECONDS_64BIT_UNSIGNED:
-			value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED;
+			*value_type = LIBFDATETIME_POSIX_TIME_VALUE_TYPE_NANO_SECONDS_64BIT_UNSIGNED;
 			break;
 
 		default:
@@ -1159,6 +1889,40 @@ int libfvalue_value_type_posix_time_copy_from_byte_stream(
 
 			return( -1 );
 	}
+	*byte_order = safe_byte_order;
+
+	return( 1 );
+}
+
+/* Helper function for libfvalue value type to covert a byte stream into a POSIX time using libfdatetime
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_posix_time_copy_from_byte_stream(
+     libfdatetime_posix_time_t *posix_time,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_posix_time_copy_from_byte_stream";
+	int byte_order        = 0;
+	uint8_t value_type    = 0;
+
+	if( libfvalue_value_type_posix_time_get_value_type(
+	     encoding,
+	     &byte_order,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdatetime_posix_time_copy_from_byte_stream(
 	     posix_time,
 	     byte_stream,
@@ -1179,5 +1943,116 @@ int libfvalue_value_type_posix_time_copy_from_byte_stream(
 	return( 1 );
 }
 
+/* Helper function for libfvalue value type to covert a POSIX time into a byte stream using libfdatetime
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_posix_time_copy_to_byte_stream(
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_posix_time_copy_to_byte_stream";
+	int byte_order        = 0;
+	uint8_t value_type    = 0;
+
+	if( libfvalue_value_type_posix_time_get_value_type(
+	     encoding,
+	     &byte_order,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_posix_time_copy_to_byte_stream(
+	     posix_time,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy POSIX time to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a byte stream of the POSIX time
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_posix_time_get_byte_stream_size(
+     libfdatetime_posix_time_t *posix_time,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_value_type_posix_time_get_byte_stream_size";
+	int byte_order        = 0;
+	uint8_t value_type    = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_type_posix_time_get_value_type(
+	     encoding,
+	     &byte_order,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED )
+	 || ( value_type == LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_UNSIGNED ) )
+	{
+		*byte_stream_size = 4;
+	}
+	else
+	{
+		*byte_stream_size = 8;
+	}
+	return( 1 );
+}
+
 #endif /* defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME ) */
 
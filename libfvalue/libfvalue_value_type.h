@@ -50,6 +50,33 @@ int libfvalue_value_type_initialize_with_data_handle(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFVALUE_EXTERN \
+int libfvalue_value_type_initialize_in_arena(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     int type,
+     libcerror_error_t **error );
+
+int libfvalue_internal_value_type_initialize(
+     libfvalue_value_t **value,
+     libfvalue_arena_t *arena,
+     int type,
+     libfvalue_data_handle_t *data_handle,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfvalue_value_type_get_type_by_type_string(
+     const uint8_t *type_string,
+     size_t type_string_length,
+     int *type,
+     libcerror_error_t **error );
+
+int libfvalue_value_type_get_string_copy_defaults(
+     int type,
+     size_t *data_size,
+     uint32_t *format_flags,
+     libcerror_error_t **error );
+
 ssize_t libfvalue_value_type_get_string_size(
          libfvalue_value_t *value,
          const uint8_t *data,
@@ -83,6 +110,12 @@ ssize_t libfvalue_value_type_set_data_strings_array(
 
 #if defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME )
 
+int libfvalue_value_type_posix_time_get_value_type(
+     int encoding,
+     int *byte_order,
+     uint8_t *value_type,
+     libcerror_error_t **error );
+
 int libfvalue_value_type_posix_time_copy_from_byte_stream(
      libfdatetime_posix_time_t *posix_time,
      const uint8_t *byte_stream,
@@ -90,6 +123,19 @@ int libfvalue_value_type_posix_time_copy_from_byte_stream(
      int encoding,
      libcerror_error_t **error );
 
+int libfvalue_value_type_posix_time_copy_to_byte_stream(
+     libfdatetime_posix_time_t *posix_time,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libfvalue_value_type_posix_time_get_byte_stream_size(
+     libfdatetime_posix_time_t *posix_time,
+     size_t *byte_stream_size,
+     int encoding,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_LIBFDATETIME ) || defined( HAVE_LOCAL_LIBFDATETIME ) */
 
 #if defined( __cplusplus )
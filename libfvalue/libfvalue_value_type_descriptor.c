@@ -0,0 +1,364 @@
+/*
+ * Value type descriptor functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_statistics.h"
+#include "libfvalue_types.h"
+#include "libfvalue_value_type_descriptor.h"
+
+/* Creates a value type descriptor
+ * A type descriptor can be used to create values of a custom type
+ * and must remain available during the life-time of these values
+ * Make sure the value type_descriptor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_descriptor_initialize(
+     libfvalue_value_type_descriptor_t **type_descriptor,
+     const char *type_string,
+     const char *type_description,
+     int (*initialize_instance)(
+           intptr_t **instance,
+           libcerror_error_t **error ),
+     int (*free_instance)(
+           intptr_t **instance,
+           libcerror_error_t **error ),
+     int (*clone_instance)(
+           intptr_t **destination_instance,
+           intptr_t *source_instance,
+           libcerror_error_t **error ),
+     int (*copy_from_byte_stream)(
+           intptr_t *instance,
+           const uint8_t *byte_stream,
+           size_t byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*copy_to_byte_stream)(
+           intptr_t *instance,
+           uint8_t *byte_stream,
+           size_t byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*get_byte_stream_size)(
+           intptr_t *instance,
+           size_t *byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*copy_from_integer)(
+           intptr_t *instance,
+           uint64_t integer_value,
+           size_t integer_value_size,
+           libcerror_error_t **error ),
+     int (*copy_to_integer)(
+           intptr_t *instance,
+           uint64_t *integer_value,
+           size_t *integer_value_size,
+           libcerror_error_t **error ),
+     int (*copy_from_floating_point)(
+           intptr_t *instance,
+           double floating_point_value,
+           size_t floating_point_value_size,
+           libcerror_error_t **error ),
+     int (*copy_to_floating_point)(
+           intptr_t *instance,
+           double *floating_point_value,
+           size_t *floating_point_value_size,
+           libcerror_error_t **error ),
+     int (*copy_from_utf8_string_with_index)(
+           intptr_t *instance,
+           const uint8_t *utf8_string,
+           size_t utf8_string_length,
+           size_t *utf8_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf8_string_size)(
+           intptr_t *instance,
+           size_t *utf8_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf8_string_with_index)(
+           intptr_t *instance,
+           uint8_t *utf8_string,
+           size_t utf8_string_size,
+           size_t *utf8_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_from_utf16_string_with_index)(
+           intptr_t *instance,
+           const uint16_t *utf16_string,
+           size_t utf16_string_length,
+           size_t *utf16_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf16_string_size)(
+           intptr_t *instance,
+           size_t *utf16_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf16_string_with_index)(
+           intptr_t *instance,
+           uint16_t *utf16_string,
+           size_t utf16_string_size,
+           size_t *utf16_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_from_utf32_string_with_index)(
+           intptr_t *instance,
+           const uint32_t *utf32_string,
+           size_t utf32_string_length,
+           size_t *utf32_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf32_string_size)(
+           intptr_t *instance,
+           size_t *utf32_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf32_string_with_index)(
+           intptr_t *instance,
+           uint32_t *utf32_string,
+           size_t utf32_string_size,
+           size_t *utf32_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_type_descriptor_t *internal_type_descriptor = NULL;
+	static char *function                                                = "libfvalue_value_type_descriptor_initialize";
+
+	if( type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *type_descriptor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid type descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( type_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type string",
+		 function );
+
+		return( -1 );
+	}
+	internal_type_descriptor = memory_allocate_structure(
+	                            libfvalue_internal_value_type_descriptor_t );
+
+	if( internal_type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	 sizeof( libfvalue_internal_value_type_descriptor_t ) );
+
+	if( memory_set(
+	     internal_type_descriptor,
+	     0,
+	     sizeof( libfvalue_internal_value_type_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear type descriptor.",
+		 function );
+
+		memory_free(
+		 internal_type_descriptor );
+
+		return( -1 );
+	}
+	internal_type_descriptor->type                              = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+	internal_type_descriptor->type_string                       = type_string;
+	internal_type_descriptor->type_description                  = type_description;
+
+	internal_type_descriptor->initialize_instance               = initialize_instance;
+	internal_type_descriptor->free_instance                     = free_instance;
+	internal_type_descriptor->clone_instance                    = clone_instance;
+
+	internal_type_descriptor->copy_from_byte_stream             = copy_from_byte_stream;
+	internal_type_descriptor->copy_to_byte_stream               = copy_to_byte_stream;
+	internal_type_descriptor->get_byte_stream_size              = get_byte_stream_size;
+
+	internal_type_descriptor->copy_from_integer                 = copy_from_integer;
+	internal_type_descriptor->copy_to_integer                   = copy_to_integer;
+
+	internal_type_descriptor->copy_from_floating_point          = copy_from_floating_point;
+	internal_type_descriptor->copy_to_floating_point            = copy_to_floating_point;
+
+	internal_type_descriptor->copy_from_utf8_string_with_index  = copy_from_utf8_string_with_index;
+	internal_type_descriptor->get_utf8_string_size              = get_utf8_string_size;
+	internal_type_descriptor->copy_to_utf8_string_with_index    = copy_to_utf8_string_with_index;
+
+	internal_type_descriptor->copy_from_utf16_string_with_index = copy_from_utf16_string_with_index;
+	internal_type_descriptor->get_utf16_string_size             = get_utf16_string_size;
+	internal_type_descriptor->copy_to_utf16_string_with_index   = copy_to_utf16_string_with_index;
+
+	internal_type_descriptor->copy_from_utf32_string_with_index = copy_from_utf32_string_with_index;
+	internal_type_descriptor->get_utf32_string_size             = get_utf32_string_size;
+	internal_type_descriptor->copy_to_utf32_string_with_index   = copy_to_utf32_string_with_index;
+
+	*type_descriptor = (libfvalue_value_type_descriptor_t *) internal_type_descriptor;
+
+	return( 1 );
+}
+
+/* Frees a value type descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_descriptor_free(
+     libfvalue_value_type_descriptor_t **type_descriptor,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_type_descriptor_t *internal_type_descriptor = NULL;
+	static char *function                                                = "libfvalue_value_type_descriptor_free";
+
+	if( type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *type_descriptor != NULL )
+	{
+		internal_type_descriptor = (libfvalue_internal_value_type_descriptor_t *) *type_descriptor;
+		*type_descriptor         = NULL;
+
+		memory_free(
+		 internal_type_descriptor );
+	}
+	return( 1 );
+}
+
+/* Clones a value type descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_value_type_descriptor_clone(
+     libfvalue_value_type_descriptor_t **destination_type_descriptor,
+     libfvalue_value_type_descriptor_t *source_type_descriptor,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_type_descriptor_t *internal_destination_type_descriptor = NULL;
+	static char *function                                                            = "libfvalue_value_type_descriptor_clone";
+
+	if( destination_type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_type_descriptor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination type descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_type_descriptor == NULL )
+	{
+		*destination_type_descriptor = NULL;
+
+		return( 1 );
+	}
+	internal_destination_type_descriptor = memory_allocate_structure(
+	                                        libfvalue_internal_value_type_descriptor_t );
+
+	if( internal_destination_type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	libfvalue_statistics_count_allocation(
+	 LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	 sizeof( libfvalue_internal_value_type_descriptor_t ) );
+
+	if( memory_copy(
+	     internal_destination_type_descriptor,
+	     source_type_descriptor,
+	     sizeof( libfvalue_internal_value_type_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy type descriptor.",
+		 function );
+
+		memory_free(
+		 internal_destination_type_descriptor );
+
+		return( -1 );
+	}
+	*destination_type_descriptor = (libfvalue_value_type_descriptor_t *) internal_destination_type_descriptor;
+
+	return( 1 );
+}
+
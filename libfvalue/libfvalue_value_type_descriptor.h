@@ -0,0 +1,366 @@
+/*
+ * Value type descriptor functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_VALUE_TYPE_DESCRIPTOR_H )
+#define _LIBFVALUE_VALUE_TYPE_DESCRIPTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_extern.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvalue_internal_value_type_descriptor libfvalue_internal_value_type_descriptor_t;
+
+/* The value type descriptor contains the type specific functions
+ * of a value. A descriptor is shared by all values of the same type.
+ */
+struct libfvalue_internal_value_type_descriptor
+{
+	/* The type
+	 */
+	int type;
+
+	/* The type string
+	 */
+	const char *type_string;
+
+	/* The type description
+	 */
+	const char *type_description;
+
+	/* The initialize instance function
+	 */
+	int (*initialize_instance)(
+	      intptr_t **instance,
+	      libcerror_error_t **error );
+
+	/* The free instance function
+	 */
+	int (*free_instance)(
+	      intptr_t **instance,
+	      libcerror_error_t **error );
+
+	/* The clone (duplicate) instance function
+	 */
+	int (*clone_instance)(
+	      intptr_t **destination_instance,
+	      intptr_t *source_instance,
+	      libcerror_error_t **error );
+
+	/* The instance copy from byte stream
+	 */
+	int (*copy_from_byte_stream)(
+	      intptr_t *instance,
+	      const uint8_t *byte_stream,
+	      size_t byte_stream_size,
+	      int encoding,
+	      libcerror_error_t **error );
+
+	/* The instance copy to byte stream
+	 */
+	int (*copy_to_byte_stream)(
+	      intptr_t *instance,
+	      uint8_t *byte_stream,
+	      size_t byte_stream_size,
+	      int encoding,
+	      libcerror_error_t **error );
+
+	/* The instance get byte stream size function
+	 */
+	int (*get_byte_stream_size)(
+	      intptr_t *instance,
+	      size_t *byte_stream_size,
+	      int encoding,
+	      libcerror_error_t **error );
+
+	/* The instance copy from integer function
+	 */
+	int (*copy_from_integer)(
+	      intptr_t *instance,
+	      uint64_t integer_value,
+	      size_t integer_value_size,
+	      libcerror_error_t **error );
+
+	/* The instance copy to integer function
+	 */
+	int (*copy_to_integer)(
+	      intptr_t *instance,
+	      uint64_t *integer_value,
+	      size_t *integer_value_size,
+	      libcerror_error_t **error );
+
+	/* The instance copy from floating point function
+	 */
+	int (*copy_from_floating_point)(
+	      intptr_t *instance,
+	      double floating_point_value,
+	      size_t floating_point_value_size,
+	      libcerror_error_t **error );
+
+	/* The instance copy to floating point function
+	 */
+	int (*copy_to_floating_point)(
+	      intptr_t *instance,
+	      double *floating_point_value,
+	      size_t *floating_point_value_size,
+	      libcerror_error_t **error );
+
+	/* The instance copy from UTF-8 string with index function
+	 */
+	int (*copy_from_utf8_string_with_index)(
+	      intptr_t *instance,
+	      const uint8_t *utf8_string,
+	      size_t utf8_string_length,
+	      size_t *utf8_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance get UTF-8 string size function
+	 */
+	int (*get_utf8_string_size)(
+	      intptr_t *instance,
+	      size_t *utf8_string_size,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance copy to UTF-8 string with index function
+	 */
+	int (*copy_to_utf8_string_with_index)(
+	      intptr_t *instance,
+	      uint8_t *utf8_string,
+	      size_t utf8_string_size,
+	      size_t *utf8_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance copy from UTF-16 string with index function
+	 */
+	int (*copy_from_utf16_string_with_index)(
+	      intptr_t *instance,
+	      const uint16_t *utf16_string,
+	      size_t utf16_string_length,
+	      size_t *utf16_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance get UTF-16 string size function
+	 */
+	int (*get_utf16_string_size)(
+	      intptr_t *instance,
+	      size_t *utf16_string_size,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance copy to UTF-16 string with index function
+	 */
+	int (*copy_to_utf16_string_with_index)(
+	      intptr_t *instance,
+	      uint16_t *utf16_string,
+	      size_t utf16_string_size,
+	      size_t *utf16_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance copy from UTF-32 string with index function
+	 */
+	int (*copy_from_utf32_string_with_index)(
+	      intptr_t *instance,
+	      const uint32_t *utf32_string,
+	      size_t utf32_string_length,
+	      size_t *utf32_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance get UTF-32 string size function
+	 */
+	int (*get_utf32_string_size)(
+	      intptr_t *instance,
+	      size_t *utf32_string_size,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance copy to UTF-32 string with index function
+	 */
+	int (*copy_to_utf32_string_with_index)(
+	      intptr_t *instance,
+	      uint32_t *utf32_string,
+	      size_t utf32_string_size,
+	      size_t *utf32_string_index,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+
+	/* The instance set byte stream function
+	 * Used to reference data that is not managed by the data handle
+	 * NULL if the instance always copies the byte stream
+	 */
+	int (*set_byte_stream)(
+	      intptr_t *instance,
+	      const uint8_t *byte_stream,
+	      size_t byte_stream_size,
+	      int encoding,
+	      uint8_t flags,
+	      libcerror_error_t **error );
+
+	/* The instance get UTF-8 string function
+	 * Used to retrieve an UTF-8 string that is converted once and cached by the instance
+	 * NULL if the instance does not cache an UTF-8 string
+	 */
+	int (*get_utf8_string)(
+	      intptr_t *instance,
+	      const uint8_t **utf8_string,
+	      size_t *utf8_string_size,
+	      uint32_t string_format_flags,
+	      libcerror_error_t **error );
+};
+
+LIBFVALUE_EXTERN \
+int libfvalue_value_type_descriptor_initialize(
+     libfvalue_value_type_descriptor_t **type_descriptor,
+     const char *type_string,
+     const char *type_description,
+     int (*initialize_instance)(
+           intptr_t **instance,
+           libcerror_error_t **error ),
+     int (*free_instance)(
+           intptr_t **instance,
+           libcerror_error_t **error ),
+     int (*clone_instance)(
+           intptr_t **destination_instance,
+           intptr_t *source_instance,
+           libcerror_error_t **error ),
+     int (*copy_from_byte_stream)(
+           intptr_t *instance,
+           const uint8_t *byte_stream,
+           size_t byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*copy_to_byte_stream)(
+           intptr_t *instance,
+           uint8_t *byte_stream,
+           size_t byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*get_byte_stream_size)(
+           intptr_t *instance,
+           size_t *byte_stream_size,
+           int encoding,
+           libcerror_error_t **error ),
+     int (*copy_from_integer)(
+           intptr_t *instance,
+           uint64_t integer_value,
+           size_t integer_value_size,
+           libcerror_error_t **error ),
+     int (*copy_to_integer)(
+           intptr_t *instance,
+           uint64_t *integer_value,
+           size_t *integer_value_size,
+           libcerror_error_t **error ),
+     int (*copy_from_floating_point)(
+           intptr_t *instance,
+           double floating_point_value,
+           size_t floating_point_value_size,
+           libcerror_error_t **error ),
+     int (*copy_to_floating_point)(
+           intptr_t *instance,
+           double *floating_point_value,
+           size_t *floating_point_value_size,
+           libcerror_error_t **error ),
+     int (*copy_from_utf8_string_with_index)(
+           intptr_t *instance,
+           const uint8_t *utf8_string,
+           size_t utf8_string_length,
+           size_t *utf8_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf8_string_size)(
+           intptr_t *instance,
+           size_t *utf8_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf8_string_with_index)(
+           intptr_t *instance,
+           uint8_t *utf8_string,
+           size_t utf8_string_size,
+           size_t *utf8_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_from_utf16_string_with_index)(
+           intptr_t *instance,
+           const uint16_t *utf16_string,
+           size_t utf16_string_length,
+           size_t *utf16_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf16_string_size)(
+           intptr_t *instance,
+           size_t *utf16_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf16_string_with_index)(
+           intptr_t *instance,
+           uint16_t *utf16_string,
+           size_t utf16_string_size,
+           size_t *utf16_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_from_utf32_string_with_index)(
+           intptr_t *instance,
+           const uint32_t *utf32_string,
+           size_t utf32_string_length,
+           size_t *utf32_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*get_utf32_string_size)(
+           intptr_t *instance,
+           size_t *utf32_string_size,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     int (*copy_to_utf32_string_with_index)(
+           intptr_t *instance,
+           uint32_t *utf32_string,
+           size_t utf32_string_size,
+           size_t *utf32_string_index,
+           uint32_t string_format_flags,
+           libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_value_type_descriptor_free(
+     libfvalue_value_type_descriptor_t **type_descriptor,
+     libcerror_error_t **error );
+
+int libfvalue_value_type_descriptor_clone(
+     libfvalue_value_type_descriptor_t **destination_type_descriptor,
+     libfvalue_value_type_descriptor_t *source_type_descriptor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_VALUE_TYPE_DESCRIPTOR_H ) */
+
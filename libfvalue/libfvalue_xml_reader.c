@@ -0,0 +1,2455 @@
+/*
+ * XML reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfvalue_data_handle.h"
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_libuna.h"
+#include "libfvalue_table.h"
+#include "libfvalue_types.h"
+#include "libfvalue_value.h"
+#include "libfvalue_value_type.h"
+#include "libfvalue_xml_reader.h"
+
+/* The XML reader reads its input in chunks of the buffer size using the read function
+ * and parses the XML as the chunks become available. Only the character data
+ * of the element that is being read is retained, hence the memory used by
+ * the XML reader does not depend on the size of the input.
+ */
+
+/* Determines if a character is XML white space
+ */
+#define libfvalue_xml_reader_is_white_space( character ) \
+	( ( ( character ) == 0x20 ) || ( ( character ) == 0x09 ) || ( ( character ) == 0x0a ) || ( ( character ) == 0x0d ) )
+
+/* Determines if a character is a supported tag name character: [A-Za-z0-9_]
+ */
+#define libfvalue_xml_reader_is_tag_name_character( character ) \
+	( ( ( ( character ) >= 0x41 ) && ( ( character ) <= 0x5a ) ) \
+	 || ( ( ( character ) >= 0x61 ) && ( ( character ) <= 0x7a ) ) \
+	 || ( ( ( character ) >= 0x30 ) && ( ( character ) <= 0x39 ) ) \
+	 || ( ( character ) == 0x5f ) )
+
+/* Creates a XML reader
+ * Make sure the value xml_reader is referencing, is set to NULL
+ * The read function should return 0 when the end of the input is reached
+ * If buffer size is 0 the default buffer size is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_initialize(
+     libfvalue_xml_reader_t **xml_reader,
+     intptr_t *io_handle,
+     ssize_t (*read_function)(
+              intptr_t *io_handle,
+              uint8_t *data,
+              size_t data_size,
+              libcerror_error_t **error ),
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	static char *function                                = "libfvalue_xml_reader_initialize";
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		buffer_size = LIBFVALUE_XML_READER_DEFAULT_BUFFER_SIZE;
+	}
+	if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader = memory_allocate_structure(
+	                       libfvalue_internal_xml_reader_t );
+
+	if( internal_xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_xml_reader,
+	     0,
+	     sizeof( libfvalue_internal_xml_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML reader.",
+		 function );
+
+		memory_free(
+		 internal_xml_reader );
+
+		return( -1 );
+	}
+	internal_xml_reader->buffer = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * buffer_size );
+
+	if( internal_xml_reader->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_xml_reader->buffer_size   = buffer_size;
+	internal_xml_reader->io_handle     = io_handle;
+	internal_xml_reader->read_function = read_function;
+
+	*xml_reader = (libfvalue_xml_reader_t *) internal_xml_reader;
+
+	return( 1 );
+
+on_error:
+	if( internal_xml_reader != NULL )
+	{
+		memory_free(
+		 internal_xml_reader );
+	}
+	return( -1 );
+}
+
+/* Frees a XML reader
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_free(
+     libfvalue_xml_reader_t **xml_reader,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	static char *function                                = "libfvalue_xml_reader_free";
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_reader != NULL )
+	{
+		internal_xml_reader = (libfvalue_internal_xml_reader_t *) *xml_reader;
+		*xml_reader         = NULL;
+
+		if( internal_xml_reader->element_name != NULL )
+		{
+			memory_free(
+			 internal_xml_reader->element_name );
+		}
+		if( internal_xml_reader->type_string != NULL )
+		{
+			memory_free(
+			 internal_xml_reader->type_string );
+		}
+		if( internal_xml_reader->tag_name != NULL )
+		{
+			memory_free(
+			 internal_xml_reader->tag_name );
+		}
+		if( internal_xml_reader->text != NULL )
+		{
+			memory_free(
+			 internal_xml_reader->text );
+		}
+		memory_free(
+		 internal_xml_reader->buffer );
+
+		memory_free(
+		 internal_xml_reader );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset
+ * The offset contains the number of bytes that were parsed, which
+ * can be less than the number of bytes read using the read function
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_get_offset(
+     libfvalue_xml_reader_t *xml_reader,
+     size_t *offset,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	static char *function                                = "libfvalue_xml_reader_get_offset";
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader = (libfvalue_internal_xml_reader_t *) xml_reader;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_xml_reader->offset;
+
+	return( 1 );
+}
+
+/* Fills the buffer using the read function if all the data in the buffer was parsed
+ * Returns 1 if successful, 0 if the end of the input was reached or -1 on error
+ */
+int libfvalue_internal_xml_reader_fill_buffer(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_xml_reader_fill_buffer";
+	ssize_t read_count    = 0;
+
+	if( internal_xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_reader->buffer_offset < internal_xml_reader->buffer_data_size )
+	{
+		return( 1 );
+	}
+	if( internal_xml_reader->end_of_input != 0 )
+	{
+		return( 0 );
+	}
+	read_count = internal_xml_reader->read_function(
+	              internal_xml_reader->io_handle,
+	              internal_xml_reader->buffer,
+	              internal_xml_reader->buffer_size,
+	              error );
+
+	if( ( read_count < 0 )
+	 || ( (size_t) read_count > internal_xml_reader->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader->buffer_offset    = 0;
+	internal_xml_reader->buffer_data_size = (size_t) read_count;
+
+	if( read_count == 0 )
+	{
+		internal_xml_reader->end_of_input = 1;
+
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next byte
+ * Returns 1 if successful, 0 if the end of the input was reached or -1 on error
+ */
+int libfvalue_internal_xml_reader_get_byte(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     uint8_t *byte_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_xml_reader_get_byte";
+	int result            = 0;
+
+	if( byte_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_internal_xml_reader_fill_buffer(
+	          internal_xml_reader,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to fill buffer.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*byte_value = internal_xml_reader->buffer[ internal_xml_reader->buffer_offset ];
+
+		internal_xml_reader->buffer_offset += 1;
+		internal_xml_reader->offset        += 1;
+	}
+	return( result );
+}
+
+/* Appends data to a string that grows as needed
+ * The string is kept terminated by an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_reader_append_string(
+     uint8_t **string,
+     size_t *string_size,
+     size_t *string_length,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libfvalue_internal_xml_reader_append_string";
+	size_t required_size  = 0;
+	size_t new_size       = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - *string_length - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	required_size = *string_length + data_size + 1;
+
+	if( required_size > *string_size )
+	{
+		new_size = *string_size;
+
+		if( new_size < 64 )
+		{
+			new_size = 64;
+		}
+		while( new_size < required_size )
+		{
+			if( new_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				new_size = required_size;
+
+				break;
+			}
+			new_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                *string,
+		                sizeof( uint8_t ) * new_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			return( -1 );
+		}
+		*string      = (uint8_t *) reallocation;
+		*string_size = new_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( ( *string )[ *string_length ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to string.",
+			 function );
+
+			return( -1 );
+		}
+		*string_length += data_size;
+	}
+	( *string )[ *string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Reads the next tag
+ * If collect text is set the character data preceding the tag is appended to the text
+ * The tag name, tag type and type attribute of the tag are retained in the XML reader
+ * Processing instructions, comments and declarations are returned as a tag of type other
+ * Returns 1 if successful, 0 if the end of the input was reached or -1 on error
+ */
+int libfvalue_internal_xml_reader_read_tag(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     uint8_t collect_text,
+     libcerror_error_t **error )
+{
+	uint8_t attribute_name[ 5 ];
+
+	const uint8_t *text_data    = NULL;
+	static char *function       = "libfvalue_internal_xml_reader_read_tag";
+	size_t attribute_name_index = 0;
+	size_t text_data_size       = 0;
+	uint8_t byte_value          = 0;
+	uint8_t is_type_attribute   = 0;
+	uint8_t previous_byte_value = 0;
+	uint8_t quote_byte_value    = 0;
+	int result                  = 0;
+
+	if( internal_xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that numeric values for the characters are used to prevent
+	 * platform specific values being assigned
+	 */
+	/* Look for the start of the tag: '<' in the data that is available in the buffer
+	 */
+	do
+	{
+		result = libfvalue_internal_xml_reader_fill_buffer(
+		          internal_xml_reader,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill buffer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		text_data      = &( internal_xml_reader->buffer[ internal_xml_reader->buffer_offset ] );
+		text_data_size = 0;
+
+		while( internal_xml_reader->buffer_offset < internal_xml_reader->buffer_data_size )
+		{
+			byte_value = internal_xml_reader->buffer[ internal_xml_reader->buffer_offset ];
+
+			internal_xml_reader->buffer_offset += 1;
+			internal_xml_reader->offset        += 1;
+
+			if( byte_value == 0x3c )
+			{
+				break;
+			}
+			text_data_size++;
+		}
+		if( ( collect_text != 0 )
+		 && ( text_data_size > 0 ) )
+		{
+			if( libfvalue_internal_xml_reader_append_string(
+			     &( internal_xml_reader->text ),
+			     &( internal_xml_reader->text_size ),
+			     &( internal_xml_reader->text_length ),
+			     text_data,
+			     text_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append text.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( byte_value != 0x3c );
+
+	internal_xml_reader->tag_name_length    = 0;
+	internal_xml_reader->type_string_length = 0;
+
+	result = libfvalue_internal_xml_reader_get_byte(
+	          internal_xml_reader,
+	          &byte_value,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	/* Determine if the tag is an open or close tag: '/'
+	 */
+	if( byte_value == 0x2f )
+	{
+		internal_xml_reader->tag_type = LIBFVALUE_XML_TAG_TYPE_CLOSE;
+
+		result = libfvalue_internal_xml_reader_get_byte(
+		          internal_xml_reader,
+		          &byte_value,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* Processing instructions: '?', comments and declarations: '!'
+	 * are skipped upto the end of the tag: '>'
+	 */
+	else if( ( byte_value == 0x3f )
+	      || ( byte_value == 0x21 ) )
+	{
+		internal_xml_reader->tag_type = LIBFVALUE_XML_TAG_TYPE_OTHER;
+
+		/* A comment: "<!--" ends with "-->" instead of '>'
+		 */
+		if( byte_value == 0x21 )
+		{
+			while( attribute_name_index < 2 )
+			{
+				result = libfvalue_internal_xml_reader_get_byte(
+				          internal_xml_reader,
+				          &byte_value,
+				          error );
+
+				if( result != 1 )
+				{
+					goto on_error;
+				}
+				if( byte_value != 0x2d )
+				{
+					break;
+				}
+				attribute_name_index++;
+			}
+		}
+		if( attribute_name_index == 2 )
+		{
+			byte_value = 0;
+
+			while( ( byte_value != 0x3e )
+			    || ( previous_byte_value != 0x2d )
+			    || ( quote_byte_value != 0x2d ) )
+			{
+				quote_byte_value    = previous_byte_value;
+				previous_byte_value = byte_value;
+
+				result = libfvalue_internal_xml_reader_get_byte(
+				          internal_xml_reader,
+				          &byte_value,
+				          error );
+
+				if( result != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+		else
+		{
+			while( byte_value != 0x3e )
+			{
+				result = libfvalue_internal_xml_reader_get_byte(
+				          internal_xml_reader,
+				          &byte_value,
+				          error );
+
+				if( result != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+		return( 1 );
+	}
+	else
+	{
+		internal_xml_reader->tag_type = LIBFVALUE_XML_TAG_TYPE_OPEN;
+	}
+	while( libfvalue_xml_reader_is_tag_name_character( byte_value ) )
+	{
+		if( libfvalue_internal_xml_reader_append_string(
+		     &( internal_xml_reader->tag_name ),
+		     &( internal_xml_reader->tag_name_size ),
+		     &( internal_xml_reader->tag_name_length ),
+		     &byte_value,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append tag name.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfvalue_internal_xml_reader_get_byte(
+		          internal_xml_reader,
+		          &byte_value,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( internal_xml_reader->tag_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character: 0x%02" PRIx8 " in tag name.",
+		 function,
+		 byte_value );
+
+		return( -1 );
+	}
+	/* Read the attributes upto the end of the tag: '>' or empty element tag: "/>"
+	 */
+	while( byte_value != 0x3e )
+	{
+		if( libfvalue_xml_reader_is_white_space( byte_value ) )
+		{
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			continue;
+		}
+		if( byte_value == 0x2f )
+		{
+			if( internal_xml_reader->tag_type != LIBFVALUE_XML_TAG_TYPE_OPEN )
+			{
+				break;
+			}
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			if( byte_value != 0x3e )
+			{
+				break;
+			}
+			internal_xml_reader->tag_type = LIBFVALUE_XML_TAG_TYPE_EMPTY;
+
+			continue;
+		}
+		if( internal_xml_reader->tag_type != LIBFVALUE_XML_TAG_TYPE_OPEN )
+		{
+			break;
+		}
+		/* Read the attribute name upto the equal sign: '='
+		 */
+		attribute_name_index = 0;
+
+		while( ( byte_value != 0x3d )
+		    && ( byte_value != 0x3e )
+		    && ( byte_value != 0x2f )
+		    && ( libfvalue_xml_reader_is_white_space( byte_value ) == 0 ) )
+		{
+			if( attribute_name_index < 5 )
+			{
+				attribute_name[ attribute_name_index ] = byte_value;
+			}
+			attribute_name_index++;
+
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		while( libfvalue_xml_reader_is_white_space( byte_value ) )
+		{
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( ( attribute_name_index == 0 )
+		 || ( byte_value != 0x3d ) )
+		{
+			break;
+		}
+		is_type_attribute = (uint8_t) ( ( attribute_name_index == 4 )
+		                             && ( narrow_string_compare(
+		                                   (char *) attribute_name,
+		                                   "type",
+		                                   4 ) == 0 ) );
+
+		do
+		{
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		while( libfvalue_xml_reader_is_white_space( byte_value ) );
+
+		/* The attribute value is enclosed by quotes: '"' or '\''
+		 */
+		if( ( byte_value != 0x22 )
+		 && ( byte_value != 0x27 ) )
+		{
+			break;
+		}
+		quote_byte_value = byte_value;
+
+		if( is_type_attribute != 0 )
+		{
+			internal_xml_reader->type_string_length = 0;
+		}
+		do
+		{
+			result = libfvalue_internal_xml_reader_get_byte(
+			          internal_xml_reader,
+			          &byte_value,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			if( ( is_type_attribute != 0 )
+			 && ( byte_value != quote_byte_value ) )
+			{
+				if( libfvalue_internal_xml_reader_append_string(
+				     &( internal_xml_reader->type_string ),
+				     &( internal_xml_reader->type_string_size ),
+				     &( internal_xml_reader->type_string_length ),
+				     &byte_value,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append type string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		while( byte_value != quote_byte_value );
+
+		result = libfvalue_internal_xml_reader_get_byte(
+		          internal_xml_reader,
+		          &byte_value,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( byte_value != 0x3e )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character: 0x%02" PRIx8 " in tag: %s.",
+		 function,
+		 byte_value,
+		 (char *) internal_xml_reader->tag_name );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unexpected end of input in tag.",
+		 function );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tag.",
+		 function );
+	}
+	return( -1 );
+}
+
+/* Decodes the character and entity references in an UTF-8 string
+ * The UTF-8 string is decoded in place and must be followed by an end-of-string character
+ * The predefined entities: &amp; &lt; &gt; &quot; &apos; and the character
+ * references: &#N; and &#xN; are supported, other references are left as-is
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_decode_entities(
+     uint8_t *utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *entity                               = NULL;
+	static char *function                         = "libfvalue_xml_reader_decode_entities";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t entity_end_index                       = 0;
+	size_t entity_index                           = 0;
+	size_t entity_length                          = 0;
+	size_t string_index                           = 0;
+	size_t output_index                           = 0;
+	uint8_t byte_value                            = 0;
+	uint8_t is_hexadecimal                        = 0;
+	int result                                    = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that the UTF-8 encoding of a reference is never larger than
+	 * the reference itself, hence the output never overtakes the input
+	 */
+	while( string_index < *utf8_string_length )
+	{
+		if( utf8_string[ string_index ] != (uint8_t) '&' )
+		{
+			utf8_string[ output_index++ ] = utf8_string[ string_index++ ];
+
+			continue;
+		}
+		/* The longest supported reference: "&#x0010FFFF;" is 12 characters
+		 */
+		for( entity_end_index = string_index + 1;
+		     entity_end_index < *utf8_string_length;
+		     entity_end_index++ )
+		{
+			if( ( utf8_string[ entity_end_index ] == (uint8_t) ';' )
+			 || ( ( entity_end_index - string_index ) >= 11 ) )
+			{
+				break;
+			}
+		}
+		result = 0;
+
+		if( ( entity_end_index < *utf8_string_length )
+		 && ( utf8_string[ entity_end_index ] == (uint8_t) ';' ) )
+		{
+			entity        = &( utf8_string[ string_index + 1 ] );
+			entity_length = entity_end_index - string_index - 1;
+
+			if( ( entity_length == 3 )
+			 && ( narrow_string_compare(
+			       (char *) entity,
+			       "amp",
+			       3 ) == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) '&';
+				result            = 1;
+			}
+			else if( ( entity_length == 2 )
+			      && ( narrow_string_compare(
+			            (char *) entity,
+			            "lt",
+			            2 ) == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) '<';
+				result            = 1;
+			}
+			else if( ( entity_length == 2 )
+			      && ( narrow_string_compare(
+			            (char *) entity,
+			            "gt",
+			            2 ) == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) '>';
+				result            = 1;
+			}
+			else if( ( entity_length == 4 )
+			      && ( narrow_string_compare(
+			            (char *) entity,
+			            "quot",
+			            4 ) == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) '"';
+				result            = 1;
+			}
+			else if( ( entity_length == 4 )
+			      && ( narrow_string_compare(
+			            (char *) entity,
+			            "apos",
+			            4 ) == 0 ) )
+			{
+				unicode_character = (libuna_unicode_character_t) '\'';
+				result            = 1;
+			}
+			else if( ( entity_length >= 2 )
+			      && ( entity[ 0 ] == (uint8_t) '#' ) )
+			{
+				entity_index      = 1;
+				is_hexadecimal    = 0;
+				unicode_character = 0;
+
+				if( ( entity[ 1 ] == (uint8_t) 'x' )
+				 || ( entity[ 1 ] == (uint8_t) 'X' ) )
+				{
+					entity_index   = 2;
+					is_hexadecimal = 1;
+				}
+				result = (int) ( entity_index < entity_length );
+
+				while( entity_index < entity_length )
+				{
+					byte_value = entity[ entity_index++ ];
+
+					if( ( byte_value >= (uint8_t) '0' )
+					 && ( byte_value <= (uint8_t) '9' ) )
+					{
+						byte_value -= (uint8_t) '0';
+					}
+					else if( ( is_hexadecimal != 0 )
+					      && ( byte_value >= (uint8_t) 'a' )
+					      && ( byte_value <= (uint8_t) 'f' ) )
+					{
+						byte_value -= (uint8_t) 'a' - 10;
+					}
+					else if( ( is_hexadecimal != 0 )
+					      && ( byte_value >= (uint8_t) 'A' )
+					      && ( byte_value <= (uint8_t) 'F' ) )
+					{
+						byte_value -= (uint8_t) 'A' - 10;
+					}
+					else
+					{
+						result = 0;
+
+						break;
+					}
+					if( is_hexadecimal != 0 )
+					{
+						unicode_character <<= 4;
+					}
+					else
+					{
+						unicode_character *= 10;
+					}
+					unicode_character += byte_value;
+
+					if( unicode_character > 0x0010ffffUL )
+					{
+						result = 0;
+
+						break;
+					}
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			utf8_string[ output_index++ ] = utf8_string[ string_index++ ];
+
+			continue;
+		}
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_string,
+		     entity_end_index + 1,
+		     &output_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character: 0x%08" PRIx32 " to UTF-8 string.",
+			 function,
+			 unicode_character );
+
+			return( -1 );
+		}
+		string_index = entity_end_index + 1;
+	}
+	utf8_string[ output_index ] = 0;
+
+	*utf8_string_length = output_index;
+
+	return( 1 );
+}
+
+/* Creates a value of the value type of a type attribute
+ * A value without a type attribute, of an unsupported value type or of
+ * a value type that cannot be copied from a string is created as an UTF-8 string value
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_initialize_value(
+     libfvalue_value_t **value,
+     const uint8_t *type_string,
+     size_t type_string_length,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvalue_xml_reader_initialize_value";
+	size_t value_data_size = 0;
+	uint32_t format_flags  = 0;
+	int result             = 0;
+	int value_type         = LIBFVALUE_VALUE_TYPE_STRING_UTF8;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type_string != NULL )
+	 && ( type_string_length > 0 ) )
+	{
+		result = libfvalue_value_type_get_type_by_type_string(
+		          type_string,
+		          type_string_length,
+		          &value_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			value_type = LIBFVALUE_VALUE_TYPE_STRING_UTF8;
+		}
+		else if( ( value_type != LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+		      && ( value_type != LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+		      && ( value_type != LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+		      && ( value_type != LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+		{
+			result = libfvalue_value_type_get_string_copy_defaults(
+			          value_type,
+			          &value_data_size,
+			          &format_flags,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string copy defaults.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				value_type = LIBFVALUE_VALUE_TYPE_STRING_UTF8;
+			}
+		}
+	}
+	if( libfvalue_value_type_initialize(
+	     value,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_flags != 0 )
+	{
+		if( libfvalue_value_set_format_flags(
+		     *value,
+		     format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set format flags.",
+			 function );
+
+			libfvalue_value_free(
+			 value,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the character data of an element without value entries is a value entry
+ * The character data of a string value is a value entry even if empty,
+ * for other value types empty character data means no value entries
+ * Returns 1 if a value entry, 0 if not or -1 on error
+ */
+int libfvalue_xml_reader_element_text_is_value_entry(
+     libfvalue_internal_value_t *internal_value,
+     size_t text_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_xml_reader_element_text_is_value_entry";
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+	{
+		return( 1 );
+	}
+	if( text_length > 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Copies a value entry from the character data of an element
+ * The text must be terminated by an end-of-string character, the XML entities
+ * are decoded in the text and the text length is updated accordingly
+ * A value entry that does not exist in a value of a non-string type is added
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_copy_value_entry_from_text(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     uint8_t *text,
+     size_t *text_length,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ 8 ]        = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	static char *function          = "libfvalue_xml_reader_copy_value_entry_from_text";
+	size_t entry_data_size         = 0;
+	uint32_t format_flags          = 0;
+	int appended_value_entry_index = 0;
+	int number_of_value_entries    = 0;
+	int result                     = 0;
+
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_xml_reader_decode_entities(
+	     text,
+	     text_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to decode text.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	 && ( internal_value->type_descriptor->type != LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+	{
+		/* A value without data has no value entries
+		 */
+		result = libfvalue_value_has_data(
+		          (libfvalue_value_t *) internal_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if value has data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libfvalue_value_get_number_of_value_entries(
+			     (libfvalue_value_t *) internal_value,
+			     &number_of_value_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of value entries.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( value_entry_index >= number_of_value_entries )
+		{
+			result = libfvalue_value_type_get_string_copy_defaults(
+			          internal_value->type_descriptor->type,
+			          &entry_data_size,
+			          &format_flags,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string copy defaults.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported value type: %s.",
+				 function,
+				 internal_value->type_descriptor->type_string );
+
+				return( -1 );
+			}
+			/* Appending can reallocate the data and free the value instances,
+			 * hence the value instances of the previous value entries are
+			 * written back into the data first. The data grows geometrically
+			 * so this is only needed for a small number of the value entries
+			 */
+			result = libfvalue_data_handle_append_requires_resize(
+			          internal_value->data_handle,
+			          entry_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if appending value entry data requires a resize.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( libfvalue_value_flush_to_data_handle(
+				     (libfvalue_value_t *) internal_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to flush value instances to data handle.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			/* The value entry data is a placeholder until the value is flushed
+			 */
+			if( libfvalue_value_append_entry_data(
+			     (libfvalue_value_t *) internal_value,
+			     &appended_value_entry_index,
+			     entry_data,
+			     entry_data_size,
+			     LIBFVALUE_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value entry data.",
+				 function );
+
+				return( -1 );
+			}
+			if( appended_value_entry_index != value_entry_index )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value entry index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libfvalue_internal_value_copy_entry_from_utf8_string(
+	     internal_value,
+	     value_entry_index,
+	     text,
+	     *text_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value entry: %d from text.",
+		 function,
+		 value_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the text of the XML reader to a value entry
+ * The references in the text are decoded before the text is copied
+ * A value entry that does not exist in a value of a non-string type is added
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_reader_copy_text_to_value_entry(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvalue_internal_xml_reader_copy_text_to_value_entry";
+
+	if( internal_xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the text is allocated and terminated by an end-of-string character
+	 */
+	if( libfvalue_internal_xml_reader_append_string(
+	     &( internal_xml_reader->text ),
+	     &( internal_xml_reader->text_size ),
+	     &( internal_xml_reader->text_length ),
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to terminate text.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_xml_reader_copy_value_entry_from_text(
+	     internal_value,
+	     value_entry_index,
+	     internal_xml_reader->text,
+	     &( internal_xml_reader->text_length ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value entry: %d from text.",
+		 function,
+		 value_entry_index );
+
+		return( -1 );
+	}
+	internal_xml_reader->text_length = 0;
+
+	return( 1 );
+}
+
+/* Reads the content of the element of the last tag into a value
+ * The identifier of the value is set to the element name if not set already
+ * otherwise the identifier must match the element name
+ * The value entries of a string value are replaced, the value entries of
+ * other value types are overwritten and added if they do not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_reader_read_element(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfvalue_internal_xml_reader_read_element";
+	size_t element_name_length = 0;
+	size_t identifier_length   = 0;
+	uint8_t has_value_entries  = 0;
+	uint8_t in_value_entry     = 0;
+	uint8_t is_value_entry     = 0;
+	int result                 = 0;
+	int value_entry_index      = 0;
+
+	if( internal_xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->type_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing type descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	/* The tag name is overwritten by the tags that follow
+	 */
+	if( libfvalue_internal_xml_reader_append_string(
+	     &( internal_xml_reader->element_name ),
+	     &( internal_xml_reader->element_name_size ),
+	     &element_name_length,
+	     internal_xml_reader->tag_name,
+	     internal_xml_reader->tag_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set element name.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->identifier == NULL )
+	{
+		if( libfvalue_value_set_identifier(
+		     (libfvalue_value_t *) internal_value,
+		     internal_xml_reader->element_name,
+		     element_name_length + 1,
+		     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		identifier_length = internal_value->identifier_size;
+
+		while( ( identifier_length > 0 )
+		    && ( internal_value->identifier[ identifier_length - 1 ] == 0 ) )
+		{
+			identifier_length--;
+		}
+		if( ( identifier_length != element_name_length )
+		 || ( memory_compare(
+		       internal_value->identifier,
+		       internal_xml_reader->element_name,
+		       element_name_length ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in identifier and element name: %s.",
+			 function,
+			 (char *) internal_xml_reader->element_name );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF8 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	 || ( internal_value->type_descriptor->type == LIBFVALUE_VALUE_TYPE_STRING_UTF32 ) )
+	{
+		if( libfvalue_internal_value_clear_value_entries(
+		     internal_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear value entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY )
+	{
+		return( 1 );
+	}
+	internal_xml_reader->text_length = 0;
+
+	do
+	{
+		result = libfvalue_internal_xml_reader_read_tag(
+		          internal_xml_reader,
+		          1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of input in element: %s.",
+			 function,
+			 (char *) internal_xml_reader->element_name );
+
+			return( -1 );
+		}
+		if( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_OTHER )
+		{
+			continue;
+		}
+		is_value_entry = (uint8_t) ( ( internal_xml_reader->tag_name_length == 11 )
+		                          && ( narrow_string_compare(
+		                                (char *) internal_xml_reader->tag_name,
+		                                "value_entry",
+		                                11 ) == 0 ) );
+
+		if( ( is_value_entry != 0 )
+		 && ( in_value_entry == 0 )
+		 && ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_OPEN ) )
+		{
+			/* The character data preceding a value entry is ignored
+			 */
+			internal_xml_reader->text_length = 0;
+
+			has_value_entries = 1;
+			in_value_entry    = 1;
+		}
+		else if( ( is_value_entry != 0 )
+		      && ( in_value_entry == 0 )
+		      && ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY ) )
+		{
+			internal_xml_reader->text_length = 0;
+
+			has_value_entries = 1;
+
+			if( libfvalue_internal_xml_reader_copy_text_to_value_entry(
+			     internal_xml_reader,
+			     internal_value,
+			     value_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value entry: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			value_entry_index++;
+		}
+		else if( ( is_value_entry != 0 )
+		      && ( in_value_entry != 0 )
+		      && ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE ) )
+		{
+			if( libfvalue_internal_xml_reader_copy_text_to_value_entry(
+			     internal_xml_reader,
+			     internal_value,
+			     value_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value entry: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			in_value_entry = 0;
+
+			value_entry_index++;
+		}
+		else if( ( in_value_entry == 0 )
+		      && ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE )
+		      && ( internal_xml_reader->tag_name_length == element_name_length )
+		      && ( memory_compare(
+		            internal_xml_reader->tag_name,
+		            internal_xml_reader->element_name,
+		            element_name_length ) == 0 ) )
+		{
+			break;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported tag: %s in element: %s.",
+			 function,
+			 (char *) internal_xml_reader->tag_name,
+			 (char *) internal_xml_reader->element_name );
+
+			return( -1 );
+		}
+	}
+	while( result == 1 );
+
+	/* The character data of an element without value entries can contain
+	 * a single value entry
+	 */
+	if( has_value_entries == 0 )
+	{
+		result = libfvalue_xml_reader_element_text_is_value_entry(
+		          internal_value,
+		          internal_xml_reader->text_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if element text is a value entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libfvalue_internal_xml_reader_copy_text_to_value_entry(
+			     internal_xml_reader,
+			     internal_value,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value entry: 0.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	internal_xml_reader->text_length = 0;
+
+	return( 1 );
+}
+
+/* Reads a value
+ * Processing instructions, comments and declarations preceding the value are skipped
+ * Returns 1 if successful, 0 if no value was found or -1 on error
+ */
+int libfvalue_xml_reader_read_value(
+     libfvalue_xml_reader_t *xml_reader,
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	static char *function                                = "libfvalue_xml_reader_read_value";
+	int result                                           = 0;
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader = (libfvalue_internal_xml_reader_t *) xml_reader;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfvalue_internal_xml_reader_read_tag(
+		          internal_xml_reader,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tag.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( ( result == 1 )
+	    && ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_OTHER ) );
+
+	/* A close tag indicates the end of the enclosing element
+	 */
+	if( ( result == 0 )
+	 || ( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_internal_xml_reader_read_element(
+	     internal_xml_reader,
+	     (libfvalue_internal_value_t *) value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read element: %s.",
+		 function,
+		 (char *) internal_xml_reader->element_name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the values of a table
+ * The elements preceding the table element are skipped. Every element
+ * contained by the table element is read into the value with the same
+ * identifier, a value that does not exist is added to the table with the value
+ * type of its type attribute or as an UTF-8 string
+ * Only the element that is being read is kept in memory
+ * Returns 1 if successful, 0 if no table was found or -1 on error
+ */
+int libfvalue_xml_reader_read_table(
+     libfvalue_xml_reader_t *xml_reader,
+     libfvalue_table_t *table,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	libfvalue_value_t *value                             = NULL;
+	libfvalue_value_t *new_value                         = NULL;
+	static char *function                                = "libfvalue_xml_reader_read_table";
+	int result                                           = 0;
+	int value_index                                      = 0;
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader = (libfvalue_internal_xml_reader_t *) xml_reader;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_name_length == 0 )
+	 || ( table_name_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the start of the table element
+	 */
+	do
+	{
+		result = libfvalue_internal_xml_reader_read_tag(
+		          internal_xml_reader,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tag.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	while( ( ( internal_xml_reader->tag_type != LIBFVALUE_XML_TAG_TYPE_OPEN )
+	      && ( internal_xml_reader->tag_type != LIBFVALUE_XML_TAG_TYPE_EMPTY ) )
+	    || ( internal_xml_reader->tag_name_length != table_name_length )
+	    || ( memory_compare(
+	          internal_xml_reader->tag_name,
+	          table_name,
+	          table_name_length ) != 0 ) );
+
+	if( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_EMPTY )
+	{
+		return( 1 );
+	}
+	while( result == 1 )
+	{
+		result = libfvalue_internal_xml_reader_read_tag(
+		          internal_xml_reader,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tag.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of input in table.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_OTHER )
+		{
+			continue;
+		}
+		if( internal_xml_reader->tag_type == LIBFVALUE_XML_TAG_TYPE_CLOSE )
+		{
+			if( ( internal_xml_reader->tag_name_length != table_name_length )
+			 || ( memory_compare(
+			       internal_xml_reader->tag_name,
+			       table_name,
+			       table_name_length ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported close tag: %s in table.",
+				 function,
+				 (char *) internal_xml_reader->tag_name );
+
+				goto on_error;
+			}
+			break;
+		}
+		result = libfvalue_table_get_index_by_identifier(
+		          table,
+		          internal_xml_reader->tag_name,
+		          internal_xml_reader->tag_name_length + 1,
+		          &value_index,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find index for: %s.",
+			 function,
+			 (char *) internal_xml_reader->tag_name );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfvalue_table_get_value_by_index(
+			     table,
+			     value_index,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d from table.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* The type attribute is overwritten by the tags that follow
+			 */
+			if( libfvalue_xml_reader_initialize_value(
+			     &new_value,
+			     internal_xml_reader->type_string,
+			     internal_xml_reader->type_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create value: %s.",
+				 function,
+				 (char *) internal_xml_reader->tag_name );
+
+				goto on_error;
+			}
+			if( libfvalue_value_set_identifier(
+			     new_value,
+			     internal_xml_reader->tag_name,
+			     internal_xml_reader->tag_name_length + 1,
+			     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set identifier in value: %s.",
+				 function,
+				 (char *) internal_xml_reader->tag_name );
+
+				goto on_error;
+			}
+			if( libfvalue_table_set_value(
+			     table,
+			     new_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value: %s in table.",
+				 function,
+				 (char *) internal_xml_reader->tag_name );
+
+				goto on_error;
+			}
+			value     = new_value;
+			new_value = NULL;
+		}
+		if( libfvalue_internal_xml_reader_read_element(
+		     internal_xml_reader,
+		     (libfvalue_internal_value_t *) value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element: %s.",
+			 function,
+			 (char *) internal_xml_reader->element_name );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( new_value != NULL )
+	{
+		libfvalue_value_free(
+		 &new_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data from a file stream
+ * This function can be used as the read function of a XML reader
+ * where the IO handle is the file stream
+ * Returns the number of bytes read, 0 if the end of the file stream was reached or -1 on error
+ */
+ssize_t libfvalue_xml_reader_read_file_stream(
+         intptr_t *io_handle,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvalue_xml_reader_read_file_stream";
+	size_t read_count     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              (FILE *) io_handle,
+	              data,
+	              data_size );
+
+	if( ( read_count == 0 )
+	 && ( data_size > 0 )
+	 && ( file_stream_at_end(
+	       (FILE *) io_handle ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_count );
+}
+
+/* Gives back the data that was read from a file stream but not parsed
+ * by seeking the file stream back to the first byte that was not parsed
+ * The data in the buffer of the XML reader is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_reader_unread_file_stream(
+     libfvalue_xml_reader_t *xml_reader,
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_reader_t *internal_xml_reader = NULL;
+	static char *function                                = "libfvalue_xml_reader_unread_file_stream";
+	size_t unparsed_data_size                            = 0;
+
+	if( xml_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_reader = (libfvalue_internal_xml_reader_t *) xml_reader;
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	unparsed_data_size = internal_xml_reader->buffer_data_size
+	                   - internal_xml_reader->buffer_offset;
+
+	if( unparsed_data_size > 0 )
+	{
+		if( file_stream_seek_offset(
+		     file_stream,
+		     -( (off_t) unparsed_data_size ),
+		     SEEK_CUR ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_xml_reader->buffer_offset    = 0;
+	internal_xml_reader->buffer_data_size = 0;
+	internal_xml_reader->end_of_input     = 0;
+
+	return( 1 );
+}
+
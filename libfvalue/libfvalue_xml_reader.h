@@ -0,0 +1,244 @@
+/*
+ * XML reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_XML_READER_H )
+#define _LIBFVALUE_XML_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#include "libfvalue_extern.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_types.h"
+#include "libfvalue_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvalue_internal_xml_reader libfvalue_internal_xml_reader_t;
+
+struct libfvalue_internal_xml_reader
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 * contains the offset of the first byte in the buffer that was not yet parsed
+	 */
+	size_t buffer_offset;
+
+	/* The buffer data size
+	 * contains the number of bytes in the buffer that were read
+	 */
+	size_t buffer_data_size;
+
+	/* The text
+	 * contains the character data preceding the last tag
+	 */
+	uint8_t *text;
+
+	/* The text size
+	 */
+	size_t text_size;
+
+	/* The text length
+	 */
+	size_t text_length;
+
+	/* The tag name
+	 * contains the name of the last tag
+	 */
+	uint8_t *tag_name;
+
+	/* The tag name size
+	 */
+	size_t tag_name_size;
+
+	/* The tag name length
+	 */
+	size_t tag_name_length;
+
+	/* The tag type
+	 */
+	uint8_t tag_type;
+
+	/* The type string
+	 * contains the type attribute of the last tag
+	 */
+	uint8_t *type_string;
+
+	/* The type string size
+	 */
+	size_t type_string_size;
+
+	/* The type string length
+	 */
+	size_t type_string_length;
+
+	/* The element name
+	 * contains the name of the element that is being read
+	 */
+	uint8_t *element_name;
+
+	/* The element name size
+	 */
+	size_t element_name_size;
+
+	/* The offset
+	 * contains the number of bytes that were parsed
+	 */
+	size_t offset;
+
+	/* Value to indicate the end of the input was reached
+	 */
+	uint8_t end_of_input;
+
+	/* The IO handle
+	 */
+	intptr_t *io_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *io_handle,
+	           uint8_t *data,
+	           size_t data_size,
+	           libcerror_error_t **error );
+};
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_reader_initialize(
+     libfvalue_xml_reader_t **xml_reader,
+     intptr_t *io_handle,
+     ssize_t (*read_function)(
+              intptr_t *io_handle,
+              uint8_t *data,
+              size_t data_size,
+              libcerror_error_t **error ),
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_reader_free(
+     libfvalue_xml_reader_t **xml_reader,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_reader_get_offset(
+     libfvalue_xml_reader_t *xml_reader,
+     size_t *offset,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_fill_buffer(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_get_byte(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     uint8_t *byte_value,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_append_string(
+     uint8_t **string,
+     size_t *string_size,
+     size_t *string_length,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_read_tag(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     uint8_t collect_text,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_copy_text_to_value_entry(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_reader_read_element(
+     libfvalue_internal_xml_reader_t *internal_xml_reader,
+     libfvalue_internal_value_t *internal_value,
+     libcerror_error_t **error );
+
+int libfvalue_xml_reader_decode_entities(
+     uint8_t *utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libfvalue_xml_reader_initialize_value(
+     libfvalue_value_t **value,
+     const uint8_t *type_string,
+     size_t type_string_length,
+     libcerror_error_t **error );
+
+int libfvalue_xml_reader_element_text_is_value_entry(
+     libfvalue_internal_value_t *internal_value,
+     size_t text_length,
+     libcerror_error_t **error );
+
+int libfvalue_xml_reader_copy_value_entry_from_text(
+     libfvalue_internal_value_t *internal_value,
+     int value_entry_index,
+     uint8_t *text,
+     size_t *text_length,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_reader_read_value(
+     libfvalue_xml_reader_t *xml_reader,
+     libfvalue_value_t *value,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_reader_read_table(
+     libfvalue_xml_reader_t *xml_reader,
+     libfvalue_table_t *table,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     libcerror_error_t **error );
+
+ssize_t libfvalue_xml_reader_read_file_stream(
+         intptr_t *io_handle,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libfvalue_xml_reader_unread_file_stream(
+     libfvalue_xml_reader_t *xml_reader,
+     FILE *file_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_XML_READER_H ) */
+
@@ -0,0 +1,1266 @@
+/*
+ * XML writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfvalue_definitions.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_table.h"
+#include "libfvalue_types.h"
+#include "libfvalue_value.h"
+#include "libfvalue_xml_writer.h"
+
+/* The XML writer collects its output in a single buffer. If a write function
+ * is set the buffer has a fixed size and is passed to the write function,
+ * in a single call, when it is full or when the writer is flushed. Otherwise
+ * the buffer grows to contain all output.
+ *
+ * The value entries are converted to an UTF-8 string in a scratch string
+ * that is reused for all conversions.
+ */
+
+/* Creates a XML writer
+ * Make sure the value xml_writer is referencing, is set to NULL
+ * If write function is NULL the output is retained in a buffer that grows as needed,
+ * otherwise the buffer of buffer size is passed to the write function when it is flushed
+ * If buffer size is 0 the default buffer size is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_initialize(
+     libfvalue_xml_writer_t **xml_writer,
+     intptr_t *io_handle,
+     ssize_t (*write_function)(
+              intptr_t *io_handle,
+              const uint8_t *data,
+              size_t data_size,
+              libcerror_error_t **error ),
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	static char *function                                = "libfvalue_xml_writer_initialize";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == 0 )
+	{
+		buffer_size = LIBFVALUE_XML_WRITER_DEFAULT_BUFFER_SIZE;
+	}
+	if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = memory_allocate_structure(
+	                       libfvalue_internal_xml_writer_t );
+
+	if( internal_xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_xml_writer,
+	     0,
+	     sizeof( libfvalue_internal_xml_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML writer.",
+		 function );
+
+		memory_free(
+		 internal_xml_writer );
+
+		return( -1 );
+	}
+	internal_xml_writer->buffer = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * buffer_size );
+
+	if( internal_xml_writer->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_xml_writer->buffer_size    = buffer_size;
+	internal_xml_writer->io_handle      = io_handle;
+	internal_xml_writer->write_function = write_function;
+
+	*xml_writer = (libfvalue_xml_writer_t *) internal_xml_writer;
+
+	return( 1 );
+
+on_error:
+	if( internal_xml_writer != NULL )
+	{
+		memory_free(
+		 internal_xml_writer );
+	}
+	return( -1 );
+}
+
+/* Frees a XML writer
+ * Output that was not flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_free(
+     libfvalue_xml_writer_t **xml_writer,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	static char *function                                = "libfvalue_xml_writer_free";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_writer != NULL )
+	{
+		internal_xml_writer = (libfvalue_internal_xml_writer_t *) *xml_writer;
+		*xml_writer         = NULL;
+
+		if( internal_xml_writer->scratch_string != NULL )
+		{
+			memory_free(
+			 internal_xml_writer->scratch_string );
+		}
+		memory_free(
+		 internal_xml_writer->buffer );
+
+		memory_free(
+		 internal_xml_writer );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data in the buffer
+ * Without a write function this is all the output, otherwise the output that was not yet flushed
+ * The data is not an end-of-string terminated string and remains valid until the next write
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_get_data(
+     libfvalue_xml_writer_t *xml_writer,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	static char *function                                = "libfvalue_xml_writer_get_data";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = (libfvalue_internal_xml_writer_t *) xml_writer;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = internal_xml_writer->buffer;
+	*data_size = internal_xml_writer->buffer_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes written
+ * This includes the output that was not yet flushed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_get_number_of_bytes_written(
+     libfvalue_xml_writer_t *xml_writer,
+     size_t *number_of_bytes_written,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	static char *function                                = "libfvalue_xml_writer_get_number_of_bytes_written";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = (libfvalue_internal_xml_writer_t *) xml_writer;
+
+	if( number_of_bytes_written == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes written.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes_written = internal_xml_writer->number_of_bytes_written;
+
+	return( 1 );
+}
+
+/* Flushes the buffer to the write function
+ * The buffer is passed to the write function in a single call
+ * Without a write function the output is retained in the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_flush(
+     libfvalue_xml_writer_t *xml_writer,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	static char *function                                = "libfvalue_xml_writer_flush";
+	ssize_t write_count                                  = 0;
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = (libfvalue_internal_xml_writer_t *) xml_writer;
+
+	if( ( internal_xml_writer->write_function == NULL )
+	 || ( internal_xml_writer->buffer_offset == 0 ) )
+	{
+		return( 1 );
+	}
+	write_count = internal_xml_writer->write_function(
+	               internal_xml_writer->io_handle,
+	               internal_xml_writer->buffer,
+	               internal_xml_writer->buffer_offset,
+	               error );
+
+	if( write_count != (ssize_t) internal_xml_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Appends data to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_writer_append_data(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libfvalue_internal_xml_writer_append_data";
+	size_t buffer_size    = 0;
+	size_t copy_size      = 0;
+
+	if( internal_xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_writer->write_function == NULL )
+	 && ( data_size > ( internal_xml_writer->buffer_size - internal_xml_writer->buffer_offset ) ) )
+	{
+		buffer_size = internal_xml_writer->buffer_size;
+
+		while( data_size > ( buffer_size - internal_xml_writer->buffer_offset ) )
+		{
+			if( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid buffer size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                internal_xml_writer->buffer,
+		                sizeof( uint8_t ) * buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_xml_writer->buffer      = (uint8_t *) reallocation;
+		internal_xml_writer->buffer_size = buffer_size;
+	}
+	internal_xml_writer->number_of_bytes_written += data_size;
+
+	while( data_size > 0 )
+	{
+		if( internal_xml_writer->buffer_offset >= internal_xml_writer->buffer_size )
+		{
+			if( libfvalue_xml_writer_flush(
+			     (libfvalue_xml_writer_t *) internal_xml_writer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		copy_size = internal_xml_writer->buffer_size - internal_xml_writer->buffer_offset;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( internal_xml_writer->buffer[ internal_xml_writer->buffer_offset ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_xml_writer->buffer_offset += copy_size;
+
+		data      += copy_size;
+		data_size -= copy_size;
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-8 string to the buffer with the XML special characters replaced by entities
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_writer_append_escaped_string(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	const char *entity         = NULL;
+	static char *function      = "libfvalue_internal_xml_writer_append_escaped_string";
+	size_t entity_length       = 0;
+	size_t string_index        = 0;
+	size_t unescaped_index     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		/* Note that numeric values for the characters are used to prevent
+		 * platform specific values being assigned
+		 */
+		switch( utf8_string[ string_index ] )
+		{
+			case 0x22:
+				entity        = "&quot;";
+				entity_length = 6;
+				break;
+
+			case 0x26:
+				entity        = "&amp;";
+				entity_length = 5;
+				break;
+
+			case 0x3c:
+				entity        = "&lt;";
+				entity_length = 4;
+				break;
+
+			case 0x3e:
+				entity        = "&gt;";
+				entity_length = 4;
+				break;
+
+			default:
+				continue;
+		}
+		if( libfvalue_internal_xml_writer_append_data(
+		     internal_xml_writer,
+		     &( utf8_string[ unescaped_index ] ),
+		     string_index - unescaped_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfvalue_internal_xml_writer_append_data(
+		     internal_xml_writer,
+		     (uint8_t *) entity,
+		     entity_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entity.",
+			 function );
+
+			return( -1 );
+		}
+		unescaped_index = string_index + 1;
+	}
+	if( libfvalue_internal_xml_writer_append_data(
+	     internal_xml_writer,
+	     &( utf8_string[ unescaped_index ] ),
+	     utf8_string_length - unescaped_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a XML tag to the buffer
+ * The tag name should only consist of the characters [A-Za-z0-9_] so that
+ * it can be read by libfvalue_table_copy_from_utf8_xml_string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_internal_xml_writer_append_tag(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *tag_name,
+     size_t tag_name_length,
+     const char *type_string,
+     uint8_t is_close_tag,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvalue_internal_xml_writer_append_tag";
+	size_t tag_name_index  = 0;
+	size_t tag_prefix_size = 1;
+
+	if( tag_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag name.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid tag name length value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( tag_name_index = 0;
+	     tag_name_index < tag_name_length;
+	     tag_name_index++ )
+	{
+		if( ( ( tag_name[ tag_name_index ] < 0x41 )
+		  ||  ( tag_name[ tag_name_index ] > 0x5a ) )
+		 && ( ( tag_name[ tag_name_index ] < 0x61 )
+		  ||  ( tag_name[ tag_name_index ] > 0x7a ) )
+		 && ( ( tag_name[ tag_name_index ] < 0x30 )
+		  ||  ( tag_name[ tag_name_index ] > 0x39 ) )
+		 &&   ( tag_name[ tag_name_index ] != 0x5f ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: 0x%02" PRIx8 " in tag name.",
+			 function,
+			 tag_name[ tag_name_index ] );
+
+			return( -1 );
+		}
+	}
+	if( is_close_tag != 0 )
+	{
+		tag_prefix_size = 2;
+	}
+	if( libfvalue_internal_xml_writer_append_data(
+	     internal_xml_writer,
+	     (uint8_t *) "</",
+	     tag_prefix_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tag start.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_internal_xml_writer_append_data(
+	     internal_xml_writer,
+	     tag_name,
+	     tag_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tag name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_close_tag == 0 )
+	 && ( type_string != NULL ) )
+	{
+		if( libfvalue_internal_xml_writer_append_data(
+		     internal_xml_writer,
+		     (uint8_t *) " type=\"",
+		     7,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append type attribute.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfvalue_internal_xml_writer_append_escaped_string(
+		     internal_xml_writer,
+		     (uint8_t *) type_string,
+		     narrow_string_length(
+		      type_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append type string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfvalue_internal_xml_writer_append_data(
+		     internal_xml_writer,
+		     (uint8_t *) "\"",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append type attribute.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfvalue_internal_xml_writer_append_data(
+	     internal_xml_writer,
+	     (uint8_t *) ">",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tag end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a value
+ * The value is written as: <identifier type="type">data</identifier>
+ * where a value with multiple value entries contains a <value_entry> element per value entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_write_value(
+     libfvalue_xml_writer_t *xml_writer,
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_value_t *internal_value           = NULL;
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	intptr_t *value_instance                             = NULL;
+	void *reallocation                                   = NULL;
+	static char *function                                = "libfvalue_xml_writer_write_value";
+	size_t identifier_length                             = 0;
+	size_t value_string_index                            = 0;
+	size_t value_string_size                             = 0;
+	int number_of_value_entries                          = 0;
+	int value_entry_index                                = 0;
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = (libfvalue_internal_xml_writer_t *) xml_writer;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_value = (libfvalue_internal_value_t *) value;
+
+	if( internal_value->type_descriptor->type_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing type string.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->identifier != NULL )
+	{
+		identifier_length = internal_value->identifier_size;
+
+		while( ( identifier_length > 0 )
+		    && ( internal_value->identifier[ identifier_length - 1 ] == 0 ) )
+		{
+			identifier_length--;
+		}
+	}
+	if( identifier_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->type_descriptor->get_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing get UTF-8 string size function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_value->type_descriptor->copy_to_utf8_string_with_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value - missing copy to UTF-8 string function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_number_of_value_entries(
+	     value,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_internal_xml_writer_append_tag(
+	     internal_xml_writer,
+	     internal_value->identifier,
+	     identifier_length,
+	     internal_value->type_descriptor->type_string,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append open tag.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		value_instance = NULL;
+
+		if( libfvalue_internal_value_get_read_instance_by_index(
+		     internal_value,
+		     value_entry_index,
+		     &value_instance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value instance: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( number_of_value_entries > 1 )
+		{
+			if( libfvalue_internal_xml_writer_append_data(
+			     internal_xml_writer,
+			     (uint8_t *) "<value_entry>",
+			     13,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value entry open tag.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( value_instance != NULL )
+		{
+			if( internal_value->type_descriptor->get_utf8_string_size(
+			     value_instance,
+			     &value_string_size,
+			     internal_value->format_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size UTF-8 string of instance: %d.",
+				 function,
+				 value_entry_index );
+
+				return( -1 );
+			}
+			if( value_string_size > internal_xml_writer->scratch_string_size )
+			{
+				if( value_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid value string size value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
+				reallocation = memory_reallocate(
+				                internal_xml_writer->scratch_string,
+				                sizeof( uint8_t ) * value_string_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize scratch string.",
+					 function );
+
+					return( -1 );
+				}
+				internal_xml_writer->scratch_string      = (uint8_t *) reallocation;
+				internal_xml_writer->scratch_string_size = value_string_size;
+			}
+			if( value_string_size > 0 )
+			{
+				value_string_index = 0;
+
+				if( internal_value->type_descriptor->copy_to_utf8_string_with_index(
+				     value_instance,
+				     internal_xml_writer->scratch_string,
+				     value_string_size,
+				     &value_string_index,
+				     internal_value->format_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy instance: %d to UTF-8 string.",
+					 function,
+					 value_entry_index );
+
+					return( -1 );
+				}
+				/* The end-of-string character is not written
+				 */
+				while( ( value_string_index > 0 )
+				    && ( internal_xml_writer->scratch_string[ value_string_index - 1 ] == 0 ) )
+				{
+					value_string_index--;
+				}
+				if( libfvalue_internal_xml_writer_append_escaped_string(
+				     internal_xml_writer,
+				     internal_xml_writer->scratch_string,
+				     value_string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append value string: %d.",
+					 function,
+					 value_entry_index );
+
+					return( -1 );
+				}
+			}
+		}
+		if( number_of_value_entries > 1 )
+		{
+			if( libfvalue_internal_xml_writer_append_data(
+			     internal_xml_writer,
+			     (uint8_t *) "</value_entry>",
+			     14,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value entry close tag.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libfvalue_internal_xml_writer_append_tag(
+	     internal_xml_writer,
+	     internal_value->identifier,
+	     identifier_length,
+	     NULL,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append close tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a values table
+ * The table is written as: <table_name>values</table_name>
+ * which can be read by libfvalue_table_copy_from_utf8_xml_string
+ * Returns 1 if successful or -1 on error
+ */
+int libfvalue_xml_writer_write_table(
+     libfvalue_xml_writer_t *xml_writer,
+     libfvalue_table_t *table,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     libcerror_error_t **error )
+{
+	libfvalue_internal_xml_writer_t *internal_xml_writer = NULL;
+	libfvalue_value_t *value                             = NULL;
+	static char *function                                = "libfvalue_xml_writer_write_table";
+	int number_of_values                                 = 0;
+	int value_index                                      = 0;
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_writer = (libfvalue_internal_xml_writer_t *) xml_writer;
+
+	if( table_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid table name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_table_get_number_of_values(
+	     table,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_internal_xml_writer_append_tag(
+	     internal_xml_writer,
+	     table_name,
+	     table_name_length,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table open tag.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libfvalue_table_get_value_by_index(
+		     table,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		/* Unset values in the table are not written
+		 */
+		if( value == NULL )
+		{
+			continue;
+		}
+		if( libfvalue_xml_writer_write_value(
+		     xml_writer,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	if( libfvalue_internal_xml_writer_append_tag(
+	     internal_xml_writer,
+	     table_name,
+	     table_name_length,
+	     NULL,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table close tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to a file stream
+ * This function can be used as the write function of a XML writer
+ * where the IO handle is the file stream
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libfvalue_xml_writer_write_file_stream(
+         intptr_t *io_handle,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvalue_xml_writer_write_file_stream";
+	size_t write_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               (FILE *) io_handle,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) write_count );
+}
+
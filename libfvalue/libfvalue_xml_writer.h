@@ -0,0 +1,160 @@
+/*
+ * XML writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVALUE_XML_WRITER_H )
+#define _LIBFVALUE_XML_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvalue_extern.h"
+#include "libfvalue_libcerror.h"
+#include "libfvalue_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvalue_internal_xml_writer libfvalue_internal_xml_writer_t;
+
+struct libfvalue_internal_xml_writer
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 * contains the number of bytes in the buffer that were not yet flushed
+	 */
+	size_t buffer_offset;
+
+	/* The scratch string
+	 * used to convert the value entries to an UTF-8 string
+	 */
+	uint8_t *scratch_string;
+
+	/* The scratch string size
+	 */
+	size_t scratch_string_size;
+
+	/* The number of bytes written
+	 */
+	size_t number_of_bytes_written;
+
+	/* The IO handle
+	 */
+	intptr_t *io_handle;
+
+	/* The write function
+	 * NULL if the output is retained in the buffer
+	 */
+	ssize_t (*write_function)(
+	           intptr_t *io_handle,
+	           const uint8_t *data,
+	           size_t data_size,
+	           libcerror_error_t **error );
+};
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_initialize(
+     libfvalue_xml_writer_t **xml_writer,
+     intptr_t *io_handle,
+     ssize_t (*write_function)(
+              intptr_t *io_handle,
+              const uint8_t *data,
+              size_t data_size,
+              libcerror_error_t **error ),
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_free(
+     libfvalue_xml_writer_t **xml_writer,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_get_data(
+     libfvalue_xml_writer_t *xml_writer,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_get_number_of_bytes_written(
+     libfvalue_xml_writer_t *xml_writer,
+     size_t *number_of_bytes_written,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_flush(
+     libfvalue_xml_writer_t *xml_writer,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_writer_append_data(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_writer_append_escaped_string(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libfvalue_internal_xml_writer_append_tag(
+     libfvalue_internal_xml_writer_t *internal_xml_writer,
+     const uint8_t *tag_name,
+     size_t tag_name_length,
+     const char *type_string,
+     uint8_t is_close_tag,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_write_value(
+     libfvalue_xml_writer_t *xml_writer,
+     libfvalue_value_t *value,
+     libcerror_error_t **error );
+
+LIBFVALUE_EXTERN \
+int libfvalue_xml_writer_write_table(
+     libfvalue_xml_writer_t *xml_writer,
+     libfvalue_table_t *table,
+     const uint8_t *table_name,
+     size_t table_name_length,
+     libcerror_error_t **error );
+
+ssize_t libfvalue_xml_writer_write_file_stream(
+         intptr_t *io_handle,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVALUE_XML_WRITER_H ) */
+
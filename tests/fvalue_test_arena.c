@@ -0,0 +1,940 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_arena.h"
+
+/* Tests the libfvalue_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfvalue_arena_t *arena        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_arena_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libfvalue_arena_t *) 0x12345678UL;
+
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	arena = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_arena_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvalue_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfvalue_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_arena_initialize with memset failing
+		 */
+		fvalue_test_memset_attempts_before_fail = test_number;
+
+		result = libfvalue_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fvalue_test_memset_attempts_before_fail != -1 )
+		{
+			fvalue_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfvalue_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvalue_arena_free(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_arena_t *arena = NULL;
+	libfvalue_value_t *value = NULL;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	uint8_t value_data[ 4 ]  = { 0x78, 0x56, 0x34, 0x12 };
+
+	/* Initialize test
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_arena_reset(
+	          arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reset of an arena that contains values with materialized instances
+	 */
+	for( value_index = 0;
+	     value_index < 32;
+	     value_index++ )
+	{
+		value = NULL;
+
+		result = libfvalue_value_type_initialize_in_arena(
+		          &value,
+		          arena,
+		          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvalue_value_set_data(
+		          value,
+		          value_data,
+		          4,
+		          LIBFVALUE_ENDIAN_LITTLE,
+		          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvalue_value_copy_to_32bit(
+		          value,
+		          0,
+		          &value_32bit,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 (uint32_t) 0x12345678UL );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_arena_reset(
+	          arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_arena_reset(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* Tests the libfvalue_arena_allocate_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_allocate_memory(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_arena_t *arena = NULL;
+	uint8_t *first_memory    = NULL;
+	uint8_t *memory          = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	first_memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                            arena,
+	                            5 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "first_memory",
+	 first_memory );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "first_memory alignment",
+	 (int) ( (intptr_t) first_memory % 16 ),
+	 0 );
+
+	memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                      arena,
+	                      5 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "memory offset",
+	 (int) ( memory - first_memory ),
+	 16 );
+
+	/* Test an allocation that exceeds the block size
+	 */
+	memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                      arena,
+	                      1024 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	/* Test that a reset arena reuses its blocks
+	 */
+	result = libfvalue_arena_reset(
+	          arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                      arena,
+	                      5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "memory offset",
+	 (ssize_t) ( memory - first_memory ),
+	 (ssize_t) 0 );
+
+	/* Test error cases
+	 */
+	memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                      arena,
+	                      0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	/* Clean up
+	 */
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_arena_reallocate_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_reallocate_memory(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_arena_t *arena = NULL;
+	uint8_t *memory          = NULL;
+	uint8_t *new_memory      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          128,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory = (uint8_t *) libfvalue_arena_allocate_memory(
+	                      arena,
+	                      8 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	memory[ 0 ] = 'A';
+	memory[ 7 ] = 'Z';
+
+	/* Test regular cases
+	 */
+	new_memory = (uint8_t *) libfvalue_arena_reallocate_memory(
+	                          arena,
+	                          memory,
+	                          8,
+	                          64 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "new_memory offset",
+	 (ssize_t) ( new_memory - memory ),
+	 (ssize_t) 0 );
+
+	/* Test reallocate of memory that does not fit the current block
+	 */
+	new_memory = (uint8_t *) libfvalue_arena_reallocate_memory(
+	                          arena,
+	                          memory,
+	                          64,
+	                          512 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "new_memory",
+	 new_memory );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "new_memory offset",
+	 (ssize_t) ( new_memory - memory ),
+	 (ssize_t) 0 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "new_memory[ 0 ]",
+	 new_memory[ 0 ],
+	 'A' );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "new_memory[ 7 ]",
+	 new_memory[ 7 ],
+	 'Z' );
+
+	/* Test error cases
+	 */
+	new_memory = (uint8_t *) libfvalue_arena_reallocate_memory(
+	                          arena,
+	                          memory,
+	                          64,
+	                          0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "new_memory",
+	 new_memory );
+
+	/* Clean up
+	 */
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_arena_append_cleanup function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_arena_append_cleanup(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_arena_t *arena = NULL;
+	uint8_t *memory          = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory = (uint8_t *) memory_allocate(
+	                      16 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_arena_append_cleanup(
+	          arena,
+	          (intptr_t *) memory,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory is now owned by the arena
+	 */
+	memory = NULL;
+
+	/* Test error cases
+	 */
+	result = libfvalue_arena_append_cleanup(
+	          NULL,
+	          (intptr_t *) arena,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_arena_append_cleanup(
+	          arena,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory != NULL )
+	{
+		memory_free(
+		 memory );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_initialize",
+	 fvalue_test_arena_initialize );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_free",
+	 fvalue_test_arena_free );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_reset",
+	 fvalue_test_arena_reset );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_allocate_memory",
+	 fvalue_test_arena_allocate_memory );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_reallocate_memory",
+	 fvalue_test_arena_reallocate_memory );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_arena_append_cleanup",
+	 fvalue_test_arena_append_cleanup );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1194 @@
+/*
+ * Library ASCII string functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_ascii.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* The streams are larger than a single vector block to test
+ * both the vectorized and the remaining units conversion
+ */
+uint8_t fvalue_test_ascii_utf16le_stream[ 40 ] = {
+	0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00,
+	0x53, 0x00, 0x43, 0x00, 0x49, 0x00, 0x49, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00,
+	0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x00, 0x00 };
+
+uint8_t fvalue_test_ascii_utf16be_stream[ 38 ] = {
+	0x00, 0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41,
+	0x00, 0x53, 0x00, 0x43, 0x00, 0x49, 0x00, 0x49, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72,
+	0x00, 0x69, 0x00, 0x6e, 0x00, 0x67 };
+
+uint8_t fvalue_test_ascii_utf32le_stream[ 80 ] = {
+	0x53, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+	0x69, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fvalue_test_ascii_non_ascii_utf16le_stream[ 40 ] = {
+	0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0xe4, 0x00,
+	0x53, 0x00, 0x43, 0x00, 0x49, 0x00, 0x49, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00,
+	0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x00, 0x00 };
+
+char *fvalue_test_ascii_string = "Sample ASCII string";
+
+/* Tests the libfvalue_ascii_string_size_from_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_string_size_from_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_size = 0;
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 20 );
+
+	string_size = 0;
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          fvalue_test_ascii_utf16be_stream,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 20 );
+
+	string_size = 0;
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          fvalue_test_ascii_utf32le_stream,
+	          80,
+	          LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 20 );
+
+	string_size = 0;
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 20 );
+
+	/* Test streams that cannot be converted as ASCII
+	 */
+	result = libfvalue_ascii_string_size_from_stream(
+	          fvalue_test_ascii_non_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_UTF7,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_string_size_from_stream(
+	          NULL,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_string_size_from_stream(
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_ascii_utf8_string_with_index_copy_from_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_utf8_string_with_index_copy_from_stream(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 1;
+
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 21 );
+
+	for( string_index = 0;
+	     string_index < 19;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "utf8_string[ string_index + 1 ]",
+		 (int) utf8_string[ string_index + 1 ],
+		 (int) fvalue_test_ascii_string[ string_index ] );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 20 ]",
+	 (int) utf8_string[ 20 ],
+	 0 );
+
+	/* Test streams that cannot be converted as ASCII
+	 */
+	utf8_string_index = 0;
+
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          fvalue_test_ascii_non_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          utf8_string,
+	          19,
+	          &utf8_string_index,
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          NULL,
+	          32,
+	          &utf8_string_index,
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          utf8_string,
+	          32,
+	          NULL,
+	          fvalue_test_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf8_string_with_index_copy_from_stream(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          NULL,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_ascii_utf16_string_with_index_copy_from_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_utf16_string_with_index_copy_from_stream(
+     void )
+{
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_index = 0;
+	size_t string_index       = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	utf16_string_index = 1;
+
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 21 );
+
+	for( string_index = 0;
+	     string_index < 19;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "utf16_string[ string_index + 1 ]",
+		 (int) utf16_string[ string_index + 1 ],
+		 (int) fvalue_test_ascii_string[ string_index ] );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "utf16_string[ 20 ]",
+	 (int) utf16_string[ 20 ],
+	 0 );
+
+	/* Test streams that cannot be converted as ASCII
+	 */
+	utf16_string_index = 0;
+
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          fvalue_test_ascii_non_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 0 );
+
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          utf16_string,
+	          19,
+	          &utf16_string_index,
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          NULL,
+	          32,
+	          &utf16_string_index,
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          utf16_string,
+	          32,
+	          NULL,
+	          (uint8_t *) fvalue_test_ascii_string,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf16_string_with_index_copy_from_stream(
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          NULL,
+	          19,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_ascii_utf32_string_with_index_copy_from_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_utf32_string_with_index_copy_from_stream(
+     void )
+{
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf32_string_index = 0;
+	size_t string_index       = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	utf32_string_index = 1;
+
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          fvalue_test_ascii_utf16be_stream,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 21 );
+
+	for( string_index = 0;
+	     string_index < 19;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "utf32_string[ string_index + 1 ]",
+		 (int) utf32_string[ string_index + 1 ],
+		 (int) fvalue_test_ascii_string[ string_index ] );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "utf32_string[ 20 ]",
+	 (int) utf32_string[ 20 ],
+	 0 );
+
+	/* Test streams that cannot be converted as ASCII
+	 */
+	utf32_string_index = 0;
+
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          fvalue_test_ascii_non_ascii_utf16le_stream,
+	          40,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          utf32_string,
+	          19,
+	          &utf32_string_index,
+	          fvalue_test_ascii_utf16be_stream,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          NULL,
+	          32,
+	          &utf32_string_index,
+	          fvalue_test_ascii_utf16be_stream,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          utf32_string,
+	          32,
+	          NULL,
+	          fvalue_test_ascii_utf16be_stream,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_utf32_string_with_index_copy_from_stream(
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          NULL,
+	          38,
+	          LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_ascii_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_copy_to_string(
+     void )
+{
+	uint16_t utf16_string[ 32 ];
+	uint32_t utf32_string[ 32 ];
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_ascii_copy_to_string(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          20,
+	          utf8_string,
+	          1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          fvalue_test_ascii_string,
+	          20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_ascii_copy_to_string(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          20,
+	          (uint8_t *) utf16_string,
+	          2,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( string_index = 0;
+	     string_index < 20;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "utf16_string[ string_index ]",
+		 (int) utf16_string[ string_index ],
+		 (int) fvalue_test_ascii_string[ string_index ] );
+	}
+	result = libfvalue_ascii_copy_to_string(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          20,
+	          (uint8_t *) utf32_string,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( string_index = 0;
+	     string_index < 20;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "utf32_string[ string_index ]",
+		 (int) utf32_string[ string_index ],
+		 (int) fvalue_test_ascii_string[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_copy_to_string(
+	          NULL,
+	          20,
+	          (uint8_t *) utf16_string,
+	          2,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_copy_to_string(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          20,
+	          NULL,
+	          2,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_copy_to_string(
+	          (uint8_t *) fvalue_test_ascii_string,
+	          20,
+	          (uint8_t *) utf16_string,
+	          3,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_ascii_copy_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_ascii_copy_from_string(
+     void )
+{
+	uint16_t utf16_string[ 32 ];
+	uint32_t utf32_string[ 32 ];
+	uint8_t ascii_characters[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	for( string_index = 0;
+	     string_index < 20;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) fvalue_test_ascii_string[ string_index ];
+		utf32_string[ string_index ] = (uint32_t) fvalue_test_ascii_string[ string_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          (uint8_t *) utf16_string,
+	          2,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ascii_characters,
+	          fvalue_test_ascii_string,
+	          20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          (uint8_t *) utf32_string,
+	          4,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ascii_characters,
+	          fvalue_test_ascii_string,
+	          20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test characters outside the ASCII range
+	 */
+	utf16_string[ 7 ]  = 0x00e4;
+	utf32_string[ 17 ] = 0x00010000UL;
+
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          (uint8_t *) utf16_string,
+	          2,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "ascii_characters[ 7 ]",
+	 ascii_characters[ 7 ],
+	 0xff );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "ascii_characters[ 8 ]",
+	 ascii_characters[ 8 ],
+	 (uint8_t) 'S' );
+
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          (uint8_t *) utf32_string,
+	          4,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "ascii_characters[ 17 ]",
+	 ascii_characters[ 17 ],
+	 0xff );
+
+	/* Test error cases
+	 */
+	result = libfvalue_ascii_copy_from_string(
+	          NULL,
+	          (uint8_t *) utf16_string,
+	          2,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          NULL,
+	          2,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_ascii_copy_from_string(
+	          ascii_characters,
+	          (uint8_t *) utf16_string,
+	          3,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_string_size_from_stream",
+	 fvalue_test_ascii_string_size_from_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_utf8_string_with_index_copy_from_stream",
+	 fvalue_test_ascii_utf8_string_with_index_copy_from_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_utf16_string_with_index_copy_from_stream",
+	 fvalue_test_ascii_utf16_string_with_index_copy_from_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_utf32_string_with_index_copy_from_stream",
+	 fvalue_test_ascii_utf32_string_with_index_copy_from_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_copy_to_string",
+	 fvalue_test_ascii_copy_to_string );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_ascii_copy_from_string",
+	 fvalue_test_ascii_copy_from_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,966 @@
+/*
+ * Library base16 functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_base16.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* The byte stream is larger than a single vector block to test
+ * both the vectorized and the remaining bytes conversion
+ */
+uint8_t fvalue_test_base16_byte_stream[ 20 ] = {
+	0x00, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x10, 0x32, 0x54, 0x76, 0x98, 0xba, 0xdc,
+	0xfe, 0xff, 0x5a, 0xa5 };
+
+char *fvalue_test_base16_lower_case_string = "000123456789abcdef1032547698badcfeff5aa5";
+
+char *fvalue_test_base16_upper_case_string = "000123456789ABCDEF1032547698BADCFEFF5AA5";
+
+/* Tests the libfvalue_base16_utf8_string_with_index_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base16_utf8_string_with_index_copy_from_byte_stream(
+     void )
+{
+	uint8_t utf8_string[ 48 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 1;
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          48,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 41 );
+
+	result = memory_compare(
+	          &( utf8_string[ 1 ] ),
+	          fvalue_test_base16_lower_case_string,
+	          40 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          48,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_UPPER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 40 );
+
+	result = memory_compare(
+	          utf8_string,
+	          fvalue_test_base16_upper_case_string,
+	          40 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          NULL,
+	          48,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          48,
+	          NULL,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          48,
+	          &utf8_string_index,
+	          NULL,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          48,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          0xff,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf8_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          39,
+	          &utf8_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_base16_utf16_string_with_index_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base16_utf16_string_with_index_copy_from_byte_stream(
+     void )
+{
+	uint16_t utf16_string[ 48 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t string_index       = 0;
+	size_t utf16_string_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	utf16_string_index = 1;
+
+	result = libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+	          utf16_string,
+	          48,
+	          &utf16_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_UPPER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 41 );
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf16_string[ string_index + 1 ]",
+		 (uint32_t) utf16_string[ string_index + 1 ],
+		 (uint32_t) fvalue_test_base16_upper_case_string[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	utf16_string_index = 0;
+
+	result = libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+	          NULL,
+	          48,
+	          &utf16_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+	          utf16_string,
+	          48,
+	          NULL,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+	          utf16_string,
+	          48,
+	          &utf16_string_index,
+	          NULL,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf16_string_with_index_copy_from_byte_stream(
+	          utf16_string,
+	          39,
+	          &utf16_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_base16_utf32_string_with_index_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base16_utf32_string_with_index_copy_from_byte_stream(
+     void )
+{
+	uint32_t utf32_string[ 48 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t string_index       = 0;
+	size_t utf32_string_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	utf32_string_index = 1;
+
+	result = libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+	          utf32_string,
+	          48,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_UPPER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 41 );
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf32_string[ string_index + 1 ]",
+		 (uint32_t) utf32_string[ string_index + 1 ],
+		 (uint32_t) fvalue_test_base16_upper_case_string[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	utf32_string_index = 0;
+
+	result = libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+	          NULL,
+	          48,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+	          utf32_string,
+	          48,
+	          NULL,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+	          utf32_string,
+	          48,
+	          &utf32_string_index,
+	          NULL,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_utf32_string_with_index_copy_from_byte_stream(
+	          utf32_string,
+	          39,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_base16_copy_to_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base16_copy_to_integer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t integer_value   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "0123456789abcdef",
+	          16,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0x0123456789abcdefULL );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "FEDCBA9876543210",
+	          16,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0xfedcba9876543210ULL );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "fF0",
+	          3,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0x0ff0UL );
+
+	/* Test error cases
+	 */
+	result = libfvalue_base16_copy_to_integer(
+	          NULL,
+	          16,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "0123456789abcdef",
+	          0,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "0123456789abcdef0",
+	          17,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "0123456789abcdef",
+	          16,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test invalid characters
+	 */
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "12g4",
+	          4,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "123456789abcde:",
+	          15,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_copy_to_integer(
+	          (uint8_t *) "12\xb4",
+	          3,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_base16_string_with_index_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base16_string_with_index_copy_from_byte_stream(
+     void )
+{
+	uint32_t utf32_string[ 48 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t string_index       = 0;
+	size_t utf32_string_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	utf32_string_index = 1;
+
+	result = libfvalue_base16_string_with_index_copy_from_byte_stream(
+	          (uint8_t *) utf32_string,
+	          4,
+	          48,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 41 );
+
+	for( string_index = 0;
+	     string_index < 40;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf32_string[ string_index + 1 ]",
+		 utf32_string[ string_index + 1 ],
+		 (uint32_t) fvalue_test_base16_lower_case_string[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	utf32_string_index = 0;
+
+	result = libfvalue_base16_string_with_index_copy_from_byte_stream(
+	          NULL,
+	          4,
+	          48,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_string_with_index_copy_from_byte_stream(
+	          (uint8_t *) utf32_string,
+	          3,
+	          48,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base16_string_with_index_copy_from_byte_stream(
+	          (uint8_t *) utf32_string,
+	          4,
+	          39,
+	          &utf32_string_index,
+	          fvalue_test_base16_byte_stream,
+	          20,
+	          LIBFVALUE_BASE16_CASE_LOWER,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base16_utf8_string_with_index_copy_from_byte_stream",
+	 fvalue_test_base16_utf8_string_with_index_copy_from_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base16_utf16_string_with_index_copy_from_byte_stream",
+	 fvalue_test_base16_utf16_string_with_index_copy_from_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base16_utf32_string_with_index_copy_from_byte_stream",
+	 fvalue_test_base16_utf32_string_with_index_copy_from_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base16_copy_to_integer",
+	 fvalue_test_base16_copy_to_integer );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base16_string_with_index_copy_from_byte_stream",
+	 fvalue_test_base16_string_with_index_copy_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+}
+
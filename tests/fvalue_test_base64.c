@@ -0,0 +1,506 @@
+/*
+ * Library base64 functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_base64.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* The byte stream is larger than the vector blocks to test both
+ * the vectorized and the remaining bytes conversion
+ */
+uint8_t fvalue_test_base64_byte_stream[ 64 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
+char *fvalue_test_base64_string = "AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDEyMzQ1Njc4OTo7PD0+Pw==";
+
+/* The test vectors from RFC 4648 for the prefixes of "foobar"
+ */
+char *fvalue_test_base64_rfc4648_strings[ 7 ] = {
+	"",
+	"Zg==",
+	"Zm8=",
+	"Zm9v",
+	"Zm9vYg==",
+	"Zm9vYmE=",
+	"Zm9vYmFy" };
+
+/* Tests the libfvalue_base64_string_size_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base64_string_size_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int byte_stream_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( byte_stream_size = 0;
+	     byte_stream_size < 7;
+	     byte_stream_size++ )
+	{
+		result = libfvalue_base64_string_size_from_byte_stream(
+		          (size_t) byte_stream_size,
+		          &string_size,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "string_size",
+		 string_size,
+		 (size_t) narrow_string_length( fvalue_test_base64_rfc4648_strings[ byte_stream_size ] ) );
+	}
+	result = libfvalue_base64_string_size_from_byte_stream(
+	          64,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 88 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_base64_string_size_from_byte_stream(
+	          (size_t) SSIZE_MAX,
+	          &string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_size_from_byte_stream(
+	          64,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_base64_string_with_index_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_base64_string_with_index_copy_from_byte_stream(
+     void )
+{
+	uint8_t utf8_string[ 96 ];
+	uint16_t utf16_string[ 96 ];
+	uint32_t utf32_string[ 96 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t string_index       = 0;
+	size_t utf8_string_index  = 0;
+	size_t utf16_string_index = 0;
+	size_t utf32_string_index = 0;
+	int byte_stream_size      = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	for( byte_stream_size = 0;
+	     byte_stream_size < 7;
+	     byte_stream_size++ )
+	{
+		utf8_string_index = 0;
+
+		result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+		          utf8_string,
+		          1,
+		          96,
+		          &utf8_string_index,
+		          (uint8_t *) "foobar",
+		          (size_t) byte_stream_size,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_index",
+		 utf8_string_index,
+		 (size_t) narrow_string_length( fvalue_test_base64_rfc4648_strings[ byte_stream_size ] ) );
+
+		result = memory_compare(
+		          utf8_string,
+		          fvalue_test_base64_rfc4648_strings[ byte_stream_size ],
+		          utf8_string_index );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	utf8_string_index = 1;
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          1,
+	          96,
+	          &utf8_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 89 );
+
+	result = memory_compare(
+	          &( utf8_string[ 1 ] ),
+	          fvalue_test_base64_string,
+	          88 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf16_string_index = 1;
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          (uint8_t *) utf16_string,
+	          2,
+	          96,
+	          &utf16_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 89 );
+
+	for( string_index = 0;
+	     string_index < 88;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf16_string[ string_index + 1 ]",
+		 (uint32_t) utf16_string[ string_index + 1 ],
+		 (uint32_t) fvalue_test_base64_string[ string_index ] );
+	}
+	utf32_string_index = 1;
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          (uint8_t *) utf32_string,
+	          4,
+	          96,
+	          &utf32_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 89 );
+
+	for( string_index = 0;
+	     string_index < 88;
+	     string_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf32_string[ string_index + 1 ]",
+		 utf32_string[ string_index + 1 ],
+		 (uint32_t) fvalue_test_base64_string[ string_index ] );
+	}
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          NULL,
+	          1,
+	          96,
+	          &utf8_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          3,
+	          96,
+	          &utf8_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          1,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          1,
+	          96,
+	          NULL,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          1,
+	          96,
+	          &utf8_string_index,
+	          NULL,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_base64_string_with_index_copy_from_byte_stream(
+	          utf8_string,
+	          1,
+	          87,
+	          &utf8_string_index,
+	          fvalue_test_base64_byte_stream,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base64_string_size_from_byte_stream",
+	 fvalue_test_base64_string_size_from_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_base64_string_with_index_copy_from_byte_stream",
+	 fvalue_test_base64_string_with_index_copy_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+}
+
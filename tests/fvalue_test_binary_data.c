@@ -698,15 +698,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_binary_data_get_utf8_string_size function
+/* Tests the libfvalue_binary_data_copy_to_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_binary_data_get_utf8_string_size(
+int fvalue_test_binary_data_copy_to_byte_stream(
      void )
 {
+	uint8_t byte_stream[ 16 ];
+
 	libcerror_error_t *error             = NULL;
 	libfvalue_binary_data_t *binary_data = NULL;
-	size_t utf8_string_size              = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -728,9 +729,11 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libfvalue_binary_data_copy_from_byte_stream(
 	          binary_data,
-	          (uint8_t *) "test",
+	          (uint8_t *) "\x01\x02\x03\x04",
 	          4,
 	          0,
 	          &error );
@@ -744,12 +747,11 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfvalue_binary_data_get_utf8_string_size(
+	result = libfvalue_binary_data_copy_to_byte_stream(
 	          binary_data,
-	          &utf8_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          byte_stream,
+	          16,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -757,61 +759,46 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 9 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_binary_data_get_utf8_string_size(
-	          binary_data,
-	          &utf8_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
-	          &error );
+	result = memory_compare(
+	          byte_stream,
+	          "\x01\x02\x03\x04",
+	          4 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 9 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libfvalue_binary_data_get_utf8_string_size(
-	          binary_data,
-	          &utf8_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          16,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
-	 (size_t) 9 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfvalue_binary_data_get_utf8_string_size(
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_copy_to_byte_stream(
+	          binary_data,
 	          NULL,
-	          &utf8_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          16,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -826,10 +813,11 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf8_string_size(
+	result = libfvalue_binary_data_copy_to_byte_stream(
 	          binary_data,
-	          NULL,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -844,10 +832,11 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf8_string_size(
+	result = libfvalue_binary_data_copy_to_byte_stream(
 	          binary_data,
-	          &utf8_string_size,
-	          0xffffff00UL,
+	          byte_stream,
+	          16,
+	          -1,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -862,10 +851,11 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf8_string_size(
+	result = libfvalue_binary_data_copy_to_byte_stream(
 	          binary_data,
-	          &utf8_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          byte_stream,
+	          2,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -880,12 +870,6 @@ int fvalue_test_binary_data_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	/* TODO test with libuna_base16_stream_size_from_byte_stream failing */
-
-	/* TODO test with libuna_base32_stream_size_from_byte_stream failing */
-
-	/* TODO test with libuna_base64_stream_size_from_byte_stream failing */
-
 	/* Clean up
 	 */
 	result = libfvalue_binary_data_free(
@@ -922,23 +906,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_binary_data_copy_to_utf8_string_with_index function
+/* Tests the libfvalue_binary_data_get_byte_stream_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_binary_data_copy_to_utf8_string_with_index(
+int fvalue_test_binary_data_get_byte_stream_size(
      void )
 {
-	uint8_t expected_utf8_string_base16[ 9 ] = {
-		'7', '4', '6', '5', '7', '3', '7', '4', 0 };
-	uint8_t expected_utf8_string_base32[ 9 ] = {
-		'O', 'R', 'S', 'X', 'G', '5', 'A', '=', 0 };
-	uint8_t expected_utf8_string_base64[ 9 ] = {
-		'd', 'G', 'V', 'z', 'd', 'A', '=', '=', 0 };
-	uint8_t utf8_string[ 32 ];
-
 	libcerror_error_t *error             = NULL;
 	libfvalue_binary_data_t *binary_data = NULL;
-	size_t utf8_string_index             = 0;
+	size_t byte_stream_size              = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -960,9 +936,11 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libfvalue_binary_data_copy_from_byte_stream(
 	          binary_data,
-	          (uint8_t *) "test",
+	          (uint8_t *) "\x01\x02\x03\x04",
 	          4,
 	          0,
 	          &error );
@@ -976,16 +954,10 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	utf8_string_index = 0;
-
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	result = libfvalue_binary_data_get_byte_stream_size(
 	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &byte_stream_size,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -994,66 +966,56 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 9 );
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 4 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf8_string,
-	          expected_utf8_string_base16,
-	          sizeof( uint8_t ) * 9 );
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          0,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	utf8_string_index = 0;
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_byte_stream_size(
 	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
+	          NULL,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 9 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf8_string,
-	          expected_utf8_string_base32,
-	          sizeof( uint8_t ) * 9 );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	utf8_string_index = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
-	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	/* Clean up
+	 */
+	result = libfvalue_binary_data_free(
+	          &binary_data,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1061,104 +1023,144 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 9 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "binary_data",
+	 binary_data );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf8_string,
-	          expected_utf8_string_base64,
-	          sizeof( uint8_t ) * 9 );
+	return( 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( binary_data != NULL )
+	{
+		libfvalue_binary_data_free(
+		 &binary_data,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	/* Test error cases
-	 */
-	utf8_string_index = 0;
+/* Tests the libfvalue_binary_data_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_binary_data_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvalue_binary_data_t *binary_data = NULL;
+	size_t utf8_string_size              = 0;
+	int result                           = 0;
 
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
-	          NULL,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	/* Initialize test
+	 */
+	result = libfvalue_binary_data_initialize(
+	          &binary_data,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 0 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	result = libfvalue_binary_data_copy_from_byte_stream(
 	          binary_data,
-	          NULL,
-	          32,
-	          &utf8_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          (uint8_t *) "test",
+	          4,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	/* Test regular cases
+	 */
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          binary_data,
-	          utf8_string,
-	          (size_t) SSIZE_MAX + 1,
-	          &utf8_string_index,
+	          &utf8_string_size,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 0 );
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfvalue_binary_data_get_utf8_string_size(
+	          binary_data,
+	          &utf8_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
+	          &error );
 
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          binary_data,
-	          utf8_string,
-	          32,
+	          &utf8_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          NULL,
+	          &utf8_string_size,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1167,11 +1169,6 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1179,13 +1176,9 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	utf8_string_index = 32;
-
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
+	          NULL,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1194,11 +1187,6 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 32 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1206,15 +1194,9 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	utf8_string_index = 0;
-
-	/* Unsupported flags
-	 */
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
+	          &utf8_string_size,
 	          0xffffff00UL,
 	          &error );
 
@@ -1223,11 +1205,6 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1235,13 +1212,9 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Unsupported encoding
-	 */
-	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	result = libfvalue_binary_data_get_utf8_string_size(
 	          binary_data,
-	          utf8_string,
-	          32,
-	          &utf8_string_index,
+	          &utf8_string_size,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
 	          &error );
 
@@ -1250,11 +1223,6 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_index",
-	 utf8_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1262,11 +1230,11 @@ int fvalue_test_binary_data_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* TODO test with libuna_base16_stream_with_index_copy_from_byte_stream failing */
+	/* TODO test with libuna_base16_stream_size_from_byte_stream failing */
 
-	/* TODO test with libuna_base32_stream_with_index_copy_from_byte_stream failing */
+	/* TODO test with libuna_base32_stream_size_from_byte_stream failing */
 
-	/* TODO test with libuna_base64_stream_with_index_copy_from_byte_stream failing */
+	/* TODO test with libuna_base64_stream_size_from_byte_stream failing */
 
 	/* Clean up
 	 */
@@ -1304,15 +1272,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_binary_data_get_utf16_string_size function
+/* Tests the libfvalue_binary_data_copy_to_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_binary_data_get_utf16_string_size(
+int fvalue_test_binary_data_copy_to_utf8_string_with_index(
      void )
 {
+	uint8_t expected_utf8_string_base16[ 9 ] = {
+		'7', '4', '6', '5', '7', '3', '7', '4', 0 };
+	uint8_t expected_utf8_string_base32[ 9 ] = {
+		'O', 'R', 'S', 'X', 'G', '5', 'A', '=', 0 };
+	uint8_t expected_utf8_string_base64[ 9 ] = {
+		'd', 'G', 'V', 'z', 'd', 'A', '=', '=', 0 };
+	uint8_t utf8_string[ 32 ];
+
 	libcerror_error_t *error             = NULL;
 	libfvalue_binary_data_t *binary_data = NULL;
-	size_t utf16_string_size             = 0;
+	size_t utf8_string_index             = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -1352,9 +1328,13 @@ int fvalue_test_binary_data_get_utf16_string_size(
 
 	/* Test regular cases
 	 */
-	result = libfvalue_binary_data_get_utf16_string_size(
+	utf8_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
-	          &utf16_string_size,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1364,17 +1344,31 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
+	 "utf8_string_index",
+	 utf8_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_binary_data_get_utf16_string_size(
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string_base16,
+	          sizeof( uint8_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
-	          &utf16_string_size,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
 	          &error );
 
@@ -1384,17 +1378,31 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
+	 "utf8_string_index",
+	 utf8_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_binary_data_get_utf16_string_size(
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string_base32,
+	          sizeof( uint8_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
-	          &utf16_string_size,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
@@ -1404,21 +1412,33 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
+	 "utf8_string_index",
+	 utf8_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* TODO test with big endian byte order */
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string_base64,
+	          sizeof( uint8_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libfvalue_binary_data_get_utf16_string_size(
+	utf8_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          NULL,
-	          &utf16_string_size,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1427,6 +1447,11 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1434,9 +1459,11 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf16_string_size(
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
 	          NULL,
+	          32,
+	          &utf8_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1452,10 +1479,12 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf16_string_size(
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
-	          &utf16_string_size,
-	          0xffffff00UL,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1463,6 +1492,11 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1470,10 +1504,12 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf16_string_size(
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
 	          binary_data,
-	          &utf16_string_size,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          utf8_string,
+	          32,
+	          NULL,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1481,6 +1517,11 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1488,28 +1529,337 @@ int fvalue_test_binary_data_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	/* TODO test with unsupported byte order */
-
-	/* TODO test with libuna_base16_stream_size_from_byte_stream failing */
-
-	/* TODO test with libuna_base32_stream_size_from_byte_stream failing */
-
-	/* TODO test with libuna_base64_stream_size_from_byte_stream failing */
+	utf8_string_index = 32;
 
-	/* Clean up
-	 */
-	result = libfvalue_binary_data_free(
-	          &binary_data,
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	          binary_data,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "binary_data",
-	 binary_data );
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 32 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 0;
+
+	/* Unsupported flags
+	 */
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	          binary_data,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          0xffffff00UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Unsupported encoding
+	 */
+	result = libfvalue_binary_data_copy_to_utf8_string_with_index(
+	          binary_data,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* TODO test with libuna_base16_stream_with_index_copy_from_byte_stream failing */
+
+	/* TODO test with libuna_base32_stream_with_index_copy_from_byte_stream failing */
+
+	/* TODO test with libuna_base64_stream_with_index_copy_from_byte_stream failing */
+
+	/* Clean up
+	 */
+	result = libfvalue_binary_data_free(
+	          &binary_data,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( binary_data != NULL )
+	{
+		libfvalue_binary_data_free(
+		 &binary_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_binary_data_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_binary_data_get_utf16_string_size(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvalue_binary_data_t *binary_data = NULL;
+	size_t utf16_string_size             = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_binary_data_initialize(
+	          &binary_data,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_copy_from_byte_stream(
+	          binary_data,
+	          (uint8_t *) "test",
+	          4,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          &utf16_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          &utf16_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          &utf16_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* TODO test with big endian byte order */
+
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          NULL,
+	          &utf16_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          NULL,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          &utf16_string_size,
+	          0xffffff00UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_utf16_string_size(
+	          binary_data,
+	          &utf16_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* TODO test with unsupported byte order */
+
+	/* TODO test with libuna_base16_stream_size_from_byte_stream failing */
+
+	/* TODO test with libuna_base32_stream_size_from_byte_stream failing */
+
+	/* TODO test with libuna_base64_stream_size_from_byte_stream failing */
+
+	/* Clean up
+	 */
+	result = libfvalue_binary_data_free(
+	          &binary_data,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "binary_data",
+	 binary_data );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1764,11 +2114,263 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
-	          binary_data,
-	          utf16_string,
-	          32,
+	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	          binary_data,
+	          utf16_string,
+	          32,
+	          NULL,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf16_string_index = 32;
+
+	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	          binary_data,
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 32 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf16_string_index = 0;
+
+	/* Unsupported flags
+	 */
+	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	          binary_data,
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          0xffffff00UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Unsupported encoding
+	 */
+	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	          binary_data,
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_binary_data_free(
+	          &binary_data,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( binary_data != NULL )
+	{
+		libfvalue_binary_data_free(
+		 &binary_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_binary_data_get_utf32_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_binary_data_get_utf32_string_size(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvalue_binary_data_t *binary_data = NULL;
+	size_t utf32_string_size             = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_binary_data_initialize(
+	          &binary_data,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_copy_from_byte_stream(
+	          binary_data,
+	          (uint8_t *) "test",
+	          4,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_binary_data_get_utf32_string_size(
+	          binary_data,
+	          &utf32_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_size",
+	 utf32_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_get_utf32_string_size(
+	          binary_data,
+	          &utf32_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_size",
+	 utf32_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_binary_data_get_utf32_string_size(
+	          binary_data,
+	          &utf32_string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_size",
+	 utf32_string_size,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_get_utf32_string_size(
 	          NULL,
+	          &utf32_string_size,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1777,11 +2379,6 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_index",
-	 utf16_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1789,13 +2386,9 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	utf16_string_index = 32;
-
-	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	result = libfvalue_binary_data_get_utf32_string_size(
 	          binary_data,
-	          utf16_string,
-	          32,
-	          &utf16_string_index,
+	          NULL,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1804,11 +2397,6 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_index",
-	 utf16_string_index,
-	 (size_t) 32 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1816,15 +2404,9 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	utf16_string_index = 0;
-
-	/* Unsupported flags
-	 */
-	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	result = libfvalue_binary_data_get_utf32_string_size(
 	          binary_data,
-	          utf16_string,
-	          32,
-	          &utf16_string_index,
+	          &utf32_string_size,
 	          0xffffff00UL,
 	          &error );
 
@@ -1833,11 +2415,6 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_index",
-	 utf16_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1845,13 +2422,9 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Unsupported encoding
-	 */
-	result = libfvalue_binary_data_copy_to_utf16_string_with_index(
+	result = libfvalue_binary_data_get_utf32_string_size(
 	          binary_data,
-	          utf16_string,
-	          32,
-	          &utf16_string_index,
+	          &utf32_string_size,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
 	          &error );
 
@@ -1860,11 +2433,6 @@ int fvalue_test_binary_data_copy_to_utf16_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_index",
-	 utf16_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1908,15 +2476,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_binary_data_get_utf32_string_size function
+/* Tests the libfvalue_binary_data_copy_to_utf32_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_binary_data_get_utf32_string_size(
+int fvalue_test_binary_data_copy_to_utf32_string_with_index(
      void )
 {
+	uint32_t expected_utf32_string_base16[ 9 ] = {
+		'7', '4', '6', '5', '7', '3', '7', '4', 0 };
+	uint32_t expected_utf32_string_base32[ 9 ] = {
+		'O', 'R', 'S', 'X', 'G', '5', 'A', '=', 0 };
+	uint32_t expected_utf32_string_base64[ 9 ] = {
+		'd', 'G', 'V', 'z', 'd', 'A', '=', '=', 0 };
+	uint32_t utf32_string[ 32 ];
+
 	libcerror_error_t *error             = NULL;
 	libfvalue_binary_data_t *binary_data = NULL;
-	size_t utf32_string_size             = 0;
+	size_t utf32_string_index            = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -1956,9 +2532,13 @@ int fvalue_test_binary_data_get_utf32_string_size(
 
 	/* Test regular cases
 	 */
-	result = libfvalue_binary_data_get_utf32_string_size(
+	utf32_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
-	          &utf32_string_size,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -1968,17 +2548,31 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_size",
-	 utf32_string_size,
+	 "utf32_string_index",
+	 utf32_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_binary_data_get_utf32_string_size(
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string_base16,
+	          sizeof( uint32_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf32_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
-	          &utf32_string_size,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
 	          &error );
 
@@ -1988,17 +2582,31 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_size",
-	 utf32_string_size,
+	 "utf32_string_index",
+	 utf32_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_binary_data_get_utf32_string_size(
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string_base32,
+	          sizeof( uint32_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf32_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
-	          &utf32_string_size,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
@@ -2008,19 +2616,33 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_size",
-	 utf32_string_size,
+	 "utf32_string_index",
+	 utf32_string_index,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string_base64,
+	          sizeof( uint32_t ) * 9 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfvalue_binary_data_get_utf32_string_size(
+	utf32_string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          NULL,
-	          &utf32_string_size,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -2029,6 +2651,11 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2036,9 +2663,11 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf32_string_size(
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
 	          NULL,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
@@ -2054,9 +2683,92 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf32_string_size(
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
-	          &utf32_string_size,
+	          utf32_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf32_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	          binary_data,
+	          utf32_string,
+	          32,
+	          NULL,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf32_string_index = 32;
+
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	          binary_data,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 32 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf32_string_index = 0;
+
+	/* Unsupported flags
+	 */
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	          binary_data,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          0xffffff00UL,
 	          &error );
 
@@ -2065,6 +2777,11 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2072,9 +2789,13 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_binary_data_get_utf32_string_size(
+	/* Unsupported encoding
+	 */
+	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
 	          binary_data,
-	          &utf32_string_size,
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
 	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
 	          &error );
 
@@ -2083,6 +2804,11 @@ int fvalue_test_binary_data_get_utf32_string_size(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2126,23 +2852,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_binary_data_copy_to_utf32_string_with_index function
+/* Tests the libfvalue_binary_data_get_string_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_binary_data_copy_to_utf32_string_with_index(
+int fvalue_test_binary_data_get_string_size(
      void )
 {
-	uint32_t expected_utf32_string_base16[ 9 ] = {
-		'7', '4', '6', '5', '7', '3', '7', '4', 0 };
-	uint32_t expected_utf32_string_base32[ 9 ] = {
-		'O', 'R', 'S', 'X', 'G', '5', 'A', '=', 0 };
-	uint32_t expected_utf32_string_base64[ 9 ] = {
-		'd', 'G', 'V', 'z', 'd', 'A', '=', '=', 0 };
-	uint32_t utf32_string[ 32 ];
-
 	libcerror_error_t *error             = NULL;
 	libfvalue_binary_data_t *binary_data = NULL;
-	size_t utf32_string_index            = 0;
+	size_t string_size                   = 0;
 	int result                           = 0;
 
 	/* Initialize test
@@ -2182,14 +2900,11 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 
 	/* Test regular cases
 	 */
-	utf32_string_index = 0;
-
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_get_string_size(
 	          binary_data,
-	          utf32_string,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          4,
+	          &string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2198,32 +2913,19 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf32_string,
-	          expected_utf32_string_base16,
-	          sizeof( uint32_t ) * 9 );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	utf32_string_index = 0;
-
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_get_string_size(
 	          binary_data,
-	          utf32_string,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE32,
+	          2,
+	          &string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2232,165 +2934,207 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 9 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf32_string,
-	          expected_utf32_string_base32,
-	          sizeof( uint32_t ) * 9 );
+	/* Test error cases
+	 */
+	result = libfvalue_binary_data_get_string_size(
+	          NULL,
+	          4,
+	          &string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	utf32_string_index = 0;
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_string_size(
 	          binary_data,
-	          utf32_string,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
+	          3,
+	          &string_size,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 9 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf32_string,
-	          expected_utf32_string_base64,
-	          sizeof( uint32_t ) * 9 );
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_binary_data_get_string_size(
+	          binary_data,
+	          4,
+	          NULL,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	/* Test error cases
-	 */
-	utf32_string_index = 0;
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
-	          NULL,
-	          utf32_string,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_binary_data_free(
+	          &binary_data,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 0 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "binary_data",
+	 binary_data );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
 
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
-	          binary_data,
-	          NULL,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( binary_data != NULL )
+	{
+		libfvalue_binary_data_free(
+		 &binary_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_binary_data_copy_to_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_binary_data_copy_to_string_with_index(
+     void )
+{
+	uint32_t expected_utf32_string_base64[ 9 ] = {
+		'd', 'G', 'V', 'z', 'd', 'A', '=', '=', 0 };
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error             = NULL;
+	libfvalue_binary_data_t *binary_data = NULL;
+	size_t string_index                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_binary_data_initialize(
+	          &binary_data,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_data",
+	 binary_data );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_copy_from_byte_stream(
 	          binary_data,
-	          utf32_string,
-	          (size_t) SSIZE_MAX + 1,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          (uint8_t *) "test",
+	          4,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 0 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
+	string_index = 0;
 
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_copy_to_string_with_index(
 	          binary_data,
-	          utf32_string,
+	          (uint8_t *) utf32_string,
+	          4,
 	          32,
-	          NULL,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 0 );
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          utf32_string,
+	          expected_utf32_string_base64,
+	          sizeof( uint32_t ) * 9 );
 
-	utf32_string_index = 32;
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
-	          binary_data,
-	          utf32_string,
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_binary_data_copy_to_string_with_index(
+	          NULL,
+	          (uint8_t *) utf32_string,
+	          4,
 	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
+	          &string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2398,11 +3142,6 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 32 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2410,16 +3149,13 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	utf32_string_index = 0;
-
-	/* Unsupported flags
-	 */
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_copy_to_string_with_index(
 	          binary_data,
-	          utf32_string,
+	          (uint8_t *) utf32_string,
+	          3,
 	          32,
-	          &utf32_string_index,
-	          0xffffff00UL,
+	          &string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2427,11 +3163,6 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2439,14 +3170,15 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Unsupported encoding
+	/* Test a string that is too small for the end of string character
 	 */
-	result = libfvalue_binary_data_copy_to_utf32_string_with_index(
+	result = libfvalue_binary_data_copy_to_string_with_index(
 	          binary_data,
-	          utf32_string,
-	          32,
-	          &utf32_string_index,
-	          LIBFVALUE_BINARY_DATA_FORMAT_FLAG_CASE_UPPER | 0x000000ffUL,
+	          (uint8_t *) utf32_string,
+	          4,
+	          8,
+	          &string_index,
+	          LIBFVALUE_BINARY_DATA_FORMAT_TYPE_BASE16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2455,8 +3187,8 @@ int fvalue_test_binary_data_copy_to_utf32_string_with_index(
 	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "utf32_string_index",
-	 utf32_string_index,
+	 "string_index",
+	 string_index,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -2537,6 +3269,14 @@ int main(
 	 "libfvalue_binary_data_copy_from_byte_stream",
 	 fvalue_test_binary_data_copy_from_byte_stream );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_binary_data_copy_to_byte_stream",
+	 fvalue_test_binary_data_copy_to_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_binary_data_get_byte_stream_size",
+	 fvalue_test_binary_data_get_byte_stream_size );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_binary_data_get_utf8_string_size",
 	 fvalue_test_binary_data_get_utf8_string_size );
@@ -2561,6 +3301,14 @@ int main(
 	 "libfvalue_binary_data_copy_to_utf32_string_with_index",
 	 fvalue_test_binary_data_copy_to_utf32_string_with_index );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_binary_data_get_string_size",
+	 fvalue_test_binary_data_get_string_size );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_binary_data_copy_to_string_with_index",
+	 fvalue_test_binary_data_copy_to_string_with_index );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
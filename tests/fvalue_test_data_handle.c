@@ -1503,6 +1503,157 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* Tests the libfvalue_data_handle_is_data_managed function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_data_handle_is_data_managed(
+     void )
+{
+	uint8_t data[ 4 ]                    = { 't', 'e', 's', 't' };
+	libcerror_error_t *error             = NULL;
+	libfvalue_data_handle_t *data_handle = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_data_handle_initialize(
+	          &data_handle,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_data_handle_set_data(
+	          data_handle,
+	          data,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_is_data_managed(
+	          data_handle,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_set_data(
+	          data_handle,
+	          data,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_is_data_managed(
+	          data_handle,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_data_handle_is_data_managed(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
 /* Tests the libfvalue_data_handle_get_data_flags function
  * Returns 1 if successful or 0 if not
  */
@@ -3038,17 +3189,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_data_handle_set_value_entry_data function
+/* Tests the libfvalue_data_handle_get_value_entries_data function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_data_handle_set_value_entry_data(
+int fvalue_test_data_handle_get_value_entries_data(
      void )
 {
-	uint8_t data[ 32 ];
-
 	libcerror_error_t *error             = NULL;
 	libfvalue_data_handle_t *data_handle = NULL;
+	uint8_t *value_entries_data          = NULL;
+	size_t value_entry_data_size         = 0;
+	int encoding                         = 0;
 	int result                           = 0;
+	int value_entry_index                = 0;
 
 	/* Initialize test
 	 */
@@ -3072,12 +3225,13 @@ int fvalue_test_data_handle_set_value_entry_data(
 
 	/* Test error cases
 	 */
-	result = libfvalue_data_handle_set_value_entry_data(
+	result = libfvalue_data_handle_get_value_entries_data(
 	          data_handle,
 	          0,
-	          data,
-	          32,
-	          0,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3094,12 +3248,12 @@ int fvalue_test_data_handle_set_value_entry_data(
 
 	/* Initialize test
 	 */
-	result = libfvalue_data_handle_set_data(
+	result = libfvalue_data_handle_append_value_entry_data(
 	          data_handle,
-	          data,
-	          32,
-	          0,
-	          0,
+	          &value_entry_index,
+	          (uint8_t *) "\x01\x02\x03\x04",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3111,14 +3265,12 @@ int fvalue_test_data_handle_set_value_entry_data(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfvalue_data_handle_set_value_entry_data(
+	result = libfvalue_data_handle_append_value_entry_data(
 	          data_handle,
-	          0,
-	          data,
-	          32,
-	          0,
+	          &value_entry_index,
+	          (uint8_t *) "\x05\x06\x07\x08",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3130,106 +3282,519 @@ int fvalue_test_data_handle_set_value_entry_data(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfvalue_data_handle_set_value_entry_data(
-	          NULL,
-	          0,
-	          data,
-	          32,
-	          0,
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          (uint8_t *) "\x09\x0a\x0b\x0c",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_data_handle_set_value_entry_data(
+	result = libfvalue_data_handle_append_value_entry_data(
 	          data_handle,
-	          -1,
-	          data,
-	          32,
-	          0,
+	          &value_entry_index,
+	          (uint8_t *) "\x0d\x0e",
+	          2,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_data_handle_set_value_entry_data(
+	/* Test regular cases
+	 */
+	result = libfvalue_data_handle_get_value_entries_data(
 	          data_handle,
 	          0,
-	          NULL,
-	          32,
-	          0,
+	          3,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "value_entry_data_size",
+	 value_entry_data_size,
+	 (size_t) 4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "encoding",
+	 encoding,
+	 LIBFVALUE_ENDIAN_LITTLE );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          value_entries_data,
+	          "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c",
+	          12 );
 
-	result = libfvalue_data_handle_set_value_entry_data(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_data_handle_get_value_entries_data(
 	          data_handle,
-	          0,
-	          data,
-	          (size_t) SSIZE_MAX + 1,
-	          0,
+	          3,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "value_entry_data_size",
+	 value_entry_data_size,
+	 (size_t) 2 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_data_handle_set_value_entry_data(
+	result = libfvalue_data_handle_get_value_entries_data(
 	          data_handle,
-	          0,
-	          data,
-	          32,
-	          -1,
+	          1,
+	          3,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test value entry offset out of bounds
+	/* Test error cases
+	 */
+	result = libfvalue_data_handle_get_value_entries_data(
+	          NULL,
+	          0,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          -1,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          4,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          0,
+	          0,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          1,
+	          4,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          0,
+	          1,
+	          NULL,
+	          &value_entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          0,
+	          1,
+	          &value_entries_data,
+	          NULL,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_get_value_entries_data(
+	          data_handle,
+	          0,
+	          1,
+	          &value_entries_data,
+	          &value_entry_data_size,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_data_handle_set_value_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_data_handle_set_value_entry_data(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error             = NULL;
+	libfvalue_data_handle_t *data_handle = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_data_handle_initialize(
+	          &data_handle,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          0,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libfvalue_data_handle_set_data(
+	          data_handle,
+	          data,
+	          32,
+	          0,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          0,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_data_handle_set_value_entry_data(
+	          NULL,
+	          0,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          -1,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          0,
+	          NULL,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          0,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_set_value_entry_data(
+	          data_handle,
+	          0,
+	          data,
+	          32,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test value entry offset out of bounds
 	 */
 	result = libfvalue_data_handle_set_value_entry_data(
 	          data_handle,
@@ -3255,8 +3820,247 @@ int fvalue_test_data_handle_set_value_entry_data(
 	 */
 	result = libfvalue_data_handle_set_value_entry_data(
 	          data_handle,
-	          0,
-	          data + 16,
+	          0,
+	          data + 16,
+	          32,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_data_handle_append_value_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_data_handle_append_value_entry_data(
+     void )
+{
+	uint8_t data1[ 32 ];
+	uint8_t data2[ 32 ];
+	uint8_t data3[ 32 ];
+
+	libcerror_error_t *error             = NULL;
+	libfvalue_data_handle_t *data_handle = NULL;
+	int result                           = 0;
+	int value_entry_index                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_data_handle_initialize(
+	          &data_handle,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	value_entry_index = 0;
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          data1,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_entry_index = 0;
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          data2,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	value_entry_index = 0;
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          NULL,
+	          &value_entry_index,
+	          data3,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          NULL,
+	          data3,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          NULL,
+	          32,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          data3,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_append_value_entry_data(
+	          data_handle,
+	          &value_entry_index,
+	          data3,
 	          32,
 	          -1,
 	          &error );
@@ -3266,6 +4070,11 @@ int fvalue_test_data_handle_set_value_entry_data(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_entry_index",
+	 value_entry_index,
+	 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3309,20 +4118,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_data_handle_append_value_entry_data function
+/* Tests the libfvalue_data_handle_reserve function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_data_handle_append_value_entry_data(
+int fvalue_test_data_handle_reserve(
      void )
 {
-	uint8_t data1[ 32 ];
-	uint8_t data2[ 32 ];
-	uint8_t data3[ 32 ];
-
-	libcerror_error_t *error             = NULL;
-	libfvalue_data_handle_t *data_handle = NULL;
-	int result                           = 0;
-	int value_entry_index                = 0;
+	uint8_t entry_data[ 16 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfvalue_data_handle_t *clone_data_handle = NULL;
+	libfvalue_data_handle_t *data_handle       = NULL;
+	uint8_t *data                              = NULL;
+	uint8_t *reserved_data                     = NULL;
+	size_t data_size                           = 0;
+	size_t value_entry_offset                  = 0;
+	size_t value_entry_size                    = 0;
+	int encoding                               = 0;
+	int entry_index                            = 0;
+	int number_of_value_entries                = 0;
+	int result                                 = 0;
+	int value_entry_index                      = 0;
 
 	/* Initialize test
 	 */
@@ -3346,14 +4162,10 @@ int fvalue_test_data_handle_append_value_entry_data(
 
 	/* Test regular cases
 	 */
-	value_entry_index = 0;
-
-	result = libfvalue_data_handle_append_value_entry_data(
+	result = libfvalue_data_handle_reserve(
 	          data_handle,
-	          &value_entry_index,
-	          data1,
-	          32,
-	          0,
+	          64 * 16,
+	          64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3361,23 +4173,173 @@ int fvalue_test_data_handle_append_value_entry_data(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that appending within the reserved size does not move the data
+	 */
+	for( entry_index = 0;
+	     entry_index < 64;
+	     entry_index++ )
+	{
+		memory_set(
+		 entry_data,
+		 (uint8_t) entry_index,
+		 16 );
+
+		result = libfvalue_data_handle_append_value_entry_data(
+		          data_handle,
+		          &value_entry_index,
+		          entry_data,
+		          16,
+		          0,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "value_entry_index",
+		 value_entry_index,
+		 entry_index );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvalue_data_handle_get_data(
+		          data_handle,
+		          &data,
+		          &data_size,
+		          &encoding,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 (size_t) ( entry_index + 1 ) * 16 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index == 0 )
+		{
+			reserved_data = data;
+		}
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "data",
+		 (int) ( data == reserved_data ),
+		 1 );
+	}
+	/* Test that appending beyond the reserved size retains the value entries
+	 */
+	for( entry_index = 64;
+	     entry_index < 256;
+	     entry_index++ )
+	{
+		memory_set(
+		 entry_data,
+		 (uint8_t) entry_index,
+		 16 );
+
+		result = libfvalue_data_handle_append_value_entry_data(
+		          data_handle,
+		          &value_entry_index,
+		          entry_data,
+		          16,
+		          0,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "value_entry_index",
+		 value_entry_index,
+		 entry_index );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_data_handle_get_data(
+	          data_handle,
+	          &data,
+	          &data_size,
+	          &encoding,
+	          &error );
+
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 256 * 16 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	value_entry_index = 0;
+	for( entry_index = 0;
+	     entry_index < 256;
+	     entry_index++ )
+	{
+		result = libfvalue_data_handle_get_value_entry(
+		          data_handle,
+		          entry_index,
+		          &value_entry_offset,
+		          &value_entry_size,
+		          &error );
 
-	result = libfvalue_data_handle_append_value_entry_data(
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "value_entry_offset",
+		 value_entry_offset,
+		 (size_t) entry_index * 16 );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "value_entry_size",
+		 value_entry_size,
+		 (size_t) 16 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ value_entry_offset ]",
+		 data[ value_entry_offset ],
+		 (uint8_t) entry_index );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ value_entry_offset + 15 ]",
+		 data[ value_entry_offset + 15 ],
+		 (uint8_t) entry_index );
+	}
+	/* Test reserve on existing data
+	 */
+	result = libfvalue_data_handle_reserve(
 	          data_handle,
-	          &value_entry_index,
-	          data2,
-	          32,
-	          0,
+	          512 * 16,
+	          512,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3385,61 +4347,113 @@ int fvalue_test_data_handle_append_value_entry_data(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_get_data(
+	          data_handle,
+	          &data,
+	          &data_size,
+	          &encoding,
+	          &error );
+
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
+	 "result",
+	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 256 * 16 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 255 * 16 ]",
+	 data[ 255 * 16 ],
+	 (uint8_t) 255 );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test clone of the value entries
 	 */
-	value_entry_index = 0;
+	result = libfvalue_data_handle_clone(
+	          &clone_data_handle,
+	          data_handle,
+	          &error );
 
-	result = libfvalue_data_handle_append_value_entry_data(
-	          NULL,
-	          &value_entry_index,
-	          data3,
-	          32,
-	          0,
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "clone_data_handle",
+	 clone_data_handle );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_get_number_of_value_entries(
+	          clone_data_handle,
+	          &number_of_value_entries,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 256 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_data_handle_append_value_entry_data(
-	          data_handle,
-	          NULL,
-	          data3,
-	          32,
-	          0,
+	result = libfvalue_data_handle_get_value_entry_data(
+	          clone_data_handle,
+	          200,
+	          &data,
+	          &data_size,
+	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 16 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 200 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_data_handle_get_value_entry(
+	          clone_data_handle,
+	          256,
+	          &value_entry_offset,
+	          &value_entry_size,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
+	 "result",
+	 result,
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3448,34 +4462,43 @@ int fvalue_test_data_handle_append_value_entry_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_data_handle_append_value_entry_data(
-	          data_handle,
-	          &value_entry_index,
-	          NULL,
-	          32,
-	          0,
+	result = libfvalue_data_handle_free(
+	          &clone_data_handle,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_data_handle_reserve(
+	          NULL,
+	          64,
+	          1,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
+	 "result",
+	 result,
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_data_handle_append_value_entry_data(
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_reserve(
 	          data_handle,
-	          &value_entry_index,
-	          data3,
 	          (size_t) SSIZE_MAX + 1,
-	          0,
+	          1,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3483,20 +4506,16 @@ int fvalue_test_data_handle_append_value_entry_data(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfvalue_data_handle_append_value_entry_data(
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_data_handle_reserve(
 	          data_handle,
-	          &value_entry_index,
-	          data3,
-	          32,
+	          64,
 	          -1,
 	          &error );
 
@@ -3505,11 +4524,6 @@ int fvalue_test_data_handle_append_value_entry_data(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "value_entry_index",
-	 value_entry_index,
-	 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3544,6 +4558,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( clone_data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &clone_data_handle,
+		 NULL );
+	}
 	if( data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -3600,6 +4620,14 @@ int main(
 	 "libfvalue_data_handle_set_data_as_owned",
 	 fvalue_test_data_handle_set_data_as_owned );
 
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_data_handle_is_data_managed",
+	 fvalue_test_data_handle_is_data_managed );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_data_handle_get_data_flags",
 	 fvalue_test_data_handle_get_data_flags );
@@ -3628,6 +4656,10 @@ int main(
 	 "libfvalue_data_handle_get_value_entry_data",
 	 fvalue_test_data_handle_get_value_entry_data );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_data_handle_get_value_entries_data",
+	 fvalue_test_data_handle_get_value_entries_data );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_data_handle_set_value_entry_data",
 	 fvalue_test_data_handle_set_value_entry_data );
@@ -3636,6 +4668,10 @@ int main(
 	 "libfvalue_data_handle_append_value_entry_data",
 	 fvalue_test_data_handle_append_value_entry_data );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_data_handle_reserve",
+	 fvalue_test_data_handle_reserve );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -159,6 +160,383 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_filetime_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_filetime_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 8 ];
+
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_filetime_copy_from_integer(
+	          filetime,
+	          0x01d0e38b9c7c8000UL,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x00\x80\x7c\x9c\x8b\xe3\xd0\x01",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x01\xd0\xe3\x8b\x9c\x7c\x80\x00",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          NULL,
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          byte_stream,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_copy_to_byte_stream(
+	          filetime,
+	          byte_stream,
+	          8,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_filetime_get_byte_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_filetime_get_byte_stream_size(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfdatetime_filetime_t *filetime = NULL;
+	size_t byte_stream_size           = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfdatetime_filetime_initialize(
+	          &filetime,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime",
+	 filetime );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_filetime_get_byte_stream_size(
+	          filetime,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 8 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_filetime_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_get_byte_stream_size(
+	          filetime,
+	          NULL,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_filetime_get_byte_stream_size(
+	          filetime,
+	          &byte_stream_size,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdatetime_filetime_free(
+	          &filetime,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "filetime",
+	 filetime );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfvalue_filetime_copy_to_integer function
  * Returns 1 if successful or 0 if not
  */
@@ -372,6 +750,14 @@ int main(
 	 "libfvalue_filetime_copy_from_integer",
 	 fvalue_test_filetime_copy_from_integer );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_filetime_copy_to_byte_stream",
+	 fvalue_test_filetime_copy_to_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_filetime_get_byte_stream_size",
+	 fvalue_test_filetime_get_byte_stream_size );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_filetime_copy_to_integer",
 	 fvalue_test_filetime_copy_to_integer );
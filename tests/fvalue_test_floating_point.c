@@ -828,12 +828,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_from_integer function
+/* Tests the libfvalue_floating_point_copy_to_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_from_integer(
+int fvalue_test_floating_point_copy_to_byte_stream(
      void )
 {
+	uint8_t byte_stream[ 8 ];
+
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
 	int result                                 = 0;
@@ -859,10 +861,11 @@ int fvalue_test_floating_point_copy_from_integer(
 
 	/* Test regular cases
 	 */
-	result = libfvalue_floating_point_copy_from_integer(
+	result = libfvalue_floating_point_copy_from_byte_stream(
 	          floating_point,
-	          (uint64_t) 12,
-	          64,
+	          (uint8_t *) "\x3f\x80\x00\x00",
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -870,21 +873,85 @@ int fvalue_test_floating_point_copy_from_integer(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "floating_point->value",
-	 floating_point->value,
-	 (uint64_t) 0x4028000000000000UL );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_copy_to_byte_stream(
+	          floating_point,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x00\x00\x80\x3f",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_floating_point_copy_from_byte_stream(
+	          floating_point,
+	          (uint8_t *) "\x3f\xf0\x00\x00\x00\x00\x00\x00",
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = libfvalue_floating_point_copy_to_byte_stream(
+	          floating_point,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x3f\xf0\x00\x00\x00\x00\x00\x00",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfvalue_floating_point_copy_from_integer(
+	result = libfvalue_floating_point_copy_to_byte_stream(
 	          NULL,
-	          (uint64_t) 12,
-	          64,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -899,10 +966,68 @@ int fvalue_test_floating_point_copy_from_integer(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_from_integer(
+	result = libfvalue_floating_point_copy_to_byte_stream(
 	          floating_point,
-	          (uint64_t) 12,
+	          NULL,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_byte_stream(
+	          floating_point,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_byte_stream(
+	          floating_point,
+	          byte_stream,
 	          8,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_byte_stream(
+	          floating_point,
+	          byte_stream,
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -953,16 +1078,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_to_integer function
+/* Tests the libfvalue_floating_point_get_byte_stream_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_to_integer(
+int fvalue_test_floating_point_get_byte_stream_size(
      void )
 {
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
-	size_t integer_value_size                  = 0;
-	uint64_t integer_value                     = 0;
+	size_t byte_stream_size                    = 0;
 	int result                                 = 0;
 
 	/* Initialize test
@@ -984,18 +1108,13 @@ int fvalue_test_floating_point_copy_to_integer(
 	 "error",
 	 error );
 
-	floating_point->value      = (uint64_t) 0x4028ae147ae147aeUL;
-	floating_point->value_size = 64;
-
 	/* Test regular cases
 	 */
-	integer_value      = 0;
-	integer_value_size = 0;
-
-	result = libfvalue_floating_point_copy_to_integer(
+	result = libfvalue_floating_point_copy_from_byte_stream(
 	          floating_point,
-	          &integer_value,
-	          &integer_value_size,
+	          (uint8_t *) "\x3f\x80\x00\x00",
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1003,57 +1122,36 @@ int fvalue_test_floating_point_copy_to_integer(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 12 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 64 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	integer_value      = 0;
-	integer_value_size = 0;
-
-	result = libfvalue_floating_point_copy_to_integer(
-	          NULL,
-	          &integer_value,
-	          &integer_value_size,
+	result = libfvalue_floating_point_get_byte_stream_size(
+	          floating_point,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 4 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_floating_point_copy_to_integer(
-	          floating_point,
+	/* Test error cases
+	 */
+	result = libfvalue_floating_point_get_byte_stream_size(
 	          NULL,
-	          &integer_value_size,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1061,16 +1159,6 @@ int fvalue_test_floating_point_copy_to_integer(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1078,10 +1166,10 @@ int fvalue_test_floating_point_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_integer(
+	result = libfvalue_floating_point_get_byte_stream_size(
 	          floating_point,
-	          &integer_value,
 	          NULL,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1089,16 +1177,6 @@ int fvalue_test_floating_point_copy_to_integer(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1142,10 +1220,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_from_floating_point function
+/* Tests the libfvalue_floating_point_copy_from_integer function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_from_floating_point(
+int fvalue_test_floating_point_copy_from_integer(
      void )
 {
 	libcerror_error_t *error                   = NULL;
@@ -1173,9 +1251,9 @@ int fvalue_test_floating_point_copy_from_floating_point(
 
 	/* Test regular cases
 	 */
-	result = libfvalue_floating_point_copy_from_floating_point(
+	result = libfvalue_floating_point_copy_from_integer(
 	          floating_point,
-	          (double) 12.34,
+	          (uint64_t) 12,
 	          64,
 	          &error );
 
@@ -1187,7 +1265,7 @@ int fvalue_test_floating_point_copy_from_floating_point(
 	FVALUE_TEST_ASSERT_EQUAL_UINT64(
 	 "floating_point->value",
 	 floating_point->value,
-	 (uint64_t) 0x4028ae147ae147aeUL );
+	 (uint64_t) 0x4028000000000000UL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1195,9 +1273,9 @@ int fvalue_test_floating_point_copy_from_floating_point(
 
 	/* Test error cases
 	 */
-	result = libfvalue_floating_point_copy_from_floating_point(
+	result = libfvalue_floating_point_copy_from_integer(
 	          NULL,
-	          (double) 12.34,
+	          (uint64_t) 12,
 	          64,
 	          &error );
 
@@ -1213,9 +1291,9 @@ int fvalue_test_floating_point_copy_from_floating_point(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_from_floating_point(
+	result = libfvalue_floating_point_copy_from_integer(
 	          floating_point,
-	          (double) 12.34,
+	          (uint64_t) 12,
 	          8,
 	          &error );
 
@@ -1267,16 +1345,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_to_floating_point function
+/* Tests the libfvalue_floating_point_copy_to_integer function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_to_floating_point(
+int fvalue_test_floating_point_copy_to_integer(
      void )
 {
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
-	size_t floating_point_value_size           = 0;
-	double floating_point_value                = 0;
+	size_t integer_value_size                  = 0;
+	uint64_t integer_value                     = 0;
 	int result                                 = 0;
 
 	/* Initialize test
@@ -1303,13 +1381,13 @@ int fvalue_test_floating_point_copy_to_floating_point(
 
 	/* Test regular cases
 	 */
-	floating_point_value      = 0;
-	floating_point_value_size = 0;
+	integer_value      = 0;
+	integer_value_size = 0;
 
-	result = libfvalue_floating_point_copy_to_floating_point(
+	result = libfvalue_floating_point_copy_to_integer(
 	          floating_point,
-	          &floating_point_value,
-	          &floating_point_value_size,
+	          &integer_value,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1317,14 +1395,14 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
-	 "floating_point_value",
-	 floating_point_value,
-	 (double) 12.34 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 12 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "floating_point_value_size",
-	 floating_point_value_size,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 64 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
@@ -1333,13 +1411,13 @@ int fvalue_test_floating_point_copy_to_floating_point(
 
 	/* Test error cases
 	 */
-	floating_point_value      = 0;
-	floating_point_value_size = 0;
+	integer_value      = 0;
+	integer_value_size = 0;
 
-	result = libfvalue_floating_point_copy_to_floating_point(
+	result = libfvalue_floating_point_copy_to_integer(
 	          NULL,
-	          &floating_point_value,
-	          &floating_point_value_size,
+	          &integer_value,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1347,14 +1425,14 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
-	 "floating_point_value",
-	 floating_point_value,
-	 (double) 0.0 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "floating_point_value_size",
-	 floating_point_value_size,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1364,10 +1442,10 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_floating_point(
+	result = libfvalue_floating_point_copy_to_integer(
 	          floating_point,
 	          NULL,
-	          &floating_point_value_size,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1375,14 +1453,14 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
-	 "floating_point_value",
-	 floating_point_value,
-	 (double) 0.0 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "floating_point_value_size",
-	 floating_point_value_size,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1392,9 +1470,9 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_floating_point(
+	result = libfvalue_floating_point_copy_to_integer(
 	          floating_point,
-	          &floating_point_value,
+	          &integer_value,
 	          NULL,
 	          &error );
 
@@ -1403,14 +1481,14 @@ int fvalue_test_floating_point_copy_to_floating_point(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
-	 "floating_point_value",
-	 floating_point_value,
-	 (double) 0.0 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "floating_point_value_size",
-	 floating_point_value_size,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1456,15 +1534,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_get_string_size function
+/* Tests the libfvalue_floating_point_copy_from_floating_point function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_get_string_size(
+int fvalue_test_floating_point_copy_from_floating_point(
      void )
 {
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
-	size_t string_size                         = 0;
 	int result                                 = 0;
 
 	/* Initialize test
@@ -1486,6 +1563,8 @@ int fvalue_test_floating_point_get_string_size(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libfvalue_floating_point_copy_from_floating_point(
 	          floating_point,
 	          (double) 12.34,
@@ -1497,29 +1576,10 @@ int fvalue_test_floating_point_get_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
-	string_size = 0;
-
-	result = libfvalue_floating_point_get_string_size(
-	          floating_point,
-	          &string_size,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
-	          &error );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 19 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point->value",
+	 floating_point->value,
+	 (uint64_t) 0x4028ae147ae147aeUL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1527,12 +1587,10 @@ int fvalue_test_floating_point_get_string_size(
 
 	/* Test error cases
 	 */
-	string_size = 0;
-
-	result = libfvalue_floating_point_get_string_size(
+	result = libfvalue_floating_point_copy_from_floating_point(
 	          NULL,
-	          &string_size,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          (double) 12.34,
+	          64,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1540,11 +1598,6 @@ int fvalue_test_floating_point_get_string_size(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1552,10 +1605,10 @@ int fvalue_test_floating_point_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_get_string_size(
+	result = libfvalue_floating_point_copy_from_floating_point(
 	          floating_point,
-	          NULL,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          (double) 12.34,
+	          8,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1563,11 +1616,6 @@ int fvalue_test_floating_point_get_string_size(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1611,19 +1659,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_from_utf8_string_with_index function
+/* Tests the libfvalue_floating_point_copy_to_floating_point function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_from_utf8_string_with_index(
+int fvalue_test_floating_point_copy_to_floating_point(
      void )
 {
-	uint8_t utf8_string[ 19 ] = {
-		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
-		'0', '0', 0 };
-
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
-	size_t string_index                        = 0;
+	size_t floating_point_value_size           = 0;
+	double floating_point_value                = 0;
 	int result                                 = 0;
 
 	/* Initialize test
@@ -1645,11 +1690,18 @@ int fvalue_test_floating_point_copy_from_utf8_string_with_index(
 	 "error",
 	 error );
 
-	result = libfvalue_floating_point_copy_from_byte_stream(
+	floating_point->value      = (uint64_t) 0x4028ae147ae147aeUL;
+	floating_point->value_size = 64;
+
+	/* Test regular cases
+	 */
+	floating_point_value      = 0;
+	floating_point_value_size = 0;
+
+	result = libfvalue_floating_point_copy_to_floating_point(
 	          floating_point,
-	          (uint8_t *) "\x40\x28\x00\x00\x00\x00\x00\x00",
-	          8,
-	          LIBFVALUE_ENDIAN_BIG,
+	          &floating_point_value,
+	          &floating_point_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1657,46 +1709,57 @@ int fvalue_test_floating_point_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 (double) 12.34 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "floating_point_value_size",
+	 floating_point_value_size,
+	 (size_t) 64 );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	string_index = 0;
+	floating_point_value      = 0;
+	floating_point_value_size = 0;
 
-	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
-	          floating_point,
-	          utf8_string,
-	          18,
-	          &string_index,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	result = libfvalue_floating_point_copy_to_floating_point(
+	          NULL,
+	          &floating_point_value,
+	          &floating_point_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 (double) 0.0 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 18 );
+	 "floating_point_value_size",
+	 floating_point_value_size,
+	 (size_t) 0 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	string_index = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
+	result = libfvalue_floating_point_copy_to_floating_point(
+	          floating_point,
 	          NULL,
-	          utf8_string,
-	          18,
-	          &string_index,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &floating_point_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1704,9 +1767,14 @@ int fvalue_test_floating_point_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 (double) 0.0 );
+
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "floating_point_value_size",
+	 floating_point_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1716,12 +1784,10 @@ int fvalue_test_floating_point_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
+	result = libfvalue_floating_point_copy_to_floating_point(
 	          floating_point,
+	          &floating_point_value,
 	          NULL,
-	          18,
-	          &string_index,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1729,9 +1795,14 @@ int fvalue_test_floating_point_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 (double) 0.0 );
+
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "floating_point_value_size",
+	 floating_point_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1777,20 +1848,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_to_utf8_string_with_index function
+/* Tests the libfvalue_floating_point_get_string_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_to_utf8_string_with_index(
+int fvalue_test_floating_point_get_string_size(
      void )
 {
-	uint8_t expected_utf8_string[ 19 ] = {
-		'0', 'x', '4', '0', '2', '8', 'a', 'e', '1', '4', '7', 'a', 'e', '1', '4', '7',
-		'a', 'e', 0 };
-	uint8_t utf8_string[ 32 ];
-
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
-	size_t string_index                        = 0;
+	size_t string_size                         = 0;
 	int result                                 = 0;
 
 	/* Initialize test
@@ -1829,13 +1895,11 @@ int fvalue_test_floating_point_copy_to_utf8_string_with_index(
 
 	/* Test regular cases
 	 */
-	string_index = 0;
+	string_size = 0;
 
-	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
+	result = libfvalue_floating_point_get_string_size(
 	          floating_point,
-	          utf8_string,
-	          32,
-	          &string_index,
+	          &string_size,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
@@ -1845,44 +1909,32 @@ int fvalue_test_floating_point_copy_to_utf8_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 19 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          expected_utf8_string,
-	          utf8_string,
-	          sizeof( uint8_t ) * 19 );
+	/* Test error cases
+	 */
+	string_size = 0;
+
+	result = libfvalue_floating_point_get_string_size(
+	          NULL,
+	          &string_size,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	/* Test error cases
-	 */
-	string_index = 0;
-
-	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
-	          NULL,
-	          utf8_string,
-	          32,
-	          &string_index,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
-	          &error );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1892,11 +1944,9 @@ int fvalue_test_floating_point_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
+	result = libfvalue_floating_point_get_string_size(
 	          floating_point,
 	          NULL,
-	          32,
-	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
@@ -1906,8 +1956,8 @@ int fvalue_test_floating_point_copy_to_utf8_string_with_index(
 	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1953,13 +2003,13 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_from_utf16_string_with_index function
+/* Tests the libfvalue_floating_point_copy_from_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_from_utf16_string_with_index(
+int fvalue_test_floating_point_copy_from_utf8_string_with_index(
      void )
 {
-	uint16_t utf16_string[ 19 ] = {
+	uint8_t utf8_string[ 19 ] = {
 		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
 		'0', '0', 0 };
 
@@ -2007,9 +2057,9 @@ int fvalue_test_floating_point_copy_from_utf16_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
 	          floating_point,
-	          utf16_string,
+	          utf8_string,
 	          18,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2033,9 +2083,9 @@ int fvalue_test_floating_point_copy_from_utf16_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
 	          NULL,
-	          utf16_string,
+	          utf8_string,
 	          18,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2058,7 +2108,7 @@ int fvalue_test_floating_point_copy_from_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf8_string_with_index(
 	          floating_point,
 	          NULL,
 	          18,
@@ -2119,16 +2169,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_to_utf16_string_with_index function
+/* Tests the libfvalue_floating_point_copy_to_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_to_utf16_string_with_index(
+int fvalue_test_floating_point_copy_to_utf8_string_with_index(
      void )
 {
-	uint16_t expected_utf16_string[ 19 ] = {
+	uint8_t expected_utf8_string[ 19 ] = {
 		'0', 'x', '4', '0', '2', '8', 'a', 'e', '1', '4', '7', 'a', 'e', '1', '4', '7',
 		'a', 'e', 0 };
-	uint16_t utf16_string[ 32 ];
+	uint8_t utf8_string[ 32 ];
 
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
@@ -2173,9 +2223,9 @@ int fvalue_test_floating_point_copy_to_utf16_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
 	          floating_point,
-	          utf16_string,
+	          utf8_string,
 	          32,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2196,9 +2246,9 @@ int fvalue_test_floating_point_copy_to_utf16_string_with_index(
 	 error );
 
 	result = memory_compare(
-	          expected_utf16_string,
-	          utf16_string,
-	          sizeof( uint16_t ) * 19 );
+	          expected_utf8_string,
+	          utf8_string,
+	          sizeof( uint8_t ) * 19 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2209,9 +2259,9 @@ int fvalue_test_floating_point_copy_to_utf16_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
 	          NULL,
-	          utf16_string,
+	          utf8_string,
 	          32,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2234,7 +2284,7 @@ int fvalue_test_floating_point_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
+	result = libfvalue_floating_point_copy_to_utf8_string_with_index(
 	          floating_point,
 	          NULL,
 	          32,
@@ -2295,13 +2345,13 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_from_utf32_string_with_index function
+/* Tests the libfvalue_floating_point_copy_from_utf16_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_from_utf32_string_with_index(
+int fvalue_test_floating_point_copy_from_utf16_string_with_index(
      void )
 {
-	uint32_t utf32_string[ 19 ] = {
+	uint16_t utf16_string[ 19 ] = {
 		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
 		'0', '0', 0 };
 
@@ -2349,9 +2399,9 @@ int fvalue_test_floating_point_copy_from_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
 	          floating_point,
-	          utf32_string,
+	          utf16_string,
 	          18,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2375,9 +2425,9 @@ int fvalue_test_floating_point_copy_from_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
 	          NULL,
-	          utf32_string,
+	          utf16_string,
 	          18,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2400,7 +2450,7 @@ int fvalue_test_floating_point_copy_from_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	result = libfvalue_floating_point_copy_from_utf16_string_with_index(
 	          floating_point,
 	          NULL,
 	          18,
@@ -2461,16 +2511,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_floating_point_copy_to_utf32_string_with_index function
+/* Tests the libfvalue_floating_point_copy_to_utf16_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_floating_point_copy_to_utf32_string_with_index(
+int fvalue_test_floating_point_copy_to_utf16_string_with_index(
      void )
 {
-	uint32_t expected_utf32_string[ 19 ] = {
+	uint16_t expected_utf16_string[ 19 ] = {
 		'0', 'x', '4', '0', '2', '8', 'a', 'e', '1', '4', '7', 'a', 'e', '1', '4', '7',
 		'a', 'e', 0 };
-	uint32_t utf32_string[ 32 ];
+	uint16_t utf16_string[ 32 ];
 
 	libcerror_error_t *error                   = NULL;
 	libfvalue_floating_point_t *floating_point = NULL;
@@ -2515,9 +2565,9 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
+	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
 	          floating_point,
-	          utf32_string,
+	          utf16_string,
 	          32,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2538,9 +2588,9 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	 error );
 
 	result = memory_compare(
-	          expected_utf32_string,
-	          utf32_string,
-	          sizeof( uint32_t ) * 19 );
+	          expected_utf16_string,
+	          utf16_string,
+	          sizeof( uint16_t ) * 19 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2551,9 +2601,34 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
+	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
+	          NULL,
+	          utf16_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_utf16_string_with_index(
+	          floating_point,
 	          NULL,
-	          utf32_string,
 	          32,
 	          &string_index,
 	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
@@ -2564,11 +2639,1467 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_floating_point_free(
+	          &floating_point,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "floating_point",
+	 floating_point );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floating_point != NULL )
+	{
+		libfvalue_floating_point_free(
+		 &floating_point,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_copy_from_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_copy_from_utf32_string_with_index(
+     void )
+{
+	uint32_t utf32_string[ 19 ] = {
+		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
+		'0', '0', 0 };
+
+	libcerror_error_t *error                   = NULL;
+	libfvalue_floating_point_t *floating_point = NULL;
+	size_t string_index                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_floating_point_initialize(
+	          &floating_point,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "floating_point",
+	 floating_point );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_copy_from_byte_stream(
+	          floating_point,
+	          (uint8_t *) "\x40\x28\x00\x00\x00\x00\x00\x00",
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	          floating_point,
+	          utf32_string,
+	          18,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 18 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	          NULL,
+	          utf32_string,
+	          18,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_from_utf32_string_with_index(
+	          floating_point,
+	          NULL,
+	          18,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_floating_point_free(
+	          &floating_point,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "floating_point",
+	 floating_point );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floating_point != NULL )
+	{
+		libfvalue_floating_point_free(
+		 &floating_point,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_copy_to_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_copy_to_utf32_string_with_index(
+     void )
+{
+	uint32_t expected_utf32_string[ 19 ] = {
+		'0', 'x', '4', '0', '2', '8', 'a', 'e', '1', '4', '7', 'a', 'e', '1', '4', '7',
+		'a', 'e', 0 };
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfvalue_floating_point_t *floating_point = NULL;
+	size_t string_index                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_floating_point_initialize(
+	          &floating_point,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "floating_point",
+	 floating_point );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_copy_from_floating_point(
+	          floating_point,
+	          (double) 12.34,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
+	          floating_point,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 19 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string,
+	          utf32_string,
+	          sizeof( uint32_t ) * 19 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
+	          NULL,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
+	          floating_point,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_floating_point_free(
+	          &floating_point,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "floating_point",
+	 floating_point );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( floating_point != NULL )
+	{
+		libfvalue_floating_point_free(
+		 &floating_point,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_get_shortest_decimal function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_get_shortest_decimal(
+     void )
+{
+	uint64_t expected_significands[ 8 ] = {
+		0, 1, 1, 5, 17976931348623157ULL, 1, 16777216, 34028235 };
+	uint64_t floating_point_values[ 8 ] = {
+		0x0000000000000000ULL, 0x3ff0000000000000ULL, 0x3fb999999999999aULL, 0x0000000000000001ULL,
+		0x7fefffffffffffffULL, 0x3dcccccdUL, 0x4b800000UL, 0x7f7fffffUL };
+	size_t floating_point_value_sizes[ 8 ] = {
+		64, 64, 64, 64, 64, 32, 32, 32 };
+	int16_t expected_exponents[ 8 ] = {
+		0, 0, -1, -324, 292, -1, 0, 31 };
+
+	libcerror_error_t *error     = NULL;
+	uint64_t decimal_significand = 0;
+	int16_t decimal_exponent     = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		result = libfvalue_floating_point_get_shortest_decimal(
+		          floating_point_values[ value_index ],
+		          floating_point_value_sizes[ value_index ],
+		          &decimal_significand,
+		          &decimal_exponent,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT64(
+		 "decimal_significand",
+		 decimal_significand,
+		 expected_significands[ value_index ] );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "decimal_exponent",
+		 (int) decimal_exponent,
+		 (int) expected_exponents[ value_index ] );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfvalue_floating_point_get_shortest_decimal(
+	          0x3ff0000000000000ULL,
+	          64,
+	          NULL,
+	          &decimal_exponent,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_get_shortest_decimal(
+	          0x3ff0000000000000ULL,
+	          64,
+	          &decimal_significand,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_get_shortest_decimal(
+	          0x3ff0000000000000ULL,
+	          16,
+	          &decimal_significand,
+	          &decimal_exponent,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_get_shortest_decimal(
+	          0x7ff0000000000000ULL,
+	          64,
+	          &decimal_significand,
+	          &decimal_exponent,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_copy_to_shortest_decimal_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_copy_to_shortest_decimal_string(
+     void )
+{
+	uint8_t expected_string_64bit[ 23 ] = {
+		'2', '.', '2', '2', '5', '0', '7', '3', '8', '5', '8', '5', '0', '7', '2', '0',
+		'1', '4', 'e', '-', '3', '0', '8' };
+	uint8_t expected_string_zero[ 6 ] = {
+		'0', 'e', '+', '0', '0', '0' };
+	uint8_t string[ LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_length     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x0010000000000000ULL,
+	          64,
+	          string,
+	          LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE,
+	          &string_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 23 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_string_64bit,
+	          string,
+	          23 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The sign bit is ignored
+	 */
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x80000000UL,
+	          32,
+	          string,
+	          LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE,
+	          &string_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 6 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_string_zero,
+	          string,
+	          6 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x3ff0000000000000ULL,
+	          64,
+	          NULL,
+	          LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE,
+	          &string_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x3ff0000000000000ULL,
+	          64,
+	          string,
+	          8,
+	          &string_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x3ff0000000000000ULL,
+	          64,
+	          string,
+	          LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_copy_to_shortest_decimal_string(
+	          0x7f800000UL,
+	          32,
+	          string,
+	          LIBFVALUE_FLOATING_POINT_SHORTEST_DECIMAL_STRING_SIZE,
+	          &string_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_get_value_from_decimal function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_get_value_from_decimal(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint64_t floating_point_value = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          -1,
+	          64,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x3fb999999999999aULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          -1,
+	          32,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x3dcccccdUL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          23,
+	          64,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x44b52d02c7e14af6ULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          0,
+	          10,
+	          64,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test overflow to infinity and underflow to zero
+	 */
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          400,
+	          64,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x7ff0000000000000ULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          -400,
+	          64,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          0,
+	          16,
+	          &floating_point_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_floating_point_get_value_from_decimal(
+	          1,
+	          0,
+	          64,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_floating_point_copy_from_decimal_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_floating_point_copy_from_decimal_string(
+     void )
+{
+	uint8_t string_halfway[ 16 ] = {
+		'9', '0', '0', '7', '1', '9', '9', '2', '5', '4', '7', '4', '0', '9', '9', '3' };
+	uint8_t string_subnormal[ 23 ] = {
+		'2', '.', '4', '7', '0', '3', '2', '8', '2', '2', '9', '2', '0', '6', '2', '3',
+		'2', '8', 'e', '-', '3', '2', '4' };
+	uint8_t string_trailing[ 5 ] = {
+		'1', 'e', '2', '3', 'x' };
+	uint8_t string_invalid1[ 2 ] = {
+		'-', '.' };
+	uint8_t string_invalid2[ 3 ] = {
+		'1', 'e', '+' };
+
+	libcerror_error_t *error      = NULL;
+	uint64_t floating_point_value = 0;
+	size_t string_index           = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          1,
+	          16,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 16 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x4340000000000000ULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_subnormal,
+	          1,
+	          23,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 23 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x0000000000000001ULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_trailing,
+	          1,
+	          4,
+	          &string_index,
+	          &floating_point_value,
+	          32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x65a96816UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          NULL,
+	          1,
+	          16,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          3,
+	          16,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          1,
+	          16,
+	          NULL,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 16;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          1,
+	          16,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          1,
+	          16,
+	          &string_index,
+	          NULL,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_halfway,
+	          1,
+	          16,
+	          &string_index,
+	          &floating_point_value,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test invalid strings
+	 */
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_trailing,
+	          1,
+	          5,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_invalid1,
+	          1,
+	          2,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_floating_point_copy_from_decimal_string(
+	          string_invalid2,
+	          1,
+	          3,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_with_index_copy_from_floating_point function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_with_index_copy_from_floating_point(
+     void )
+{
+	uint32_t expected_utf32_string_hexadecimal_64bit[ 19 ] = {
+		'0', 'x', '4', '0', 'b', '3', '1', 'a', '4', '5', '1', 'e', 'b', '8', '5', '1',
+		'e', 'c', 0 };
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 1;
+
+	result = libfvalue_string_with_index_copy_from_floating_point(
+	          (uint8_t *) utf32_string,
+	          4,
+	          32,
+	          &string_index,
+	          (uint64_t) 0x40b31a451eb851ecUL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string_hexadecimal_64bit,
+	          &( utf32_string[ 1 ] ),
+	          sizeof( uint32_t ) * 19 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_string_with_index_copy_from_floating_point(
+	          NULL,
+	          4,
+	          32,
+	          &string_index,
+	          (uint64_t) 0x40b31a451eb851ecUL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_with_index_copy_from_floating_point(
+	          (uint8_t *) utf32_string,
+	          3,
+	          32,
+	          &string_index,
+	          (uint64_t) 0x40b31a451eb851ecUL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_with_index_copy_from_floating_point(
+	          (uint8_t *) utf32_string,
+	          4,
+	          18,
+	          &string_index,
+	          (uint64_t) 0x40b31a451eb851ecUL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_with_index_copy_to_floating_point function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_with_index_copy_to_floating_point(
+     void )
+{
+	uint32_t utf32_string[ 80 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t string_index           = 0;
+	uint64_t floating_point_value = 0;
+	int result                    = 0;
+
+	/* The string is longer than the formatted string size to test
+	 * that decimal strings are not truncated
+	 */
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		utf32_string[ string_index ] = (uint32_t) '0';
+	}
+	utf32_string[ 0 ] = (uint32_t) '4';
+	utf32_string[ 1 ] = (uint32_t) '8';
+	utf32_string[ 2 ] = (uint32_t) '9';
+	utf32_string[ 3 ] = (uint32_t) '0';
+	utf32_string[ 4 ] = (uint32_t) '.';
+	utf32_string[ 5 ] = (uint32_t) '2';
+	utf32_string[ 6 ] = (uint32_t) '7';
+
+	/* Test regular cases
+	 */
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_string_with_index_copy_to_floating_point(
+	          (uint8_t *) utf32_string,
+	          4,
+	          80,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 80 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x40b31a451eb851ecUL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_string_with_index_copy_to_floating_point(
+	          NULL,
+	          4,
+	          80,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2576,12 +4107,14 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_floating_point_copy_to_utf32_string_with_index(
-	          floating_point,
-	          NULL,
-	          32,
+	result = libfvalue_string_with_index_copy_to_floating_point(
+	          (uint8_t *) utf32_string,
+	          3,
+	          80,
 	          &string_index,
-	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_HEXADECIMAL,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2589,11 +4122,6 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2601,25 +4129,32 @@ int fvalue_test_floating_point_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	/* Test a character outside the ASCII range
 	 */
-	result = libfvalue_floating_point_free(
-	          &floating_point,
+	utf32_string[ 40 ] = 0x00010030UL;
+
+	result = libfvalue_string_with_index_copy_to_floating_point(
+	          (uint8_t *) utf32_string,
+	          4,
+	          80,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "floating_point",
-	 floating_point );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2628,12 +4163,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( floating_point != NULL )
-	{
-		libfvalue_floating_point_free(
-		 &floating_point,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -2950,6 +4479,75 @@ int fvalue_test_string_size_from_floating_point(
 	 "error",
 	 error );
 
+	string_size = 0;
+
+	result = libfvalue_string_size_from_floating_point(
+	          &string_size,
+	          (uint64_t) 0xbfc00000UL,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_size = 0;
+
+	result = libfvalue_string_size_from_floating_point(
+	          &string_size,
+	          (uint64_t) 0x3fb999999999999aULL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_size = 0;
+
+	result = libfvalue_string_size_from_floating_point(
+	          &string_size,
+	          (uint64_t) 0x7fefffffffffffffULL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 24 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	string_size = 0;
@@ -3165,6 +4763,10 @@ int fvalue_test_utf8_string_with_index_copy_from_floating_point(
 		'3', '.', '4', '0', '2', '8', '2', '3', 'e', '+', '0', '3', '8', 0 };
 	uint8_t expected_utf8_string_positive_64bit[ 14 ] = {
 		'1', '.', '7', '9', '7', '6', '9', '3', 'e', '+', '3', '0', '8', 0 };
+	uint8_t expected_utf8_string_shortest_32bit[ 10 ] = {
+		'-', '1', '.', '5', 'e', '+', '0', '0', '0', 0 };
+	uint8_t expected_utf8_string_shortest_64bit[ 7 ] = {
+		'1', 'e', '-', '0', '0', '1', 0 };
 	uint8_t expected_utf8_string_zero[ 14 ] = {
                 '0', '.', '0', '0', '0', '0', '0', '0', 'e', '+', '0', '0', '0', 0 };
 	uint8_t utf8_string[ 32 ];
@@ -3630,6 +5232,76 @@ int fvalue_test_utf8_string_with_index_copy_from_floating_point(
 	 result,
 	 0 );
 
+	utf8_string_index = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_from_floating_point(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          (uint64_t) 0xbfc00000UL,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string_shortest_32bit,
+	          utf8_string,
+	          sizeof( uint8_t ) * 10 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_from_floating_point(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          (uint64_t) 0x3fb999999999999aULL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string_shortest_64bit,
+	          utf8_string,
+	          sizeof( uint8_t ) * 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	utf8_string_index = 0;
@@ -3871,6 +5543,12 @@ int fvalue_test_utf8_string_with_index_copy_to_floating_point(
 {
 	uint8_t utf8_string_decimal[ 8 ] = {
 		'4', '8', '9', '0', '.', '2', '7', 0 };
+	uint8_t utf8_string_exponent[ 8 ] = {
+		'-', '1', '.', '5', 'e', '-', '3', 0 };
+	uint8_t utf8_string_halfway[ 37 ] = {
+		'9', '0', '0', '7', '1', '9', '9', '2', '5', '4', '7', '4', '0', '9', '9', '3',
+		'.', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
+		'0', '0', '0', '1', 0 };
 	uint8_t utf8_string_hexadecimal_lower_case[ 19 ] = {
 		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
 		'0', '0', 0 };
@@ -3909,12 +5587,105 @@ int fvalue_test_utf8_string_with_index_copy_to_floating_point(
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
 	 "string_index",
 	 string_index,
-	 (size_t) 7 );
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0x40b31a451eb851ecUL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_to_floating_point(
+	          utf8_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbf589374bc6a7efaULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_to_floating_point(
+	          utf8_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbac49ba6UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_to_floating_point(
+	          utf8_string_halfway,
+	          36,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 36 );
 
 	FVALUE_TEST_ASSERT_EQUAL_UINT64(
 	 "floating_point_value",
 	 floating_point_value,
-	 (uint64_t) 0x40b31a451eb851ecUL );
+	 (uint64_t) 0x4340000000000001ULL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4449,6 +6220,10 @@ int fvalue_test_utf16_string_with_index_copy_from_floating_point(
 		'3', '.', '4', '0', '2', '8', '2', '3', 'e', '+', '0', '3', '8', 0 };
 	uint16_t expected_utf16_string_positive_64bit[ 14 ] = {
 		'1', '.', '7', '9', '7', '6', '9', '3', 'e', '+', '3', '0', '8', 0 };
+	uint16_t expected_utf16_string_shortest_32bit[ 10 ] = {
+		'-', '1', '.', '5', 'e', '+', '0', '0', '0', 0 };
+	uint16_t expected_utf16_string_shortest_64bit[ 7 ] = {
+		'1', 'e', '-', '0', '0', '1', 0 };
 	uint16_t expected_utf16_string_zero[ 14 ] = {
                 '0', '.', '0', '0', '0', '0', '0', '0', 'e', '+', '0', '0', '0', 0 };
 	uint16_t utf16_string[ 32 ];
@@ -4914,6 +6689,76 @@ int fvalue_test_utf16_string_with_index_copy_from_floating_point(
 	 result,
 	 0 );
 
+	utf16_string_index = 0;
+
+	result = libfvalue_utf16_string_with_index_copy_from_floating_point(
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          (uint64_t) 0xbfc00000UL,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf16_string_shortest_32bit,
+	          utf16_string,
+	          sizeof( uint16_t ) * 10 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf16_string_index = 0;
+
+	result = libfvalue_utf16_string_with_index_copy_from_floating_point(
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          (uint64_t) 0x3fb999999999999aULL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf16_string_shortest_64bit,
+	          utf16_string,
+	          sizeof( uint16_t ) * 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	utf16_string_index = 0;
@@ -5155,6 +7000,8 @@ int fvalue_test_utf16_string_with_index_copy_to_floating_point(
 {
 	uint16_t utf16_string_decimal[ 8 ] = {
 		'4', '8', '9', '0', '.', '2', '7', 0 };
+	uint16_t utf16_string_exponent[ 8 ] = {
+		'-', '1', '.', '5', 'e', '-', '3', 0 };
 	uint16_t utf16_string_hexadecimal_lower_case[ 19 ] = {
 		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
 		'0', '0', 0 };
@@ -5207,6 +7054,68 @@ int fvalue_test_utf16_string_with_index_copy_to_floating_point(
 	string_index         = 0;
 	floating_point_value = 0;
 
+	result = libfvalue_utf16_string_with_index_copy_to_floating_point(
+	          utf16_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbf589374bc6a7efaULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_utf16_string_with_index_copy_to_floating_point(
+	          utf16_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbac49ba6UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
 	result = libfvalue_utf16_string_with_index_copy_to_floating_point(
 	          utf16_string_hexadecimal_lower_case,
 	          18,
@@ -5733,6 +7642,10 @@ int fvalue_test_utf32_string_with_index_copy_from_floating_point(
 		'3', '.', '4', '0', '2', '8', '2', '3', 'e', '+', '0', '3', '8', 0 };
 	uint32_t expected_utf32_string_positive_64bit[ 14 ] = {
 		'1', '.', '7', '9', '7', '6', '9', '3', 'e', '+', '3', '0', '8', 0 };
+	uint32_t expected_utf32_string_shortest_32bit[ 10 ] = {
+		'-', '1', '.', '5', 'e', '+', '0', '0', '0', 0 };
+	uint32_t expected_utf32_string_shortest_64bit[ 7 ] = {
+		'1', 'e', '-', '0', '0', '1', 0 };
 	uint32_t expected_utf32_string_zero[ 14 ] = {
                 '0', '.', '0', '0', '0', '0', '0', '0', 'e', '+', '0', '0', '0', 0 };
 	uint32_t utf32_string[ 32 ];
@@ -6198,6 +8111,76 @@ int fvalue_test_utf32_string_with_index_copy_from_floating_point(
 	 result,
 	 0 );
 
+	utf32_string_index = 0;
+
+	result = libfvalue_utf32_string_with_index_copy_from_floating_point(
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          (uint64_t) 0xbfc00000UL,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string_shortest_32bit,
+	          utf32_string,
+	          sizeof( uint32_t ) * 10 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf32_string_index = 0;
+
+	result = libfvalue_utf32_string_with_index_copy_from_floating_point(
+	          utf32_string,
+	          32,
+	          &utf32_string_index,
+	          (uint64_t) 0x3fb999999999999aULL,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL | LIBFVALUE_FLOATING_POINT_FORMAT_FLAG_SHORTEST,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf32_string_index",
+	 utf32_string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string_shortest_64bit,
+	          utf32_string,
+	          sizeof( uint32_t ) * 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	utf32_string_index = 0;
@@ -6439,6 +8422,8 @@ int fvalue_test_utf32_string_with_index_copy_to_floating_point(
 {
 	uint32_t utf32_string_decimal[ 8 ] = {
 		'4', '8', '9', '0', '.', '2', '7', 0 };
+	uint32_t utf32_string_exponent[ 8 ] = {
+		'-', '1', '.', '5', 'e', '-', '3', 0 };
 	uint32_t utf32_string_hexadecimal_lower_case[ 19 ] = {
 		'0', 'x', '4', '1', 'd', '0', '5', '1', '5', 'c', '2', '9', '0', '0', '0', '0',
 		'0', '0', 0 };
@@ -6491,6 +8476,68 @@ int fvalue_test_utf32_string_with_index_copy_to_floating_point(
 	string_index         = 0;
 	floating_point_value = 0;
 
+	result = libfvalue_utf32_string_with_index_copy_to_floating_point(
+	          utf32_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          64,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbf589374bc6a7efaULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
+	result = libfvalue_utf32_string_with_index_copy_to_floating_point(
+	          utf32_string_exponent,
+	          7,
+	          &string_index,
+	          &floating_point_value,
+	          32,
+	          LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "floating_point_value",
+	 floating_point_value,
+	 (uint64_t) 0xbac49ba6UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index         = 0;
+	floating_point_value = 0;
+
 	result = libfvalue_utf32_string_with_index_copy_to_floating_point(
 	          utf32_string_hexadecimal_lower_case,
 	          18,
@@ -6950,6 +8997,14 @@ int main(
 	 "libfvalue_floating_point_copy_from_byte_stream",
 	 fvalue_test_floating_point_copy_from_byte_stream );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_copy_to_byte_stream",
+	 fvalue_test_floating_point_copy_to_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_get_byte_stream_size",
+	 fvalue_test_floating_point_get_byte_stream_size );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_floating_point_copy_from_integer",
 	 fvalue_test_floating_point_copy_from_integer );
@@ -6994,6 +9049,30 @@ int main(
 	 "libfvalue_floating_point_copy_to_utf32_string_with_index",
 	 fvalue_test_floating_point_copy_to_utf32_string_with_index );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_get_shortest_decimal",
+	 fvalue_test_floating_point_get_shortest_decimal );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_copy_to_shortest_decimal_string",
+	 fvalue_test_floating_point_copy_to_shortest_decimal_string );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_get_value_from_decimal",
+	 fvalue_test_floating_point_get_value_from_decimal );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_floating_point_copy_from_decimal_string",
+	 fvalue_test_floating_point_copy_from_decimal_string );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_with_index_copy_from_floating_point",
+	 fvalue_test_string_with_index_copy_from_floating_point );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_with_index_copy_to_floating_point",
+	 fvalue_test_string_with_index_copy_to_floating_point );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 	FVALUE_TEST_RUN(
@@ -0,0 +1,1329 @@
+/*
+ * Library identifier_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_identifier_index.h"
+#include "../libfvalue/libfvalue_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* Creates a table with values for testing
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_test_identifier_index_create_table(
+     libfvalue_table_t **table,
+     libcerror_error_t **error )
+{
+	uint8_t value_identifier[ 2 ] = { 'a', 0 };
+	libfvalue_value_t *value      = NULL;
+	int value_index               = 0;
+
+	if( libfvalue_table_initialize(
+	     table,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		value_identifier[ 0 ] = (uint8_t) ( 'a' + value_index );
+
+		if( libfvalue_value_type_initialize(
+		     &value,
+		     LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfvalue_value_set_identifier(
+		     value,
+		     value_identifier,
+		     2,
+		     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfvalue_table_set_value(
+		     *table,
+		     value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		value = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	libfvalue_table_free(
+	 table,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfvalue_identifier_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfvalue_identifier_index_t *identifier_index = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 2;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvalue_identifier_index_initialize(
+	          &identifier_index,
+	          100,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "identifier_index->number_of_allocated_entries",
+	 identifier_index->number_of_allocated_entries,
+	 256 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "identifier_index->number_of_entries",
+	 identifier_index->number_of_entries,
+	 0 );
+
+	result = libfvalue_identifier_index_free(
+	          &identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_index = (libfvalue_identifier_index_t *) 0x12345678UL;
+
+	result = libfvalue_identifier_index_initialize(
+	          &identifier_index,
+	          0,
+	          &error );
+
+	identifier_index = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_initialize(
+	          &identifier_index,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_identifier_index_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvalue_identifier_index_initialize(
+		          &identifier_index,
+		          0,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( identifier_index != NULL )
+			{
+				libfvalue_identifier_index_free(
+				 &identifier_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "identifier_index",
+			 identifier_index );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_identifier_index_initialize with memset failing
+		 */
+		fvalue_test_memset_attempts_before_fail = test_number;
+
+		result = libfvalue_identifier_index_initialize(
+		          &identifier_index,
+		          0,
+		          &error );
+
+		if( fvalue_test_memset_attempts_before_fail != -1 )
+		{
+			fvalue_test_memset_attempts_before_fail = -1;
+
+			if( identifier_index != NULL )
+			{
+				libfvalue_identifier_index_free(
+				 &identifier_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "identifier_index",
+			 identifier_index );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &identifier_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_identifier_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_free(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_identifier_index_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_clone(
+     void )
+{
+	uint8_t value_identifier[ 2 ]                              = { 'a', 0 };
+	libcerror_error_t *error                                   = NULL;
+	libfvalue_identifier_index_t *destination_identifier_index = NULL;
+	libfvalue_identifier_index_t *source_identifier_index      = NULL;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_identifier_index_initialize(
+	          &source_identifier_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_identifier_index",
+	 source_identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_set_value_index(
+	          source_identifier_index,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_identifier_index_clone(
+	          &destination_identifier_index,
+	          source_identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_identifier_index",
+	 destination_identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "destination_identifier_index->number_of_allocated_entries",
+	 destination_identifier_index->number_of_allocated_entries,
+	 source_identifier_index->number_of_allocated_entries );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "destination_identifier_index->number_of_entries",
+	 destination_identifier_index->number_of_entries,
+	 1 );
+
+	result = libfvalue_identifier_index_free(
+	          &destination_identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "destination_identifier_index",
+	 destination_identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_clone(
+	          &destination_identifier_index,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "destination_identifier_index",
+	 destination_identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_clone(
+	          NULL,
+	          source_identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_identifier_index = (libfvalue_identifier_index_t *) 0x12345678UL;
+
+	result = libfvalue_identifier_index_clone(
+	          &destination_identifier_index,
+	          source_identifier_index,
+	          &error );
+
+	destination_identifier_index = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_identifier_index_free(
+	          &source_identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "source_identifier_index",
+	 source_identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &destination_identifier_index,
+		 NULL );
+	}
+	if( source_identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &source_identifier_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_identifier_index_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_calculate_hash(
+     void )
+{
+	uint8_t identifier[ 1 ]  = { 'a' };
+	libcerror_error_t *error = NULL;
+	uint32_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_identifier_index_calculate_hash(
+	          identifier,
+	          0,
+	          &hash,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_calculate_hash(
+	          identifier,
+	          1,
+	          &hash,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_calculate_hash(
+	          NULL,
+	          1,
+	          &hash,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_calculate_hash(
+	          identifier,
+	          (size_t) SSIZE_MAX + 1,
+	          &hash,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_calculate_hash(
+	          identifier,
+	          1,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_identifier_index_set_value_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_set_value_index(
+     void )
+{
+	uint8_t value_identifier[ 5 ]                  = { 'v', 0, 0, 0, 0 };
+	libcerror_error_t *error                       = NULL;
+	libfvalue_identifier_index_t *identifier_index = NULL;
+	int result                                     = 0;
+	int value_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_identifier_index_initialize(
+	          &identifier_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 100;
+	     value_index++ )
+	{
+		value_identifier[ 1 ] = (uint8_t) ( '0' + ( value_index / 10 ) );
+		value_identifier[ 2 ] = (uint8_t) ( '0' + ( value_index % 10 ) );
+
+		result = libfvalue_identifier_index_set_value_index(
+		          identifier_index,
+		          value_identifier,
+		          4,
+		          value_index,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "identifier_index->number_of_entries",
+	 identifier_index->number_of_entries,
+	 100 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "identifier_index->number_of_allocated_entries",
+	 identifier_index->number_of_allocated_entries,
+	 256 );
+
+	result = libfvalue_identifier_index_empty(
+	          identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "identifier_index->number_of_entries",
+	 identifier_index->number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_set_value_index(
+	          NULL,
+	          value_identifier,
+	          4,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_set_value_index(
+	          identifier_index,
+	          NULL,
+	          4,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_set_value_index(
+	          identifier_index,
+	          value_identifier,
+	          4,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_identifier_index_free(
+	          &identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &identifier_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_identifier_index_get_value_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_identifier_index_get_value_index(
+     void )
+{
+	uint8_t value_identifier[ 2 ]                  = { 'a', 0 };
+	libcerror_error_t *error                       = NULL;
+	libfvalue_identifier_index_t *identifier_index = NULL;
+	libfvalue_internal_table_t *internal_table     = NULL;
+	libfvalue_table_t *table                       = NULL;
+	int result                                     = 0;
+	int value_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = fvalue_test_identifier_index_create_table(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_table = (libfvalue_internal_table_t *) table;
+
+	result = libfvalue_identifier_index_initialize(
+	          &identifier_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Index value 0 ("a") and 2 ("c")
+	 */
+	result = libfvalue_identifier_index_set_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_identifier[ 0 ] = 'c';
+
+	result = libfvalue_identifier_index_set_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          2,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 2 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an identifier that was not indexed
+	 */
+	value_identifier[ 0 ] = 'b';
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an identifier with a different size
+	 */
+	value_identifier[ 0 ] = 'a';
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          1,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test removing a value index
+	 */
+	result = libfvalue_identifier_index_remove_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_remove_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a value index, which moves "c" to value index 3
+	 */
+	result = libfvalue_identifier_index_insert_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_identifier_index_get_value_index(
+	          NULL,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          NULL,
+	          2,
+	          &value_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_get_value_index(
+	          identifier_index,
+	          internal_table->values,
+	          value_identifier,
+	          2,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_remove_value_index(
+	          NULL,
+	          value_identifier,
+	          2,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_identifier_index_insert_value_index(
+	          identifier_index,
+	          value_identifier,
+	          2,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_identifier_index_free(
+	          &identifier_index,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "identifier_index",
+	 identifier_index );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_index != NULL )
+	{
+		libfvalue_identifier_index_free(
+		 &identifier_index,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_initialize",
+	 fvalue_test_identifier_index_initialize );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_free",
+	 fvalue_test_identifier_index_free );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_clone",
+	 fvalue_test_identifier_index_clone );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_calculate_hash",
+	 fvalue_test_identifier_index_calculate_hash );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_set_value_index",
+	 fvalue_test_identifier_index_set_value_index );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_identifier_index_get_value_index",
+	 fvalue_test_identifier_index_get_value_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+}
+
@@ -921,20 +921,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_from_integer function
+/* Tests the libfvalue_integer_copy_from_byte_stream_array function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_from_integer(
+int fvalue_test_integer_copy_from_byte_stream_array(
      void )
 {
-	libcerror_error_t *error     = NULL;
-	libfvalue_integer_t *integer = NULL;
-	int result                   = 0;
+	uint64_t integer_values[ 3 ];
 
-	/* Initialize test
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
 	 */
-	result = libfvalue_integer_initialize(
-	          &integer,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          3,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -942,20 +947,31 @@ int fvalue_test_integer_copy_from_integer(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "integer",
-	 integer );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x01UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x02UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 2 ]",
+	 integer_values[ 2 ],
+	 (uint64_t) 0x03UL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfvalue_integer_copy_from_integer(
-	          integer,
-	          (uint64_t) 0x12345678UL,
-	          32,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          6,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -964,161 +980,156 @@ int fvalue_test_integer_copy_from_integer(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer->value",
-	 integer->value,
-	 (uint64_t) 0x12345678UL );
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x0102UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x0304UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 2 ]",
+	 integer_values[ 2 ],
+	 (uint64_t) 0x0506UL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfvalue_integer_copy_from_integer(
-	          NULL,
-	          (uint64_t) 0x12345678UL,
-	          32,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          12,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x04030201UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x08070605UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 2 ]",
+	 integer_values[ 2 ],
+	 (uint64_t) 0x0c0b0a09UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfvalue_integer_copy_from_integer(
-	          integer,
-	          (uint64_t) 0x12345678UL,
-	          4,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          24,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x0102030405060708ULL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x090a0b0c0d0e0f10ULL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 2 ]",
+	 integer_values[ 2 ],
+	 (uint64_t) 0x1112131415161718ULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
+	/* Test error cases
 	 */
-	result = libfvalue_integer_free(
-	          &integer,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          NULL,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          12,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "integer",
-	 integer );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( integer != NULL )
-	{
-		libfvalue_integer_free(
-		 &integer,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libfvalue_integer_copy_to_integer function
- * Returns 1 if successful or 0 if not
- */
-int fvalue_test_integer_copy_to_integer(
-     void )
-{
-	libcerror_error_t *error     = NULL;
-	libfvalue_integer_t *integer = NULL;
-	size_t integer_value_size    = 0;
-	uint64_t integer_value       = 0;
-	int result                   = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Initialize test
-	 */
-	result = libfvalue_integer_initialize(
-	          &integer,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          0,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          12,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "integer",
-	 integer );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	integer->value      = (uint64_t) 0x12345678UL;
-	integer->value_size = 32;
-
-	/* Test regular cases
-	 */
-	integer_value      = 0;
-	integer_value_size = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_integer_copy_to_integer(
-	          integer,
-	          &integer_value,
-	          &integer_value_size,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          NULL,
+	          12,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0x12345678UL );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 32 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	integer_value      = 0;
-	integer_value_size = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_integer_copy_to_integer(
-	          NULL,
-	          &integer_value,
-	          &integer_value_size,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1126,16 +1137,6 @@ int fvalue_test_integer_copy_to_integer(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1143,10 +1144,12 @@ int fvalue_test_integer_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_to_integer(
-	          integer,
-	          NULL,
-	          &integer_value_size,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          12,
+	          -1,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1154,16 +1157,6 @@ int fvalue_test_integer_copy_to_integer(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1171,10 +1164,12 @@ int fvalue_test_integer_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_to_integer(
-	          integer,
-	          &integer_value,
-	          NULL,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          10,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1182,16 +1177,6 @@ int fvalue_test_integer_copy_to_integer(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer_value",
-	 integer_value,
-	 (uint64_t) 0 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "integer_value_size",
-	 integer_value_size,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1199,25 +1184,26 @@ int fvalue_test_integer_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfvalue_integer_free(
-	          &integer,
+	result = libfvalue_integer_copy_from_byte_stream_array(
+	          integer_values,
+	          3,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18",
+	          9,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "integer",
-	 integer );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1226,24 +1212,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( integer != NULL )
-	{
-		libfvalue_integer_free(
-		 &integer,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_get_string_size function
+/* Tests the libfvalue_integer_copy_to_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_get_string_size(
+int fvalue_test_integer_copy_to_byte_stream(
      void )
 {
+	uint8_t byte_stream[ 8 ];
+
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
-	size_t string_size           = 0;
 	int result                   = 0;
 
 	/* Initialize test
@@ -1265,12 +1246,15 @@ int fvalue_test_integer_get_string_size(
 	 "error",
 	 error );
 
-	result = libfvalue_integer_copy_from_integer(
+	/* Test regular cases
+	 */
+	result = libfvalue_integer_copy_from_byte_stream(
 	          integer,
-	          (uint64_t) 0x12345678UL,
-	          32,
-	          &error );
-
+	          (uint8_t *) "\x12\x34\x56\x78",
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1280,14 +1264,37 @@ int fvalue_test_integer_get_string_size(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	string_size = 0;
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
 
-	result = libfvalue_integer_get_string_size(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x12\x34\x56\x78",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_integer_copy_to_byte_stream(
 	          integer,
-	          &string_size,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          byte_stream,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1295,23 +1302,130 @@ int fvalue_test_integer_get_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 11 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x78\x56\x34\x12",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_integer_copy_from_byte_stream(
+	          integer,
+	          (uint8_t *) "\x12\x34",
+	          2,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
+	          byte_stream,
+	          2,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "\x34\x12",
+	          2 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_integer_copy_from_byte_stream(
+	          integer,
+	          (uint8_t *) "\x12\x34\x56\x78\x9a\xbc\xde\xf0",
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          byte_stream,
+	          "\xf0\xde\xbc\x9a\x78\x56\x34\x12",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	string_size = 0;
+	result = libfvalue_integer_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
 
-	result = libfvalue_integer_get_string_size(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
 	          NULL,
-	          &string_size,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          8,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1319,10 +1433,24 @@ int fvalue_test_integer_get_string_size(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 0 );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1331,10 +1459,11 @@ int fvalue_test_integer_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_get_string_size(
+	result = libfvalue_integer_copy_to_byte_stream(
 	          integer,
-	          NULL,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          byte_stream,
+	          8,
+	          -1,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1342,10 +1471,24 @@ int fvalue_test_integer_get_string_size(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 0 );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_byte_stream(
+	          integer,
+	          byte_stream,
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1390,18 +1533,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_from_utf8_string_with_index function
+/* Tests the libfvalue_integer_get_byte_stream_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_from_utf8_string_with_index(
+int fvalue_test_integer_get_byte_stream_size(
      void )
 {
-	uint8_t utf8_string[ 11 ] = {
-		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
-
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
-	size_t string_index          = 0;
+	size_t byte_stream_size      = 0;
 	int result                   = 0;
 
 	/* Initialize test
@@ -1423,10 +1563,12 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libfvalue_integer_copy_from_byte_stream(
 	          integer,
-	          (uint8_t *) "\x12\x34\x56\x78",
-	          4,
+	          (uint8_t *) "\x12\x34",
+	          2,
 	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
@@ -1435,25 +1577,14 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer->value",
-	 integer->value,
-	 (uint64_t) 0x12345678UL );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	string_index = 0;
-
-	result = libfvalue_integer_copy_from_utf8_string_with_index(
+	result = libfvalue_integer_get_byte_stream_size(
 	          integer,
-	          utf8_string,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1461,15 +1592,10 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer->value",
-	 integer->value,
-	 (uint64_t) 0x12345678UL );
-
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 10 );
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 2 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1477,14 +1603,10 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 
 	/* Test error cases
 	 */
-	string_index = 0;
-
-	result = libfvalue_integer_copy_from_utf8_string_with_index(
+	result = libfvalue_integer_get_byte_stream_size(
 	          NULL,
-	          utf8_string,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &byte_stream_size,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1492,11 +1614,6 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1504,12 +1621,10 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_from_utf8_string_with_index(
+	result = libfvalue_integer_get_byte_stream_size(
 	          integer,
 	          NULL,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          LIBFVALUE_ENDIAN_BIG,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1517,11 +1632,6 @@ int fvalue_test_integer_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1565,19 +1675,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_to_utf8_string_with_index function
+/* Tests the libfvalue_integer_copy_from_integer function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_to_utf8_string_with_index(
+int fvalue_test_integer_copy_from_integer(
      void )
 {
-	uint8_t expected_utf8_string[ 11 ] = {
-		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
-	uint8_t utf8_string[ 32 ];
-
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
-	size_t string_index          = 0;
 	int result                   = 0;
 
 	/* Initialize test
@@ -1599,6 +1704,8 @@ int fvalue_test_integer_copy_to_utf8_string_with_index(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libfvalue_integer_copy_from_integer(
 	          integer,
 	          (uint64_t) 0x12345678UL,
@@ -1610,56 +1717,21 @@ int fvalue_test_integer_copy_to_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
-	string_index = 0;
-
-	result = libfvalue_integer_copy_to_utf8_string_with_index(
-	          integer,
-	          utf8_string,
-	          32,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
-	          &error );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 11 );
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer->value",
+	 integer->value,
+	 (uint64_t) 0x12345678UL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          expected_utf8_string,
-	          utf8_string,
-	          sizeof( uint8_t ) * 11 );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
 	/* Test error cases
 	 */
-	string_index = 0;
-
-	result = libfvalue_integer_copy_to_utf8_string_with_index(
+	result = libfvalue_integer_copy_from_integer(
 	          NULL,
-	          utf8_string,
+	          (uint64_t) 0x12345678UL,
 	          32,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1667,11 +1739,6 @@ int fvalue_test_integer_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1679,12 +1746,10 @@ int fvalue_test_integer_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_to_utf8_string_with_index(
+	result = libfvalue_integer_copy_from_integer(
 	          integer,
-	          NULL,
-	          32,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          (uint64_t) 0x12345678UL,
+	          4,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1692,11 +1757,6 @@ int fvalue_test_integer_copy_to_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1740,18 +1800,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_from_utf16_string_with_index function
+/* Tests the libfvalue_integer_copy_to_integer function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_from_utf16_string_with_index(
+int fvalue_test_integer_copy_to_integer(
      void )
 {
-	uint16_t utf16_string[ 11 ] = {
-		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
-
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
-	size_t string_index          = 0;
+	size_t integer_value_size    = 0;
+	uint64_t integer_value       = 0;
 	int result                   = 0;
 
 	/* Initialize test
@@ -1773,11 +1831,18 @@ int fvalue_test_integer_copy_from_utf16_string_with_index(
 	 "error",
 	 error );
 
-	result = libfvalue_integer_copy_from_byte_stream(
+	integer->value      = (uint64_t) 0x12345678UL;
+	integer->value_size = 32;
+
+	/* Test regular cases
+	 */
+	integer_value      = 0;
+	integer_value_size = 0;
+
+	result = libfvalue_integer_copy_to_integer(
 	          integer,
-	          (uint8_t *) "\x12\x34\x56\x78",
-	          4,
-	          LIBFVALUE_ENDIAN_BIG,
+	          &integer_value,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1786,55 +1851,56 @@ int fvalue_test_integer_copy_from_utf16_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer->value",
-	 integer->value,
+	 "integer_value",
+	 integer_value,
 	 (uint64_t) 0x12345678UL );
 
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "integer_value_size",
+	 integer_value_size,
+	 (size_t) 32 );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	string_index = 0;
+	integer_value      = 0;
+	integer_value_size = 0;
 
-	result = libfvalue_integer_copy_from_utf16_string_with_index(
-	          integer,
-	          utf16_string,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	result = libfvalue_integer_copy_to_integer(
+	          NULL,
+	          &integer_value,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_UINT64(
-	 "integer->value",
-	 integer->value,
-	 (uint64_t) 0x12345678UL );
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 10 );
+	 "integer_value_size",
+	 integer_value_size,
+	 (size_t) 0 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	string_index = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_integer_copy_from_utf16_string_with_index(
+	result = libfvalue_integer_copy_to_integer(
+	          integer,
 	          NULL,
-	          utf16_string,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &integer_value_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1842,9 +1908,14 @@ int fvalue_test_integer_copy_from_utf16_string_with_index(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
+
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1854,12 +1925,10 @@ int fvalue_test_integer_copy_from_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_from_utf16_string_with_index(
+	result = libfvalue_integer_copy_to_integer(
 	          integer,
+	          &integer_value,
 	          NULL,
-	          10,
-	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1867,9 +1936,14 @@ int fvalue_test_integer_copy_from_utf16_string_with_index(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0 );
+
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "integer_value_size",
+	 integer_value_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -1915,19 +1989,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_to_utf16_string_with_index function
+/* Tests the libfvalue_integer_get_string_size function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_to_utf16_string_with_index(
+int fvalue_test_integer_get_string_size(
      void )
 {
-	uint16_t expected_utf16_string[ 11 ] = {
-		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
-	uint16_t utf16_string[ 32 ];
-
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
-	size_t string_index          = 0;
+	size_t string_size           = 0;
 	int result                   = 0;
 
 	/* Initialize test
@@ -1966,13 +2036,11 @@ int fvalue_test_integer_copy_to_utf16_string_with_index(
 
 	/* Test regular cases
 	 */
-	string_index = 0;
+	string_size = 0;
 
-	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	result = libfvalue_integer_get_string_size(
 	          integer,
-	          utf16_string,
-	          32,
-	          &string_index,
+	          &string_size,
 	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
@@ -1982,33 +2050,21 @@ int fvalue_test_integer_copy_to_utf16_string_with_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 11 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          expected_utf16_string,
-	          utf16_string,
-	          sizeof( uint16_t ) * 11 );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
 	/* Test error cases
 	 */
-	string_index = 0;
+	string_size = 0;
 
-	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	result = libfvalue_integer_get_string_size(
 	          NULL,
-	          utf16_string,
-	          32,
-	          &string_index,
+	          &string_size,
 	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
@@ -2018,8 +2074,8 @@ int fvalue_test_integer_copy_to_utf16_string_with_index(
 	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -2029,11 +2085,9 @@ int fvalue_test_integer_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	result = libfvalue_integer_get_string_size(
 	          integer,
 	          NULL,
-	          32,
-	          &string_index,
 	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
 	          &error );
 
@@ -2043,8 +2097,8 @@ int fvalue_test_integer_copy_to_utf16_string_with_index(
 	 -1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
+	 "string_size",
+	 string_size,
 	 (size_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
@@ -2090,13 +2144,13 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_from_utf32_string_with_index function
+/* Tests the libfvalue_integer_copy_from_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_from_utf32_string_with_index(
+int fvalue_test_integer_copy_from_utf8_string_with_index(
      void )
 {
-	uint32_t utf32_string[ 11 ] = {
+	uint8_t utf8_string[ 11 ] = {
 		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
 
 	libcerror_error_t *error     = NULL;
@@ -2148,9 +2202,9 @@ int fvalue_test_integer_copy_from_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	result = libfvalue_integer_copy_from_utf8_string_with_index(
 	          integer,
-	          utf32_string,
+	          utf8_string,
 	          10,
 	          &string_index,
 	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
@@ -2179,9 +2233,9 @@ int fvalue_test_integer_copy_from_utf32_string_with_index(
 	 */
 	string_index = 0;
 
-	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	result = libfvalue_integer_copy_from_utf8_string_with_index(
 	          NULL,
-	          utf32_string,
+	          utf8_string,
 	          10,
 	          &string_index,
 	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
@@ -2204,7 +2258,7 @@ int fvalue_test_integer_copy_from_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	result = libfvalue_integer_copy_from_utf8_string_with_index(
 	          integer,
 	          NULL,
 	          10,
@@ -2265,15 +2319,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_integer_copy_to_utf32_string_with_index function
+/* Tests the libfvalue_integer_copy_to_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_integer_copy_to_utf32_string_with_index(
+int fvalue_test_integer_copy_to_utf8_string_with_index(
      void )
 {
-	uint32_t expected_utf32_string[ 11 ] = {
+	uint8_t expected_utf8_string[ 11 ] = {
 		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
-	uint32_t utf32_string[ 32 ];
+	uint8_t utf8_string[ 32 ];
 
 	libcerror_error_t *error     = NULL;
 	libfvalue_integer_t *integer = NULL;
@@ -2316,14 +2370,1451 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 
 	/* Test regular cases
 	 */
-	string_index = 0;
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf8_string_with_index(
+	          integer,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 11 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string,
+	          utf8_string,
+	          sizeof( uint8_t ) * 11 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf8_string_with_index(
+	          NULL,
+	          utf8_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_utf8_string_with_index(
+	          integer,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_integer_free(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integer != NULL )
+	{
+		libfvalue_integer_free(
+		 &integer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_from_utf16_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_from_utf16_string_with_index(
+     void )
+{
+	uint16_t utf16_string[ 11 ] = {
+		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
+
+	libcerror_error_t *error     = NULL;
+	libfvalue_integer_t *integer = NULL;
+	size_t string_index          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_integer_initialize(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_byte_stream(
+	          integer,
+	          (uint8_t *) "\x12\x34\x56\x78",
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer->value",
+	 integer->value,
+	 (uint64_t) 0x12345678UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_from_utf16_string_with_index(
+	          integer,
+	          utf16_string,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer->value",
+	 integer->value,
+	 (uint64_t) 0x12345678UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_from_utf16_string_with_index(
+	          NULL,
+	          utf16_string,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_from_utf16_string_with_index(
+	          integer,
+	          NULL,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_integer_free(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integer != NULL )
+	{
+		libfvalue_integer_free(
+		 &integer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_to_utf16_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_to_utf16_string_with_index(
+     void )
+{
+	uint16_t expected_utf16_string[ 11 ] = {
+		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error     = NULL;
+	libfvalue_integer_t *integer = NULL;
+	size_t string_index          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_integer_initialize(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_integer(
+	          integer,
+	          (uint64_t) 0x12345678UL,
+	          32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	          integer,
+	          utf16_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 11 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf16_string,
+	          utf16_string,
+	          sizeof( uint16_t ) * 11 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	          NULL,
+	          utf16_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_utf16_string_with_index(
+	          integer,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_integer_free(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integer != NULL )
+	{
+		libfvalue_integer_free(
+		 &integer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_from_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_from_utf32_string_with_index(
+     void )
+{
+	uint32_t utf32_string[ 11 ] = {
+		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
+
+	libcerror_error_t *error     = NULL;
+	libfvalue_integer_t *integer = NULL;
+	size_t string_index          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_integer_initialize(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_byte_stream(
+	          integer,
+	          (uint8_t *) "\x12\x34\x56\x78",
+	          4,
+	          LIBFVALUE_ENDIAN_BIG,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer->value",
+	 integer->value,
+	 (uint64_t) 0x12345678UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	          integer,
+	          utf32_string,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer->value",
+	 integer->value,
+	 (uint64_t) 0x12345678UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 10 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	          NULL,
+	          utf32_string,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_from_utf32_string_with_index(
+	          integer,
+	          NULL,
+	          10,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_integer_free(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integer != NULL )
+	{
+		libfvalue_integer_free(
+		 &integer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_to_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_to_utf32_string_with_index(
+     void )
+{
+	uint32_t expected_utf32_string[ 11 ] = {
+		'0', 'x', '1', '2', '3', '4', '5', '6', '7', '8', 0 };
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error     = NULL;
+	libfvalue_integer_t *integer = NULL;
+	size_t string_index          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_integer_initialize(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_integer(
+	          integer,
+	          (uint64_t) 0x12345678UL,
+	          32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf32_string_with_index(
+	          integer,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 11 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string,
+	          utf32_string,
+	          sizeof( uint32_t ) * 11 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_integer_copy_to_utf32_string_with_index(
+	          NULL,
+	          utf32_string,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_utf32_string_with_index(
+	          integer,
+	          NULL,
+	          32,
+	          &string_index,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_integer_free(
+	          &integer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "integer",
+	 integer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integer != NULL )
+	{
+		libfvalue_integer_free(
+		 &integer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_get_number_of_decimal_digits function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_get_number_of_decimal_digits(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t integer_value   = 0;
+	uint8_t expected_digits  = 0;
+	uint8_t number_of_digits = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_integer_get_number_of_decimal_digits(
+	          0,
+	          &number_of_digits,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_digits",
+	 number_of_digits,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the values around each power of 10
+	 */
+	integer_value = 1;
+
+	for( expected_digits = 1;
+	     expected_digits < 20;
+	     expected_digits++ )
+	{
+		if( expected_digits > 1 )
+		{
+			result = libfvalue_integer_get_number_of_decimal_digits(
+			          integer_value - 1,
+			          &number_of_digits,
+			          &error );
+
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FVALUE_TEST_ASSERT_EQUAL_UINT8(
+			 "number_of_digits",
+			 number_of_digits + 1,
+			 expected_digits );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfvalue_integer_get_number_of_decimal_digits(
+		          integer_value,
+		          &number_of_digits,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT8(
+		 "number_of_digits",
+		 number_of_digits,
+		 expected_digits );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		integer_value *= 10;
+	}
+	result = libfvalue_integer_get_number_of_decimal_digits(
+	          0xffffffffffffffffUL,
+	          &number_of_digits,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_digits",
+	 number_of_digits,
+	 20 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_integer_get_number_of_decimal_digits(
+	          0,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_to_decimal_digits function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_to_decimal_digits(
+     void )
+{
+	uint8_t digits[ 20 ];
+
+	uint8_t expected_digits[ 21 ] = "18446744073709551615";
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          0xffffffffffffffffUL,
+	          digits,
+	          20,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          digits,
+	          expected_digits,
+	          20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          1234567,
+	          digits,
+	          7,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          digits,
+	          "1234567",
+	          7 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with leading zeros
+	 */
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          42,
+	          digits,
+	          5,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          digits,
+	          "00042",
+	          5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          42,
+	          NULL,
+	          2,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          42,
+	          digits,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_to_decimal_digits(
+	          42,
+	          digits,
+	          1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_integer_copy_from_eight_decimal_digits function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_integer_copy_from_eight_decimal_digits(
+     void )
+{
+	uint8_t digits1[ 9 ]  = "12345678";
+	uint8_t digits2[ 9 ]  = "00000009";
+	uint8_t digits3[ 9 ]  = "99999999";
+	uint8_t invalid1[ 9 ] = "1234567/";
+	uint8_t invalid2[ 9 ] = ":2345678";
+	uint8_t invalid3[ 9 ] = "1234\0678";
+
+	libcerror_error_t *error = NULL;
+	uint32_t integer_value   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          digits1,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "integer_value",
+	 integer_value,
+	 (uint32_t) 12345678 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          digits2,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "integer_value",
+	 integer_value,
+	 (uint32_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          digits3,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "integer_value",
+	 integer_value,
+	 (uint32_t) 99999999 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test characters that are not decimal digits
+	 */
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          invalid1,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          invalid2,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          invalid3,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          NULL,
+	          &integer_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_integer_copy_from_eight_decimal_digits(
+	          digits1,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_with_index_copy_from_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_with_index_copy_from_integer(
+     void )
+{
+	uint32_t expected_utf32_string_decimal[ 5 ] = {
+		'4', '8', '9', '0', 0 };
+	uint32_t utf32_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 1;
+
+	result = libfvalue_string_with_index_copy_from_integer(
+	          (uint8_t *) utf32_string,
+	          4,
+	          32,
+	          &string_index,
+	          4890,
+	          16,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 6 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf32_string_decimal,
+	          &( utf32_string[ 1 ] ),
+	          sizeof( uint32_t ) * 5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfvalue_string_with_index_copy_from_integer(
+	          NULL,
+	          4,
+	          32,
+	          &string_index,
+	          4890,
+	          16,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_with_index_copy_from_integer(
+	          (uint8_t *) utf32_string,
+	          3,
+	          32,
+	          &string_index,
+	          4890,
+	          16,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_with_index_copy_from_integer(
+	          (uint8_t *) utf32_string,
+	          4,
+	          4,
+	          &string_index,
+	          4890,
+	          16,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_with_index_copy_to_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_with_index_copy_to_integer(
+     void )
+{
+	uint32_t utf32_string1[ 6 ]        = { ' ', '4', '8', '9', '0', 0 };
+	uint32_t utf32_string_invalid[ 5 ] = { '4', '8', 0x00010039UL, '0', 0 };
+	libcerror_error_t *error           = NULL;
+	size_t string_index                = 0;
+	uint64_t integer_value             = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	string_index  = 1;
+	integer_value = 0;
 
-	result = libfvalue_integer_copy_to_utf32_string_with_index(
-	          integer,
-	          utf32_string,
-	          32,
+	result = libfvalue_string_with_index_copy_to_integer(
+	          (uint8_t *) utf32_string1,
+	          4,
+	          5,
 	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2334,32 +3825,29 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
 	 "string_index",
 	 string_index,
-	 (size_t) 11 );
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 4890 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          expected_utf32_string,
-	          utf32_string,
-	          sizeof( uint32_t ) * 11 );
-
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
 	/* Test error cases
 	 */
 	string_index = 0;
 
-	result = libfvalue_integer_copy_to_utf32_string_with_index(
+	result = libfvalue_string_with_index_copy_to_integer(
 	          NULL,
-	          utf32_string,
-	          32,
+	          4,
+	          5,
 	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2367,11 +3855,6 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2379,12 +3862,14 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_integer_copy_to_utf32_string_with_index(
-	          integer,
-	          NULL,
-	          32,
+	result = libfvalue_string_with_index_copy_to_integer(
+	          (uint8_t *) utf32_string1,
+	          3,
+	          5,
 	          &string_index,
-	          LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -2392,11 +3877,6 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2404,25 +3884,30 @@ int fvalue_test_integer_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	/* Test a character outside the ASCII range that narrows to a digit
 	 */
-	result = libfvalue_integer_free(
-	          &integer,
+	result = libfvalue_string_with_index_copy_to_integer(
+	          (uint8_t *) utf32_string_invalid,
+	          4,
+	          4,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_IS_NULL(
-	 "integer",
-	 integer );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -2431,12 +3916,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( integer != NULL )
-	{
-		libfvalue_integer_free(
-		 &integer,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -3147,13 +4626,15 @@ on_error:
 int fvalue_test_utf8_string_with_index_copy_to_integer(
      void )
 {
-	uint8_t utf8_string1[ 5 ]        = { '4', '8', '9', '0', 0 };
-	uint8_t utf8_string2[ 3 ]        = { '-', '1', 0 };
-	uint8_t utf8_string_invalid[ 3 ] = { '/', ':', 0 };
-	libcerror_error_t *error         = NULL;
-	size_t string_index              = 0;
-	uint64_t integer_value           = 0;
-	int result                       = 0;
+	uint8_t utf8_string1[ 5 ]          = { '4', '8', '9', '0', 0 };
+	uint8_t utf8_string2[ 3 ]          = { '-', '1', 0 };
+	uint8_t utf8_string3[ 21 ]         = { '1', '8', '4', '4', '6', '7', '4', '4', '0', '7', '3', '7', '0', '9', '5', '5', '1', '6', '1', '5', 0 };
+	uint8_t utf8_string_invalid[ 3 ]   = { '/', ':', 0 };
+	uint8_t utf8_string_invalid2[ 10 ] = { '1', '2', '3', '4', '5', '6', '7', 0xc4, '9', 0 };
+	libcerror_error_t *error           = NULL;
+	size_t string_index                = 0;
+	uint64_t integer_value             = 0;
+	int result                         = 0;
 
 	/* Test regular cases
 	 */
@@ -3191,6 +4672,37 @@ int fvalue_test_utf8_string_with_index_copy_to_integer(
 	string_index  = 0;
 	integer_value = 0;
 
+	result = libfvalue_utf8_string_with_index_copy_to_integer(
+	          utf8_string3,
+	          20,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index  = 0;
+	integer_value = 0;
+
 	result = libfvalue_utf8_string_with_index_copy_to_integer(
 	          utf8_string2,
 	          2,
@@ -3476,6 +4988,30 @@ int fvalue_test_utf8_string_with_index_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
+	string_index  = 0;
+	integer_value = 0;
+
+	result = libfvalue_utf8_string_with_index_copy_to_integer(
+	          utf8_string_invalid2,
+	          9,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -3947,13 +5483,15 @@ on_error:
 int fvalue_test_utf16_string_with_index_copy_to_integer(
      void )
 {
-	uint16_t utf16_string1[ 5 ]        = { '4', '8', '9', '0', 0 };
-	uint16_t utf16_string2[ 3 ]        = { '-', '1', 0 };
-	uint16_t utf16_string_invalid[ 3 ] = { '/', ':', 0 };
-	libcerror_error_t *error           = NULL;
-	size_t string_index                = 0;
-	uint64_t integer_value             = 0;
-	int result                         = 0;
+	uint16_t utf16_string1[ 5 ]          = { '4', '8', '9', '0', 0 };
+	uint16_t utf16_string2[ 3 ]          = { '-', '1', 0 };
+	uint16_t utf16_string3[ 21 ]         = { '1', '8', '4', '4', '6', '7', '4', '4', '0', '7', '3', '7', '0', '9', '5', '5', '1', '6', '1', '5', 0 };
+	uint16_t utf16_string_invalid[ 3 ]   = { '/', ':', 0 };
+	uint16_t utf16_string_invalid2[ 10 ] = { '1', '2', '3', '4', '5', '6', '7', 0x0130, '9', 0 };
+	libcerror_error_t *error             = NULL;
+	size_t string_index                  = 0;
+	uint64_t integer_value               = 0;
+	int result                           = 0;
 
 	/* Test regular cases
 	 */
@@ -3991,6 +5529,37 @@ int fvalue_test_utf16_string_with_index_copy_to_integer(
 	string_index  = 0;
 	integer_value = 0;
 
+	result = libfvalue_utf16_string_with_index_copy_to_integer(
+	          utf16_string3,
+	          20,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index  = 0;
+	integer_value = 0;
+
 	result = libfvalue_utf16_string_with_index_copy_to_integer(
 	          utf16_string2,
 	          2,
@@ -4276,6 +5845,30 @@ int fvalue_test_utf16_string_with_index_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
+	string_index  = 0;
+	integer_value = 0;
+
+	result = libfvalue_utf16_string_with_index_copy_to_integer(
+	          utf16_string_invalid2,
+	          9,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -4747,13 +6340,15 @@ on_error:
 int fvalue_test_utf32_string_with_index_copy_to_integer(
      void )
 {
-	uint32_t utf32_string1[ 5 ]        = { '4', '8', '9', '0', 0 };
-	uint32_t utf32_string2[ 3 ]        = { '-', '1', 0 };
-	uint32_t utf32_string_invalid[ 3 ] = { '/', ':', 0 };
-	libcerror_error_t *error           = NULL;
-	size_t string_index                = 0;
-	uint64_t integer_value             = 0;
-	int result                         = 0;
+	uint32_t utf32_string1[ 5 ]          = { '4', '8', '9', '0', 0 };
+	uint32_t utf32_string2[ 3 ]          = { '-', '1', 0 };
+	uint32_t utf32_string3[ 21 ]         = { '1', '8', '4', '4', '6', '7', '4', '4', '0', '7', '3', '7', '0', '9', '5', '5', '1', '6', '1', '5', 0 };
+	uint32_t utf32_string_invalid[ 3 ]   = { '/', ':', 0 };
+	uint32_t utf32_string_invalid2[ 10 ] = { '1', '2', '3', '4', '5', '6', '7', 0x0130, '9', 0 };
+	libcerror_error_t *error             = NULL;
+	size_t string_index                  = 0;
+	uint64_t integer_value               = 0;
+	int result                           = 0;
 
 	/* Test regular cases
 	 */
@@ -4791,6 +6386,37 @@ int fvalue_test_utf32_string_with_index_copy_to_integer(
 	string_index  = 0;
 	integer_value = 0;
 
+	result = libfvalue_utf32_string_with_index_copy_to_integer(
+	          utf32_string3,
+	          20,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_value",
+	 integer_value,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index  = 0;
+	integer_value = 0;
+
 	result = libfvalue_utf32_string_with_index_copy_to_integer(
 	          utf32_string2,
 	          2,
@@ -5076,6 +6702,30 @@ int fvalue_test_utf32_string_with_index_copy_to_integer(
 	libcerror_error_free(
 	 &error );
 
+	string_index  = 0;
+	integer_value = 0;
+
+	result = libfvalue_utf32_string_with_index_copy_to_integer(
+	          utf32_string_invalid2,
+	          9,
+	          &string_index,
+	          &integer_value,
+	          64,
+	          LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -5121,6 +6771,18 @@ int main(
 	 "libfvalue_integer_copy_from_byte_stream",
 	 fvalue_test_integer_copy_from_byte_stream );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_copy_from_byte_stream_array",
+	 fvalue_test_integer_copy_from_byte_stream_array );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_copy_to_byte_stream",
+	 fvalue_test_integer_copy_to_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_get_byte_stream_size",
+	 fvalue_test_integer_get_byte_stream_size );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_integer_copy_from_integer",
 	 fvalue_test_integer_copy_from_integer );
@@ -5157,6 +6819,26 @@ int main(
 	 "libfvalue_integer_copy_to_utf32_string_with_index",
 	 fvalue_test_integer_copy_to_utf32_string_with_index );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_get_number_of_decimal_digits",
+	 fvalue_test_integer_get_number_of_decimal_digits );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_copy_to_decimal_digits",
+	 fvalue_test_integer_copy_to_decimal_digits );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_integer_copy_from_eight_decimal_digits",
+	 fvalue_test_integer_copy_from_eight_decimal_digits );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_with_index_copy_from_integer",
+	 fvalue_test_string_with_index_copy_from_integer );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_with_index_copy_to_integer",
+	 fvalue_test_string_with_index_copy_to_integer );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 	FVALUE_TEST_RUN(
@@ -31,6 +31,7 @@
 #undef __USE_GNU
 #endif
 
+#include "fvalue_test_libfvalue.h"
 #include "fvalue_test_memory.h"
 
 #if defined( HAVE_FVALUE_TEST_MEMORY )
@@ -197,3 +198,39 @@ void *realloc(
 
 #endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
 
+/* Retrieves the number of allocations and reallocations counted by the library statistics
+ * This can be used to determine the number of memory allocation failure tests of a function
+ * Returns 1 if successful, 0 if statistics are not available or -1 on error
+ */
+int fvalue_test_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations )
+{
+	uint64_t subsystem_number_of_allocations = 0;
+	int result                               = 0;
+	int subsystem                            = 0;
+
+	if( number_of_allocations == NULL )
+	{
+		return( -1 );
+	}
+	*number_of_allocations = 0;
+
+	for( subsystem = LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE;
+	     subsystem <= LIBFVALUE_STATISTICS_SUBSYSTEM_ARENA;
+	     subsystem++ )
+	{
+		result = libfvalue_statistics_get(
+		          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS,
+		          subsystem,
+		          &subsystem_number_of_allocations,
+		          NULL );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		*number_of_allocations += subsystem_number_of_allocations;
+	}
+	return( 1 );
+}
+
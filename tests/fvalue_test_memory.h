@@ -23,6 +23,7 @@
 #define _FVALUE_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,6 +59,9 @@ extern int fvalue_test_realloc_attempts_before_fail;
 
 #endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
 
+int fvalue_test_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations );
+
 #if defined( __cplusplus )
 }
 #endif
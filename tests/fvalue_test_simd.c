@@ -0,0 +1,178 @@
+/*
+ * Library SIMD functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_simd.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON )
+
+uint8_t fvalue_test_simd_characters[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'B', '+', '/', '=', 0x7f };
+
+/* Tests the libfvalue_simd_store_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_simd_store_characters(
+     void )
+{
+	uint32_t utf32_string[ 17 ];
+	uint16_t utf16_string[ 17 ];
+	uint8_t utf8_string[ 17 ];
+
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 )
+	__m128i characters = _mm_loadu_si128(
+	                      (__m128i *) fvalue_test_simd_characters );
+#else
+	uint8x16_t characters = vld1q_u8(
+	                         fvalue_test_simd_characters );
+#endif
+	int character_index = 0;
+	int result          = 0;
+
+	/* Test regular cases
+	 * The character following the 16 characters is not overwritten
+	 */
+	utf8_string[ 16 ] = 0xff;
+
+	libfvalue_simd_store_characters(
+	 utf8_string,
+	 1,
+	 characters );
+
+	result = memory_compare(
+	          utf8_string,
+	          fvalue_test_simd_characters,
+	          16 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "utf8_string[ 16 ]",
+	 (uint32_t) utf8_string[ 16 ],
+	 (uint32_t) 0xff );
+
+	utf16_string[ 16 ] = 0xffff;
+
+	libfvalue_simd_store_characters(
+	 (uint8_t *) utf16_string,
+	 2,
+	 characters );
+
+	for( character_index = 0;
+	     character_index < 16;
+	     character_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf16_string[ character_index ]",
+		 (uint32_t) utf16_string[ character_index ],
+		 (uint32_t) fvalue_test_simd_characters[ character_index ] );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_string[ 16 ]",
+	 (uint32_t) utf16_string[ 16 ],
+	 (uint32_t) 0xffff );
+
+	utf32_string[ 16 ] = 0xffffffffUL;
+
+	libfvalue_simd_store_characters(
+	 (uint8_t *) utf32_string,
+	 4,
+	 characters );
+
+	for( character_index = 0;
+	     character_index < 16;
+	     character_index++ )
+	{
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "utf32_string[ character_index ]",
+		 utf32_string[ character_index ],
+		 (uint32_t) fvalue_test_simd_characters[ character_index ] );
+	}
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "utf32_string[ 16 ]",
+	 utf32_string[ 16 ],
+	 (uint32_t) 0xffffffffUL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_simd_store_characters",
+	 fvalue_test_simd_store_characters );
+
+#endif /* defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+#if defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( LIBFVALUE_SIMD_HAVE_SSE2 ) || defined( LIBFVALUE_SIMD_HAVE_NEON ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+}
+
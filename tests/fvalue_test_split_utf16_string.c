@@ -51,6 +51,7 @@ int fvalue_test_split_utf16_string_initialize(
 	int result                                   = 0;
 
 #if defined( HAVE_FVALUE_TEST_MEMORY )
+	uint64_t number_of_allocations               = 0;
 	int number_of_malloc_fail_tests              = 4;
 	int number_of_memset_fail_tests              = 3;
 	int test_number                              = 0;
@@ -62,6 +63,20 @@ int fvalue_test_split_utf16_string_initialize(
 
 	/* Test regular cases
 	 */
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	result = libfvalue_statistics_reset(
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif
 	result = libfvalue_split_utf16_string_initialize(
 	          &split_string,
 	          utf16_string,
@@ -82,6 +97,24 @@ int fvalue_test_split_utf16_string_initialize(
 	 "error",
 	 error );
 
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	/* If the library was built with --enable-statistics the number of malloc
+	 * failure tests is the number of allocations counted in the regular case
+	 */
+	result = fvalue_test_memory_get_number_of_allocations(
+	          &number_of_allocations );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	if( result == 1 )
+	{
+		number_of_malloc_fail_tests = (int) number_of_allocations;
+	}
+#endif
+
 	result = libfvalue_split_utf16_string_free(
 	          &split_string,
 	          &error );
@@ -0,0 +1,692 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+/* Tests the libfvalue_statistics_get function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_statistics_get(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS,
+	          LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_CONVERSIONS,
+	          LIBFVALUE_VALUE_TYPE_NT_SECURITY_IDENTIFIER,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_LOOKUP_SCAN_LENGTH,
+	          0,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_statistics_get(
+	          0,
+	          0,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_ALLOCATED_SIZE,
+	          -1,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_ALLOCATED_SIZE,
+	          LIBFVALUE_STATISTICS_SUBSYSTEM_ARENA + 1,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_LOOKUPS,
+	          1,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS,
+	          LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_statistics_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_statistics_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_statistics_reset(
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_LOOKUPS,
+	          0,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the statistics counters of a value
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_statistics_value(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfvalue_value_t *value       = NULL;
+	uint64_t number_of_allocations = 0;
+	uint64_t number_of_conversions = 0;
+	uint32_t value_32bit           = 0;
+	int result                     = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	uint64_t test_number           = 0;
+#endif
+
+	result = libfvalue_statistics_reset(
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		/* The library was built without statistics
+		 */
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvalue_test_memory_get_number_of_allocations(
+	          &number_of_allocations );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "number_of_allocations",
+	 (int64_t) number_of_allocations,
+	 (int64_t) 0 );
+
+	result = libfvalue_value_set_data(
+	          value,
+	          (uint8_t *) "\x78\x56\x34\x12",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x12345678UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_CONVERSIONS,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &number_of_conversions,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_conversions",
+	 number_of_conversions,
+	 (uint64_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	/* Every allocation counted by the statistics is a point of failure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_allocations;
+	     test_number++ )
+	{
+		/* Test libfvalue_value_type_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = (int) test_number;
+
+		result = libfvalue_value_type_initialize(
+		          &value,
+		          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( value != NULL )
+			{
+				libfvalue_value_free(
+				 &value,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "value",
+			 value );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the statistics counters of a table
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_statistics_table(
+     void )
+{
+	uint8_t value_identifier[ 5 ] = { 't', 'e', 's', 't', 0 };
+
+	libcerror_error_t *error      = NULL;
+	libfvalue_table_t *table      = NULL;
+	libfvalue_value_t *value      = NULL;
+	uint64_t number_of_lookups    = 0;
+	uint64_t scan_length          = 0;
+	int result                    = 0;
+
+	result = libfvalue_statistics_reset(
+	          &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		/* The library was built without statistics
+		 */
+		return( 1 );
+	}
+	/* Initialize test
+	 */
+	result = libfvalue_table_initialize(
+	          &table,
+	          1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          value_identifier,
+	          5,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_set_value_by_index(
+	          table,
+	          0,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table now manages the value
+	 */
+	value = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          value_identifier,
+	          5,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_LOOKUPS,
+	          0,
+	          &number_of_lookups,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_lookups",
+	 number_of_lookups,
+	 (uint64_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_statistics_get(
+	          LIBFVALUE_STATISTICS_COUNTER_TYPE_LOOKUP_SCAN_LENGTH,
+	          0,
+	          &scan_length,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_length",
+	 scan_length,
+	 (uint64_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_statistics_get",
+	 fvalue_test_statistics_get );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_statistics_reset",
+	 fvalue_test_statistics_reset );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_statistics_value",
+	 fvalue_test_statistics_value );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_statistics_table",
+	 fvalue_test_statistics_table );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -892,21 +892,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_string_copy_from_utf8_string_with_index function
+/* Tests the libfvalue_string_set_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_string_copy_from_utf8_string_with_index(
+int fvalue_test_string_set_byte_stream(
      void )
 {
-	uint8_t utf8_error_string[ 4 ] = {
-		0xff, 0xff, 0xff, 0 };
-
-	uint8_t utf8_string[ 9 ] = {
-		'1', '2', '3', '4', '5', '6', '7', '8', 0 };
-
+	uint8_t byte_stream[ 5 ]   = { 't', 'e', 's', 't', 0 };
 	libcerror_error_t *error   = NULL;
 	libfvalue_string_t *string = NULL;
-	size_t string_index        = 0;
 	int result                 = 0;
 
 	/* Initialize test
@@ -928,11 +922,16 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 "error",
 	 error );
 
-	result = libfvalue_string_copy_from_byte_stream(
+	/* Test regular cases
+	 */
+	/* Test with a copy of the byte stream
+	 */
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          (uint8_t *) "12345678",
-	          9,
+	          byte_stream,
+	          5,
 	          LIBFVALUE_CODEPAGE_ASCII,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -944,18 +943,24 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	string_index = 0;
+	FVALUE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "string->data",
+	 (ssize_t) ( string->data - byte_stream ),
+	 (ssize_t) 0 );
 
-	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "string->flags",
+	 (int) ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ),
+	 (int) LIBFVALUE_VALUE_FLAG_DATA_MANAGED );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	/* Test with a reference to the byte stream
+	 */
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          byte_stream,
+	          5,
+	          LIBFVALUE_CODEPAGE_ASCII,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -963,77 +968,71 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "string->data",
+	 (ssize_t) ( string->data - byte_stream ),
+	 (ssize_t) 0 );
 
-	string->codepage = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string->data_size",
+	 string->data_size,
+	 (size_t) 5 );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "string->flags",
+	 (int) ( string->flags & LIBFVALUE_VALUE_FLAG_DATA_MANAGED ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_string_set_byte_stream(
+	          NULL,
+	          byte_stream,
+	          5,
+	          LIBFVALUE_CODEPAGE_ASCII,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
-
-	string->codepage = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          byte_stream,
+	          5,
+	          LIBFVALUE_CODEPAGE_ASCII,
+	          0xff,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
-
-	string->codepage = LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	/* Clean up
+	 */
+	result = libfvalue_string_free(
+	          &string,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1041,25 +1040,47 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
+	return( 1 );
 
-	string->codepage = LIBFVALUE_CODEPAGE_UTF7;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		libfvalue_string_free(
+		 &string,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+/* Tests the libfvalue_string_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 16 ];
+
+	libcerror_error_t *error   = NULL;
+	libfvalue_string_t *string = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_string_initialize(
+	          &string,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1067,25 +1088,21 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
-
-	string->codepage = LIBFVALUE_CODEPAGE_UTF8;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	/* Test regular cases
+	 */
+	result = libfvalue_string_copy_from_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          (uint8_t *) "Hello",
+	          5,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1093,25 +1110,15 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_index = 0;
-
-	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_to_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          byte_stream,
+	          16,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1119,27 +1126,27 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	string_index = 0;
+	result = memory_compare(
+	          byte_stream,
+	          "Hello",
+	          5 );
 
-	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	/* Test error cases
+	 */
+	result = libfvalue_string_copy_to_byte_stream(
 	          NULL,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          byte_stream,
+	          16,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1147,11 +1154,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1159,12 +1161,11 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_to_byte_stream(
 	          string,
-	          utf8_string,
-	          (size_t) SSIZE_MAX + 1,
-	          &string_index,
-	          0,
+	          NULL,
+	          16,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1172,11 +1173,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1184,12 +1180,11 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_to_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          NULL,
-	          0,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1197,11 +1192,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1209,14 +1199,11 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	string_index = 9;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_to_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          byte_stream,
+	          16,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1224,11 +1211,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 9 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1236,14 +1218,11 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	string_index = 0;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_to_byte_stream(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0xffffffffUL,
+	          byte_stream,
+	          4,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1251,11 +1230,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1263,132 +1237,116 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	string->codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	/* Clean up
+	 */
+	result = libfvalue_string_free(
+	          &string,
 	          &error );
 
-	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
-
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
 
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf16_stream_size_from_utf8 failing
-	 */
-	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		libfvalue_string_free(
+		 &string,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_error_string,
-	          4,
-	          &string_index,
-	          0,
+/* Tests the libfvalue_string_get_byte_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_get_byte_stream_size(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfvalue_string_t *string = NULL;
+	size_t byte_stream_size    = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_string_initialize(
+	          &string,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf32_stream_size_from_utf8 failing
+	/* Test regular cases
 	 */
-	string->codepage = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_copy_from_byte_stream(
 	          string,
-	          utf8_error_string,
-	          4,
-	          &string_index,
-	          0,
+	          (uint8_t *) "Hello",
+	          5,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf7_stream_size_from_utf8 failing
-	 */
-	string->codepage = LIBFVALUE_CODEPAGE_UTF7;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_get_byte_stream_size(
 	          string,
-	          utf8_error_string,
-	          4,
-	          &string_index,
-	          0,
+	          &byte_stream_size,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 5 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf8_stream_size_from_utf8 failing
+	/* Test error cases
 	 */
-	string->codepage = LIBFVALUE_CODEPAGE_UTF8;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
-	          string,
-	          utf8_error_string,
-	          4,
-	          &string_index,
-	          0,
+	result = libfvalue_string_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1396,11 +1354,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1408,16 +1361,10 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_byte_stream_size_from_utf8 failing
-	 */
-	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_get_byte_stream_size(
 	          string,
-	          utf8_error_string,
-	          4,
-	          &string_index,
-	          0,
+	          NULL,
+	          LIBFVALUE_CODEPAGE_ASCII,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1425,11 +1372,6 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_index",
-	 string_index,
-	 (size_t) 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1437,55 +1379,23 @@ int fvalue_test_string_copy_from_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_FVALUE_TEST_MEMORY )
-
-	/* Test libfvalue_string_copy_from_utf8_string_with_index with malloc failing
-	 */
-	fvalue_test_malloc_attempts_before_fail = 0;
-
-	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
-
-	result = libfvalue_string_copy_from_utf8_string_with_index(
+	result = libfvalue_string_get_byte_stream_size(
 	          string,
-	          utf8_string,
-	          9,
-	          &string_index,
-	          0,
+	          &byte_stream_size,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
 	          &error );
 
-	if( fvalue_test_malloc_attempts_before_fail != -1 )
-	{
-		fvalue_test_malloc_attempts_before_fail = -1;
-
-		FVALUE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		FVALUE_TEST_ASSERT_EQUAL_SIZE(
-		 "string_index",
-		 string_index,
-		 (size_t) 9 );
-
-		FVALUE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	else
-	{
-		FVALUE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		FVALUE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -1523,22 +1433,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_string_get_utf8_string_size function
+/* Tests the libfvalue_string_get_resolved_codepage function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_string_get_utf8_string_size(
+int fvalue_test_string_get_resolved_codepage(
      void )
 {
-	uint8_t scsu_stream[ 9 ]     = { 0xd6, 0x6c, 0x20, 0x66, 0x6c, 0x69, 0x65, 0xdf, 0x74 };
-	uint8_t utf16be_stream[ 10 ] = { 0, 't', 0, 'e', 0, 's', 0, 't', 0, 0 };
-	uint8_t utf16le_stream[ 10 ] = { 't', 0, 'e', 0, 's', 0, 't', 0, 0, 0 };
-	uint8_t utf32be_stream[ 20 ] = { 0, 0, 0, 't', 0, 0, 0, 'e', 0, 0, 0, 's', 0, 0, 0, 't', 0, 0, 0, 0 };
-	uint8_t utf32le_stream[ 20 ] = { 't', 0, 0, 0, 'e', 0, 0, 0, 's', 0, 0, 0, 't', 0, 0, 0, 0, 0, 0, 0 };
-	uint8_t utf8_stream[ 5 ]     = { 't', 'e', 's', 't', 0 };
-	libcerror_error_t *error     = NULL;
-	libfvalue_string_t *string   = NULL;
-	size_t string_size           = 0;
-	int result                   = 0;
+	uint8_t invalid_surrogate_stream[ 4 ] = { 0x00, 0xd8, 'a', 0 };
+	uint8_t padded_stream[ 8 ]            = { 'z', 0, ':', 0, 0, 0, 0x00, 0xd8 };
+	uint8_t surrogate_pair_stream[ 4 ]    = { 0x3d, 0xd8, 0x00, 0xde };
+	uint8_t utf16le_stream[ 6 ]           = { 'a', 0, 'b', 0, 0, 0 };
+	libcerror_error_t *error              = NULL;
+	libfvalue_string_t *string            = NULL;
+	int codepage                          = 0;
+	int result                            = 0;
 
 	/* Initialize test
 	 */
@@ -1561,18 +1469,14 @@ int fvalue_test_string_get_utf8_string_size(
 
 	/* Test regular cases
 	 */
-	/* Test without data
+	/* A valid UTF-16 stream
 	 */
-	string->data      = NULL;
-	string->data_size = 0;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
-	string_size = 0;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          &string_size,
-	          0,
+	          utf16le_stream,
+	          6,
+	          LIBFVALUE_CODEPAGE_1200_MIXED,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1580,27 +1484,13 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 1 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with data size 0
-	 */
-	string->data      = utf8_stream;
-	string->data_size = 0;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
-	string_size = 0;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_get_resolved_codepage(
 	          string,
-	          &string_size,
-	          0,
+	          &codepage,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1608,18 +1498,1005 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 1 );
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with data without end-of-string character
+	/* An odd sized stream
 	 */
-	string->data      = utf16be_stream;
+	result = libfvalue_string_set_byte_stream(
+	          string,
+	          utf16le_stream,
+	          5,
+	          LIBFVALUE_CODEPAGE_1200_MIXED,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_ASCII );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A valid surrogate pair
+	 */
+	result = libfvalue_string_set_byte_stream(
+	          string,
+	          surrogate_pair_stream,
+	          4,
+	          LIBFVALUE_CODEPAGE_1200_MIXED,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An unpaired surrogate
+	 */
+	result = libfvalue_string_set_byte_stream(
+	          string,
+	          invalid_surrogate_stream,
+	          4,
+	          LIBFVALUE_CODEPAGE_1200_MIXED,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_ASCII );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An unpaired surrogate after the end-of-string character
+	 */
+	result = libfvalue_string_set_byte_stream(
+	          string,
+	          padded_stream,
+	          8,
+	          LIBFVALUE_CODEPAGE_1200_MIXED,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A codepage that does not need to be resolved
+	 */
+	result = libfvalue_string_set_byte_stream(
+	          string,
+	          utf16le_stream,
+	          6,
+	          LIBFVALUE_CODEPAGE_WINDOWS_1252,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "codepage",
+	 codepage,
+	 LIBFVALUE_CODEPAGE_WINDOWS_1252 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_string_get_resolved_codepage(
+	          NULL,
+	          &codepage,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_get_resolved_codepage(
+	          string,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_string_free(
+	          &string,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		libfvalue_string_free(
+		 &string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_copy_from_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_copy_from_utf8_string_with_index(
+     void )
+{
+	uint8_t utf8_error_string[ 4 ] = {
+		0xff, 0xff, 0xff, 0 };
+
+	uint8_t utf8_string[ 9 ] = {
+		'1', '2', '3', '4', '5', '6', '7', '8', 0 };
+
+	libcerror_error_t *error   = NULL;
+	libfvalue_string_t *string = NULL;
+	size_t string_index        = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_string_initialize(
+	          &string,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_string_copy_from_byte_stream(
+	          string,
+	          (uint8_t *) "12345678",
+	          9,
+	          LIBFVALUE_CODEPAGE_ASCII,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF7;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF8;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          NULL,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 9;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 9 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_index = 0;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0xffffffffUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf16_stream_size_from_utf8 failing
+	 */
+	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_error_string,
+	          4,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf32_stream_size_from_utf8 failing
+	 */
+	string->codepage = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_error_string,
+	          4,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf7_stream_size_from_utf8 failing
+	 */
+	string->codepage = LIBFVALUE_CODEPAGE_UTF7;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_error_string,
+	          4,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_utf8_stream_size_from_utf8 failing
+	 */
+	string->codepage = LIBFVALUE_CODEPAGE_UTF8;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_error_string,
+	          4,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with libuna_byte_stream_size_from_utf8 failing
+	 */
+	string->codepage = LIBFVALUE_CODEPAGE_ASCII;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_error_string,
+	          4,
+	          &string_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	/* Test libfvalue_string_copy_from_utf8_string_with_index with malloc failing
+	 */
+	fvalue_test_malloc_attempts_before_fail = 0;
+
+	string->codepage = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+
+	result = libfvalue_string_copy_from_utf8_string_with_index(
+	          string,
+	          utf8_string,
+	          9,
+	          &string_index,
+	          0,
+	          &error );
+
+	if( fvalue_test_malloc_attempts_before_fail != -1 )
+	{
+		fvalue_test_malloc_attempts_before_fail = -1;
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 (size_t) 9 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVALUE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfvalue_string_free(
+	          &string,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		libfvalue_string_free(
+		 &string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_string_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_get_utf8_string_size(
+     void )
+{
+	uint8_t scsu_stream[ 9 ]     = { 0xd6, 0x6c, 0x20, 0x66, 0x6c, 0x69, 0x65, 0xdf, 0x74 };
+	uint8_t utf16be_stream[ 10 ] = { 0, 't', 0, 'e', 0, 's', 0, 't', 0, 0 };
+	uint8_t utf16le_stream[ 10 ] = { 't', 0, 'e', 0, 's', 0, 't', 0, 0, 0 };
+	uint8_t utf32be_stream[ 20 ] = { 0, 0, 0, 't', 0, 0, 0, 'e', 0, 0, 0, 's', 0, 0, 0, 't', 0, 0, 0, 0 };
+	uint8_t utf32le_stream[ 20 ] = { 't', 0, 0, 0, 'e', 0, 0, 0, 's', 0, 0, 0, 't', 0, 0, 0, 0, 0, 0, 0 };
+	uint8_t utf8_stream[ 5 ]     = { 't', 'e', 's', 't', 0 };
+	libcerror_error_t *error     = NULL;
+	libfvalue_string_t *string   = NULL;
+	size_t string_size           = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_string_initialize(
+	          &string,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test without data
+	 */
+	string->data      = NULL;
+	string->data_size = 0;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data size 0
+	 */
+	string->data      = utf8_stream;
+	string->data_size = 0;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data without end-of-string character
+	 */
+	string->data      = utf16be_stream;
 	string->data_size = 8;
 	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
 
@@ -1645,46 +2522,420 @@ int fvalue_test_string_get_utf8_string_size(
 	 "error",
 	 error );
 
-	/* Test with data with end-of-string character
+	/* Test with data with end-of-string character
+	 */
+	string->data      = utf16be_stream;
+	string->data_size = 10;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Tests with data different codepages
+	 */
+	string->data      = utf16le_stream;
+	string->data_size = 10;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = utf32be_stream;
+	string->data_size = 20;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = utf32le_stream;
+	string->data_size = 20;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF7;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF8;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string->data      = scsu_stream;
+	string->data_size = 9;
+	string->codepage  = LIBFVALUE_CODEPAGE_SCSU;
+
+	string_size = 0;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 12 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
 	 */
+	string_size = 0;
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          NULL,
+	          &string_size,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          &string_size,
+	          0xffffffffUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = scsu_stream;
+	string->data_size = 9;
+	string->codepage  = LIBFVALUE_CODEPAGE_SCSU;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	string->data      = utf16be_stream;
 	string->data_size = 10;
 	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
 
-	string_size = 0;
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = utf32be_stream;
+	string->data_size = 20;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF7;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_UTF8;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = utf8_stream;
+	string->data_size = 5;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
+
+	result = libfvalue_string_get_utf8_string_size(
+	          string,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string->data      = NULL;
+	string->data_size = 0;
+	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
 
 	result = libfvalue_string_get_utf8_string_size(
 	          string,
-	          &string_size,
+	          NULL,
 	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 5 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Tests with data different codepages
-	 */
-	string->data      = utf16le_stream;
-	string->data_size = 10;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
-
-	string_size = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfvalue_string_get_utf8_string_size(
-	          string,
-	          &string_size,
-	          0,
+	/* Clean up
+	 */
+	result = libfvalue_string_free(
+	          &string,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1692,25 +2943,52 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 5 );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string->data      = utf32be_stream;
-	string->data_size = 20;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
+	return( 1 );
 
-	string_size = 0;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		libfvalue_string_free(
+		 &string,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	result = libfvalue_string_get_utf8_string_size(
-	          string,
-	          &string_size,
-	          0,
+/* Tests the libfvalue_string_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_string_get_utf8_string(
+     void )
+{
+	uint8_t utf16le_stream[ 10 ]     = { 't', 0, 'e', 0, 's', 0, 't', 0, 0, 0 };
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error         = NULL;
+	libfvalue_string_t *string       = NULL;
+	const uint8_t *cached_string     = NULL;
+	const uint8_t *utf8_string_value = NULL;
+	size_t string_size               = 0;
+	size_t utf8_string_index         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_string_initialize(
+	          &string,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1718,25 +2996,20 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 5 );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string->data      = utf32le_stream;
-	string->data_size = 20;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_LITTLE_ENDIAN;
-
-	string_size = 0;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          &string_size,
-	          0,
+	          utf16le_stream,
+	          10,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1744,23 +3017,15 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 5 );
-
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF7;
-
-	string_size = 0;
-
-	result = libfvalue_string_get_utf8_string_size(
+	/* Test regular cases
+	 */
+	result = libfvalue_string_get_utf8_string(
 	          string,
+	          &utf8_string_value,
 	          &string_size,
 	          0,
 	          &error );
@@ -1770,6 +3035,10 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string_value",
+	 utf8_string_value );
+
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
 	 "string_size",
 	 string_size,
@@ -1779,14 +3048,23 @@ int fvalue_test_string_get_utf8_string_size(
 	 "error",
 	 error );
 
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF8;
+	result = memory_compare(
+	          utf8_string_value,
+	          "test",
+	          5 );
 
-	string_size = 0;
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libfvalue_string_get_utf8_string_size(
+	/* Test if the cached UTF-8 string is returned
+	 */
+	cached_string = utf8_string_value;
+
+	result = libfvalue_string_get_utf8_string(
 	          string,
+	          &utf8_string_value,
 	          &string_size,
 	          0,
 	          &error );
@@ -1796,19 +3074,17 @@ int fvalue_test_string_get_utf8_string_size(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 5 );
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "utf8_string_value",
+	 (ssize_t) ( utf8_string_value - cached_string ),
+	 (ssize_t) 0 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
+	/* Test if the size and copy functions use the cached UTF-8 string
+	 */
 	string_size = 0;
 
 	result = libfvalue_string_get_utf8_string_size(
@@ -1831,15 +3107,13 @@ int fvalue_test_string_get_utf8_string_size(
 	 "error",
 	 error );
 
-	string->data      = scsu_stream;
-	string->data_size = 9;
-	string->codepage  = LIBFVALUE_CODEPAGE_SCSU;
-
-	string_size = 0;
+	utf8_string_index = 1;
 
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_copy_to_utf8_string_with_index(
 	          string,
-	          &string_size,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
 	          0,
 	          &error );
 
@@ -1849,44 +3123,32 @@ int fvalue_test_string_get_utf8_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_EQUAL_SIZE(
-	 "string_size",
-	 string_size,
-	 (size_t) 12 );
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 6 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	string_size = 0;
-
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
-	result = libfvalue_string_get_utf8_string_size(
-	          NULL,
-	          &string_size,
-	          0,
-	          &error );
+	result = memory_compare(
+	          &( utf8_string[ 1 ] ),
+	          "test",
+	          5 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	libcerror_error_free(
-	 &error );
+	utf8_string_index = 12;
 
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_copy_to_utf8_string_with_index(
 	          string,
-	          &string_size,
-	          0xffffffffUL,
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -1901,79 +3163,66 @@ int fvalue_test_string_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	string->data      = scsu_stream;
-	string->data_size = 9;
-	string->codepage  = LIBFVALUE_CODEPAGE_SCSU;
-
-	result = libfvalue_string_get_utf8_string_size(
+	/* Test if changing the string data releases the cached UTF-8 string
+	 */
+	result = libfvalue_string_set_byte_stream(
 	          string,
-	          NULL,
+	          (uint8_t *) "ab",
+	          3,
+	          LIBFVALUE_CODEPAGE_UTF8,
 	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "string->utf8_string",
+	 string->utf8_string );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	string->data      = utf16be_stream;
-	string->data_size = 10;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF16_BIG_ENDIAN;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_get_utf8_string(
 	          string,
-	          NULL,
+	          &utf8_string_value,
+	          &string_size,
 	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 3 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	string->data      = utf32be_stream;
-	string->data_size = 20;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF32_BIG_ENDIAN;
-
-	result = libfvalue_string_get_utf8_string_size(
-	          string,
-	          NULL,
-	          0,
-	          &error );
+	result = memory_compare(
+	          utf8_string_value,
+	          "ab",
+	          3 );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF7;
+	 0 );
 
-	result = libfvalue_string_get_utf8_string_size(
-	          string,
+	/* Test error cases
+	 */
+	result = libfvalue_string_get_utf8_string(
 	          NULL,
+	          &utf8_string_value,
+	          &string_size,
 	          0,
 	          &error );
 
@@ -1989,13 +3238,10 @@ int fvalue_test_string_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_UTF8;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_get_utf8_string(
 	          string,
 	          NULL,
+	          &string_size,
 	          0,
 	          &error );
 
@@ -2011,12 +3257,9 @@ int fvalue_test_string_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	string->data      = utf8_stream;
-	string->data_size = 5;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_get_utf8_string(
 	          string,
+	          &utf8_string_value,
 	          NULL,
 	          0,
 	          &error );
@@ -2033,14 +3276,11 @@ int fvalue_test_string_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	string->data      = NULL;
-	string->data_size = 0;
-	string->codepage  = LIBFVALUE_CODEPAGE_ASCII;
-
-	result = libfvalue_string_get_utf8_string_size(
+	result = libfvalue_string_get_utf8_string(
 	          string,
-	          NULL,
-	          0,
+	          &utf8_string_value,
+	          &string_size,
+	          0xffffffffUL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -7116,6 +8356,22 @@ int main(
 	 "libfvalue_string_copy_from_byte_stream",
 	 fvalue_test_string_copy_from_byte_stream );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_set_byte_stream",
+	 fvalue_test_string_set_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_copy_to_byte_stream",
+	 fvalue_test_string_copy_to_byte_stream );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_get_byte_stream_size",
+	 fvalue_test_string_get_byte_stream_size );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_get_resolved_codepage",
+	 fvalue_test_string_get_resolved_codepage );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_string_copy_from_utf8_string_with_index",
 	 fvalue_test_string_copy_from_utf8_string_with_index );
@@ -7124,6 +8380,10 @@ int main(
 	 "libfvalue_string_get_utf8_string_size",
 	 fvalue_test_string_get_utf8_string_size );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_string_get_utf8_string",
+	 fvalue_test_string_get_utf8_string );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_string_copy_to_utf8_string_with_index",
 	 fvalue_test_string_copy_to_utf8_string_with_index );
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -1469,6 +1471,1497 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_table_set_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_table_set_value(
+     void )
+{
+	uint8_t value_identifier[ 4 ] = { 'v', 0, 0, 0 };
+	libcerror_error_t *error      = NULL;
+	libfvalue_table_t *table      = NULL;
+	libfvalue_table_t *clone      = NULL;
+	libfvalue_value_t *value      = NULL;
+	int number_of_values          = 0;
+	int result                    = 0;
+	int value_index               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_table_initialize(
+	          &table,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * with more values than needed to use the identifier index
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		value_identifier[ 1 ] = (uint8_t) ( 'a' + ( ( value_index * 7 ) % 64 ) / 8 );
+		value_identifier[ 2 ] = (uint8_t) ( 'a' + ( ( value_index * 7 ) % 64 ) % 8 );
+
+		result = libfvalue_value_type_initialize(
+		          &value,
+		          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvalue_value_set_identifier(
+		          value,
+		          value_identifier,
+		          4,
+		          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvalue_table_set_value(
+		          table,
+		          value,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		value = NULL;
+	}
+	/* Replace an existing value
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          value_identifier,
+	          4,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_set_value(
+	          table,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libfvalue_table_get_number_of_values(
+	          table,
+	          &number_of_values,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 64 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values are stored sorted by identifier
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		value_identifier[ 1 ] = (uint8_t) ( 'a' + ( value_index / 8 ) );
+		value_identifier[ 2 ] = (uint8_t) ( 'a' + ( value_index % 8 ) );
+
+		result = libfvalue_table_get_value_by_identifier(
+		          table,
+		          value_identifier,
+		          4,
+		          &value,
+		          0,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		value = NULL;
+
+		result = libfvalue_table_get_index_by_identifier(
+		          table,
+		          value_identifier,
+		          4,
+		          &number_of_values,
+		          0,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "value_index",
+		 number_of_values,
+		 value_index );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	value_identifier[ 1 ] = 'z';
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          value_identifier,
+	          4,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a partial match
+	 */
+	value_identifier[ 1 ] = 'c';
+
+	result = libfvalue_table_get_index_by_identifier(
+	          table,
+	          value_identifier,
+	          2,
+	          &value_index,
+	          LIBFVALUE_TABLE_FLAG_ALLOW_PARTIAL_MATCH,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 16 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test lookups in a clone
+	 */
+	result = libfvalue_table_clone(
+	          &clone,
+	          table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "clone",
+	 clone );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_identifier[ 2 ] = 'h';
+
+	result = libfvalue_table_get_index_by_identifier(
+	          clone,
+	          value_identifier,
+	          4,
+	          &value_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 23 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_free(
+	          &clone,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test lookups after replacing a value by index
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_identifier[ 1 ] = 'z';
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          value_identifier,
+	          4,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_set_value_by_index(
+	          table,
+	          63,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libfvalue_table_get_index_by_identifier(
+	          table,
+	          value_identifier,
+	          4,
+	          &value_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 63 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_identifier[ 1 ] = 'h';
+
+	result = libfvalue_table_get_index_by_identifier(
+	          table,
+	          value_identifier,
+	          4,
+	          &value_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_table_set_value(
+	          NULL,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_table_set_value(
+	          table,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( clone != NULL )
+	{
+		libfvalue_table_free(
+		 &clone,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates an UTF-8 encoded XML string of a values table with a value that contains
+ * a number of value entries, where the value of every value entry is its index times 7
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_test_table_create_value_entries_xml_string(
+     uint8_t **xml_string,
+     size_t *xml_string_size,
+     int number_of_value_entries )
+{
+	uint8_t *safe_xml_string    = NULL;
+	size_t safe_xml_string_size = 0;
+	size_t string_index         = 0;
+	int print_count             = 0;
+	int value_entry_index       = 0;
+
+	if( ( xml_string == NULL )
+	 || ( xml_string_size == NULL )
+	 || ( number_of_value_entries < 0 )
+	 || ( (size_t) number_of_value_entries > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 64 ) / 40 ) ) )
+	{
+		return( -1 );
+	}
+	/* Every value entry requires at most 40 characters
+	 */
+	safe_xml_string_size = ( (size_t) number_of_value_entries * 40 ) + 64;
+
+	safe_xml_string = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * safe_xml_string_size );
+
+	if( safe_xml_string == NULL )
+	{
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               (char *) safe_xml_string,
+	               safe_xml_string_size,
+	               "<values><entries type=\"uint32\">" );
+
+	if( print_count < 0 )
+	{
+		goto on_error;
+	}
+	string_index = (size_t) print_count;
+
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               (char *) &( safe_xml_string[ string_index ] ),
+		               safe_xml_string_size - string_index,
+		               "<value_entry>%d</value_entry>",
+		               value_entry_index * 7 );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( safe_xml_string_size - string_index ) ) )
+		{
+			goto on_error;
+		}
+		string_index += (size_t) print_count;
+	}
+	print_count = narrow_string_snprintf(
+	               (char *) &( safe_xml_string[ string_index ] ),
+	               safe_xml_string_size - string_index,
+	               "</entries></values>" );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( safe_xml_string_size - string_index ) ) )
+	{
+		goto on_error;
+	}
+	string_index += (size_t) print_count;
+
+	*xml_string      = safe_xml_string;
+	*xml_string_size = string_index + 1;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 safe_xml_string );
+
+	return( -1 );
+}
+
+/* Tests the libfvalue_table_copy_from_utf8_xml_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_table_copy_from_utf8_xml_string(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t xml_string[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<values>\n  <beta>two</beta>\n  <alpha>one</alpha>\n  <gamma>three</gamma>\n  <delta></delta>\n</values>\n";
+
+	uint8_t typed_xml_string[] = "<values>\n  <count type=\"uint32\">42</count>\n  <list type='uint32'><value_entry>42</value_entry><value_entry>263</value_entry><value_entry>7</value_entry></list>\n  <ratio type=\"float64\"><value_entry>1.5</value_entry><value_entry>-2.25</value_entry><value_entry>0.125</value_entry></ratio>\n  <name type=\"utf8-string\">a &amp; &lt;b&gt;</name>\n  <other type=\"unsupported\">text</other>\n</values>\n";
+
+	uint32_t expected_list_values[ 3 ] = { 42, 263, 7 };
+
+	double expected_ratio_values[ 3 ] = { 1.5, -2.25, 0.125 };
+
+	libcerror_error_t *error       = NULL;
+	libfvalue_table_t *table       = NULL;
+	libfvalue_value_t *value       = NULL;
+	uint8_t *entries_xml_string    = NULL;
+	double value_double            = 0.0;
+	size_t entries_xml_string_size = 0;
+	uint64_t number_of_allocations = 0;
+	uint32_t value_32bit           = 0;
+	int number_of_value_entries    = 0;
+	int number_of_values           = 0;
+	int result                     = 0;
+	int statistics_result          = 0;
+	int value_entry_index          = 0;
+	int value_index                = 0;
+	int value_type                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_table_initialize(
+	          &table,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_number_of_values(
+	          table,
+	          &number_of_values,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 4 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values are stored sorted by identifier
+	 */
+	result = libfvalue_table_get_index_by_identifier(
+	          table,
+	          (uint8_t *) "gamma",
+	          6,
+	          &value_index,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 3 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_value_by_index(
+	          table,
+	          0,
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "one",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	value = NULL;
+
+	/* Test copying into a table that already contains the values
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_number_of_values(
+	          table,
+	          &number_of_values,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 4 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copying values with a type attribute, value entries and XML entities
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          typed_xml_string,
+	          sizeof( typed_xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "count",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_type(
+	          value,
+	          &value_type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 42 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "list",
+	          5,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 3 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_entry_index = 0;
+	     value_entry_index < 3;
+	     value_entry_index++ )
+	{
+		result = libfvalue_value_copy_to_32bit(
+		          value,
+		          value_entry_index,
+		          &value_32bit,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 expected_list_values[ value_entry_index ] );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "ratio",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 3 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_entry_index = 0;
+	     value_entry_index < 3;
+	     value_entry_index++ )
+	{
+		result = libfvalue_value_copy_to_double(
+		          value,
+		          value_entry_index,
+		          &value_double,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_FLOAT(
+		 "value_double",
+		 value_double,
+		 expected_ratio_values[ value_entry_index ] );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "name",
+	          5,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "a & <b>",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A value type that is not supported is kept as an UTF-8 string
+	 */
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "other",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_type(
+	          value,
+	          &value_type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFVALUE_VALUE_TYPE_STRING_UTF8 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	/* Test a value with a large number of value entries, the value instances
+	 * are only flushed when the data is resized hence the number of
+	 * allocations does not grow with the number of value entries
+	 */
+	result = fvalue_test_table_create_value_entries_xml_string(
+	          &entries_xml_string,
+	          &entries_xml_string_size,
+	          50000 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	statistics_result = libfvalue_statistics_reset(
+	                     &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "statistics_result",
+	 statistics_result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          entries_xml_string,
+	          entries_xml_string_size,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 entries_xml_string );
+
+	entries_xml_string = NULL;
+
+	/* The statistics are only available if the library was built with --enable-statistics
+	 */
+	if( statistics_result == 1 )
+	{
+		result = libfvalue_statistics_get(
+		          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS,
+		          LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+		          &number_of_allocations,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_LESS_THAN_UINT64(
+		 "number_of_allocations",
+		 number_of_allocations,
+		 (uint64_t) 64 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "entries",
+	          8,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 50000 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_entry_index = 0;
+	     value_entry_index < 50000;
+	     value_entry_index++ )
+	{
+		result = libfvalue_value_copy_to_32bit(
+		          value,
+		          value_entry_index,
+		          &value_32bit,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 (uint32_t) ( value_entry_index * 7 ) );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	value = NULL;
+
+	/* Test a table name that is not present
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "other",
+	          5,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          NULL,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          NULL,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          xml_string,
+	          0,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_table_copy_from_utf8_xml_string(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          NULL,
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_xml_string != NULL )
+	{
+		memory_free(
+		 entries_xml_string );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_table_copy_from_utf8_xml_string_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_table_copy_from_utf8_xml_string_with_flags(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t xml_string[] = "<values><alpha>one</alpha><beta>two</beta><gamma>three</gamma></values>";
+
+	libcerror_error_t *error = NULL;
+	libfvalue_table_t *table = NULL;
+	libfvalue_value_t *value = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_table_initialize(
+	          &table,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string_with_flags(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          LIBFVALUE_TABLE_FLAG_REFERENCE_DATA,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "gamma",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "three",
+	          6 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	value = NULL;
+
+	/* Test error cases
+	 */
+	result = libfvalue_table_copy_from_utf8_xml_string_with_flags(
+	          table,
+	          xml_string,
+	          sizeof( xml_string ),
+	          (uint8_t *) "values",
+	          6,
+	          0xff,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1528,9 +3021,17 @@ int main(
 
 	/* TODO: add tests for libfvalue_table_set_value_by_index */
 
-	/* TODO: add tests for libfvalue_table_set_value */
+	FVALUE_TEST_RUN(
+	 "libfvalue_table_set_value",
+	 fvalue_test_table_set_value );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_table_copy_from_utf8_xml_string",
+	 fvalue_test_table_copy_from_utf8_xml_string );
 
-	/* TODO: add tests for libfvalue_table_copy_from_utf8_xml_string */
+	FVALUE_TEST_RUN(
+	 "libfvalue_table_copy_from_utf8_xml_string_with_flags",
+	 fvalue_test_table_copy_from_utf8_xml_string_with_flags );
 
 	return( EXIT_SUCCESS );
 
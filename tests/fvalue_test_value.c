@@ -34,6 +34,7 @@
 #include "fvalue_test_memory.h"
 #include "fvalue_test_unused.h"
 
+#include "../libfvalue/libfvalue_string.h"
 #include "../libfvalue/libfvalue_value.h"
 #include "../libfvalue/libfvalue_value_type.h"
 
@@ -380,6 +381,214 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_value_initialize_with_type_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_initialize_with_type_descriptor(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfvalue_value_t *destination_value               = NULL;
+	libfvalue_value_t *value                           = NULL;
+	libfvalue_value_type_descriptor_t *type_descriptor = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_descriptor_initialize(
+	          &type_descriptor,
+	          "test",
+	          "Test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "type_descriptor",
+	 type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_initialize_with_type_descriptor(
+	          &value,
+	          type_descriptor,
+	          NULL,
+	          LIBFVALUE_VALUE_FLAG_DATA_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A clone shares the type descriptor of the source value
+	 */
+	result = libfvalue_value_clone(
+	          &destination_value,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_value",
+	 destination_value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &destination_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_initialize_with_type_descriptor(
+	          NULL,
+	          type_descriptor,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_initialize_with_type_descriptor(
+	          &value,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_type_descriptor_free(
+	          &type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_value != NULL )
+	{
+		libfvalue_value_free(
+		 &destination_value,
+		 NULL );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &type_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfvalue_value_free function
  * Returns 1 if successful or 0 if not
  */
@@ -3000,45 +3209,22 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
-
-/* Tests the libfvalue_value_get_value_instance_by_index function
+/* Tests the libfvalue_value_get_instance_policy function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_value_get_value_instance_by_index(
+int fvalue_test_value_get_instance_policy(
      void )
 {
 	libcerror_error_t *error = NULL;
 	libfvalue_value_t *value = NULL;
-	intptr_t *value_instance = NULL;
+	uint8_t instance_policy  = 0;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_value_initialize(
+	result = libfvalue_value_type_initialize(
 	          &value,
-	          "test",
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3056,12 +3242,11 @@ int fvalue_test_value_get_value_instance_by_index(
 
 	/* Test regular cases
 	 */
-#ifdef TODO
-/* TODO initialize test */
-	result = libfvalue_value_get_value_instance_by_index(
+	instance_policy = 0xff;
+
+	result = libfvalue_value_get_instance_policy(
 	          value,
-	          0,
-	          &value_instance,
+	          &instance_policy,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3069,19 +3254,20 @@ int fvalue_test_value_get_value_instance_by_index(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "instance_policy",
+	 instance_policy,
+	 (uint8_t) LIBFVALUE_VALUE_INSTANCE_POLICY_LAZY );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	value_instance = NULL;
-#endif
-
 	/* Test error cases
 	 */
-	result = libfvalue_value_get_value_instance_by_index(
+	result = libfvalue_value_get_instance_policy(
 	          NULL,
-	          0,
-	          &value_instance,
+	          &instance_policy,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3096,10 +3282,9 @@ int fvalue_test_value_get_value_instance_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_value_instance_by_index(
+	result = libfvalue_value_get_instance_policy(
 	          value,
-	          -1,
-	          &value_instance,
+	          NULL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3114,50 +3299,81 @@ int fvalue_test_value_get_value_instance_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_value_instance_by_index(
-	          value,
-	          0,
-	          NULL,
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	value_instance = (libfvalue_value_t *) 0x12345678UL;
-
-	result = libfvalue_value_get_value_instance_by_index(
-	          value,
-	          0,
-	          NULL,
-	          &error );
+	return( 1 );
 
-	value_instance = NULL;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_set_instance_policy function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_set_instance_policy(
+     void )
+{
+	uint8_t integer_stream1[ 4 ] = { 1, 0, 0, 0 };
+	uint8_t integer_stream2[ 4 ] = { 2, 0, 0, 0 };
+	libcerror_error_t *error     = NULL;
+	libfvalue_value_t *value     = NULL;
+	uint32_t value_32bit         = 0;
+	uint8_t instance_policy      = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
+	/* Test regular cases
 	 */
-	result = libfvalue_value_free(
-	          &value,
+	result = libfvalue_value_set_instance_policy(
+	          value,
+	          LIBFVALUE_VALUE_INSTANCE_POLICY_NO_CACHE,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3166,68 +3382,72 @@ int fvalue_test_value_get_value_instance_by_index(
 	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
-	 "value",
-	 value );
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_instance_policy(
+	          value,
+	          &instance_policy,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT8(
+	 "instance_policy",
+	 instance_policy,
+	 (uint8_t) LIBFVALUE_VALUE_INSTANCE_POLICY_NO_CACHE );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	/* Test that the no-cache policy decodes the current data on every read
+	 */
+	result = libfvalue_value_set_data(
+	          value,
+	          integer_stream1,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          0,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( value != NULL )
-	{
-		libfvalue_value_free(
-		 &value,
-		 NULL );
-	}
-	return( 0 );
-}
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfvalue_value_get_number_of_value_entries function
- * Returns 1 if successful or 0 if not
- */
-int fvalue_test_value_get_number_of_value_entries(
-     void )
-{
-	libcerror_error_t *error    = NULL;
-	libfvalue_value_t *value    = NULL;
-	int number_of_value_entries = 0;
-	int result                  = 0;
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
 
-	/* Initialize test
-	 */
-	result = libfvalue_value_initialize(
-	          &value,
-	          "test",
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          value,
+	          integer_stream2,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
 	          0,
 	          &error );
 
@@ -3236,21 +3456,52 @@ int fvalue_test_value_get_number_of_value_entries(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "value",
-	 value );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 2 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test that the eager policy decodes the data when it is set
 	 */
-	number_of_value_entries = 0;
+	result = libfvalue_value_set_instance_policy(
+	          value,
+	          LIBFVALUE_VALUE_INSTANCE_POLICY_EAGER,
+	          &error );
 
-	result = libfvalue_value_get_number_of_value_entries(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
 	          value,
-	          &number_of_value_entries,
+	          integer_stream1,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3258,25 +3509,49 @@ int fvalue_test_value_get_number_of_value_entries(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
 	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "number_of_value_entries",
-	 number_of_value_entries,
-	 0 );
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-/* TODO test with data */
-/* TODO test with value instances */
+	result = libfvalue_value_set_instance_policy(
+	          value,
+	          LIBFVALUE_VALUE_INSTANCE_POLICY_LAZY,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	number_of_value_entries = 0;
-
-	result = libfvalue_value_get_number_of_value_entries(
+	result = libfvalue_value_set_instance_policy(
 	          NULL,
-	          &number_of_value_entries,
+	          LIBFVALUE_VALUE_INSTANCE_POLICY_LAZY,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3284,11 +3559,6 @@ int fvalue_test_value_get_number_of_value_entries(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "number_of_value_entries",
-	 number_of_value_entries,
-	 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3296,9 +3566,9 @@ int fvalue_test_value_get_number_of_value_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_number_of_value_entries(
+	result = libfvalue_value_set_instance_policy(
 	          value,
-	          NULL,
+	          0xff,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3306,11 +3576,6 @@ int fvalue_test_value_get_number_of_value_entries(
 	 result,
 	 -1 );
 
-	FVALUE_TEST_ASSERT_EQUAL_INT(
-	 "number_of_value_entries",
-	 number_of_value_entries,
-	 0 );
-
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3354,17 +3619,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_value_get_entry function
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* Tests the libfvalue_value_get_value_instance_by_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_value_get_entry(
+int fvalue_test_value_get_value_instance_by_index(
      void )
 {
-	libcerror_error_t *error = NULL;
-	libfvalue_value_t *value = NULL;
-	size_t entry_data_offset = 0;
-	size_t entry_data_size   = 0;
-	int result               = 0;
+	uint8_t string_data[ 5 ]        = { 't', 'e', 's', 't', 0 };
+	libcerror_error_t *error        = NULL;
+	libfvalue_value_t *string_value = NULL;
+	libfvalue_value_t *value        = NULL;
+	intptr_t *value_instance        = NULL;
+	int result                      = 0;
 
 	/* Initialize test
 	 */
@@ -3410,12 +3678,11 @@ int fvalue_test_value_get_entry(
 	/* Test regular cases
 	 */
 #ifdef TODO
-/* TODO initialize value with data */
-	result = libfvalue_value_get_entry(
+/* TODO initialize test */
+	result = libfvalue_value_get_value_instance_by_index(
 	          value,
 	          0,
-	          &entry_data_offset,
-	          &entry_data_size,
+	          &value_instance,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3426,36 +3693,106 @@ int fvalue_test_value_get_entry(
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
+
+	value_instance = NULL;
 #endif
 
-	/* Test error cases
+	/* Test a string value instance that references data not managed by the data handle
 	 */
-	result = libfvalue_value_get_entry(
-	          NULL,
-	          0,
-	          &entry_data_offset,
-	          &entry_data_size,
+	result = libfvalue_value_type_initialize(
+	          &string_value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfvalue_value_set_data(
+	          string_value,
+	          string_data,
+	          5,
+	          LIBFVALUE_CODEPAGE_UTF8,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
 
-#ifdef TODO
-/* TODO initialize value with data */
-	result = libfvalue_value_get_entry(
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_value_instance_by_index(
+	          string_value,
+	          0,
+	          &value_instance,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value_instance",
+	 value_instance );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "string->data",
+	 (ssize_t) ( ( (libfvalue_string_t *) value_instance )->data - string_data ),
+	 (ssize_t) 0 );
+
+	value_instance = NULL;
+
+	result = libfvalue_value_free(
+	          &string_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_get_value_instance_by_index(
+	          NULL,
+	          0,
+	          &value_instance,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_get_value_instance_by_index(
 	          value,
 	          -1,
-	          &entry_data_offset,
-	          &entry_data_size,
+	          &value_instance,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3469,13 +3806,11 @@ int fvalue_test_value_get_entry(
 
 	libcerror_error_free(
 	 &error );
-#endif
 
-	result = libfvalue_value_get_entry(
+	result = libfvalue_value_get_value_instance_by_index(
 	          value,
 	          0,
 	          NULL,
-	          &entry_data_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3490,13 +3825,16 @@ int fvalue_test_value_get_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_entry(
+	value_instance = (libfvalue_value_t *) 0x12345678UL;
+
+	result = libfvalue_value_get_value_instance_by_index(
 	          value,
 	          0,
-	          &entry_data_offset,
 	          NULL,
 	          &error );
 
+	value_instance = NULL;
+
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -3542,45 +3880,33 @@ on_error:
 		 &value,
 		 NULL );
 	}
+	if( string_value != NULL )
+	{
+		libfvalue_value_free(
+		 &string_value,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfvalue_value_set_entry function
+/* Tests the libfvalue_internal_value_get_read_instance_by_index function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_value_set_entry(
+int fvalue_test_internal_value_get_read_instance_by_index(
      void )
 {
-	libcerror_error_t *error = NULL;
-	libfvalue_value_t *value = NULL;
-	int result               = 0;
+	uint8_t utf16_stream[ 10 ]     = { 't', 0, 'e', 0, 's', 0, 't', 0, 0, 0 };
+	libcerror_error_t *error       = NULL;
+	libfvalue_value_t *value       = NULL;
+	intptr_t *first_value_instance = NULL;
+	intptr_t *value_instance       = NULL;
+	int result                     = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_value_initialize(
+	result = libfvalue_value_type_initialize(
 	          &value,
-	          "test",
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF16,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3588,9 +3914,19 @@ int fvalue_test_value_set_entry(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "value",
-	 value );
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_instance_policy(
+	          value,
+	          LIBFVALUE_VALUE_INSTANCE_POLICY_NO_CACHE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3598,13 +3934,77 @@ int fvalue_test_value_set_entry(
 
 	/* Test regular cases
 	 */
-#ifdef TODO
-/* TODO initialize value with data */
-	result = libfvalue_value_set_entry(
+	result = libfvalue_internal_value_get_read_instance_by_index(
+	          (libfvalue_internal_value_t *) value,
+	          0,
+	          &value_instance,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value_instance",
+	 value_instance );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
 	          value,
+	          utf16_stream,
+	          10,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_internal_value_get_read_instance_by_index(
+	          (libfvalue_internal_value_t *) value,
 	          0,
+	          &first_value_instance,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "first_value_instance",
+	 first_value_instance );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The no-cache policy references the value data and reuses the value instance
+	 */
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "first_value_instance == scratch_instance",
+	 (int) ( first_value_instance == ( (libfvalue_internal_value_t *) value )->scratch_instance ),
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "string->data == utf16_stream",
+	 (int) ( ( (libfvalue_string_t *) first_value_instance )->data == utf16_stream ),
+	 1 );
+
+	result = libfvalue_internal_value_get_read_instance_by_index(
+	          (libfvalue_internal_value_t *) value,
 	          0,
-	          32,
+	          &value_instance,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3612,18 +4012,41 @@ int fvalue_test_value_set_entry(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_instance == first_value_instance",
+	 (int) ( value_instance == first_value_instance ),
+	 1 );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-#endif
 
 	/* Test error cases
 	 */
-	result = libfvalue_value_set_entry(
+	value_instance = NULL;
+
+	result = libfvalue_internal_value_get_read_instance_by_index(
 	          NULL,
 	          0,
+	          &value_instance,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_internal_value_get_read_instance_by_index(
+	          (libfvalue_internal_value_t *) value,
 	          0,
-	          32,
+	          NULL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3674,18 +4097,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_value_get_entry_data function
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* Tests the libfvalue_value_get_number_of_value_entries function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_value_get_entry_data(
+int fvalue_test_value_get_number_of_value_entries(
      void )
 {
-	libcerror_error_t *error = NULL;
-	libfvalue_value_t *value = NULL;
-	uint8_t *entry_data      = NULL;
-	size_t entry_data_size   = 0;
-	int encoding             = 0;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	libfvalue_value_t *value    = NULL;
+	int number_of_value_entries = 0;
+	int result                  = 0;
 
 	/* Initialize test
 	 */
@@ -3730,14 +4153,11 @@ int fvalue_test_value_get_entry_data(
 
 	/* Test regular cases
 	 */
-#ifdef TODO
-/* TODO initialize value with data */
-	result = libfvalue_value_get_entry_data(
+	number_of_value_entries = 0;
+
+	result = libfvalue_value_get_number_of_value_entries(
 	          value,
-	          0,
-	          &entry_data,
-	          &entry_data_size,
-	          &encoding,
+	          &number_of_value_entries,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3745,19 +4165,25 @@ int fvalue_test_value_get_entry_data(
 	 result,
 	 1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 0 );
+
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-#endif
+
+/* TODO test with data */
+/* TODO test with value instances */
 
 	/* Test error cases
 	 */
-	result = libfvalue_value_get_entry_data(
+	number_of_value_entries = 0;
+
+	result = libfvalue_value_get_number_of_value_entries(
 	          NULL,
-	          0,
-	          &entry_data,
-	          &entry_data_size,
-	          &encoding,
+	          &number_of_value_entries,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3765,6 +4191,11 @@ int fvalue_test_value_get_entry_data(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3772,14 +4203,9 @@ int fvalue_test_value_get_entry_data(
 	libcerror_error_free(
 	 &error );
 
-#ifdef TODO
-/* TODO fix test */
-	result = libfvalue_value_get_entry_data(
+	result = libfvalue_value_get_number_of_value_entries(
 	          value,
-	          -1,
-	          &entry_data,
-	          &entry_data_size,
-	          &encoding,
+	          NULL,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3787,20 +4213,135 @@ int fvalue_test_value_get_entry_data(
 	 result,
 	 -1 );
 
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 0 );
+
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
 	libcerror_error_free(
 	 &error );
-#endif
 
-	result = libfvalue_value_get_entry_data(
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_get_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_get_entry(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	size_t entry_data_offset = 0;
+	size_t entry_data_size   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_initialize(
+	          &value,
+	          "test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#ifdef TODO
+/* TODO initialize value with data */
+	result = libfvalue_value_get_entry(
 	          value,
 	          0,
+	          &entry_data_offset,
+	          &entry_data_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_get_entry(
 	          NULL,
+	          0,
+	          &entry_data_offset,
 	          &entry_data_size,
-	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3815,12 +4356,33 @@ int fvalue_test_value_get_entry_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_entry_data(
+#ifdef TODO
+/* TODO initialize value with data */
+	result = libfvalue_value_get_entry(
+	          value,
+	          -1,
+	          &entry_data_offset,
+	          &entry_data_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	result = libfvalue_value_get_entry(
 	          value,
 	          0,
-	          &entry_data,
 	          NULL,
-	          &encoding,
+	          &entry_data_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3835,11 +4397,10 @@ int fvalue_test_value_get_entry_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_entry_data(
+	result = libfvalue_value_get_entry(
 	          value,
 	          0,
-	          &entry_data,
-	          &entry_data_size,
+	          &entry_data_offset,
 	          NULL,
 	          &error );
 
@@ -3891,17 +4452,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvalue_value_copy_entry_data function
+/* Tests the libfvalue_value_set_entry function
  * Returns 1 if successful or 0 if not
  */
-int fvalue_test_value_copy_entry_data(
+int fvalue_test_value_set_entry(
      void )
 {
-	uint8_t entry_data[ 32 ];
-
 	libcerror_error_t *error = NULL;
 	libfvalue_value_t *value = NULL;
-	int encoding             = 0;
 	int result               = 0;
 
 	/* Initialize test
@@ -3949,12 +4507,11 @@ int fvalue_test_value_copy_entry_data(
 	 */
 #ifdef TODO
 /* TODO initialize value with data */
-	result = libfvalue_value_copy_entry_data(
+	result = libfvalue_value_set_entry(
 	          value,
 	          0,
-	          entry_data,
+	          0,
 	          32,
-	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3969,12 +4526,11 @@ int fvalue_test_value_copy_entry_data(
 
 	/* Test error cases
 	 */
-	result = libfvalue_value_copy_entry_data(
+	result = libfvalue_value_set_entry(
 	          NULL,
 	          0,
-	          entry_data,
+	          0,
 	          32,
-	          &encoding,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -3989,41 +4545,215 @@ int fvalue_test_value_copy_entry_data(
 	libcerror_error_free(
 	 &error );
 
-#ifdef TODO
-/* TODO fix test */
-	result = libfvalue_value_copy_entry_data(
-	          value,
-	          -1,
-	          entry_data,
-	          32,
-	          &encoding,
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-#endif
+	return( 1 );
 
-	result = libfvalue_value_copy_entry_data(
-	          value,
-	          0,
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_get_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_get_entry_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	uint8_t *entry_data      = NULL;
+	size_t entry_data_size   = 0;
+	int encoding             = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_initialize(
+	          &value,
+	          "test",
 	          NULL,
-	          32,
-	          &encoding,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#ifdef TODO
+/* TODO initialize value with data */
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          0,
+	          &entry_data,
+	          &entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_get_entry_data(
+	          NULL,
+	          0,
+	          &entry_data,
+	          &entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#ifdef TODO
+/* TODO fix test */
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          -1,
+	          &entry_data,
+	          &entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          0,
+	          NULL,
+	          &entry_data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          0,
+	          &entry_data,
+	          NULL,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          0,
+	          &entry_data,
+	          &entry_data_size,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -4032,11 +4762,125 @@ int fvalue_test_value_copy_entry_data(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_copy_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_copy_entry_data(
+     void )
+{
+	uint8_t entry_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	int encoding             = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_initialize(
+	          &value,
+	          "test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#ifdef TODO
+/* TODO initialize value with data */
 	result = libfvalue_value_copy_entry_data(
 	          value,
 	          0,
 	          entry_data,
-	          (size_t) SSIZE_MAX + 1,
+	          32,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_copy_entry_data(
+	          NULL,
+	          0,
+	          entry_data,
+	          32,
 	          &encoding,
 	          &error );
 
@@ -4056,9 +4900,713 @@ int fvalue_test_value_copy_entry_data(
 /* TODO fix test */
 	result = libfvalue_value_copy_entry_data(
 	          value,
-	          0,
+	          -1,
 	          entry_data,
 	          32,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	result = libfvalue_value_copy_entry_data(
+	          value,
+	          0,
+	          NULL,
+	          32,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_copy_entry_data(
+	          value,
+	          0,
+	          entry_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#ifdef TODO
+/* TODO fix test */
+	result = libfvalue_value_copy_entry_data(
+	          value,
+	          0,
+	          entry_data,
+	          32,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_get_serialized_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_get_serialized_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	size_t serialized_size   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          value,
+	          (uint8_t *) "\x01\x02\x03\x04\x05\x06\x07\x08",
+	          8,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_get_serialized_size(
+	          value,
+	          &serialized_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) 8 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_from_32bit(
+	          value,
+	          0,
+	          0xaabbccddUL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_serialized_size(
+	          value,
+	          &serialized_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) 4 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_get_serialized_size(
+	          NULL,
+	          &serialized_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_get_serialized_size(
+	          value,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_flush_to_data_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_flush_to_data_handle(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfvalue_value_t *value      = NULL;
+	uint8_t non_managed_data[ 4 ] = { 0x01, 0x02, 0x03, 0x04 };
+	uint8_t *data                 = NULL;
+	size_t data_size              = 0;
+	uint32_t value_32bit          = 0;
+	uint16_t value_16bit          = 0;
+	int encoding                  = 0;
+	int number_of_value_entries   = 0;
+	int result                    = 0;
+	int value_entry_index         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x01\x02\x03\x04",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x05\x06\x07\x08",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_flush_to_data_handle(
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_from_32bit(
+	          value,
+	          0,
+	          0x11223344UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_flush_to_data_handle(
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_data(
+	          value,
+	          &data,
+	          &data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 8 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "\x44\x33\x22\x11\x05\x06\x07\x08",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_copy_from_16bit(
+	          value,
+	          1,
+	          0x5566,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_flush_to_data_handle(
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_data(
+	          value,
+	          &data,
+	          &data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 6 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "\x44\x33\x22\x11\x66\x55",
+	          6 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 2 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x11223344UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_16bit(
+	          value,
+	          1,
+	          &value_16bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT16(
+	 "value_16bit",
+	 value_16bit,
+	 (uint16_t) 0x5566 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test flush of data that is not managed by the value, the value instance
+	 * is written into data owned by the value instead
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          value,
+	          non_managed_data,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED | LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_from_32bit(
+	          value,
+	          0,
+	          0x11223344UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_flush_to_data_handle(
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          non_managed_data,
+	          "\x01\x02\x03\x04",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_get_data(
+	          value,
+	          &data,
+	          &data_size,
+	          &encoding,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 4 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = ( data == non_managed_data );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          data,
+	          "\x44\x33\x22\x11",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_copy_to_32bit(
+	          value,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x11223344UL );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_flush_to_data_handle(
 	          NULL,
 	          &error );
 
@@ -4073,7 +5621,6 @@ int fvalue_test_value_copy_entry_data(
 
 	libcerror_error_free(
 	 &error );
-#endif
 
 	/* Clean up
 	 */
@@ -5554,39 +7101,382 @@ int fvalue_test_value_copy_to_64bit(
 	 result,
 	 1 );
 
-	FVALUE_TEST_ASSERT_IS_NOT_NULL(
-	 "value",
-	 value );
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_copy_to_64bit(
+	          value,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+/* TODO test with value entries */
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_copy_to_64bit(
+	          NULL,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#ifdef TODO
+/* TODO fix test */
+	result = libfvalue_value_copy_to_64bit(
+	          value,
+	          -1,
+	          &value_64bit,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	result = libfvalue_value_copy_to_64bit(
+	          value,
+	          0,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_copy_to_integer_array function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_copy_to_integer_array(
+     void )
+{
+	uint64_t integer_values[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	int result               = 0;
+	int value_entry_index    = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x01\x02\x03\x04",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x05\x06\x07\x08",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x09\x0a\x0b\x0c",
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          0,
+	          3,
+	          integer_values,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x04030201UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x08070605UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 2 ]",
+	 integer_values[ 2 ],
+	 (uint64_t) 0x0c0b0a09UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a value instance takes precedence over the data
+	 */
+	result = libfvalue_value_copy_from_32bit(
+	          value,
+	          1,
+	          0x11223344UL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          1,
+	          2,
+	          integer_values,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x11223344UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x0c0b0a09UL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "\x0d\x0e",
+	          2,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          2,
+	          2,
+	          integer_values,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (uint64_t) 0x0c0b0a09UL );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (uint64_t) 0x0e0dUL );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libfvalue_value_copy_to_64bit(
-	          value,
+	result = libfvalue_value_copy_to_integer_array(
+	          NULL,
 	          0,
-	          &value_64bit,
+	          1,
+	          integer_values,
+	          4,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	FVALUE_TEST_ASSERT_IS_NULL(
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-/* TODO test with value entries */
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libfvalue_value_copy_to_64bit(
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          0,
+	          1,
 	          NULL,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
 	          0,
-	          &value_64bit,
+	          0,
+	          integer_values,
+	          4,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -5601,12 +7491,12 @@ int fvalue_test_value_copy_to_64bit(
 	libcerror_error_free(
 	 &error );
 
-#ifdef TODO
-/* TODO fix test */
-	result = libfvalue_value_copy_to_64bit(
+	result = libfvalue_value_copy_to_integer_array(
 	          value,
 	          -1,
-	          &value_64bit,
+	          1,
+	          integer_values,
+	          4,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -5620,12 +7510,53 @@ int fvalue_test_value_copy_to_64bit(
 
 	libcerror_error_free(
 	 &error );
-#endif
 
-	result = libfvalue_value_copy_to_64bit(
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          4,
+	          1,
+	          integer_values,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_copy_to_integer_array(
+	          value,
+	          2,
+	          3,
+	          integer_values,
+	          4,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_copy_to_integer_array(
 	          value,
 	          0,
-	          NULL,
+	          4,
+	          integer_values,
+	          2,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -6605,10 +8536,221 @@ int fvalue_test_value_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvalue_value_get_utf8_string_size(
-	          value,
+	result = libfvalue_value_get_utf8_string_size(
+	          value,
+	          0,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_get_utf8_string(
+     void )
+{
+	uint8_t integer_stream[ 4 ]      = { 1, 0, 0, 0 };
+	uint8_t utf16_stream[ 10 ]       = { 't', 0, 'e', 0, 's', 0, 't', 0, 0, 0 };
+	libcerror_error_t *error         = NULL;
+	libfvalue_value_t *integer_value = NULL;
+	libfvalue_value_t *string_value  = NULL;
+	const uint8_t *utf8_string       = NULL;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_initialize(
+	          &string_value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          string_value,
+	          utf16_stream,
+	          10,
+	          LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	          LIBFVALUE_VALUE_DATA_FLAG_CLONE_BY_REFERENCE,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_initialize(
+	          &integer_value,
+	          LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          integer_value,
+	          integer_stream,
+	          4,
+	          LIBFVALUE_ENDIAN_LITTLE,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_get_utf8_string(
+	          string_value,
+	          0,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "test",
+	          5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a value type without a cached UTF-8 string
+	 */
+	result = libfvalue_value_get_utf8_string(
+	          integer_value,
+	          0,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_get_utf8_string(
+	          NULL,
+	          0,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_get_utf8_string(
+	          string_value,
 	          0,
 	          NULL,
+	          &utf8_string_size,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -6622,12 +8764,11 @@ int fvalue_test_value_get_utf8_string_size(
 
 	libcerror_error_free(
 	 &error );
-#endif
 
 	/* Clean up
 	 */
 	result = libfvalue_value_free(
-	          &value,
+	          &integer_value,
 	          &error );
 
 	FVALUE_TEST_ASSERT_EQUAL_INT(
@@ -6636,8 +8777,17 @@ int fvalue_test_value_get_utf8_string_size(
 	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
-	 "value",
-	 value );
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &string_value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVALUE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -6651,10 +8801,16 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( value != NULL )
+	if( integer_value != NULL )
 	{
 		libfvalue_value_free(
-		 &value,
+		 &integer_value,
+		 NULL );
+	}
+	if( string_value != NULL )
+	{
+		libfvalue_value_free(
+		 &string_value,
 		 NULL );
 	}
 	return( 0 );
@@ -8426,6 +10582,307 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_value_read_from_file_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_read_from_file_stream(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfvalue_value_t *value = NULL;
+	FILE *file_stream        = NULL;
+	ssize_t read_count       = 0;
+	ssize_t write_count      = 0;
+	ssize_t write_size       = 0;
+	int result               = 0;
+	int value_entry_index    = 0;
+
+	/* Initialize test
+	 */
+	file_stream = tmpfile();
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          (uint8_t *) "text",
+	          5,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "first",
+	          6,
+	          LIBFVALUE_CODEPAGE_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_size = libfvalue_value_write_to_file_stream(
+	              value,
+	              file_stream,
+	              &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "write_size",
+	 write_size,
+	 (ssize_t) -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_entry_data(
+	          value,
+	          0,
+	          (uint8_t *) "other",
+	          6,
+	          LIBFVALUE_CODEPAGE_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libfvalue_value_write_to_file_stream(
+	               value,
+	               file_stream,
+	               &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rewind(
+	 file_stream );
+
+	/* Test regular cases
+	 */
+	read_count = libfvalue_value_read_from_file_stream(
+	              value,
+	              file_stream,
+	              &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 write_size );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "first",
+	          6 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The data read ahead by the first read is given back to the file stream
+	 */
+	read_count = libfvalue_value_read_from_file_stream(
+	              value,
+	              file_stream,
+	              &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 write_count );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "other",
+	          6 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfvalue_value_read_from_file_stream(
+	              value,
+	              file_stream,
+	              &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfvalue_value_read_from_file_stream(
+	              NULL,
+	              file_stream,
+	              &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvalue_value_read_from_file_stream(
+	              value,
+	              NULL,
+	              &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -8445,6 +10902,10 @@ int main(
 	 "libfvalue_value_initialize",
 	 fvalue_test_value_initialize );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_initialize_with_type_descriptor",
+	 fvalue_test_value_initialize_with_type_descriptor );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_free",
 	 fvalue_test_value_free );
@@ -8509,12 +10970,24 @@ int main(
 	 "libfvalue_value_set_format_flags",
 	 fvalue_test_value_set_format_flags );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_get_instance_policy",
+	 fvalue_test_value_get_instance_policy );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_set_instance_policy",
+	 fvalue_test_value_set_instance_policy );
+
 #if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
 
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_get_value_instance_by_index",
 	 fvalue_test_value_get_value_instance_by_index );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_internal_value_get_read_instance_by_index",
+	 fvalue_test_internal_value_get_read_instance_by_index );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 	FVALUE_TEST_RUN(
@@ -8543,6 +11016,14 @@ int main(
 	 "libfvalue_value_copy_entry_data",
 	 fvalue_test_value_copy_entry_data );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_get_serialized_size",
+	 fvalue_test_value_get_serialized_size );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_flush_to_data_handle",
+	 fvalue_test_value_flush_to_data_handle );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_copy_from_boolean",
 	 fvalue_test_value_copy_from_boolean );
@@ -8583,6 +11064,10 @@ int main(
 	 "libfvalue_value_copy_to_64bit",
 	 fvalue_test_value_copy_to_64bit );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_copy_to_integer_array",
+	 fvalue_test_value_copy_to_integer_array );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_copy_from_float",
 	 fvalue_test_value_copy_from_float );
@@ -8607,6 +11092,10 @@ int main(
 	 "libfvalue_value_get_utf8_string_size",
 	 fvalue_test_value_get_utf8_string_size );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_get_utf8_string",
+	 fvalue_test_value_get_utf8_string );
+
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_copy_to_utf8_string",
 	 fvalue_test_value_copy_to_utf8_string );
@@ -8647,7 +11136,9 @@ int main(
 	 "libfvalue_value_copy_to_utf32_string_with_index",
 	 fvalue_test_value_copy_to_utf32_string_with_index );
 
-	/* TODO: add tests for libfvalue_value_read_from_file_stream */
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_read_from_file_stream",
+	 fvalue_test_value_read_from_file_stream );
 
 	/* TODO: add tests for libfvalue_value_write_to_file_stream */
 
@@ -403,6 +403,279 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_value_type_initialize_in_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_initialize_in_arena(
+     void )
+{
+	int value_types[ ] = {
+		LIBFVALUE_VALUE_TYPE_BINARY_DATA,
+		LIBFVALUE_VALUE_TYPE_BOOLEAN,
+		LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+		LIBFVALUE_VALUE_TYPE_INTEGER_64BIT,
+		LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT,
+		LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+		LIBFVALUE_VALUE_TYPE_STRING_UTF16,
+		-1 };
+
+	uint8_t utf8_string[ 6 ] = { 'f', 'v', 'a', 'l', 'u', 'e' };
+	libcerror_error_t *error = NULL;
+	libfvalue_arena_t *arena = NULL;
+	libfvalue_value_t *value = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+	int value_type_index     = 0;
+	int value_type           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	value_type = value_types[ value_type_index++ ];
+
+	while( value_type != -1 )
+	{
+		result = libfvalue_value_type_initialize_in_arena(
+		          &value,
+		          arena,
+		          value_type,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The memory of the value is released when the arena is reset
+		 */
+		value = NULL;
+
+		value_type = value_types[ value_type_index++ ];
+	}
+	/* Test a value in an arena with an identifier and an instance
+	 */
+	result = libfvalue_value_type_initialize_in_arena(
+	          &value,
+	          arena,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          (uint8_t *) "name",
+	          5,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_from_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_utf8_string_size(
+	          value,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 7 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a value in an arena can be freed before the arena is reset
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_arena_reset(
+	          arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_initialize_in_arena(
+	          NULL,
+	          arena,
+	          LIBFVALUE_VALUE_TYPE_BINARY_DATA,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_type_initialize_in_arena(
+	          &value,
+	          NULL,
+	          LIBFVALUE_VALUE_TYPE_BINARY_DATA,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_type_initialize_in_arena(
+	          &value,
+	          arena,
+	          -1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_arena_free(
+	          &arena,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfvalue_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
 
 /* Tests the libfvalue_value_type_get_string_size function
@@ -758,6 +1031,267 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvalue_value_type_get_type_by_type_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_get_type_by_type_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int type                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_type_get_type_by_type_string(
+	          (uint8_t *) "uint32",
+	          6,
+	          &type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 type,
+	 LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_get_type_by_type_string(
+	          (uint8_t *) "utf8-string\"",
+	          11,
+	          &type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 type,
+	 LIBFVALUE_VALUE_TYPE_STRING_UTF8 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_get_type_by_type_string(
+	          (uint8_t *) "uint3",
+	          5,
+	          &type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_get_type_by_type_string(
+	          NULL,
+	          6,
+	          &type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_type_get_type_by_type_string(
+	          (uint8_t *) "uint32",
+	          (size_t) SSIZE_MAX + 1,
+	          &type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_type_get_type_by_type_string(
+	          (uint8_t *) "uint32",
+	          6,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_type_get_string_copy_defaults function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_get_string_copy_defaults(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	uint32_t format_flags    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_type_get_string_copy_defaults(
+	          LIBFVALUE_VALUE_TYPE_INTEGER_16BIT,
+	          &data_size,
+	          &format_flags,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 2 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "format_flags",
+	 format_flags,
+	 (uint32_t) ( LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_SIGNED ) );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_get_string_copy_defaults(
+	          LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT,
+	          &data_size,
+	          &format_flags,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_UINT32(
+	 "format_flags",
+	 format_flags,
+	 (uint32_t) LIBFVALUE_FLOATING_POINT_FORMAT_TYPE_DECIMAL );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_get_string_copy_defaults(
+	          LIBFVALUE_VALUE_TYPE_BINARY_DATA,
+	          &data_size,
+	          &format_flags,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_get_string_copy_defaults(
+	          LIBFVALUE_VALUE_TYPE_INTEGER_16BIT,
+	          NULL,
+	          &format_flags,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_type_get_string_copy_defaults(
+	          LIBFVALUE_VALUE_TYPE_INTEGER_16BIT,
+	          &data_size,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 /* Tests the libfvalue_value_type_set_data_string function
@@ -1416,12 +1950,24 @@ int main(
 	 "libfvalue_value_type_initialize_with_data_handle",
 	 fvalue_test_value_type_initialize_with_data_handle );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_initialize_in_arena",
+	 fvalue_test_value_type_initialize_in_arena );
+
 #if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
 
 	FVALUE_TEST_RUN(
 	 "libfvalue_value_type_get_string_size",
 	 fvalue_test_value_type_get_string_size );
 
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_get_type_by_type_string",
+	 fvalue_test_value_type_get_type_by_type_string );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_get_string_copy_defaults",
+	 fvalue_test_value_type_get_string_copy_defaults );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
 
 	FVALUE_TEST_RUN(
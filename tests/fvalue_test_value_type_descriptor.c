@@ -0,0 +1,584 @@
+/*
+ * Library value type descriptor type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+#include "../libfvalue/libfvalue_value_type_descriptor.h"
+
+/* Tests the libfvalue_value_type_descriptor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_descriptor_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfvalue_value_type_descriptor_t *type_descriptor = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_type_descriptor_initialize(
+	          &type_descriptor,
+	          "test",
+	          "Test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "type_descriptor",
+	 type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_descriptor_free(
+	          &type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "type_descriptor",
+	 type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_descriptor_initialize(
+	          NULL,
+	          "test",
+	          "Test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	type_descriptor = (libfvalue_value_type_descriptor_t *) 0x12345678UL;
+
+	result = libfvalue_value_type_descriptor_initialize(
+	          &type_descriptor,
+	          "test",
+	          "Test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	type_descriptor = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_value_type_descriptor_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvalue_value_type_descriptor_initialize(
+		          &type_descriptor,
+		          "test",
+		          "Test",
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( type_descriptor != NULL )
+			{
+				libfvalue_value_type_descriptor_free(
+				 &type_descriptor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "type_descriptor",
+			 type_descriptor );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_value_type_descriptor_initialize with memset failing
+		 */
+		fvalue_test_memset_attempts_before_fail = test_number;
+
+		result = libfvalue_value_type_descriptor_initialize(
+		          &type_descriptor,
+		          "test",
+		          "Test",
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &error );
+
+		if( fvalue_test_memset_attempts_before_fail != -1 )
+		{
+			fvalue_test_memset_attempts_before_fail = -1;
+
+			if( type_descriptor != NULL )
+			{
+				libfvalue_value_type_descriptor_free(
+				 &type_descriptor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "type_descriptor",
+			 type_descriptor );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &type_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_value_type_descriptor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_descriptor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_descriptor_free(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+/* Tests the libfvalue_value_type_descriptor_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_value_type_descriptor_clone(
+     void )
+{
+	libcerror_error_t *error                                        = NULL;
+	libfvalue_internal_value_type_descriptor_t *internal_descriptor = NULL;
+	libfvalue_value_type_descriptor_t *destination_type_descriptor  = NULL;
+	libfvalue_value_type_descriptor_t *source_type_descriptor       = NULL;
+	int result                                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_value_type_descriptor_initialize(
+	          &source_type_descriptor,
+	          "test",
+	          "Test",
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_type_descriptor",
+	 source_type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_value_type_descriptor_clone(
+	          &destination_type_descriptor,
+	          source_type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_type_descriptor",
+	 destination_type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_descriptor = (libfvalue_internal_value_type_descriptor_t *) destination_type_descriptor;
+
+	FVALUE_TEST_ASSERT_EQUAL_SSIZE(
+	 "internal_descriptor->type_string",
+	 (ssize_t) ( internal_descriptor->type_string - ( (libfvalue_internal_value_type_descriptor_t *) source_type_descriptor )->type_string ),
+	 (ssize_t) 0 );
+
+	result = libfvalue_value_type_descriptor_free(
+	          &destination_type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_descriptor_clone(
+	          &destination_type_descriptor,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "destination_type_descriptor",
+	 destination_type_descriptor );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_value_type_descriptor_clone(
+	          NULL,
+	          source_type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_type_descriptor_free(
+	          &source_type_descriptor,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &destination_type_descriptor,
+		 NULL );
+	}
+	if( source_type_descriptor != NULL )
+	{
+		libfvalue_value_type_descriptor_free(
+		 &source_type_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_descriptor_initialize",
+	 fvalue_test_value_type_descriptor_initialize );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_descriptor_free",
+	 fvalue_test_value_type_descriptor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_value_type_descriptor_clone",
+	 fvalue_test_value_type_descriptor_clone );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVALUE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
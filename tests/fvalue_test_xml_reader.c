@@ -0,0 +1,1742 @@
+/*
+ * Library XML reader functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+const uint8_t *fvalue_test_xml_reader_input = NULL;
+size_t fvalue_test_xml_reader_input_size    = 0;
+size_t fvalue_test_xml_reader_input_offset  = 0;
+
+/* Sets the input of the test read function
+ */
+void fvalue_test_xml_reader_set_input(
+      const char *input )
+{
+	fvalue_test_xml_reader_input        = (const uint8_t *) input;
+	fvalue_test_xml_reader_input_size   = narrow_string_length(
+	                                       input );
+	fvalue_test_xml_reader_input_offset = 0;
+}
+
+/* Test read function that reads from the input
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fvalue_test_xml_reader_read(
+         intptr_t *io_handle FVALUE_TEST_ATTRIBUTE_UNUSED,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error FVALUE_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t read_size = 0;
+
+	FVALUE_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( error )
+
+	read_size = fvalue_test_xml_reader_input_size - fvalue_test_xml_reader_input_offset;
+
+	if( read_size > data_size )
+	{
+		read_size = data_size;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     data,
+		     &( fvalue_test_xml_reader_input[ fvalue_test_xml_reader_input_offset ] ),
+		     read_size ) == NULL )
+		{
+			return( -1 );
+		}
+		fvalue_test_xml_reader_input_offset += read_size;
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Test read function that fails
+ * Returns -1
+ */
+ssize_t fvalue_test_xml_reader_read_failing(
+         intptr_t *io_handle FVALUE_TEST_ATTRIBUTE_UNUSED,
+         uint8_t *data FVALUE_TEST_ATTRIBUTE_UNUSED,
+         size_t data_size FVALUE_TEST_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error FVALUE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( data )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( data_size )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* Reads a value from the input using a XML reader with a small buffer
+ * Returns 1 if successful, 0 if no value was found or -1 on error
+ */
+int fvalue_test_xml_reader_read_input_value(
+     const char *input,
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	libfvalue_xml_reader_t *xml_reader = NULL;
+	int result                         = 0;
+
+	fvalue_test_xml_reader_set_input(
+	 input );
+
+	if( libfvalue_xml_reader_initialize(
+	     &xml_reader,
+	     NULL,
+	     &fvalue_test_xml_reader_read,
+	     5,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          value,
+	          error );
+
+	if( libfvalue_xml_reader_free(
+	     &xml_reader,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Tests the libfvalue_xml_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_reader_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvalue_xml_reader_t *xml_reader = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_reader",
+	 xml_reader );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "xml_reader",
+	 xml_reader );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_reader_initialize(
+	          NULL,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	xml_reader = (libfvalue_xml_reader_t *) 0x12345678UL;
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          0,
+	          &error );
+
+	xml_reader = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "xml_reader",
+	 xml_reader );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "xml_reader",
+	 xml_reader );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_xml_reader_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvalue_xml_reader_initialize(
+		          &xml_reader,
+		          NULL,
+		          &fvalue_test_xml_reader_read,
+		          0,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( xml_reader != NULL )
+			{
+				libfvalue_xml_reader_free(
+				 &xml_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "xml_reader",
+			 xml_reader );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_xml_reader_initialize with memset failing
+		 */
+		fvalue_test_memset_attempts_before_fail = test_number;
+
+		result = libfvalue_xml_reader_initialize(
+		          &xml_reader,
+		          NULL,
+		          &fvalue_test_xml_reader_read,
+		          0,
+		          &error );
+
+		if( fvalue_test_memset_attempts_before_fail != -1 )
+		{
+			fvalue_test_memset_attempts_before_fail = -1;
+
+			if( xml_reader != NULL )
+			{
+				libfvalue_xml_reader_free(
+				 &xml_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "xml_reader",
+			 xml_reader );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_reader != NULL )
+	{
+		libfvalue_xml_reader_free(
+		 &xml_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_reader_free(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_reader_read_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_reader_read_value(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	const char *input                  = "<?xml version=\"1.0\"?><!-- <text>comment</text> -->\n"
+	                                     "<text type=\"utf8-string\">\n"
+	                                     "  <value_entry>a&lt;b&amp;&quot;c&gt;</value_entry>\n"
+	                                     "  <value_entry>&#x41;&#66;&unknown;</value_entry>\n"
+	                                     "</text>";
+	libcerror_error_t *error           = NULL;
+	libfvalue_value_t *value           = NULL;
+	libfvalue_xml_reader_t *xml_reader = NULL;
+	uint8_t *identifier                = NULL;
+	size_t identifier_size             = 0;
+	size_t offset                      = 0;
+	int number_of_value_entries        = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	fvalue_test_xml_reader_set_input(
+	 input );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          5,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_get_offset(
+	          xml_reader,
+	          &offset,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 fvalue_test_xml_reader_input_size );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The identifier is set to the element name
+	 */
+	result = libfvalue_value_get_identifier(
+	          value,
+	          &identifier,
+	          &identifier_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "identifier_size",
+	 identifier_size,
+	 (size_t) 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          identifier,
+	          "text",
+	          5 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 2 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "a<b&\"c>",
+	          8 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An unsupported reference is left as-is
+	 */
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "AB&unknown;",
+	          12 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with the end of the input reached
+	 */
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an element without value entries, the existing value entries are replaced
+	 */
+	result = fvalue_test_xml_reader_read_input_value(
+	          "<text>single</text>",
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_reader_read_value(
+	          NULL,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an element name that does not match the identifier
+	 */
+	result = fvalue_test_xml_reader_read_input_value(
+	          "<other>value</other>",
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated element
+	 */
+	result = fvalue_test_xml_reader_read_input_value(
+	          "<text>value</te",
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a mismatching close tag
+	 */
+	result = fvalue_test_xml_reader_read_input_value(
+	          "<text><value_entry>value</text>",
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with read function failing
+	 */
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read_failing,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_read_value(
+	          xml_reader,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( xml_reader != NULL )
+	{
+		libfvalue_xml_reader_free(
+		 &xml_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates a XML string of a values table with a value that contains a number
+ * of value entries, where the value of every value entry is its index times 7
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_test_xml_reader_create_value_entries_input(
+     char **input,
+     int number_of_value_entries )
+{
+	char *safe_input       = NULL;
+	size_t safe_input_size = 0;
+	size_t string_index    = 0;
+	int print_count        = 0;
+	int value_entry_index  = 0;
+
+	if( ( input == NULL )
+	 || ( number_of_value_entries < 0 )
+	 || ( (size_t) number_of_value_entries > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 64 ) / 40 ) ) )
+	{
+		return( -1 );
+	}
+	/* Every value entry requires at most 40 characters
+	 */
+	safe_input_size = ( (size_t) number_of_value_entries * 40 ) + 64;
+
+	safe_input = (char *) memory_allocate(
+	                       sizeof( char ) * safe_input_size );
+
+	if( safe_input == NULL )
+	{
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               safe_input,
+	               safe_input_size,
+	               "<values><entries type=\"uint32\">" );
+
+	if( print_count < 0 )
+	{
+		goto on_error;
+	}
+	string_index = (size_t) print_count;
+
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               &( safe_input[ string_index ] ),
+		               safe_input_size - string_index,
+		               "<value_entry>%d</value_entry>",
+		               value_entry_index * 7 );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( safe_input_size - string_index ) ) )
+		{
+			goto on_error;
+		}
+		string_index += (size_t) print_count;
+	}
+	print_count = narrow_string_snprintf(
+	               &( safe_input[ string_index ] ),
+	               safe_input_size - string_index,
+	               "</entries></values>" );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( safe_input_size - string_index ) ) )
+	{
+		goto on_error;
+	}
+	*input = safe_input;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 safe_input );
+
+	return( -1 );
+}
+
+/* Tests the libfvalue_xml_reader_read_table function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_reader_read_table(
+     void )
+{
+	uint32_t expected_list_values[ 3 ] = { 42, 263, 7 };
+	uint8_t utf8_string[ 16 ];
+
+	const char *input                  = "<?xml version=\"1.0\"?>\n"
+	                                     "<header><first>skipped</first></header>\n"
+	                                     "<values>\n"
+	                                     "  <first type=\"utf8-string\">one</first>\n"
+	                                     "  <second type=\"utf8-string\"><value_entry>two</value_entry></second>\n"
+	                                     "  <third/>\n"
+	                                     "  <list type=\"uint32\"><value_entry>42</value_entry><value_entry>263</value_entry><value_entry>7</value_entry></list>\n"
+	                                     "  <empty type=\"utf8-string\"></empty>\n"
+	                                     "</values>\n";
+	libcerror_error_t *error           = NULL;
+	libfvalue_table_t *table           = NULL;
+	libfvalue_value_t *value           = NULL;
+	libfvalue_xml_reader_t *xml_reader = NULL;
+	char *entries_input                = NULL;
+	uint64_t number_of_allocations     = 0;
+	uint32_t value_32bit               = 0;
+	int number_of_value_entries        = 0;
+	int number_of_values               = 0;
+	int result                         = 0;
+	int statistics_result              = 0;
+	int value_entry_index              = 0;
+	int value_type                     = 0;
+
+	/* Initialize test
+	 */
+	fvalue_test_xml_reader_set_input(
+	 input );
+
+	result = libfvalue_table_initialize(
+	          &table,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table contains a value with the identifier "first" that is to be replaced
+	 */
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          (uint8_t *) "first",
+	          6,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_append_entry_data(
+	          value,
+	          &value_entry_index,
+	          (uint8_t *) "old",
+	          4,
+	          LIBFVALUE_CODEPAGE_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_set_value(
+	          table,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          7,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_number_of_values(
+	          table,
+	          &number_of_values,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 5 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "first",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "one",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "second",
+	          7,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "two",
+	          4 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A value that does not exist is added with the value type of its type attribute
+	 */
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "list",
+	          5,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_type(
+	          value,
+	          &value_type,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 3 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_entry_index = 0;
+	     value_entry_index < 3;
+	     value_entry_index++ )
+	{
+		result = libfvalue_value_copy_to_32bit(
+		          value,
+		          value_entry_index,
+		          &value_32bit,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 expected_list_values[ value_entry_index ] );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* An empty string value contains a single empty value entry
+	 */
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "empty",
+	          6,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	/* Test with the end of the input reached
+	 */
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value with a large number of value entries, the value instances
+	 * are only flushed when the data is resized hence the number of
+	 * allocations does not grow with the number of value entries
+	 */
+	result = fvalue_test_xml_reader_create_value_entries_input(
+	          &entries_input,
+	          50000 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fvalue_test_xml_reader_set_input(
+	 entries_input );
+
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics_result = libfvalue_statistics_reset(
+	                     &error );
+
+	FVALUE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "statistics_result",
+	 statistics_result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fvalue_test_xml_reader_set_input(
+	 "" );
+
+	memory_free(
+	 entries_input );
+
+	entries_input = NULL;
+
+	/* The statistics are only available if the library was built with --enable-statistics
+	 */
+	if( statistics_result == 1 )
+	{
+		result = libfvalue_statistics_get(
+		          LIBFVALUE_STATISTICS_COUNTER_TYPE_NUMBER_OF_ALLOCATIONS,
+		          LIBFVALUE_STATISTICS_SUBSYSTEM_VALUE,
+		          &number_of_allocations,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_LESS_THAN_UINT64(
+		 "number_of_allocations",
+		 number_of_allocations,
+		 (uint64_t) 64 );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvalue_table_get_value_by_identifier(
+	          table,
+	          (uint8_t *) "entries",
+	          8,
+	          &value,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_get_number_of_value_entries(
+	          value,
+	          &number_of_value_entries,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_value_entries",
+	 number_of_value_entries,
+	 50000 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_entry_index = 0;
+	     value_entry_index < 50000;
+	     value_entry_index++ )
+	{
+		result = libfvalue_value_copy_to_32bit(
+		          value,
+		          value_entry_index,
+		          &value_32bit,
+		          &error );
+
+		FVALUE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVALUE_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 (uint32_t) ( value_entry_index * 7 ) );
+
+		FVALUE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	value = NULL;
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_reader_read_table(
+	          NULL,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          NULL,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          NULL,
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          (uint8_t *) "values",
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a table that is not closed
+	 */
+	fvalue_test_xml_reader_set_input(
+	 "<values><first>one</first>" );
+
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_initialize(
+	          &xml_reader,
+	          NULL,
+	          &fvalue_test_xml_reader_read,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_reader_read_table(
+	          xml_reader,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_xml_reader_free(
+	          &xml_reader,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_reader != NULL )
+	{
+		libfvalue_xml_reader_free(
+		 &xml_reader,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	if( entries_input != NULL )
+	{
+		fvalue_test_xml_reader_set_input(
+		 "" );
+
+		memory_free(
+		 entries_input );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_reader_initialize",
+	 fvalue_test_xml_reader_initialize );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_reader_free",
+	 fvalue_test_xml_reader_free );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_reader_read_value",
+	 fvalue_test_xml_reader_read_value );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_reader_read_table",
+	 fvalue_test_xml_reader_read_table );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
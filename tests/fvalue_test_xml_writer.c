@@ -0,0 +1,1209 @@
+/*
+ * Library XML writer functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvalue_test_libcerror.h"
+#include "fvalue_test_libfvalue.h"
+#include "fvalue_test_macros.h"
+#include "fvalue_test_memory.h"
+#include "fvalue_test_unused.h"
+
+#define FVALUE_TEST_XML_WRITER_OUTPUT_SIZE	256
+
+uint8_t fvalue_test_xml_writer_output[ FVALUE_TEST_XML_WRITER_OUTPUT_SIZE ];
+size_t fvalue_test_xml_writer_output_size = 0;
+int fvalue_test_xml_writer_number_of_writes = 0;
+
+/* Test write function that collects the data in the output buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t fvalue_test_xml_writer_write(
+         intptr_t *io_handle FVALUE_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error FVALUE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( data_size > ( FVALUE_TEST_XML_WRITER_OUTPUT_SIZE - fvalue_test_xml_writer_output_size ) )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( fvalue_test_xml_writer_output[ fvalue_test_xml_writer_output_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	fvalue_test_xml_writer_output_size      += data_size;
+	fvalue_test_xml_writer_number_of_writes += 1;
+
+	return( (ssize_t) data_size );
+}
+
+/* Test write function that fails
+ * Returns -1
+ */
+ssize_t fvalue_test_xml_writer_write_failing(
+         intptr_t *io_handle FVALUE_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *data FVALUE_TEST_ATTRIBUTE_UNUSED,
+         size_t data_size FVALUE_TEST_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error FVALUE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( data )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( data_size )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* Creates a 32-bit unsigned integer value with 2 value entries
+ * Returns 1 if successful or -1 on error
+ */
+int fvalue_test_xml_writer_create_value(
+     libfvalue_value_t **value,
+     const char *identifier,
+     libcerror_error_t **error )
+{
+	int value_entry_index = 0;
+
+	if( libfvalue_value_type_initialize(
+	     value,
+	     LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfvalue_value_set_identifier(
+	     *value,
+	     (uint8_t *) identifier,
+	     narrow_string_length(
+	      identifier ) + 1,
+	     LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfvalue_value_set_format_flags(
+	     *value,
+	     LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL_UNSIGNED,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfvalue_value_append_entry_data(
+	     *value,
+	     &value_entry_index,
+	     (uint8_t *) "\x01\x02\x03\x04",
+	     4,
+	     LIBFVALUE_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfvalue_value_append_entry_data(
+	     *value,
+	     &value_entry_index,
+	     (uint8_t *) "\x05\x06\x07\x08",
+	     4,
+	     LIBFVALUE_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfvalue_xml_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_writer_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvalue_xml_writer_t *xml_writer = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_writer",
+	 xml_writer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_free(
+	          &xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "xml_writer",
+	 xml_writer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_writer_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	xml_writer = (libfvalue_xml_writer_t *) 0x12345678UL;
+
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	xml_writer = NULL;
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          NULL,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "xml_writer",
+	 xml_writer );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVALUE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_xml_writer_initialize with malloc failing
+		 */
+		fvalue_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvalue_xml_writer_initialize(
+		          &xml_writer,
+		          NULL,
+		          NULL,
+		          0,
+		          &error );
+
+		if( fvalue_test_malloc_attempts_before_fail != -1 )
+		{
+			fvalue_test_malloc_attempts_before_fail = -1;
+
+			if( xml_writer != NULL )
+			{
+				libfvalue_xml_writer_free(
+				 &xml_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "xml_writer",
+			 xml_writer );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvalue_xml_writer_initialize with memset failing
+		 */
+		fvalue_test_memset_attempts_before_fail = test_number;
+
+		result = libfvalue_xml_writer_initialize(
+		          &xml_writer,
+		          NULL,
+		          NULL,
+		          0,
+		          &error );
+
+		if( fvalue_test_memset_attempts_before_fail != -1 )
+		{
+			fvalue_test_memset_attempts_before_fail = -1;
+
+			if( xml_writer != NULL )
+			{
+				libfvalue_xml_writer_free(
+				 &xml_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVALUE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVALUE_TEST_ASSERT_IS_NULL(
+			 "xml_writer",
+			 xml_writer );
+
+			FVALUE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVALUE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_writer != NULL )
+	{
+		libfvalue_xml_writer_free(
+		 &xml_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_writer_free(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_writer_write_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_writer_write_value(
+     void )
+{
+	const char *expected_data          = "<number type=\"uint32\"><value_entry>67305985</value_entry><value_entry>134678021</value_entry></number>"
+	                                     "<text type=\"utf8-string\">a&lt;b&amp;&quot;c&gt;</text>";
+	libcerror_error_t *error           = NULL;
+	libfvalue_value_t *value           = NULL;
+	libfvalue_xml_writer_t *xml_writer = NULL;
+	const uint8_t *data                = NULL;
+	size_t data_size                   = 0;
+	size_t number_of_bytes_written     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          NULL,
+	          16,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_writer",
+	 xml_writer );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fvalue_test_xml_writer_create_value(
+	          &value,
+	          "number",
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_write_value(
+	          xml_writer,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_type_initialize(
+	          &value,
+	          LIBFVALUE_VALUE_TYPE_STRING_UTF8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_identifier(
+	          value,
+	          (uint8_t *) "text",
+	          5,
+	          LIBFVALUE_VALUE_IDENTIFIER_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_set_data(
+	          value,
+	          (uint8_t *) "a<b&\"c>",
+	          8,
+	          LIBFVALUE_CODEPAGE_UTF8,
+	          LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_write_value(
+	          xml_writer,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_get_data(
+	          xml_writer,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 narrow_string_length( expected_data ) );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          data_size );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvalue_xml_writer_get_number_of_bytes_written(
+	          xml_writer,
+	          &number_of_bytes_written,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_bytes_written",
+	 number_of_bytes_written,
+	 data_size );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_writer_write_value(
+	          NULL,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_writer_write_value(
+	          xml_writer,
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvalue_test_xml_writer_create_value(
+	          &value,
+	          "a b",
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_write_value(
+	          xml_writer,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_free(
+	          &xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( xml_writer != NULL )
+	{
+		libfvalue_xml_writer_free(
+		 &xml_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_writer_write_table function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_writer_write_table(
+     void )
+{
+	const char *expected_data          = "<values><number type=\"uint32\"><value_entry>67305985</value_entry><value_entry>134678021</value_entry></number></values>";
+	libcerror_error_t *error           = NULL;
+	libfvalue_table_t *table           = NULL;
+	libfvalue_value_t *value           = NULL;
+	libfvalue_xml_writer_t *xml_writer = NULL;
+	size_t expected_data_size          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	fvalue_test_xml_writer_output_size      = 0;
+	fvalue_test_xml_writer_number_of_writes = 0;
+
+	expected_data_size = narrow_string_length(
+	                      expected_data );
+
+	result = libfvalue_table_initialize(
+	          &table,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvalue_test_xml_writer_create_value(
+	          &value,
+	          "number",
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_set_value(
+	          table,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          &fvalue_test_xml_writer_write,
+	          8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_writer_write_table(
+	          xml_writer,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_flush(
+	          xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVALUE_TEST_ASSERT_EQUAL_SIZE(
+	 "fvalue_test_xml_writer_output_size",
+	 fvalue_test_xml_writer_output_size,
+	 expected_data_size );
+
+	/* The buffer of 8 bytes is passed to the write function once it is full
+	 */
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "fvalue_test_xml_writer_number_of_writes",
+	 fvalue_test_xml_writer_number_of_writes,
+	 (int) ( ( expected_data_size + 7 ) / 8 ) );
+
+	result = memory_compare(
+	          fvalue_test_xml_writer_output,
+	          expected_data,
+	          expected_data_size );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_writer_write_table(
+	          NULL,
+	          table,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_writer_write_table(
+	          xml_writer,
+	          NULL,
+	          (uint8_t *) "values",
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_writer_write_table(
+	          xml_writer,
+	          table,
+	          NULL,
+	          6,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvalue_xml_writer_write_table(
+	          xml_writer,
+	          table,
+	          (uint8_t *) "<values>",
+	          8,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_xml_writer_free(
+	          &xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_table_free(
+	          &table,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_writer != NULL )
+	{
+		libfvalue_xml_writer_free(
+		 &xml_writer,
+		 NULL );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libfvalue_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvalue_xml_writer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int fvalue_test_xml_writer_flush(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvalue_value_t *value           = NULL;
+	libfvalue_xml_writer_t *xml_writer = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fvalue_test_xml_writer_create_value(
+	          &value,
+	          "number",
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_initialize(
+	          &xml_writer,
+	          NULL,
+	          &fvalue_test_xml_writer_write_failing,
+	          0,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvalue_xml_writer_flush(
+	          xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_xml_writer_write_value(
+	          xml_writer,
+	          value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvalue_xml_writer_flush(
+	          NULL,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test flush with the write function failing
+	 */
+	result = libfvalue_xml_writer_flush(
+	          xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVALUE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_xml_writer_free(
+	          &xml_writer,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	FVALUE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVALUE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_writer != NULL )
+	{
+		libfvalue_xml_writer_free(
+		 &xml_writer,
+		 NULL );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVALUE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVALUE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVALUE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_writer_initialize",
+	 fvalue_test_xml_writer_initialize );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_writer_free",
+	 fvalue_test_xml_writer_free );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_writer_flush",
+	 fvalue_test_xml_writer_flush );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_writer_write_value",
+	 fvalue_test_xml_writer_write_value );
+
+	FVALUE_TEST_RUN(
+	 "libfvalue_xml_writer_write_table",
+	 fvalue_test_xml_writer_write_table );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
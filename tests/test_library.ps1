@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "binary_data data_handle error filetime floating_point integer split_utf8_string split_utf16_string string support table utf8_string utf16_string value value_entry value_type"
+$LibraryTests = "arena ascii base16 base32 base64 binary_data data_handle error filetime floating_point identifier_index integer simd split_utf8_string split_utf16_string statistics string support table utf8_string utf16_string value value_entry value_type value_type_descriptor xml_reader xml_writer"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 